@@ -37,7 +37,7 @@ namespace gui
         if (inputEvent.isShortRelease()) {
             // Call function
             if (inputEvent.is(KeyCode::KEY_LF)) {
-                interface->handleEmergencyCallEvent(enteredNumber);
+                interface->handleEmergencyCallEvent(getEnteredNumber());
                 return true;
             }
             else if (inputEvent.is(gui::KeyCode::KEY_ENTER)) {
@@ -50,7 +50,7 @@ namespace gui
 
     bool EnterNumberWindow::addNewContact()
     {
-        interface->handleAddContactEvent(enteredNumber);
+        interface->handleAddContactEvent(getEnteredNumber());
         return true;
     }
 
@@ -66,7 +66,7 @@ namespace gui
             assert(callData != nullptr);
 
             initFormatterInput(callData->getPhoneNumber());
-            setNumberLabel(formattedNumber);
+            setNumberLabel(getFormattedNumber());
             application->refreshWindow(RefreshModes::GUI_REFRESH_FAST);
         }
         else if (data->getDescription() == app::CallSwitchData::descriptionStr) {
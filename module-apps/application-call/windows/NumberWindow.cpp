@@ -19,12 +19,10 @@ namespace gui
     NumberWindow::NumberWindow(app::ApplicationCommon *app,
                                app::EnterNumberWindowInterface *interface,
                                std::string windowName)
-        : AppWindow(app, std::move(windowName)), interface(interface), currentCountry(defaultCountry),
-          numberUtil(*PhoneNumberUtil::GetInstance())
+        : AppWindow(app, std::move(windowName)), interface(interface)
     {
         assert(interface != nullptr);
         assert(app != nullptr);
-        switchFormatter(utils::country::getAlpha2Code(currentCountry));
     }
 
     void NumberWindow::setNumberLabel(const std::string &num)
@@ -81,29 +79,27 @@ namespace gui
         if (inputEvent.isShortRelease()) {
             // Call function
             if (inputEvent.is(KeyCode::KEY_LF)) {
-                if (enteredNumber.empty()) {
+                if (getEnteredNumber().empty()) {
                     return false;
                 }
-                interface->handleCallEvent(enteredNumber);
+                interface->handleCallEvent(getEnteredNumber());
                 return true;
             }
 
             // Clear/back function
             if (inputEvent.is(KeyCode::KEY_RF)) {
                 // if there isn't any char in phone number field return to previous application
-                if (enteredNumber.empty()) {
-                    formatter->Clear();
+                if (getEnteredNumber().empty()) {
+                    formatter.clear();
                     app::manager::Controller::switchBack(application);
                 }
                 // if there is the last char just clear input
-                else if (enteredNumber.size() == 1) {
+                else if (getEnteredNumber().size() == 1) {
                     clearInput();
                 }
                 else {
-                    // remove last digit and reformat entered number otherwise
-                    enteredNumber = enteredNumber.substr(0, enteredNumber.size() - 1);
-                    initFormatterInput(enteredNumber);
-                    setNumberLabel(formattedNumber);
+                    // remove last digit, the formatting of the shorter number is remembered
+                    setNumberLabel(formatter.removeLastDigit());
 
                     application->refreshWindow(RefreshModes::GUI_REFRESH_FAST);
                 }
@@ -118,7 +114,7 @@ namespace gui
             // erase all characters from phone number
             if (inputEvent.is(KeyCode::KEY_RF)) {
                 // if there isn't any char in phone number field return to previous application
-                if (enteredNumber.empty()) {
+                if (getEnteredNumber().empty()) {
                     app::manager::Controller::switchBack(application);
                     return true;
                 }
@@ -142,40 +138,30 @@ namespace gui
         return AppWindow::onInput(inputEvent);
     }
 
-    void NumberWindow::switchFormatter(const std::string &regionCode)
+    void NumberWindow::initFormatterInput(const std::string &number)
     {
-        auto newFormatter = std::unique_ptr<Formatter>(numberUtil.GetAsYouTypeFormatter(regionCode));
-        formatter.swap(newFormatter);
-        LOG_INFO("Switched formatter to new region");
+        formatter.setNumber(number);
     }
 
-    void NumberWindow::initFormatterInput(const std::string &number)
+    auto NumberWindow::getFormattedNumber() const noexcept -> const std::string &
     {
-        enteredNumber = number;
-        formatter->Clear();
-        for (auto c : number) {
-            formatter->InputDigit(c, &formattedNumber);
-        }
+        return formatter.getFormatted();
     }
 
     void NumberWindow::addDigit(const std::string::value_type &digit)
     {
-        enteredNumber += digit;
-        formatter->InputDigit(digit, &formattedNumber);
-        setNumberLabel(formattedNumber);
+        setNumberLabel(formatter.inputDigit(digit));
         application->refreshWindow(RefreshModes::GUI_REFRESH_FAST);
     }
 
     const std::string &NumberWindow::getEnteredNumber() const noexcept
     {
-        return enteredNumber;
+        return formatter.getEntered();
     }
 
     void NumberWindow::clearInput()
     {
-        enteredNumber.clear();
-        formattedNumber.clear();
-        formatter->Clear();
+        formatter.clear();
         setNumberLabel("");
         application->refreshWindow(RefreshModes::GUI_REFRESH_FAST);
     }
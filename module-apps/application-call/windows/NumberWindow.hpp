@@ -10,10 +10,8 @@
 #include <ContactRecord.hpp>
 #include <country.hpp>
 #include <gui/input/Translator.hpp>
-#include <phonenumbers/asyoutypeformatter.h>
-#include <phonenumbers/phonenumberutil.h>
+#include <PhoneNumberFormatter.hpp>
 
-#include <memory>
 #include <string>
 
 namespace gui
@@ -30,6 +28,7 @@ namespace gui
 
         auto onInput(const InputEvent &inputEvent) -> bool override;
         [[nodiscard]] auto getEnteredNumber() const noexcept -> const std::string &;
+        [[nodiscard]] auto getFormattedNumber() const noexcept -> const std::string &;
 
         void buildInterface() override;
         void destroyInterface() override;
@@ -39,23 +38,14 @@ namespace gui
         app::EnterNumberWindowInterface *interface = nullptr;
         gui::Label *numberLabel                    = nullptr;
         gui::Label *numberDescriptionLabel         = nullptr;
-        std::string formattedNumber;
-        std::string enteredNumber;
 
         void setNumberLabel(const std::string &num);
 
-        void switchFormatter(const std::string &countryCode);
         void addDigit(const std::string::value_type &digit);
         void clearInput();
 
       private:
-        using PhoneNumberUtil = i18n::phonenumbers::PhoneNumberUtil;
-        using Formatter       = i18n::phonenumbers::AsYouTypeFormatter;
-
-        CountryCode defaultCountry = utils::country::defaultCountry;
-        CountryCode currentCountry;
         gui::KeyInputMappedTranslation translator;
-        PhoneNumberUtil &numberUtil;
-        std::unique_ptr<Formatter> formatter;
+        utils::PhoneNumberFormatter formatter{utils::country::defaultCountry};
     };
 } /* namespace gui */
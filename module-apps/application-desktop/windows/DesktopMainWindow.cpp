@@ -84,7 +84,7 @@ namespace gui
     {
         buildInterface();
 
-        preBuildDrawListHook = [this](std::list<Command> &cmd) { updateTime(); };
+        preBuildDrawListHook = [this](std::vector<Command> &cmd) { updateTime(); };
     }
 
     void DesktopMainWindow::setVisibleState()
@@ -129,9 +129,12 @@ namespace app
         windowsFactory.attach(gui::name::window::main_window, [](ApplicationCommon *app, const std::string &name) {
             return std::make_unique<gui::MessagesMainWindow>(app);
         });
-        windowsFactory.attach(gui::name::window::thread_view, [](ApplicationCommon *app, const std::string &name) {
-            return std::make_unique<gui::SMSThreadViewWindow>(app);
-        });
+        windowsFactory.attach(
+            gui::name::window::thread_view,
+            [](ApplicationCommon *app, const std::string &name) {
+                return std::make_unique<gui::SMSThreadViewWindow>(app);
+            },
+            WindowsFactory::Retention::Keep);
         windowsFactory.attach(gui::name::window::new_sms, [](ApplicationCommon *app, const std::string &name) {
             return std::make_unique<gui::NewMessageWindow>(app);
         });
@@ -85,8 +85,8 @@ auto SMSThreadModel::handleQueryResponse(db::QueryResult *queryResult) -> bool
 
     resetInputWidget();
 
-    if (msgResponse->getDraft().isValid() && smsInput->inputText->isEmpty()) {
-        smsInput->draft = msgResponse->getDraft().type == SMSType::DRAFT
+    if (smsInput->inputText->isEmpty()) {
+        smsInput->draft = msgResponse->getDraft().isValid() && msgResponse->getDraft().type == SMSType::DRAFT
                               ? std::optional<SMSRecord>{msgResponse->getDraft()}
                               : std::nullopt;
         smsInput->displayDraftMessage();
@@ -128,6 +128,14 @@ void SMSThreadModel::resetInputWidget()
     smsInput->clearNavigationItem(gui::NavigationDirection::DOWN);
 }
 
+void SMSThreadModel::clearInput()
+{
+    smsInput->draft  = std::nullopt;
+    smsInput->number = nullptr;
+    smsInput->inputText->clear();
+    number = nullptr;
+}
+
 void SMSThreadModel::markCurrentThreadAsRead()
 {
     const auto [code, msg] = DBServiceAPI::GetQueryWithReply(application,
@@ -26,6 +26,8 @@ class SMSThreadModel : public app::DatabaseModel<SMSRecord>,
     void addReturnNumber();
     void handleDraftMessage();
     void resetInputWidget();
+    /// Drops the text, the draft and the number of the input, e.g. when another thread is shown
+    void clearInput();
     void markCurrentThreadAsRead();
 
     auto handleQueryResponse(db::QueryResult *) -> bool;
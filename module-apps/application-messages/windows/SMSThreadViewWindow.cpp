@@ -20,6 +20,17 @@ namespace gui
     SMSThreadViewWindow::SMSThreadViewWindow(app::ApplicationCommon *app)
         : AppWindow(app, name::window::thread_view), app::AsyncCallbackReceiver{app},
           smsModel{std::make_shared<SMSThreadModel>(app)}
+    {}
+
+    void SMSThreadViewWindow::rebuild()
+    {
+        if (smsList == nullptr) {
+            return;
+        }
+        smsList->rebuildList();
+    }
+
+    void SMSThreadViewWindow::buildInterface()
     {
         AppWindow::buildInterface();
         setTitle(utils::translate("app_messages_title_main"));
@@ -65,17 +76,16 @@ namespace gui
         setFocusItem(smsList);
     }
 
-    void SMSThreadViewWindow::rebuild()
-    {
-        smsList->rebuildList();
-    }
-
-    void SMSThreadViewWindow::buildInterface()
-    {}
-
     void SMSThreadViewWindow::destroyInterface()
     {
         erase();
+        smsList          = nullptr;
+        oldMessagesHBox  = nullptr;
+        oldMessagesText  = nullptr;
+        oldMessagesArrow = nullptr;
+        statusBar        = nullptr;
+        header           = nullptr;
+        navBar           = nullptr;
     }
 
     SMSThreadViewWindow::~SMSThreadViewWindow()
@@ -85,6 +95,11 @@ namespace gui
 
     void SMSThreadViewWindow::onBeforeShow(ShowMode mode, SwitchData *data)
     {
+        // The window is built when it's shown for the first time, not when the windows are rebuilt in the background
+        if (smsList == nullptr) {
+            buildInterface();
+        }
+
         if (mode == ShowMode::GUI_SHOW_RETURN) {
             smsModel->markCurrentThreadAsRead();
             smsList->rebuildList();
@@ -94,6 +109,12 @@ namespace gui
             LOG_DEBUG("Thread data received: %" PRIu32, pdata->thread->ID);
             saveInfoAboutPreviousAppForProperSwitchBack(data);
 
+            // The window is kept between the threads, so nothing of the previous one may be shown or sent
+            if (pdata->thread->ID != smsModel->smsThreadID) {
+                smsModel->clearInput();
+                setTitle(utils::translate("app_messages_title_main"));
+            }
+
             smsModel->numberID    = pdata->thread->numberID;
             smsModel->smsThreadID = pdata->thread->ID;
             requestContact(smsModel->numberID);
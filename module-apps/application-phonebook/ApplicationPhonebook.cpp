@@ -1,4 +1,4 @@
-﻿// Copyright (c) 2017-2022, Mudita Sp. z.o.o. All rights reserved.
+﻿// Copyright (c) 2017-2023, Mudita Sp. z.o.o. All rights reserved.
 // For licensing, see https://github.com/mudita/MuditaOS/LICENSE.md
 
 #include <application-phonebook/ApplicationPhonebook.hpp>
@@ -173,6 +173,11 @@ namespace app
     void ApplicationPhonebook::destroyUserInterface()
     {}
 
+    void ApplicationPhonebook::flushModels()
+    {
+        phonebookModel->flush();
+    }
+
     void ApplicationPhonebook::onSearchRequest(const std::string &searchFilter)
     {
         auto model = std::make_shared<PhonebookModel>(*phonebookModel);
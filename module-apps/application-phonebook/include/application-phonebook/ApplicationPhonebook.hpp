@@ -53,6 +53,7 @@ namespace app
 
         void createUserInterface() override;
         void destroyUserInterface() override;
+        void flushModels() override;
 
         void onSearchRequest(const std::string &searchFilter);
     };
@@ -60,6 +60,7 @@ auto PhonebookModel::requestRecordsCount() -> unsigned int
 
 void PhonebookModel::requestRecords(const std::uint32_t offset, const std::uint32_t limit)
 {
+    flushed = false;
     auto query =
         std::make_unique<db::query::ContactGet>(limit, offset, queryFilter, queryGroupFilter, queryDisplayMode);
     auto task = app::AsyncQuery::createFromQuery(std::move(query), db::Interface::Name::Contact);
@@ -91,6 +92,17 @@ auto PhonebookModel::requestLetterMap() -> ContactsMapData
     return contactMapData;
 }
 
+void PhonebookModel::flush()
+{
+    clear();
+    flushed = true;
+}
+
+auto PhonebookModel::isFlushed() const noexcept -> bool
+{
+    return flushed;
+}
+
 auto PhonebookModel::updateRecords(std::vector<ContactRecord> records) -> bool
 {
     DatabaseModel::updateRecords(std::move(records));
@@ -1,4 +1,4 @@
-// Copyright (c) 2017-2022, Mudita Sp. z.o.o. All rights reserved.
+// Copyright (c) 2017-2023, Mudita Sp. z.o.o. All rights reserved.
 // For licensing, see https://github.com/mudita/MuditaOS/LICENSE.md
 
 #pragma once
@@ -25,6 +25,7 @@ class PhonebookModel : public app::DatabaseModel<ContactRecord>,
     std::string queryFilter;
     std::uint32_t queryGroupFilter;
     std::uint32_t queryDisplayMode;
+    bool flushed = false;
 
   public:
     ContactsMapData letterMap;
@@ -35,6 +36,10 @@ class PhonebookModel : public app::DatabaseModel<ContactRecord>,
     void requestRecords(std::uint32_t offset, std::uint32_t limit) override;
     auto requestLetterMap() -> ContactsMapData;
 
+    /// Drops the fetched contacts, the list showing them has to be rebuilt before it's shown again
+    void flush();
+    [[nodiscard]] auto isFlushed() const noexcept -> bool;
+
     // virtual methods for ListViewProvider
     [[nodiscard]] auto getMinimalItemSpaceRequired() const -> unsigned int override;
     auto getItem(gui::Order order) -> gui::ListItem * override;
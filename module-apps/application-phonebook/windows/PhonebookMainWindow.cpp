@@ -89,6 +89,10 @@ namespace gui
 
     void PhonebookMainWindow::onBeforeShow([[maybe_unused]] ShowMode mode, SwitchData *data)
     {
+        if (phonebookModel->isFlushed()) {
+            rebuild();
+        }
+
         const auto contactRequest = dynamic_cast<PhonebookSearchRequest *>(data);
         model->setRequested(contactRequest != nullptr);
         if (model->requestedSearch()) {
@@ -29,6 +29,8 @@
 #include <popups/data/BluetoothModeParams.hpp>
 #include <popups/data/TetheringParams.hpp>
 
+#include <utility>
+
 #if DEBUG_INPUT_EVENTS == 1
 #define debug_input_events(...) LOG_DEBUG(__VA_ARGS__)
 #else
@@ -222,12 +224,20 @@ namespace app
             auto window = getCurrentWindow();
             updateStatuses(window);
 
-            auto message = std::make_shared<service::gui::DrawMessage>(window->buildDrawList(), mode);
+            const auto traceId = std::exchange(inputTraceId, sys::trace::noTrace);
+            std::vector<gui::Command> commands;
+            {
+                sys::trace::ScopedStage drawListStage{traceId, sys::trace::Stage::DrawList};
+                commands = window->buildDrawList();
+            }
+            auto message     = std::make_shared<service::gui::DrawMessage>(std::move(commands), mode);
+            message->traceId = traceId;
 
             if (suspendInProgress) {
                 message->setCommandType(service::gui::DrawMessage::Type::SUSPEND);
             }
 
+            sys::trace::record(traceId, sys::trace::Stage::Queue, sys::trace::Phase::Begin);
             bus.sendUnicast(std::move(message), service::name::gui);
         }
 
@@ -239,6 +249,9 @@ namespace app
     void ApplicationCommon::updateStatuses(gui::AppWindow *window) const
     {}
 
+    void ApplicationCommon::flushModels()
+    {}
+
     void ApplicationCommon::setDefaultWindow(const std::string &w)
     {
         default_window = w;
@@ -336,7 +349,8 @@ namespace app
     {
         const auto &window = windowsStack().get(topWindow);
         if (window.has_value()) {
-            auto msg = std::make_shared<AppRefreshMessage>(mode, *window);
+            auto msg     = std::make_shared<AppRefreshMessage>(mode, *window);
+            msg->traceId = std::exchange(inputTraceId, sys::trace::noTrace);
             bus.sendUnicast(std::move(msg), this->GetName());
         }
     }
@@ -375,6 +389,12 @@ namespace app
             return handleAppRebuild(msg);
         case MessageType::AppFocusLost:
             return handleAppFocusLost(msgl);
+        case MessageType::AppFlushModels:
+            if (state == State::ACTIVE_BACKGROUND) {
+                windowsStack().dropRetainedWindows();
+                flushModels();
+            }
+            return sys::msgHandled();
         default:
             return sys::msgNotHandled();
         }
@@ -418,7 +438,15 @@ namespace app
         else if (msg->getEvent().isShortRelease()) {
             longPressTimer.stop();
         }
-        if (!windowsStack().isEmpty() && getCurrentWindow()->onInput(msg->getEvent())) {
+        sys::trace::record(msg->traceId, sys::trace::Stage::Dispatch, sys::trace::Phase::End);
+
+        bool isRefreshRequired = false;
+        if (!windowsStack().isEmpty()) {
+            sys::trace::ScopedStage windowStage{msg->traceId, sys::trace::Stage::Window};
+            isRefreshRequired = getCurrentWindow()->onInput(msg->getEvent());
+        }
+        if (isRefreshRequired) {
+            inputTraceId = msg->traceId;
             refreshWindow(gui::RefreshModes::GUI_REFRESH_FAST);
         }
         return sys::msgHandled();
@@ -432,7 +460,9 @@ namespace app
         const auto msg        = static_cast<sevm::KbdMessage *>(msgl);
         const auto inputEvent = keyTranslator->translate(msg->key);
         if (!inputEvent.is(gui::KeyCode::KEY_UNDEFINED)) {
-            messageInputEventApplication(this, this->GetName(), inputEvent);
+            auto inputMsg     = std::make_shared<AppInputEventMessage>(inputEvent);
+            inputMsg->traceId = msg->traceId;
+            bus.sendUnicast(std::move(inputMsg), this->GetName());
         }
 
         debug_input_events("AppInput -> K:|%s|, S:|%s|, App:|%s|, W:|%s|",
@@ -702,6 +732,7 @@ namespace app
                       windowsStack().isEmpty() ? "none" : getCurrentWindow()->getName().c_str());
             return sys::msgNotHandled();
         }
+        inputTraceId = msg->traceId;
         render(msg->getMode());
         return sys::msgHandled();
     }
@@ -825,6 +856,12 @@ namespace app
         sender->bus.sendUnicast(std::move(msg), application);
     }
 
+    void ApplicationCommon::messageFlushModels(sys::Service *sender, const std::string &application)
+    {
+        auto msg = std::make_shared<AppFlushModelsMessage>();
+        sender->bus.sendUnicast(std::move(msg), application);
+    }
+
     void ApplicationCommon::messageInputEventApplication(sys::Service *sender,
                                                          const std::string &application,
                                                          const gui::InputEvent &event)
@@ -985,8 +1022,12 @@ namespace app
             LOG_INFO("Requested window %s is previous one - get back to it", newWindow.c_str());
             return;
         }
+        if (windowsStack().pushRetained(newWindow, d)) {
+            LOG_INFO("Reuse window kept off the stack: %s", newWindow.c_str());
+            return;
+        }
         LOG_INFO("Create window for stack: %s", newWindow.c_str());
-        windowsStack().push(newWindow, windowsFactory.build(this, newWindow), d);
+        windowsStack().push(newWindow, windowsFactory.build(this, newWindow), d, windowsFactory.isRetained(newWindow));
     }
 
     std::optional<std::string> ApplicationCommon::getPreviousWindow(std::uint32_t count) const
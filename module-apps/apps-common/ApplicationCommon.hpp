@@ -334,6 +334,7 @@ namespace app
         static void messageRebuildApplication(sys::Service *sender, const std::string &application);
         static void messageApplicationLostFocus(sys::Service *sender, const std::string &application);
         static void messageSwitchBack(sys::Service *sender, const std::string &application);
+        static void messageFlushModels(sys::Service *sender, const std::string &application);
         /// @}
 
       protected:
@@ -346,6 +347,9 @@ namespace app
         virtual void createUserInterface() = 0;
         /// Method closing application's windows.
         virtual void destroyUserInterface() = 0;
+        /// Drops the data of the models, called on memory shortage while the application is kept in the background.
+        /// The windows fetch the data again when they are shown.
+        virtual void flushModels();
 
         /// @ingrup AppWindowStack
         WindowsFactory windowsFactory;
@@ -404,6 +408,8 @@ namespace app
         /// sent to gui service. If suspend is true, application manager will receive information from both eink and gui
         /// services if last rendering mesage will be processed.
         bool suspendInProgress = false;
+        /// Traced input being handled, it's passed on to the window refresh and the draw commands it causes
+        sys::trace::Id inputTraceId = sys::trace::noTrace;
 
         /// Storage for asynchronous tasks callbacks.
         std::unique_ptr<CallbackStorage> callbackStorage;
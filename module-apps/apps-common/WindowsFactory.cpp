@@ -1,4 +1,4 @@
-// Copyright (c) 2017-2021, Mudita Sp. z.o.o. All rights reserved.
+// Copyright (c) 2017-2023, Mudita Sp. z.o.o. All rights reserved.
 // For licensing, see https://github.com/mudita/MuditaOS/LICENSE.md
 
 #include "WindowsFactory.hpp"
@@ -8,9 +8,15 @@
 namespace app
 {
 
-    void WindowsFactory::attach(const std::string &name, builder builder)
+    void WindowsFactory::attach(const std::string &name, builder builder, Retention retention)
     {
         builders[name] = std::move(builder);
+        if (retention == Retention::Keep) {
+            retainedWindows.insert(name);
+        }
+        else {
+            retainedWindows.erase(name);
+        }
     }
 
     auto WindowsFactory::isRegistered(const std::string &name) const -> bool
@@ -18,6 +24,11 @@ namespace app
         return builders.find(name) != std::end(builders);
     }
 
+    auto WindowsFactory::isRetained(const std::string &name) const -> bool
+    {
+        return retainedWindows.find(name) != std::end(retainedWindows);
+    }
+
     auto WindowsFactory::build(ApplicationCommon *app, const std::string &name) -> handle
     {
         return builders[name](app, name);
@@ -1,4 +1,4 @@
-// Copyright (c) 2017-2021, Mudita Sp. z.o.o. All rights reserved.
+// Copyright (c) 2017-2023, Mudita Sp. z.o.o. All rights reserved.
 // For licensing, see https://github.com/mudita/MuditaOS/LICENSE.md
 
 #pragma once
@@ -6,6 +6,7 @@
 #include <memory>
 #include <functional>
 #include <map>
+#include <set>
 #include <string>
 
 namespace app
@@ -26,8 +27,16 @@ namespace app
         using handle  = std::unique_ptr<gui::AppWindow>;
         using builder = std::function<handle(ApplicationCommon *, std::string)>;
 
+        /// What happens to the window once it's off the windows stack
+        enum class Retention
+        {
+            Rebuild, ///< built again when it's requested next time
+            Keep     ///< kept for reuse, the window has to set itself up again in onBeforeShow
+        };
+
       private:
         std::map<std::string, builder> builders;
+        std::set<std::string> retainedWindows;
 
       public:
         WindowsFactory()                       = default;
@@ -36,8 +45,9 @@ namespace app
         WindowsFactory &operator=(const WindowsFactory &) = delete;
         WindowsFactory &operator=(WindowsFactory &&) = delete;
 
-        void attach(const std::string &name, builder builder);
+        void attach(const std::string &name, builder builder, Retention retention = Retention::Rebuild);
         [[nodiscard]] auto isRegistered(const std::string &name) const -> bool;
+        [[nodiscard]] auto isRetained(const std::string &name) const -> bool;
         auto build(ApplicationCommon *app, const std::string &name) -> handle;
     };
 } // namespace app
@@ -25,7 +25,36 @@ namespace app
     {
         /// Note: this is the place which will destroy old window if there was one
         windows[name] = std::move(window);
-        stack.push_back(WindowData(name, disposition));
+        retainedWindows.remove(name);
+        stack.push_back(WindowData(name, disposition, retained));
+    }
+
+    bool WindowsStack::pushRetained(const std::string &name, const gui::popup::Disposition &disposition)
+    {
+        const auto it = std::find(retainedWindows.begin(), retainedWindows.end(), name);
+        if (it == retainedWindows.end()) {
+            return false;
+        }
+        retainedWindows.erase(it);
+        stack.push_back(WindowData(name, disposition, true));
+        return true;
+    }
+
+    void WindowsStack::setRetainedWindowsLimit(std::size_t limit)
+    {
+        retainedLimit = limit;
+        while (retainedWindows.size() > retainedLimit) {
+            windows.erase(retainedWindows.back());
+            retainedWindows.pop_back();
+        }
+    }
+
+    void WindowsStack::dropRetainedWindows()
+    {
+        for (const auto &name : retainedWindows) {
+            windows.erase(name);
+        }
+        retainedWindows.clear();
     }
 
     gui::AppWindow *WindowsStack::get(const std::string &name) const
@@ -56,10 +85,10 @@ namespace app
     }
 
     /// return false on pop empty
-    bool WindowsStack::pop() noexcept
+    bool WindowsStack::pop()
     {
         if (!stack.empty()) {
-            stack.pop_back();
+            erase(std::prev(stack.end()), stack.end());
             return true;
         }
         return false;
@@ -69,7 +98,7 @@ namespace app
     {
         auto ret = findInStack(window);
         if (ret != stack.end()) {
-            stack.erase(std::next(ret), stack.end());
+            erase(std::next(ret), stack.end());
             return true;
         }
         return false;
@@ -78,7 +107,7 @@ namespace app
     bool WindowsStack::popLastWindow()
     {
         if (stack.size() == 1) {
-            stack.clear();
+            erase(stack.begin(), stack.end());
             return true;
         }
         return false;
@@ -88,7 +117,7 @@ namespace app
     {
         auto popWindow = findInStack(window);
         if (popWindow != stack.end()) {
-            stack.erase(popWindow);
+            erase(popWindow, std::next(popWindow));
             return true;
         }
         return false;
@@ -99,6 +128,8 @@ namespace app
         if (windows.empty()) {
             return false;
         }
+        // the retained windows are built again once they are requested
+        dropRetainedWindows();
         for (auto &[name, window] : windows) {
             windows[name] = windowsFactory.build(app, name);
         }
@@ -108,9 +139,38 @@ namespace app
     void WindowsStack::clear()
     {
         stack.clear();
+        retainedWindows.clear();
         windows.clear();
     }
 
+    void WindowsStack::erase(decltype(stack)::iterator first, decltype(stack)::iterator last)
+    {
+        std::vector<std::string> released;
+        for (auto it = first; it != last; ++it) {
+            if (it->retained) {
+                released.push_back(it->name);
+            }
+        }
+        stack.erase(first, last);
+        for (const auto &name : released) {
+            if (!isWindowOnStack(name)) {
+                retain(name);
+            }
+        }
+    }
+
+    void WindowsStack::retain(const std::string &name)
+    {
+        retainedWindows.remove(name);
+        retainedWindows.push_front(name);
+        // the window which has just left the stack is kept anyway, it may be handling the input that closed it
+        while (retainedWindows.size() > std::max<std::size_t>(retainedLimit, 1)) {
+            LOG_DEBUG("Destroying retained window: %s", retainedWindows.back().c_str());
+            windows.erase(retainedWindows.back());
+            retainedWindows.pop_back();
+        }
+    }
+
     decltype(WindowsStack::stack)::iterator WindowsStack::findInStack(const std::string &window)
     {
         return std::find_if(stack.begin(), stack.end(), [&](auto &el) { return el.name == window; });
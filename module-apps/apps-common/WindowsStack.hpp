@@ -4,6 +4,7 @@
 #pragma once
 
 #include <algorithm>
+#include <list>
 #include <memory>
 #include <map>
 #include <optional>
@@ -26,15 +27,19 @@ namespace app
 
     constexpr auto previousWindow = 1;
     constexpr auto topWindow      = 0;
+    /// Number of the retained windows an application keeps off the stack
+    constexpr auto retainedWindowsLimit = 2;
 
     struct WindowData
     {
       public:
         std::string name;
         gui::popup::Disposition disposition{};
+        /// window is kept for reuse once it's off the stack
+        bool retained = false;
 
-        WindowData(const std::string &name, const gui::popup::Disposition &disposition)
-            : name(name), disposition(disposition)
+        WindowData(const std::string &name, const gui::popup::Disposition &disposition, bool retained = false)
+            : name(name), disposition(disposition), retained(retained)
         {}
     };
 
@@ -42,7 +47,13 @@ namespace app
     {
         std::map<std::string, std::unique_ptr<gui::AppWindow>> windows{};
         std::vector<WindowData> stack;
+        /// retained windows which are off the stack, the most recently used first
+        std::list<std::string> retainedWindows;
+        std::size_t retainedLimit = retainedWindowsLimit;
         decltype(stack)::iterator findInStack(const std::string &);
+        /// removes the windows from the stack, the retained ones are kept off the stack up to the limit
+        void erase(decltype(stack)::iterator first, decltype(stack)::iterator last);
+        void retain(const std::string &name);
 
       public:
         WindowsStack() = default;
@@ -56,7 +67,15 @@ namespace app
         /// add window on top of stack
         void push(const std::string &name,
                   std::unique_ptr<gui::AppWindow> window,
-                  const gui::popup::Disposition &disposition = gui::popup::WindowDisposition);
+                  const gui::popup::Disposition &disposition = gui::popup::WindowDisposition,
+                  bool retained                              = false);
+        /// add the retained window kept off the stack on top of stack again
+        /// return false if the window isn't kept
+        bool pushRetained(const std::string &name,
+                          const gui::popup::Disposition &disposition = gui::popup::WindowDisposition);
+        void setRetainedWindowsLimit(std::size_t limit);
+        /// destroys the retained windows which are off the stack
+        void dropRetainedWindows();
 
         /// window getters
         gui::AppWindow *get(const std::string &name) const;
@@ -67,7 +86,7 @@ namespace app
         /// `pop`  functions - handle last, latest window
         /// `drop` functions - remove any window on stack
         /// return false on pop empty
-        bool pop() noexcept;
+        bool pop();
         bool pop(const std::string &window);
         bool popLastWindow();
         bool drop(const std::string &window);
@@ -1,4 +1,4 @@
-// Copyright (c) 2017-2022, Mudita Sp. z.o.o. All rights reserved.
+// Copyright (c) 2017-2023, Mudita Sp. z.o.o. All rights reserved.
 // For licensing, see https://github.com/mudita/MuditaOS/LICENSE.md
 
 #pragma once
@@ -252,4 +252,11 @@ namespace app
         AppSwitchBackMessage() : AppMessage(MessageType::AppSwitchBack)
         {}
     };
+
+    class AppFlushModelsMessage : public AppMessage
+    {
+      public:
+        AppFlushModelsMessage() : AppMessage(MessageType::AppFlushModels)
+        {}
+    };
 } // namespace app
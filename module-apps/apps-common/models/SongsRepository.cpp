@@ -8,6 +8,7 @@
 #include <service-audio/AudioServiceAPI.hpp>
 #include <service-audio/AudioServiceName.hpp>
 #include <time/ScopedTime.hpp>
+#include <time/time_constants.hpp>
 #include <service-audio/AudioMessage.hpp>
 #include <module-db/queries/multimedia_files/QueryMultimediaFilesGetLimited.hpp>
 #include <module-db/queries/multimedia_files/QueryMultimediaFilesGet.hpp>
@@ -20,6 +21,35 @@ namespace constants
     inline constexpr auto cacheThreshold{10};
 } // namespace constants
 
+namespace
+{
+    /// Tags of the indexed files are already in the database - caching them saves parsing when playback starts
+    void cacheTags(const std::vector<db::multimedia_files::MultimediaFilesRecord> &records)
+    {
+        for (const auto &record : records) {
+            const auto totalDuration = record.audioProperties.songLength;
+            const auto durationMin   = totalDuration / utils::time::secondsInMinute;
+            tags::fetcher::cacheTags(
+                tags::fetcher::FileStamp{.size = record.fileInfo.size, .mtime = record.fileInfo.mtime},
+                tags::fetcher::Tags{totalDuration,
+                                    durationMin / utils::time::secondsInMinute,
+                                    durationMin,
+                                    totalDuration % utils::time::secondsInMinute,
+                                    record.audioProperties.sampleRate,
+                                    record.audioProperties.channels,
+                                    record.audioProperties.bitrate,
+                                    record.tags.album.artist,
+                                    record.tags.genre,
+                                    record.tags.title,
+                                    record.tags.album.title,
+                                    record.tags.year,
+                                    record.fileInfo.path,
+                                    record.tags.comment,
+                                    record.tags.track});
+        }
+    }
+} // namespace
+
 namespace app::music
 {
     ServiceAudioTagsFetcher::ServiceAudioTagsFetcher(ApplicationCommon *application) : application(application)
@@ -202,6 +232,7 @@ namespace app::music
         }
         musicFilesModelCache.recordsOffset = 0;
         musicFilesModelCache.recordsCount  = repoRecordsCount;
+        cacheTags(records);
 
         return true;
     }
@@ -216,6 +247,7 @@ namespace app::music
         }
         musicFilesModelCache.recordsOffset = offset;
         musicFilesModelCache.recordsCount  = repoRecordsCount;
+        cacheTags(records);
 
         return true;
     }
@@ -231,6 +263,7 @@ namespace app::music
             musicFilesModelCache.recordsOffset++;
         }
         musicFilesModelCache.recordsCount = repoRecordsCount;
+        cacheTags(records);
 
         return true;
     }
@@ -247,6 +280,7 @@ namespace app::music
         }
         musicFilesModelCache.recordsOffset = offset;
         musicFilesModelCache.recordsCount  = repoRecordsCount;
+        cacheTags(records);
 
         return true;
     }
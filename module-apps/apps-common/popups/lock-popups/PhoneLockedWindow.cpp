@@ -20,7 +20,7 @@ namespace gui
         buildInterface();
         initializeDeepRefreshCounter(lockScreenDeepRefreshRate);
 
-        preBuildDrawListHook = [this](std::list<Command> &cmd) {
+        preBuildDrawListHook = [this](std::vector<Command> &cmd) {
             AppWindow::updateTime();
             wallpaperPresenter->updateWallpaper();
         };
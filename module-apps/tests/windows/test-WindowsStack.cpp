@@ -1,4 +1,4 @@
-// Copyright (c) 2017-2022, Mudita Sp. z.o.o. All rights reserved.
+// Copyright (c) 2017-2023, Mudita Sp. z.o.o. All rights reserved.
 // For licensing, see https://github.com/mudita/MuditaOS/LICENSE.md
 
 #include <catch2/catch.hpp>
@@ -258,3 +258,50 @@ TEST_CASE("WindowsStack::clear")
     stack.clear();
     REQUIRE(stack.isEmpty());
 }
+
+TEST_CASE("retained windows")
+{
+    app::WindowsStack stack;
+    stack.push("main", std::make_unique<TestWindow>("main"));
+
+    SECTION("window not retained")
+    {
+        stack.push("window", std::make_unique<TestWindow>("window"));
+        REQUIRE(stack.pop());
+        REQUIRE(!stack.pushRetained("window"));
+    }
+
+    SECTION("window retained")
+    {
+        stack.push("window", std::make_unique<TestWindow>("window"), gui::popup::WindowDisposition, true);
+        const auto window = stack.get("window");
+        REQUIRE(stack.pop());
+        REQUIRE(!stack.isWindowOnStack("window"));
+        REQUIRE(stack.pushRetained("window"));
+        REQUIRE(stack.get(app::topWindow) == "window");
+        REQUIRE(stack.get("window") == window);
+    }
+
+    SECTION("least recently used window destroyed")
+    {
+        stack.setRetainedWindowsLimit(1);
+        stack.push("first", std::make_unique<TestWindow>("first"), gui::popup::WindowDisposition, true);
+        REQUIRE(stack.pop());
+        stack.push("second", std::make_unique<TestWindow>("second"), gui::popup::WindowDisposition, true);
+        REQUIRE(stack.pop());
+        REQUIRE(stack.get("first") == nullptr);
+        REQUIRE(!stack.pushRetained("first"));
+        REQUIRE(stack.pushRetained("second"));
+    }
+
+    SECTION("retained windows dropped on rebuild")
+    {
+        app::WindowsFactory wf;
+        add_dummy_builders(wf, 1, [](unsigned int) { return "main"; });
+        stack.push("window", std::make_unique<TestWindow>("window"), gui::popup::WindowDisposition, true);
+        REQUIRE(stack.pop());
+        REQUIRE(stack.rebuildWindows(wf, nullptr));
+        REQUIRE(stack.get("window") == nullptr);
+        REQUIRE(!stack.pushRetained("window"));
+    }
+}
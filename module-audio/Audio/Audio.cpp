@@ -1,4 +1,4 @@
-// Copyright (c) 2017-2022, Mudita Sp. z.o.o. All rights reserved.
+// Copyright (c) 2017-2023, Mudita Sp. z.o.o. All rights reserved.
 // For licensing, see https://github.com/mudita/MuditaOS/LICENSE.md
 
 #include "Audio.hpp"
@@ -142,6 +142,21 @@ namespace audio
         return currentOperation->Resume();
     }
 
+    audio::RetCode Audio::Mix(const std::string &filePath,
+                              const audio::PlaybackType &playbackType,
+                              const audio::Token &token)
+    {
+        if (currentState != State::Playback) {
+            return RetCode::InvokedInIncorrectState;
+        }
+        return currentOperation->Mix(filePath, playbackType, token);
+    }
+
+    audio::RetCode Audio::StopMixing(const audio::Token &token)
+    {
+        return currentOperation->StopMixing(token);
+    }
+
     audio::RetCode Audio::Mute()
     {
         muted = Muted::True;
@@ -106,6 +106,10 @@ namespace audio
         virtual audio::RetCode Pause();
         virtual audio::RetCode Resume();
         virtual audio::RetCode Mute();
+        virtual audio::RetCode Mix(const std::string &filePath,
+                                   const audio::PlaybackType &playbackType,
+                                   const audio::Token &token);
+        virtual audio::RetCode StopMixing(const audio::Token &token);
 
       protected:
         AudioSinkState audioSinkState;
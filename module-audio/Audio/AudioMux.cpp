@@ -1,8 +1,9 @@
-// Copyright (c) 2017-2021, Mudita Sp. z.o.o. All rights reserved.
+// Copyright (c) 2017-2023, Mudita Sp. z.o.o. All rights reserved.
 // For licensing, see https://github.com/mudita/MuditaOS/LICENSE.md
 
 #include "AudioMux.hpp"
 #include "Audio.hpp"
+#include "Mixer.hpp"
 
 namespace audio
 {
@@ -65,6 +66,21 @@ namespace audio
         return std::nullopt;
     }
 
+    std::optional<AudioMux::Input *> AudioMux::GetMixingInput(const audio::PlaybackType &playbackType)
+    {
+        if (!Mixer::getPolicy(playbackType).has_value()) {
+            return std::nullopt;
+        }
+        for (auto &audioInput : audioInputs) {
+            if (audioInput.audio->GetCurrentState() == Audio::State::Playback &&
+                audioInput.audio->GetCurrentOperationState() == Operation::State::Active &&
+                Mixer::acceptsSounds(audioInput.audio->GetCurrentOperationPlaybackType())) {
+                return &audioInput;
+            }
+        }
+        return std::nullopt;
+    }
+
     std::optional<AudioMux::Input *> AudioMux::GetIdleInput()
     {
         return GetInput({Audio::State::Idle});
@@ -1,4 +1,4 @@
-// Copyright (c) 2017-2021, Mudita Sp. z.o.o. All rights reserved.
+// Copyright (c) 2017-2023, Mudita Sp. z.o.o. All rights reserved.
 // For licensing, see https://github.com/mudita/MuditaOS/LICENSE.md
 
 #pragma once
@@ -96,6 +96,12 @@ namespace audio
          * @return nullopt if input not found
          */
         auto GetPlaybackInput(const audio::PlaybackType &playbackType) -> std::optional<AudioMux::Input *>;
+        /**
+         * Gets playback input the sound can be mixed into, so it doesn't interrupt the ongoing playback
+         * @param playbackType Playback type of the sound
+         * @return nullopt if the sound is not mixable or there is no playback accepting it
+         */
+        auto GetMixingInput(const audio::PlaybackType &playbackType) -> std::optional<AudioMux::Input *>;
 
         auto GetAllInputs() -> std::vector<Input> &
         {
@@ -0,0 +1,174 @@
+// Copyright (c) 2017-2023, Mudita Sp. z.o.o. All rights reserved.
+// For licensing, see https://github.com/mudita/MuditaOS/LICENSE.md
+
+#include "Mixer.hpp"
+
+#include <algorithm>
+#include <array>
+#include <limits>
+
+namespace audio
+{
+    namespace
+    {
+        constexpr auto fractionalBits    = 15;
+        constexpr std::int32_t unityGain = 1 << fractionalBits;
+        constexpr auto channels          = 2;
+        constexpr std::chrono::milliseconds attackTime{20};
+        constexpr std::chrono::milliseconds keypadReleaseTime{100};
+        constexpr std::chrono::milliseconds notificationReleaseTime{300};
+
+        std::int32_t toQ15(float gain)
+        {
+            return static_cast<std::int32_t>(std::clamp(gain, 0.0f, 1.0f) * unityGain);
+        }
+
+        std::int16_t saturate(std::int32_t sample)
+        {
+            return static_cast<std::int16_t>(std::clamp<std::int32_t>(
+                sample, std::numeric_limits<std::int16_t>::min(), std::numeric_limits<std::int16_t>::max()));
+        }
+    } // namespace
+
+    auto Mixer::getPolicy(PlaybackType playbackType) -> std::optional<Policy>
+    {
+        switch (playbackType) {
+        case PlaybackType::KeypadSound:
+            return Policy{.gain = 1.0f, .duckedGain = 0.7f, .attack = attackTime, .release = keypadReleaseTime};
+        case PlaybackType::Notifications:
+        case PlaybackType::TextMessageRingtone:
+            return Policy{.gain = 1.0f, .duckedGain = 0.3f, .attack = attackTime, .release = notificationReleaseTime};
+        case PlaybackType::None:
+        case PlaybackType::Multimedia:
+        case PlaybackType::CallRingtone:
+        case PlaybackType::Meditation:
+        case PlaybackType::Alarm:
+        case PlaybackType::PreWakeUp:
+        case PlaybackType::Snooze:
+        case PlaybackType::Bedtime:
+            return std::nullopt;
+        }
+        return std::nullopt;
+    }
+
+    auto Mixer::acceptsSounds(PlaybackType playbackType) -> bool
+    {
+        return playbackType == PlaybackType::Multimedia;
+    }
+
+    Mixer::Mixer(std::uint32_t sampleRate, SoundEndedCallback soundEndedCallback)
+        : sampleRate{sampleRate}, soundEndedCallback{std::move(soundEndedCallback)}, duckGain{unityGain},
+          releaseStep{unityGain}
+    {
+        sounds.reserve(maxSounds);
+    }
+
+    auto Mixer::add(std::shared_ptr<const PcmSound> sound, const Policy &policy, const Token &token) -> RetCode
+    {
+        if (sound == nullptr || sound->tags.sample_rate != sampleRate || sound->tags.num_channel != channels) {
+            return RetCode::InvalidFormat;
+        }
+
+        cpp_freertos::LockGuard lock(mutex);
+        if (sounds.size() >= maxSounds) {
+            return RetCode::Failed;
+        }
+        const auto duckedGain = toQ15(policy.duckedGain);
+        sounds.push_back(Sound{.pcm         = std::move(sound),
+                               .token       = token,
+                               .gain        = toQ15(policy.gain),
+                               .duckedGain  = duckedGain,
+                               .attackStep  = toStep(duckedGain, policy.attack),
+                               .releaseStep = toStep(duckedGain, policy.release)});
+        return RetCode::Success;
+    }
+
+    auto Mixer::remove(const Token &token) -> RetCode
+    {
+        cpp_freertos::LockGuard lock(mutex);
+        const auto it =
+            std::find_if(sounds.begin(), sounds.end(), [&token](const auto &sound) { return sound.token == token; });
+        if (!token.IsValid() || it == sounds.end()) {
+            return RetCode::TokenNotFound;
+        }
+        releaseStep = it->releaseStep;
+        sounds.erase(it);
+        return RetCode::Success;
+    }
+
+    void Mixer::mix(std::int16_t *samples, std::size_t samplesCount)
+    {
+        std::array<Token, maxSounds> endedSounds;
+        std::size_t endedSoundsCount = 0;
+        {
+            cpp_freertos::LockGuard lock(mutex);
+            if (sounds.empty() && duckGain == unityGain) {
+                return;
+            }
+
+            // the sound ducking the playback the most sets the pace of the attack
+            auto duckTarget = unityGain;
+            auto attackStep = unityGain;
+            for (const auto &sound : sounds) {
+                if (sound.duckedGain < duckTarget) {
+                    duckTarget = sound.duckedGain;
+                    attackStep = sound.attackStep;
+                }
+            }
+
+            for (std::size_t i = 0; i + 1 < samplesCount; i += channels) {
+                if (duckGain > duckTarget) {
+                    duckGain = std::max(duckTarget, duckGain - attackStep);
+                }
+                else if (duckGain < duckTarget) {
+                    duckGain = std::min(duckTarget, duckGain + releaseStep);
+                }
+
+                for (auto channel = 0; channel < channels; ++channel) {
+                    auto mixed = (static_cast<std::int32_t>(samples[i + channel]) * duckGain) >> fractionalBits;
+                    for (const auto &sound : sounds) {
+                        if (sound.offset + i + channel < sound.pcm->samples.size()) {
+                            mixed += (sound.pcm->samples[sound.offset + i + channel] * sound.gain) >> fractionalBits;
+                        }
+                    }
+                    samples[i + channel] = saturate(mixed);
+                }
+            }
+
+            for (auto &sound : sounds) {
+                sound.offset += samplesCount;
+                if (sound.offset >= sound.pcm->samples.size()) {
+                    endedSounds[endedSoundsCount++] = sound.token;
+                    releaseStep                     = sound.releaseStep;
+                }
+            }
+            sounds.erase(std::remove_if(sounds.begin(),
+                                        sounds.end(),
+                                        [](const auto &sound) { return sound.offset >= sound.pcm->samples.size(); }),
+                         sounds.end());
+        }
+
+        // notified without the lock, so the callback may add or remove sounds
+        if (soundEndedCallback) {
+            for (std::size_t i = 0; i < endedSoundsCount; ++i) {
+                soundEndedCallback(endedSounds[i]);
+            }
+        }
+    }
+
+    auto Mixer::isIdle() -> bool
+    {
+        cpp_freertos::LockGuard lock(mutex);
+        return sounds.empty() && duckGain == unityGain;
+    }
+
+    auto Mixer::toFrames(std::chrono::milliseconds time) const -> std::int32_t
+    {
+        return static_cast<std::int32_t>(time.count() * sampleRate / std::milli::den);
+    }
+
+    auto Mixer::toStep(std::int32_t duckedGain, std::chrono::milliseconds time) const -> std::int32_t
+    {
+        return std::max(1, (unityGain - duckedGain) / std::max(1, toFrames(time)));
+    }
+} // namespace audio
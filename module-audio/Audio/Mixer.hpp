@@ -0,0 +1,87 @@
+// Copyright (c) 2017-2023, Mudita Sp. z.o.o. All rights reserved.
+// For licensing, see https://github.com/mudita/MuditaOS/LICENSE.md
+
+#pragma once
+
+#include "AudioCommon.hpp"
+#include "decoder/SoundCache.hpp"
+
+#include <mutex.hpp>
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <vector>
+
+namespace audio
+{
+    /// Mixes short sounds into the samples of an ongoing playback, so that e.g. a notification is heard over
+    /// the music without stopping it. While any sound is mixed the playback is ducked - its gain is lowered
+    /// during the attack time of the sound ducking it the most and raised back during the release time of the
+    /// sound which ended last. All the samples are interleaved stereo S16, gains are applied in Q15.
+    /// Mixed sounds are identified by tokens, just like the playbacks they are mixed into.
+    class Mixer
+    {
+      public:
+        struct Policy
+        {
+            /// Gain of the mixed sound, range 0 - 1
+            float gain = 1.0f;
+            /// Gain of the playback while the sound is mixed, range 0 - 1
+            float duckedGain = 1.0f;
+            std::chrono::milliseconds attack{0};
+            std::chrono::milliseconds release{0};
+        };
+
+        /// Called from the mixing context with the token of every sound played to the end
+        using SoundEndedCallback = std::function<void(const Token &token)>;
+
+        static constexpr std::size_t maxSounds = 4;
+
+        /// Policy of mixing sounds of the playback type, nullopt if they must not be mixed
+        static auto getPolicy(PlaybackType playbackType) -> std::optional<Policy>;
+        /// Whether other sounds may be mixed into a playback of the given type
+        static auto acceptsSounds(PlaybackType playbackType) -> bool;
+
+        explicit Mixer(std::uint32_t sampleRate, SoundEndedCallback soundEndedCallback = nullptr);
+
+        /// Queues a sound to be mixed from the next block on. Fails if the sound doesn't match the sample
+        /// rate of the playback or too many sounds are already mixed.
+        auto add(std::shared_ptr<const PcmSound> sound, const Policy &policy, const Token &token = Token())
+            -> RetCode;
+        /// Stops mixing the sound, the playback is released as if the sound has ended
+        auto remove(const Token &token) -> RetCode;
+
+        /// Mixes queued sounds into the block of playback samples in place
+        void mix(std::int16_t *samples, std::size_t samplesCount);
+
+        /// True if nothing is mixed and the playback is not ducked
+        auto isIdle() -> bool;
+
+      private:
+        struct Sound
+        {
+            std::shared_ptr<const PcmSound> pcm;
+            Token token;
+            std::size_t offset       = 0;
+            std::int32_t gain        = 0;
+            std::int32_t duckedGain  = 0;
+            std::int32_t attackStep  = 0;
+            std::int32_t releaseStep = 0;
+        };
+
+        auto toFrames(std::chrono::milliseconds time) const -> std::int32_t;
+        auto toStep(std::int32_t duckedGain, std::chrono::milliseconds time) const -> std::int32_t;
+
+        const std::uint32_t sampleRate;
+        SoundEndedCallback soundEndedCallback;
+        cpp_freertos::MutexStandard mutex;
+        std::vector<Sound> sounds;
+        std::int32_t duckGain = 0;
+        /// release step of the sound which ended last
+        std::int32_t releaseStep = 0;
+    };
+} // namespace audio
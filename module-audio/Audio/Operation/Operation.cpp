@@ -76,6 +76,18 @@ namespace audio
         return SwitchToPriorityProfile();
     }
 
+    audio::RetCode Operation::Mix([[maybe_unused]] const std::string &filePath,
+                                  [[maybe_unused]] const audio::PlaybackType &playbackType,
+                                  [[maybe_unused]] const audio::Token &token)
+    {
+        return audio::RetCode::InvokedInIncorrectState;
+    }
+
+    audio::RetCode Operation::StopMixing([[maybe_unused]] const audio::Token &token)
+    {
+        return audio::RetCode::TokenNotFound;
+    }
+
     void Operation::SetProfileAvailability(std::vector<Profile::Type> profiles, bool available)
     {
         for (auto &p : supportedProfiles) {
@@ -73,6 +73,24 @@ namespace audio
 
         virtual Position GetPosition() = 0;
 
+        /**
+         * @brief Mixes a short sound into the ongoing operation.
+         *
+         * @param filePath sound to be mixed
+         * @param playbackType playback type of the sound, defines the mixing policy and volume
+         * @param token token of the sound, reported in the end of file message once the sound has been played
+         */
+        virtual audio::RetCode Mix(const std::string &filePath,
+                                   const audio::PlaybackType &playbackType,
+                                   const audio::Token &token);
+
+        /**
+         * @brief Stops mixing the sound started with Mix.
+         *
+         * @param token token of the sound
+         */
+        virtual audio::RetCode StopMixing(const audio::Token &token);
+
         Volume GetOutputVolume() const
         {
             return (currentProfile != nullptr) ? currentProfile->GetOutputVolume() : Volume{};
@@ -4,6 +4,7 @@
 #include "PlaybackOperation.hpp"
 
 #include "Audio/decoder/Decoder.hpp"
+#include "Audio/decoder/decoderPCM.hpp"
 #include "Audio/Profiles/Profile.hpp"
 #include "Audio/StreamFactory.hpp"
 
@@ -11,8 +12,28 @@
 
 #include <log/log.hpp>
 
+#include <algorithm>
+
 namespace audio
 {
+    namespace
+    {
+        bool isShortSound(audio::PlaybackType playbackType)
+        {
+            return playbackType == PlaybackType::KeypadSound || playbackType == PlaybackType::Notifications ||
+                   playbackType == PlaybackType::TextMessageRingtone;
+        }
+
+        std::unique_ptr<Decoder> createDecoder(const std::string &filePath, audio::PlaybackType playbackType)
+        {
+            if (isShortSound(playbackType)) {
+                if (auto sound = SoundCache::get().fetch(filePath); sound != nullptr) {
+                    return std::make_unique<decoderPCM>(std::move(sound));
+                }
+            }
+            return Decoder::Create(filePath);
+        }
+    } // namespace
 
     using namespace AudioServiceMessage;
 
@@ -33,12 +54,19 @@ namespace audio
             return std::string();
         };
 
-        dec = Decoder::Create(filePath);
+        dec = createDecoder(filePath, playbackType);
         if (dec == nullptr) {
             throw AudioInitException("Error during initializing decoder", RetCode::FileDoesntExist);
         }
         auto format = dec->getSourceFormat();
         LOG_DEBUG("Source format: %s", format.toString().c_str());
+        if (Mixer::acceptsSounds(playbackType)) {
+            mixer = std::make_unique<Mixer>(format.getSampleRate(), [this](const Token &token) {
+                auto soundToken = token;
+                const auto req  = AudioServiceMessage::EndOfFile(soundToken);
+                serviceCallback(&req);
+            });
+        }
 
         auto retCode = SwitchToPriorityProfile(playbackType);
         if (retCode != RetCode::Success) {
@@ -66,7 +94,7 @@ namespace audio
         outputConnection = std::make_unique<StreamConnection>(dec.get(), audioDevice.get(), dataStreamOut.get());
 
         // decoder worker soft start - must be called after connection setup
-        dec->startDecodingWorker(endOfFileCallback);
+        dec->startDecodingWorker(endOfFileCallback, mixer.get());
 
         // start output device and enable audio connection
         auto ret = audioDevice->Start();
@@ -141,6 +169,41 @@ namespace audio
         return dec->getCurrentPosition();
     }
 
+    audio::RetCode PlaybackOperation::Mix(const std::string &filePath,
+                                          const audio::PlaybackType &type,
+                                          const audio::Token &token)
+    {
+        if (mixer == nullptr || currentProfile == nullptr || state != State::Active) {
+            return RetCode::InvokedInIncorrectState;
+        }
+        auto policy = Mixer::getPolicy(type);
+        if (!policy.has_value()) {
+            return RetCode::UnsupportedEvent;
+        }
+        // only sounds short enough to be kept decoded are mixed
+        auto sound = SoundCache::get().fetch(filePath);
+        if (sound == nullptr) {
+            return RetCode::FileDoesntExist;
+        }
+
+        // the sound is played at the output volume of the playback, so its own volume can only make it quieter
+        const auto reqVol = AudioServiceMessage::DbRequest(Setting::Volume, type, currentProfile->GetType());
+        if (const auto val = serviceCallback(&reqVol); val) {
+            const auto volume         = utils::getNumericValue<audio::Volume>(val.value());
+            const auto playbackVolume = std::max<audio::Volume>(GetOutputVolume(), 1);
+            policy->gain *= std::min(1.0f, static_cast<float>(volume) / static_cast<float>(playbackVolume));
+        }
+        return mixer->add(std::move(sound), *policy, token);
+    }
+
+    audio::RetCode PlaybackOperation::StopMixing(const audio::Token &token)
+    {
+        if (mixer == nullptr) {
+            return RetCode::TokenNotFound;
+        }
+        return mixer->remove(token);
+    }
+
     audio::RetCode PlaybackOperation::SwitchToPriorityProfile(audio::PlaybackType playbackType)
     {
         for (const auto &p : supportedProfiles) {
@@ -1,9 +1,10 @@
-﻿// Copyright (c) 2017-2022, Mudita Sp. z.o.o. All rights reserved.
+﻿// Copyright (c) 2017-2023, Mudita Sp. z.o.o. All rights reserved.
 // For licensing, see https://github.com/mudita/MuditaOS/LICENSE.md
 
 #pragma once
 
 #include "Operation.hpp"
+#include "Audio/Mixer.hpp"
 #include "Audio/Stream.hpp"
 #include "Audio/Endpoint.hpp"
 #include "Audio/decoder/DecoderWorker.hpp"
@@ -39,12 +40,18 @@ namespace audio
         audio::RetCode SetInputGain(float gain) final;
 
         Position GetPosition() final;
+        audio::RetCode Mix(const std::string &filePath,
+                           const audio::PlaybackType &playbackType,
+                           const audio::Token &token) final;
+        audio::RetCode StopMixing(const audio::Token &token) final;
         audio::RetCode SwitchToPriorityProfile(audio::PlaybackType playbackType) final;
 
       private:
         static constexpr auto playbackTimeConstraint = 10ms;
 
         std::unique_ptr<Stream> dataStreamOut;
+        /// declared before the decoder, so it outlives the decoding worker
+        std::unique_ptr<Mixer> mixer;
         std::unique_ptr<Decoder> dec;
         std::unique_ptr<StreamConnection> outputConnection;
 
@@ -31,6 +31,9 @@ namespace audio
         tags = fetchTags();
     }
 
+    Decoder::Decoder(std::unique_ptr<tags::fetcher::Tags> tags) : filePath(tags->filePath), tags(std::move(tags))
+    {}
+
     Decoder::~Decoder()
     {
         if (audioWorker) {
@@ -74,7 +77,7 @@ namespace audio
         return dec;
     }
 
-    void Decoder::startDecodingWorker(const DecoderWorker::EndOfFileCallback &endOfFileCallback)
+    void Decoder::startDecodingWorker(const DecoderWorker::EndOfFileCallback &endOfFileCallback, Mixer *mixer)
     {
         assert(_stream != nullptr);
         if (!audioWorker) {
@@ -83,7 +86,8 @@ namespace audio
                                                 this,
                                                 endOfFileCallback,
                                                 tags->num_channel == 1 ? DecoderWorker::ChannelMode::ForceStereo
-                                                                       : DecoderWorker::ChannelMode::NoConversion);
+                                                                       : DecoderWorker::ChannelMode::NoConversion,
+                                                mixer);
             audioWorker->init();
             audioWorker->run();
         }
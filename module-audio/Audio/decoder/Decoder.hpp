@@ -57,13 +57,16 @@ namespace audio
 
         auto getTraits() const -> Endpoint::Traits override;
 
-        void startDecodingWorker(const DecoderWorker::EndOfFileCallback &endOfFileCallback);
+        void startDecodingWorker(const DecoderWorker::EndOfFileCallback &endOfFileCallback, Mixer *mixer = nullptr);
         void stopDecodingWorker();
 
         // Factory method
         static std::unique_ptr<Decoder> Create(const std::string &path);
 
       protected:
+        /// For sounds which are already decoded, no file is opened
+        explicit Decoder(std::unique_ptr<tags::fetcher::Tags> tags);
+
         virtual auto getBitWidth() -> unsigned int
         {
             return bitsPerSample;
@@ -4,14 +4,17 @@
 #include "DecoderWorker.hpp"
 #include <Audio/AbstractStream.hpp>
 #include <Audio/decoder/Decoder.hpp>
+#include <Audio/Mixer.hpp>
 
 audio::DecoderWorker::DecoderWorker(audio::AbstractStream *audioStreamOut,
                                     Decoder *decoder,
                                     EndOfFileCallback endOfFileCallback,
-                                    ChannelMode mode)
+                                    ChannelMode mode,
+                                    Mixer *mixer)
     : sys::Worker(DecoderWorker::workerName, DecoderWorker::workerPriority, stackDepth), audioStreamOut(audioStreamOut),
       decoder(decoder), endOfFileCallback(std::move(endOfFileCallback)),
-      bufferSize(audioStreamOut->getInputTraits().blockSize / sizeof(BufferInternalType)), channelMode(mode)
+      bufferSize(audioStreamOut->getInputTraits().blockSize / sizeof(BufferInternalType)), channelMode(mode),
+      mixer(mixer)
 {}
 
 audio::DecoderWorker::~DecoderWorker()
@@ -107,6 +110,10 @@ void audio::DecoderWorker::pushAudioData()
             }
         }
 
+        if (mixer != nullptr) {
+            mixer->mix(buffer, samplesRead * readScale);
+        }
+
         if (!audioStreamOut->push(decoderBuffer.get(), samplesRead * sizeof(BufferInternalType) * readScale)) {
             LOG_FATAL("Decoder failed to push to stream.");
             break;
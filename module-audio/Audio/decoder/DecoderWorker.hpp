@@ -1,4 +1,4 @@
-// Copyright (c) 2017-2022, Mudita Sp. z.o.o. All rights reserved.
+// Copyright (c) 2017-2023, Mudita Sp. z.o.o. All rights reserved.
 // For licensing, see https://github.com/mudita/MuditaOS/LICENSE.md
 
 #pragma once
@@ -12,6 +12,7 @@
 namespace audio
 {
     class Decoder;
+    class Mixer;
     class DecoderWorker : public sys::Worker
     {
       public:
@@ -31,7 +32,8 @@ namespace audio
         DecoderWorker(AbstractStream *audioStreamOut,
                       Decoder *decoder,
                       EndOfFileCallback endOfFileCallback,
-                      ChannelMode mode);
+                      ChannelMode mode,
+                      Mixer *mixer = nullptr);
         ~DecoderWorker() override;
 
         virtual auto init(std::list<sys::WorkerQueueInfo> queues = std::list<sys::WorkerQueueInfo>()) -> bool override;
@@ -63,5 +65,6 @@ namespace audio
         const int bufferSize;
         std::unique_ptr<BufferInternalType[]> decoderBuffer;
         ChannelMode channelMode = ChannelMode::NoConversion;
+        Mixer *mixer            = nullptr;
     };
 } // namespace audio
@@ -0,0 +1,152 @@
+// Copyright (c) 2017-2023, Mudita Sp. z.o.o. All rights reserved.
+// For licensing, see https://github.com/mudita/MuditaOS/LICENSE.md
+
+#include "SoundCache.hpp"
+#include "Decoder.hpp"
+
+#include <log/log.hpp>
+
+#include <algorithm>
+
+namespace audio
+{
+    namespace
+    {
+        constexpr std::size_t bytesPerStereoFrame = channel::stereoSound * sizeof(std::int16_t);
+        constexpr std::size_t decodeBlockSamples  = 1024;
+    } // namespace
+
+    SoundCache &SoundCache::get()
+    {
+        static SoundCache instance;
+        return instance;
+    }
+
+    std::shared_ptr<const PcmSound> SoundCache::fetch(const std::string &filePath)
+    {
+        const auto stamp = tags::fetcher::getFileStamp(filePath);
+        if (!stamp.has_value()) {
+            return nullptr;
+        }
+
+        {
+            cpp_freertos::LockGuard lock(mutex);
+            if (const auto it = index.find(filePath); it != index.end()) {
+                if (it->second->stamp == *stamp) {
+                    entries.splice(entries.begin(), entries, it->second);
+                    return it->second->sound;
+                }
+                usedBytes -= sizeOf(*it->second->sound);
+                entries.erase(it->second);
+                index.erase(it);
+            }
+            if (const auto it = rejected.find(filePath); it != rejected.end() && it->second == *stamp) {
+                return nullptr;
+            }
+        }
+
+        auto sound = decodeFile(filePath);
+        if (sound == nullptr) {
+            reject(filePath, *stamp);
+            return nullptr;
+        }
+        insert(Entry{filePath, *stamp, sound});
+        return sound;
+    }
+
+    void SoundCache::clear()
+    {
+        cpp_freertos::LockGuard lock(mutex);
+        index.clear();
+        entries.clear();
+        rejected.clear();
+        usedBytes = 0;
+    }
+
+    std::shared_ptr<const PcmSound> SoundCache::decodeFile(const std::string &filePath)
+    {
+        // tags are cached as well, so long sounds are rejected without opening the decoder
+        auto tags = tags::fetcher::fetchTags(filePath);
+        // mono sounds are cached as stereo, so a frame takes the same space whatever the channel count of the file
+        const auto bytesPerSecond = static_cast<std::size_t>(tags.sample_rate) * bytesPerStereoFrame;
+        // the duration is truncated to full seconds, so only sounds which are too long for sure are rejected here,
+        // the rest is checked while decoding
+        if (tags.total_duration_s * bytesPerSecond > maxSoundBytes) {
+            return nullptr;
+        }
+
+        auto dec = Decoder::Create(filePath);
+        if (dec == nullptr) {
+            return nullptr;
+        }
+        const auto channels = dec->getChannelNumber();
+        if (channels != channel::monoSound && channels != channel::stereoSound) {
+            return nullptr;
+        }
+
+        auto sound = std::make_shared<PcmSound>();
+        sound->samples.reserve(std::min((tags.total_duration_s + 1) * bytesPerSecond, maxSoundBytes) /
+                               sizeof(std::int16_t));
+
+        std::int16_t block[decodeBlockSamples];
+        while (const auto samplesRead = dec->decode(decodeBlockSamples, block)) {
+            if ((sound->samples.size() + samplesRead * (channel::stereoSound / channels)) * sizeof(std::int16_t) >
+                maxSoundBytes) {
+                LOG_DEBUG("Sound too long to be cached");
+                return nullptr;
+            }
+            for (std::uint32_t i = 0; i < samplesRead; ++i) {
+                sound->samples.push_back(block[i]);
+                // pcm mono to stereo conversion done once, instead of on every playback
+                if (channels == channel::monoSound) {
+                    sound->samples.push_back(block[i]);
+                }
+            }
+        }
+        if (sound->samples.empty()) {
+            return nullptr;
+        }
+
+        sound->tags             = std::move(tags);
+        sound->tags.sample_rate = dec->getSampleRate();
+        sound->tags.num_channel = channel::stereoSound;
+        sound->samples.shrink_to_fit();
+        return sound;
+    }
+
+    std::size_t SoundCache::sizeOf(const PcmSound &sound)
+    {
+        return sound.samples.size() * sizeof(std::int16_t);
+    }
+
+    void SoundCache::reject(const std::string &filePath, const tags::fetcher::FileStamp &stamp)
+    {
+        cpp_freertos::LockGuard lock(mutex);
+        if (rejected.size() >= maxRejectedFiles) {
+            rejected.clear();
+        }
+        rejected.insert_or_assign(filePath, stamp);
+    }
+
+    void SoundCache::insert(Entry entry)
+    {
+        cpp_freertos::LockGuard lock(mutex);
+        rejected.erase(entry.filePath);
+        // the same sound could have been decoded by another task in the meantime
+        if (const auto it = index.find(entry.filePath); it != index.end()) {
+            usedBytes -= sizeOf(*it->second->sound);
+            entries.erase(it->second);
+            index.erase(it);
+        }
+
+        usedBytes += sizeOf(*entry.sound);
+        entries.push_front(std::move(entry));
+        index.emplace(entries.front().filePath, entries.begin());
+
+        while (usedBytes > capacityBytes && entries.size() > 1) {
+            usedBytes -= sizeOf(*entries.back().sound);
+            index.erase(entries.back().filePath);
+            entries.pop_back();
+        }
+    }
+} // namespace audio
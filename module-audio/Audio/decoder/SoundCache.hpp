@@ -0,0 +1,67 @@
+// Copyright (c) 2017-2023, Mudita Sp. z.o.o. All rights reserved.
+// For licensing, see https://github.com/mudita/MuditaOS/LICENSE.md
+
+#pragma once
+
+#include <tags_fetcher/TagsFetcher.hpp>
+#include <mutex.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace audio
+{
+    /// Whole sound decoded to interleaved stereo S16 samples
+    struct PcmSound
+    {
+        tags::fetcher::Tags tags;
+        std::vector<std::int16_t> samples;
+    };
+
+    /// Short sounds played over and over again (keypad tones, notifications) decoded once and kept in memory, so
+    /// playing them doesn't open, parse and decode the file each time. Least recently used sounds are dropped when
+    /// the cache doesn't fit in its budget, sounds still being played are kept alive by their decoders.
+    class SoundCache
+    {
+      public:
+        static constexpr std::size_t capacityBytes = 512 * 1024;
+        /// Longer sounds are decoded from the file
+        static constexpr std::size_t maxSoundBytes = 192 * 1024;
+        /// Files which couldn't be cached are remembered, so they aren't checked again on every playback
+        static constexpr std::size_t maxRejectedFiles = 32;
+
+        static SoundCache &get();
+
+        /// Decoded sound from the cache, the file is decoded if it changed since it was cached.
+        /// Returns nullptr if the file can't be decoded or the sound is too long to be cached.
+        std::shared_ptr<const PcmSound> fetch(const std::string &filePath);
+
+        void clear();
+
+      private:
+        struct Entry
+        {
+            std::string filePath;
+            tags::fetcher::FileStamp stamp;
+            std::shared_ptr<const PcmSound> sound;
+        };
+
+        static std::shared_ptr<const PcmSound> decodeFile(const std::string &filePath);
+        static std::size_t sizeOf(const PcmSound &sound);
+
+        void reject(const std::string &filePath, const tags::fetcher::FileStamp &stamp);
+        void insert(Entry entry);
+
+        cpp_freertos::MutexStandard mutex;
+        /// most recently used first
+        std::list<Entry> entries;
+        std::unordered_map<std::string, std::list<Entry>::iterator> index;
+        std::unordered_map<std::string, tags::fetcher::FileStamp> rejected;
+        std::size_t usedBytes = 0;
+    };
+} // namespace audio
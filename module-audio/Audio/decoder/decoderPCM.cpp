@@ -0,0 +1,36 @@
+// Copyright (c) 2017-2023, Mudita Sp. z.o.o. All rights reserved.
+// For licensing, see https://github.com/mudita/MuditaOS/LICENSE.md
+
+#include "decoderPCM.hpp"
+
+#include <algorithm>
+
+namespace audio
+{
+    decoderPCM::decoderPCM(std::shared_ptr<const PcmSound> sound)
+        : Decoder(std::make_unique<tags::fetcher::Tags>(sound->tags)), sound(std::move(sound))
+    {
+        sampleRate    = this->sound->tags.sample_rate;
+        bitsPerSample = 16;
+        chanNumber    = channel::stereoSound;
+        isInitialized = true;
+    }
+
+    std::uint32_t decoderPCM::decode(std::uint32_t samplesToRead, std::int16_t *pcmData)
+    {
+        const auto &samples     = sound->samples;
+        const auto samplesCount = std::min<std::size_t>(samplesToRead, samples.size() - offset);
+        std::copy_n(samples.begin() + offset, samplesCount, pcmData);
+        offset += samplesCount;
+        position = static_cast<float>(offset / chanNumber) / static_cast<float>(sampleRate);
+        return samplesCount;
+    }
+
+    void decoderPCM::setPosition(float pos)
+    {
+        const auto frames = sound->samples.size() / chanNumber;
+        offset            = static_cast<std::size_t>(static_cast<float>(frames) * pos) * chanNumber;
+        offset            = std::min(offset, sound->samples.size());
+        position          = static_cast<float>(offset / chanNumber) / static_cast<float>(sampleRate);
+    }
+} // namespace audio
@@ -0,0 +1,25 @@
+// Copyright (c) 2017-2023, Mudita Sp. z.o.o. All rights reserved.
+// For licensing, see https://github.com/mudita/MuditaOS/LICENSE.md
+
+#pragma once
+
+#include "Decoder.hpp"
+#include "SoundCache.hpp"
+
+namespace audio
+{
+    /// Plays a sound already decoded by the sound cache, decoding is just copying the samples
+    class decoderPCM : public Decoder
+    {
+      public:
+        explicit decoderPCM(std::shared_ptr<const PcmSound> sound);
+
+        std::uint32_t decode(std::uint32_t samplesToRead, std::int16_t *pcmData) override;
+
+        void setPosition(float pos) override;
+
+      private:
+        std::shared_ptr<const PcmSound> sound;
+        std::size_t offset = 0;
+    };
+} // namespace audio
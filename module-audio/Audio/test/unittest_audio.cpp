@@ -4,11 +4,13 @@
 #include <catch2/catch.hpp>
 
 #include "Audio/decoder/Decoder.hpp"
+#include "Audio/decoder/decoderPCM.hpp"
 #include "Audio/AudioCommon.hpp"
 #include "Audio/AudioMux.hpp"
 #include "Audio/Audio.hpp"
 #include "Audio/Operation/Operation.hpp"
 #include <Audio/Operation/RouterOperation.hpp>
+#include <tags_fetcher/HeaderParser.hpp>
 
 using namespace audio;
 
@@ -24,6 +26,64 @@ TEST_CASE("Audio Decoder")
     }
 }
 
+TEST_CASE("Sound cache")
+{
+    const std::string path = "testfiles/audio.wav";
+    SoundCache::get().clear();
+
+    const auto sound = SoundCache::get().fetch(path);
+    REQUIRE(sound);
+    REQUIRE(SoundCache::get().fetch(path) == sound);
+
+    SECTION("Mono sound is cached as stereo")
+    {
+        auto dec = Decoder::Create(path);
+        REQUIRE(dec);
+        REQUIRE(dec->getChannelNumber() == channel::monoSound);
+        REQUIRE(sound->tags.num_channel == channel::stereoSound);
+
+        std::vector<std::int16_t> mono(sound->samples.size());
+        const auto samplesRead = dec->decode(mono.size(), mono.data());
+        REQUIRE(samplesRead * channel::stereoSound == sound->samples.size());
+        for (std::size_t i = 0; i < samplesRead; ++i) {
+            REQUIRE(sound->samples[i * 2] == mono[i]);
+            REQUIRE(sound->samples[i * 2 + 1] == mono[i]);
+        }
+    }
+
+    SECTION("Cached sound is played from memory")
+    {
+        decoderPCM dec{sound};
+        REQUIRE(dec.getSourceFormat() == AudioFormat{sound->tags.sample_rate, 16, channel::stereoSound});
+
+        constexpr std::uint32_t blockSamples = 256;
+        std::vector<std::int16_t> played;
+        std::int16_t block[blockSamples];
+        while (const auto samplesRead = dec.decode(blockSamples, block)) {
+            played.insert(played.end(), block, block + samplesRead);
+        }
+        REQUIRE(played == sound->samples);
+
+        dec.setPosition(0.5f);
+        REQUIRE(dec.decode(blockSamples, block) > 0);
+        REQUIRE(block[0] == sound->samples[sound->samples.size() / 2]);
+    }
+
+    SECTION("Cleared cache decodes the file again")
+    {
+        SoundCache::get().clear();
+        REQUIRE(SoundCache::get().fetch(path) != sound);
+    }
+
+    SECTION("Files which can't be decoded are not cached")
+    {
+        REQUIRE(SoundCache::get().fetch("testfiles/testProfile.json") == nullptr);
+        REQUIRE(SoundCache::get().fetch("testfiles/testProfile.json") == nullptr);
+        REQUIRE(SoundCache::get().fetch("testfiles/missing.wav") == nullptr);
+        REQUIRE(SoundCache::get().fetch(path) == sound);
+    }
+}
+
 TEST_CASE(" Tags fetcher ")
 {
     std::vector<std::string> testExtensions = {"flac", "wav", "mp3"};
@@ -36,6 +96,71 @@ TEST_CASE(" Tags fetcher ")
     }
 }
 
+TEST_CASE("Tags fetcher - cache")
+{
+    const std::string path = "testfiles/audio.flac";
+    const auto stamp       = tags::fetcher::getFileStamp(path);
+    REQUIRE(stamp.has_value());
+
+    SECTION("Cached tags are used while the file is unchanged")
+    {
+        tags::fetcher::cacheTags(*stamp, tags::fetcher::Tags{path, "Cached title"});
+        REQUIRE(tags::fetcher::fetchTags(path).title == "Cached title");
+    }
+
+    SECTION("Stale tags are parsed again")
+    {
+        tags::fetcher::cacheTags(tags::fetcher::FileStamp{.size = stamp->size + 1, .mtime = stamp->mtime},
+                                 tags::fetcher::Tags{path, "Stale title"});
+        REQUIRE(tags::fetcher::fetchTags(path).title == "flac Test track title - łąki");
+    }
+
+    SECTION("Batch keeps the order of files")
+    {
+        constexpr auto workers                    = 2;
+        const std::vector<std::string> extensions = {"flac", "wav", "mp3"};
+        std::vector<std::string> paths;
+        for (const auto &ext : extensions) {
+            paths.push_back("testfiles/audio." + ext);
+        }
+
+        const auto tags = tags::fetcher::fetchTags(paths, workers);
+        REQUIRE(tags.size() == extensions.size());
+        for (std::size_t i = 0; i < extensions.size(); ++i) {
+            REQUIRE(tags[i].filePath == paths[i]);
+            REQUIRE(tags[i].title == extensions[i] + " Test track title - łąki");
+        }
+    }
+}
+
+TEST_CASE("Tags fetcher - header parser matches TagLib")
+{
+    // VBR MP3 without a Xing header and FLAC with a large picture in front of its Vorbis comment included
+    const std::vector<std::string> testFiles = {"audio.mp3", "audio_vbr.mp3", "audio.flac", "audio_picture.flac"};
+
+    for (const auto &file : testFiles) {
+        const auto path = "testfiles/" + file;
+        CAPTURE(path);
+
+        const auto parsed = tags::fetcher::detail::parseHeaders(path);
+        REQUIRE(parsed.has_value());
+        const auto expected = tags::fetcher::detail::parseWithTagLib(path);
+        REQUIRE(expected.has_value());
+
+        REQUIRE(parsed->title == expected->title);
+        REQUIRE(parsed->artist == expected->artist);
+        REQUIRE(parsed->album == expected->album);
+        REQUIRE(parsed->genre == expected->genre);
+        REQUIRE(parsed->comment == expected->comment);
+        REQUIRE(parsed->year == expected->year);
+        REQUIRE(parsed->track == expected->track);
+        REQUIRE(parsed->duration_s == expected->duration_s);
+        REQUIRE(parsed->sample_rate == expected->sample_rate);
+        REQUIRE(parsed->num_channel == expected->num_channel);
+        REQUIRE(parsed->bitrate == expected->bitrate);
+    }
+}
+
 TEST_CASE("Audio settings string creation")
 {
     SECTION("Create volume string for playback loudspeaker, multimedia")
@@ -475,6 +600,41 @@ TEST_CASE("Test AudioMux")
         }
     }
 
+    SECTION("Check Audio::Mux GetMixingInput")
+    {
+        int16_t tokenIdx = 1;
+        std::vector<AudioMux::Input> audioInputs;
+        AudioMux aMux(audioInputs);
+
+        GIVEN("Multimedia playback")
+        {
+            tkId = insertAudio(
+                audioInputs, Audio::State::Playback, PlaybackType::Multimedia, Operation::State::Active, tokenIdx);
+            WHEN("Short sound is played")
+            {
+                auto retInput = aMux.GetMixingInput(PlaybackType::Notifications);
+                REQUIRE(retInput != std::nullopt);
+                REQUIRE((*retInput)->token == Token(tkId));
+            }
+            WHEN("Other playback is started")
+            {
+                REQUIRE(aMux.GetMixingInput(PlaybackType::CallRingtone) == std::nullopt);
+            }
+        }
+        GIVEN("Paused multimedia playback")
+        {
+            insertAudio(
+                audioInputs, Audio::State::Playback, PlaybackType::Multimedia, Operation::State::Paused, tokenIdx);
+            REQUIRE(aMux.GetMixingInput(PlaybackType::KeypadSound) == std::nullopt);
+        }
+        GIVEN("Playback not accepting sounds")
+        {
+            insertAudio(
+                audioInputs, Audio::State::Playback, PlaybackType::Meditation, Operation::State::Active, tokenIdx);
+            REQUIRE(aMux.GetMixingInput(PlaybackType::KeypadSound) == std::nullopt);
+        }
+    }
+
     SECTION("Check Audio::Mux GetRoutingInput")
     {
         int16_t tokenIdx = 1;
@@ -0,0 +1,162 @@
+// Copyright (c) 2017-2023, Mudita Sp. z.o.o. All rights reserved.
+// For licensing, see https://github.com/mudita/MuditaOS/LICENSE.md
+
+#include <catch2/catch.hpp>
+
+#include <Audio/Mixer.hpp>
+
+#include <limits>
+
+using namespace audio;
+
+namespace
+{
+    constexpr std::uint32_t sampleRate = 1000;
+
+    std::shared_ptr<const PcmSound> makeSound(std::size_t frames, std::int16_t value)
+    {
+        auto sound              = std::make_shared<PcmSound>();
+        sound->tags.sample_rate = sampleRate;
+        sound->tags.num_channel = 2;
+        sound->samples          = std::vector<std::int16_t>(frames * 2, value);
+        return sound;
+    }
+
+    std::vector<std::int16_t> mix(Mixer &mixer, std::size_t frames, std::int16_t value)
+    {
+        std::vector<std::int16_t> samples(frames * 2, value);
+        mixer.mix(samples.data(), samples.size());
+        return samples;
+    }
+} // namespace
+
+TEST_CASE("Mixer")
+{
+    Mixer mixer{sampleRate};
+    const Mixer::Policy policy{.gain       = 0.5f,
+                               .duckedGain = 0.5f,
+                               .attack     = std::chrono::milliseconds{10},
+                               .release    = std::chrono::milliseconds{10}};
+
+    SECTION("Playback passes through untouched")
+    {
+        REQUIRE(mix(mixer, 4, 1000) == std::vector<std::int16_t>(8, 1000));
+        REQUIRE(mixer.isIdle());
+    }
+
+    SECTION("Sound of other format is rejected")
+    {
+        auto sound              = std::make_shared<PcmSound>();
+        sound->tags.sample_rate = sampleRate * 2;
+        sound->tags.num_channel = 2;
+        REQUIRE(mixer.add(sound, policy) == RetCode::InvalidFormat);
+        REQUIRE(mixer.isIdle());
+    }
+
+    SECTION("Too many sounds are rejected")
+    {
+        for (std::size_t i = 0; i < Mixer::maxSounds; ++i) {
+            REQUIRE(mixer.add(makeSound(1, 0), policy) == RetCode::Success);
+        }
+        REQUIRE(mixer.add(makeSound(1, 0), policy) == RetCode::Failed);
+    }
+
+    SECTION("Playback is ducked while the sound is mixed")
+    {
+        REQUIRE(mixer.add(makeSound(20, 2000), policy) == RetCode::Success);
+
+        const auto samples = mix(mixer, 20, 2000);
+        // attack - the playback gets quieter frame by frame
+        REQUIRE(samples[0] < 3000);
+        REQUIRE(samples[0] > samples[18]);
+        REQUIRE(samples[0] == samples[1]);
+        // fully ducked playback and the sound at its gain
+        REQUIRE(samples[38] == 2000);
+        REQUIRE_FALSE(mixer.isIdle());
+
+        // release - the playback gets louder once the sound ended
+        const auto released = mix(mixer, 20, 2000);
+        REQUIRE(released[0] < 2000);
+        REQUIRE(released[38] == 2000);
+        REQUIRE(mixer.isIdle());
+    }
+
+    SECTION("Sound shorter than a block")
+    {
+        REQUIRE(mixer.add(makeSound(2, 2000), Mixer::Policy{.gain = 1.0f, .duckedGain = 1.0f}) == RetCode::Success);
+        const auto samples = mix(mixer, 4, 0);
+        REQUIRE(samples == std::vector<std::int16_t>{2000, 2000, 2000, 2000, 0, 0, 0, 0});
+        REQUIRE(mixer.isIdle());
+    }
+
+    SECTION("Mixed samples saturate")
+    {
+        constexpr auto max = std::numeric_limits<std::int16_t>::max();
+        REQUIRE(mixer.add(makeSound(2, max), Mixer::Policy{.gain = 1.0f, .duckedGain = 1.0f}) == RetCode::Success);
+        REQUIRE(mix(mixer, 2, max) == std::vector<std::int16_t>(4, max));
+    }
+
+    SECTION("Ended sounds are reported by their tokens")
+    {
+        std::vector<Token> ended;
+        Mixer reportingMixer{sampleRate, [&ended](const Token &token) { ended.push_back(token); }};
+        const Mixer::Policy noDucking{.gain = 1.0f, .duckedGain = 1.0f};
+        REQUIRE(reportingMixer.add(makeSound(2, 1000), noDucking, Token{1}) == RetCode::Success);
+        REQUIRE(reportingMixer.add(makeSound(6, 1000), noDucking, Token{2}) == RetCode::Success);
+
+        mix(reportingMixer, 4, 0);
+        REQUIRE(ended == std::vector<Token>{Token{1}});
+        mix(reportingMixer, 4, 0);
+        REQUIRE(ended == std::vector<Token>{Token{1}, Token{2}});
+        REQUIRE(reportingMixer.isIdle());
+    }
+
+    SECTION("Stopped sound is not mixed anymore")
+    {
+        const Mixer::Policy noDucking{.gain = 1.0f, .duckedGain = 1.0f};
+        REQUIRE(mixer.add(makeSound(8, 1000), noDucking, Token{1}) == RetCode::Success);
+        REQUIRE(mix(mixer, 2, 0) == std::vector<std::int16_t>(4, 1000));
+
+        REQUIRE(mixer.remove(Token{2}) == RetCode::TokenNotFound);
+        REQUIRE(mixer.remove(Token{1}) == RetCode::Success);
+        REQUIRE(mix(mixer, 2, 0) == std::vector<std::int16_t>(4, 0));
+        REQUIRE(mixer.isIdle());
+        REQUIRE(mixer.remove(Token{1}) == RetCode::TokenNotFound);
+    }
+
+    SECTION("Envelope follows the sound ducking the playback")
+    {
+        const Mixer::Policy slow{.gain       = 0.0f,
+                                 .duckedGain = 0.5f,
+                                 .attack     = std::chrono::milliseconds{20},
+                                 .release    = std::chrono::milliseconds{20}};
+        const Mixer::Policy fast{.gain       = 0.0f,
+                                 .duckedGain = 0.5f,
+                                 .attack     = std::chrono::milliseconds{2},
+                                 .release    = std::chrono::milliseconds{2}};
+
+        // the sound added later doesn't change the envelope of the one already mixed
+        REQUIRE(mixer.add(makeSound(4, 0), slow, Token{1}) == RetCode::Success);
+        REQUIRE(mixer.add(makeSound(30, 0), fast, Token{2}) == RetCode::Success);
+        const auto attack = mix(mixer, 4, 2000);
+        REQUIRE(attack[6] > 1500);
+
+        // the release of the last ended sound is used
+        mix(mixer, 26, 2000);
+        REQUIRE_FALSE(mixer.isIdle());
+        const auto release = mix(mixer, 4, 2000);
+        REQUIRE(release[2] == 2000);
+        REQUIRE(mixer.isIdle());
+    }
+
+    SECTION("Policies")
+    {
+        REQUIRE(Mixer::getPolicy(PlaybackType::KeypadSound).has_value());
+        REQUIRE(Mixer::getPolicy(PlaybackType::Notifications).has_value());
+        REQUIRE(Mixer::getPolicy(PlaybackType::TextMessageRingtone).has_value());
+        REQUIRE_FALSE(Mixer::getPolicy(PlaybackType::CallRingtone).has_value());
+        REQUIRE_FALSE(Mixer::getPolicy(PlaybackType::Alarm).has_value());
+        REQUIRE(Mixer::acceptsSounds(PlaybackType::Multimedia));
+        REQUIRE_FALSE(Mixer::acceptsSounds(PlaybackType::Meditation));
+    }
+}
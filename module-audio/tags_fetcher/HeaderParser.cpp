@@ -0,0 +1,715 @@
+// Copyright (c) 2017-2023, Mudita Sp. z.o.o. All rights reserved.
+// For licensing, see https://github.com/mudita/MuditaOS/LICENSE.md
+
+#include "HeaderParser.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cctype>
+#include <cstdio>
+#include <cstring>
+#include <memory>
+#include <vector>
+
+namespace tags::fetcher::detail
+{
+    namespace
+    {
+        constexpr std::size_t id3v2HeaderSize      = 10;
+        constexpr std::size_t id3v1Size            = 128;
+        constexpr std::size_t apeFooterSize        = 32;
+        constexpr std::size_t maxTextFrameSize     = 4 * 1024;
+        constexpr std::size_t maxVorbisCommentSize = 64 * 1024;
+        constexpr std::size_t mpegSearchWindow     = 4 * 1024;
+
+        struct FileCloser
+        {
+            void operator()(std::FILE *file) const
+            {
+                std::fclose(file);
+            }
+        };
+
+        /// Random access reads of small parts of the file
+        class Reader
+        {
+          public:
+            explicit Reader(const std::string &path) : file{std::fopen(path.c_str(), "rb")}
+            {
+                if (file == nullptr || std::fseek(file.get(), 0, SEEK_END) != 0) {
+                    return;
+                }
+                const auto end = std::ftell(file.get());
+                size           = end > 0 ? static_cast<std::size_t>(end) : 0;
+            }
+
+            [[nodiscard]] bool isOpen() const
+            {
+                return file != nullptr && size > 0;
+            }
+
+            [[nodiscard]] std::size_t length() const
+            {
+                return size;
+            }
+
+            bool read(std::size_t offset, std::uint8_t *data, std::size_t count)
+            {
+                if (offset > size || count > size - offset) {
+                    return false;
+                }
+                if (std::fseek(file.get(), static_cast<long>(offset), SEEK_SET) != 0) {
+                    return false;
+                }
+                return std::fread(data, 1, count, file.get()) == count;
+            }
+
+            std::optional<std::vector<std::uint8_t>> read(std::size_t offset, std::size_t count)
+            {
+                std::vector<std::uint8_t> data(count);
+                if (!read(offset, data.data(), count)) {
+                    return std::nullopt;
+                }
+                return data;
+            }
+
+          private:
+            std::unique_ptr<std::FILE, FileCloser> file;
+            std::size_t size = 0;
+        };
+
+        std::uint32_t readBigEndian32(const std::uint8_t *data)
+        {
+            return static_cast<std::uint32_t>(data[0]) << 24 | static_cast<std::uint32_t>(data[1]) << 16 |
+                   static_cast<std::uint32_t>(data[2]) << 8 | data[3];
+        }
+
+        std::uint32_t readLittleEndian32(const std::uint8_t *data)
+        {
+            return static_cast<std::uint32_t>(data[3]) << 24 | static_cast<std::uint32_t>(data[2]) << 16 |
+                   static_cast<std::uint32_t>(data[1]) << 8 | data[0];
+        }
+
+        std::uint32_t readSyncSafe32(const std::uint8_t *data)
+        {
+            return static_cast<std::uint32_t>(data[0] & 0x7f) << 21 | static_cast<std::uint32_t>(data[1] & 0x7f) << 14 |
+                   static_cast<std::uint32_t>(data[2] & 0x7f) << 7 | (data[3] & 0x7f);
+        }
+
+        bool startsWith(const std::uint8_t *data, const char *text)
+        {
+            return std::memcmp(data, text, std::strlen(text)) == 0;
+        }
+
+        /// Same semantics as TagLib's String::toInt - leading digits only, "2020-01-01" and "9/12" give 2020 and 9
+        std::uint32_t leadingNumber(const std::string &text)
+        {
+            std::uint32_t value = 0;
+            for (const auto c : text) {
+                if (std::isdigit(static_cast<unsigned char>(c)) == 0) {
+                    break;
+                }
+                value = value * 10 + static_cast<std::uint32_t>(c - '0');
+            }
+            return value;
+        }
+
+        /// Multiple values of a field are joined with a space, as TagLib's StringList::toString does
+        void appendValue(std::string &field, const std::string &value)
+        {
+            if (!field.empty()) {
+                field += ' ';
+            }
+            field += value;
+        }
+
+        void appendUtf8(std::string &out, std::uint32_t codePoint)
+        {
+            if (codePoint < 0x80) {
+                out += static_cast<char>(codePoint);
+            }
+            else if (codePoint < 0x800) {
+                out += static_cast<char>(0xc0 | (codePoint >> 6));
+                out += static_cast<char>(0x80 | (codePoint & 0x3f));
+            }
+            else if (codePoint < 0x10000) {
+                out += static_cast<char>(0xe0 | (codePoint >> 12));
+                out += static_cast<char>(0x80 | ((codePoint >> 6) & 0x3f));
+                out += static_cast<char>(0x80 | (codePoint & 0x3f));
+            }
+            else {
+                out += static_cast<char>(0xf0 | (codePoint >> 18));
+                out += static_cast<char>(0x80 | ((codePoint >> 12) & 0x3f));
+                out += static_cast<char>(0x80 | ((codePoint >> 6) & 0x3f));
+                out += static_cast<char>(0x80 | (codePoint & 0x3f));
+            }
+        }
+
+        namespace id3v2
+        {
+            enum class Encoding : std::uint8_t
+            {
+                Latin1  = 0,
+                Utf16   = 1,
+                Utf16BE = 2,
+                Utf8    = 3
+            };
+
+            bool isWide(Encoding encoding)
+            {
+                return encoding == Encoding::Utf16 || encoding == Encoding::Utf16BE;
+            }
+
+            /// Position of the string terminator starting at `offset`, or `size` if the string is not terminated
+            std::size_t findTerminator(Encoding encoding,
+                                       const std::uint8_t *data,
+                                       std::size_t size,
+                                       std::size_t offset)
+            {
+                if (isWide(encoding)) {
+                    for (auto i = offset; i + 1 < size; i += 2) {
+                        if (data[i] == 0 && data[i + 1] == 0) {
+                            return i;
+                        }
+                    }
+                    return size;
+                }
+                const auto end = std::find(data + offset, data + size, 0);
+                return static_cast<std::size_t>(end - data);
+            }
+
+            std::string decodeString(Encoding encoding, const std::uint8_t *data, std::size_t size)
+            {
+                std::string out;
+                switch (encoding) {
+                case Encoding::Latin1:
+                    for (std::size_t i = 0; i < size; ++i) {
+                        appendUtf8(out, data[i]);
+                    }
+                    break;
+                case Encoding::Utf8:
+                    out.assign(reinterpret_cast<const char *>(data), size);
+                    break;
+                case Encoding::Utf16:
+                case Encoding::Utf16BE: {
+                    bool bigEndian = encoding == Encoding::Utf16BE;
+                    std::size_t i  = 0;
+                    if (encoding == Encoding::Utf16 && size >= 2) {
+                        if (data[0] == 0xfe && data[1] == 0xff) {
+                            bigEndian = true;
+                            i         = 2;
+                        }
+                        else if (data[0] == 0xff && data[1] == 0xfe) {
+                            i = 2;
+                        }
+                    }
+                    auto unitAt = [&](std::size_t pos) -> std::uint32_t {
+                        return bigEndian ? (data[pos] << 8 | data[pos + 1]) : (data[pos + 1] << 8 | data[pos]);
+                    };
+                    for (; i + 1 < size; i += 2) {
+                        auto codePoint = unitAt(i);
+                        if (codePoint >= 0xd800 && codePoint < 0xdc00 && i + 3 < size) {
+                            const auto low = unitAt(i + 2);
+                            if (low >= 0xdc00 && low < 0xe000) {
+                                codePoint = 0x10000 + ((codePoint - 0xd800) << 10) + (low - 0xdc00);
+                                i += 2;
+                            }
+                        }
+                        appendUtf8(out, codePoint);
+                    }
+                } break;
+                }
+                return out;
+            }
+
+            /// Text information frame - may carry several terminator separated values
+            std::optional<std::string> decodeTextFrame(const std::vector<std::uint8_t> &frame)
+            {
+                if (frame.empty() || frame[0] > static_cast<std::uint8_t>(Encoding::Utf8)) {
+                    return std::nullopt;
+                }
+                const auto encoding   = static_cast<Encoding>(frame[0]);
+                const auto terminator = isWide(encoding) ? 2U : 1U;
+
+                std::string text;
+                std::size_t offset = 1;
+                while (offset < frame.size()) {
+                    const auto end = findTerminator(encoding, frame.data(), frame.size(), offset);
+                    if (end > offset) {
+                        appendValue(text, decodeString(encoding, frame.data() + offset, end - offset));
+                    }
+                    offset = end + terminator;
+                }
+                return text;
+            }
+
+            struct Comment
+            {
+                std::string description;
+                std::string text;
+            };
+
+            /// COMM frame: encoding, language, terminated short description and the comment itself
+            std::optional<Comment> decodeCommentFrame(const std::vector<std::uint8_t> &frame)
+            {
+                constexpr std::size_t languageSize = 3;
+                if (frame.size() < 1 + languageSize || frame[0] > static_cast<std::uint8_t>(Encoding::Utf8)) {
+                    return std::nullopt;
+                }
+                const auto encoding         = static_cast<Encoding>(frame[0]);
+                const auto descriptionStart = 1 + languageSize;
+                const auto descriptionEnd   = findTerminator(encoding, frame.data(), frame.size(), descriptionStart);
+                const auto textStart = std::min(frame.size(), descriptionEnd + (isWide(encoding) ? 2U : 1U));
+                const auto textEnd   = findTerminator(encoding, frame.data(), frame.size(), textStart);
+
+                return Comment{
+                    decodeString(encoding, frame.data() + descriptionStart, descriptionEnd - descriptionStart),
+                    decodeString(encoding, frame.data() + textStart, textEnd - textStart)};
+            }
+
+            /// Parses the ID3v2 tag at the beginning of the file and returns the offset of the first byte behind it
+            std::optional<std::size_t> parse(Reader &reader, ParsedTags &tags)
+            {
+                std::array<std::uint8_t, id3v2HeaderSize> header{};
+                if (!reader.read(0, header.data(), header.size()) || !startsWith(header.data(), "ID3")) {
+                    return std::nullopt;
+                }
+
+                constexpr std::uint8_t unsynchronisationFlag = 0x80;
+                constexpr std::uint8_t extendedHeaderFlag    = 0x40;
+                constexpr std::uint8_t footerFlag            = 0x10;
+
+                const auto majorVersion = header[3];
+                const auto flags        = header[5];
+                if ((majorVersion != 3 && majorVersion != 4) || (flags & unsynchronisationFlag) != 0) {
+                    return std::nullopt;
+                }
+
+                const std::size_t tagEnd = id3v2HeaderSize + readSyncSafe32(&header[6]);
+                std::size_t position     = id3v2HeaderSize;
+                if ((flags & extendedHeaderFlag) != 0) {
+                    std::array<std::uint8_t, 4> extendedSize{};
+                    if (!reader.read(position, extendedSize.data(), extendedSize.size())) {
+                        return std::nullopt;
+                    }
+                    position += majorVersion == 4 ? readSyncSafe32(extendedSize.data())
+                                                  : extendedSize.size() + readBigEndian32(extendedSize.data());
+                }
+
+                // compression, encryption and frame level unsynchronisation are left to TagLib
+                const std::uint8_t unsupportedFormatFlags = majorVersion == 4 ? 0x0f : 0xe0;
+
+                std::optional<std::string> year;
+                std::optional<std::string> track;
+                std::optional<Comment> comment;
+                while (position + id3v2HeaderSize <= tagEnd) {
+                    std::array<std::uint8_t, id3v2HeaderSize> frameHeader{};
+                    if (!reader.read(position, frameHeader.data(), frameHeader.size())) {
+                        return std::nullopt;
+                    }
+                    if (frameHeader[0] == 0) {
+                        break; // padding
+                    }
+
+                    const std::string id(reinterpret_cast<const char *>(frameHeader.data()), 4);
+                    const std::size_t frameSize =
+                        majorVersion == 4 ? readSyncSafe32(&frameHeader[4]) : readBigEndian32(&frameHeader[4]);
+                    const auto dataStart = position + id3v2HeaderSize;
+                    position             = dataStart + frameSize;
+                    if (position > tagEnd) {
+                        return std::nullopt;
+                    }
+
+                    std::string *field = nullptr;
+                    if (id == "TIT2") {
+                        field = &tags.title;
+                    }
+                    else if (id == "TPE1") {
+                        field = &tags.artist;
+                    }
+                    else if (id == "TALB") {
+                        field = &tags.album;
+                    }
+                    else if (id == "TCON") {
+                        field = &tags.genre;
+                    }
+                    else if (id != "TYER" && id != "TDRC" && id != "TRCK" && id != "COMM") {
+                        continue; // pictures and other large frames are skipped without being read
+                    }
+
+                    if ((frameHeader[9] & unsupportedFormatFlags) != 0 || frameSize > maxTextFrameSize) {
+                        return std::nullopt;
+                    }
+                    const auto frame = reader.read(dataStart, frameSize);
+                    if (!frame.has_value()) {
+                        return std::nullopt;
+                    }
+
+                    if (id == "COMM") {
+                        auto decoded = decodeCommentFrame(*frame);
+                        if (!decoded.has_value()) {
+                            return std::nullopt;
+                        }
+                        // the comment without description wins, the first one otherwise
+                        if (!comment.has_value() || (!comment->description.empty() && decoded->description.empty())) {
+                            comment = std::move(decoded);
+                        }
+                        continue;
+                    }
+
+                    auto text = decodeTextFrame(*frame);
+                    if (!text.has_value()) {
+                        return std::nullopt;
+                    }
+                    if (field != nullptr) {
+                        if (field->empty()) {
+                            *field = std::move(*text);
+                        }
+                    }
+                    else if (id == "TRCK") {
+                        if (!track.has_value()) {
+                            track = std::move(*text);
+                        }
+                    }
+                    else if (!year.has_value()) { // TYER or TDRC - TagLib merges both into the recording time
+                        year = std::move(*text);
+                    }
+                }
+
+                // numeric genre references need the ID3v1 genre table
+                if (!tags.genre.empty() && (tags.genre.front() == '(' || leadingNumber(tags.genre) != 0)) {
+                    return std::nullopt;
+                }
+                if (year.has_value()) {
+                    tags.year = leadingNumber(year->substr(0, 4));
+                }
+                if (track.has_value()) {
+                    tags.track = leadingNumber(*track);
+                }
+                if (comment.has_value()) {
+                    tags.comment = std::move(comment->text);
+                }
+
+                return tagEnd + ((majorVersion == 4 && (flags & footerFlag) != 0) ? id3v2HeaderSize : 0);
+            }
+        } // namespace id3v2
+
+        /// Number of bytes taken by tags appended to the end of the file, std::nullopt if the fast path can't tell
+        std::optional<std::size_t> trailingTagsSize(Reader &reader, bool allowId3v1)
+        {
+            std::array<std::uint8_t, id3v1Size> trailer{};
+            if (reader.length() < trailer.size() ||
+                !reader.read(reader.length() - trailer.size(), trailer.data(), trailer.size())) {
+                return 0;
+            }
+            // APE tags are rare, leave them to TagLib
+            const auto apeFooter = trailer.data() + trailer.size() - apeFooterSize;
+            if (startsWith(apeFooter, "APETAGEX")) {
+                return std::nullopt;
+            }
+            if (!startsWith(trailer.data(), "TAG")) {
+                return 0;
+            }
+            if (!allowId3v1) {
+                return std::nullopt;
+            }
+            return id3v1Size;
+        }
+
+        namespace mpeg
+        {
+            struct FrameHeader
+            {
+                std::uint32_t bitrate         = 0;
+                std::uint32_t sampleRate      = 0;
+                std::uint32_t channels        = 0;
+                std::uint32_t samplesPerFrame = 0;
+                std::size_t sideInfoSize      = 0;
+            };
+
+            /// Only Layer III is handled - MPEG-1/2 Layer I/II files are left to TagLib
+            std::optional<FrameHeader> parseFrameHeader(const std::uint8_t *data)
+            {
+                constexpr std::array<std::uint32_t, 16> mpeg1Bitrates{
+                    0, 32, 40, 48, 56, 64, 80, 96, 112, 128, 160, 192, 224, 256, 320, 0};
+                constexpr std::array<std::uint32_t, 16> mpeg2Bitrates{
+                    0, 8, 16, 24, 32, 40, 48, 56, 64, 80, 96, 112, 128, 144, 160, 0};
+                constexpr std::array<std::uint32_t, 4> mpeg1SampleRates{44100, 48000, 32000, 0};
+
+                constexpr std::uint8_t mpeg1      = 3;
+                constexpr std::uint8_t mpeg2      = 2;
+                constexpr std::uint8_t mpeg25     = 0;
+                constexpr std::uint8_t layer3     = 1;
+                constexpr std::uint8_t monoMode   = 3;
+
+                if (data[0] != 0xff || (data[1] & 0xe0) != 0xe0) {
+                    return std::nullopt;
+                }
+                const auto version      = (data[1] >> 3) & 0x03;
+                const auto layer        = (data[1] >> 1) & 0x03;
+                const auto bitrateIndex = data[2] >> 4;
+                const auto rateIndex    = (data[2] >> 2) & 0x03;
+                const auto channelMode  = data[3] >> 6;
+                if ((version != mpeg1 && version != mpeg2 && version != mpeg25) || layer != layer3) {
+                    return std::nullopt;
+                }
+
+                FrameHeader header;
+                const auto isMpeg1 = version == mpeg1;
+                const auto isMono  = channelMode == monoMode;
+                header.bitrate     = isMpeg1 ? mpeg1Bitrates[bitrateIndex] : mpeg2Bitrates[bitrateIndex];
+                header.sampleRate  = mpeg1SampleRates[rateIndex] / (isMpeg1 ? 1 : (version == mpeg2 ? 2 : 4));
+                if (header.bitrate == 0 || header.sampleRate == 0) {
+                    return std::nullopt;
+                }
+                header.channels        = isMono ? 1 : 2;
+                header.samplesPerFrame = isMpeg1 ? 1152 : 576;
+                header.sideInfoSize    = isMpeg1 ? (isMono ? 17 : 32) : (isMono ? 9 : 17);
+                return header;
+            }
+
+            /// Computes audio properties the way TagLib does - from the Xing/VBRI header if present, CBR otherwise
+            bool parse(Reader &reader, std::size_t audioStart, std::size_t trailingSize, ParsedTags &tags)
+            {
+                if (audioStart + trailingSize >= reader.length()) {
+                    return false;
+                }
+                const auto window = std::min(mpegSearchWindow, reader.length() - audioStart);
+                const auto data   = reader.read(audioStart, window);
+                if (!data.has_value()) {
+                    return false;
+                }
+
+                constexpr std::size_t frameHeaderSize = 4;
+                std::optional<FrameHeader> header;
+                std::size_t frameOffset = 0;
+                for (; frameOffset + frameHeaderSize <= window; ++frameOffset) {
+                    if ((header = parseFrameHeader(data->data() + frameOffset)).has_value()) {
+                        break;
+                    }
+                }
+                if (!header.has_value()) {
+                    return false;
+                }
+
+                std::uint32_t frames = 0;
+                std::uint32_t bytes  = 0;
+                const auto xing      = frameOffset + frameHeaderSize + header->sideInfoSize;
+                const auto vbri      = frameOffset + frameHeaderSize + 32;
+                if (xing + 16 <= window && (startsWith(&(*data)[xing], "Xing") || startsWith(&(*data)[xing], "Info"))) {
+                    constexpr std::uint8_t framesAndBytesPresent = 0x03;
+                    if (((*data)[xing + 7] & framesAndBytesPresent) == framesAndBytesPresent) {
+                        frames = readBigEndian32(&(*data)[xing + 8]);
+                        bytes  = readBigEndian32(&(*data)[xing + 12]);
+                    }
+                }
+                else if (vbri + 18 <= window && startsWith(&(*data)[vbri], "VBRI")) {
+                    bytes  = readBigEndian32(&(*data)[vbri + 10]);
+                    frames = readBigEndian32(&(*data)[vbri + 14]);
+                }
+
+                tags.sample_rate = header->sampleRate;
+                tags.num_channel = header->channels;
+                if (frames > 0) {
+                    const auto frameMs  = header->samplesPerFrame * 1000.0 / header->sampleRate;
+                    const auto lengthMs = frameMs * frames;
+                    tags.duration_s     = static_cast<std::uint32_t>(lengthMs + 0.5) / 1000;
+                    tags.bitrate        = static_cast<std::uint32_t>(bytes * 8.0 / lengthMs + 0.5);
+                }
+                else {
+                    const auto streamLength = reader.length() - (audioStart + frameOffset) - trailingSize;
+                    tags.bitrate            = header->bitrate;
+                    tags.duration_s = static_cast<std::uint32_t>(streamLength * 8.0 / header->bitrate + 0.5) / 1000;
+                }
+                return true;
+            }
+        } // namespace mpeg
+
+        std::optional<ParsedTags> parseMp3(Reader &reader)
+        {
+            ParsedTags tags;
+            const auto audioStart = id3v2::parse(reader, tags);
+            if (!audioStart.has_value()) {
+                return std::nullopt;
+            }
+            // some encoders put ID3v2 in front of FLAC stream too
+            std::array<std::uint8_t, 4> magic{};
+            if (!reader.read(*audioStart, magic.data(), magic.size()) || startsWith(magic.data(), "fLaC")) {
+                return std::nullopt;
+            }
+            // ID3v1 may only fill in what ID3v2 lacks - with a complete ID3v2 tag it just has to be skipped
+            const auto complete = !tags.title.empty() && !tags.artist.empty() && !tags.album.empty() &&
+                                  !tags.genre.empty() && !tags.comment.empty() && tags.year != 0 && tags.track != 0;
+            const auto trailingSize = trailingTagsSize(reader, complete);
+            if (!trailingSize.has_value() || !mpeg::parse(reader, *audioStart, *trailingSize, tags)) {
+                return std::nullopt;
+            }
+            return tags;
+        }
+
+        namespace flac
+        {
+            enum class BlockType : std::uint8_t
+            {
+                StreamInfo    = 0,
+                VorbisComment = 4
+            };
+
+            void parseVorbisComment(const std::vector<std::uint8_t> &block, ParsedTags &tags)
+            {
+                std::string description;
+                std::string comment;
+                std::string date;
+                std::string trackNumber;
+
+                std::size_t offset = 0;
+                auto readLength    = [&](std::uint32_t &length) {
+                    if (offset + 4 > block.size()) {
+                        return false;
+                    }
+                    length = readLittleEndian32(&block[offset]);
+                    offset += 4;
+                    return length <= block.size() - offset;
+                };
+
+                std::uint32_t length = 0;
+                if (!readLength(length)) {
+                    return;
+                }
+                offset += length; // vendor string
+
+                std::uint32_t count = 0;
+                if (!readLength(count)) {
+                    return;
+                }
+                for (std::uint32_t i = 0; i < count && readLength(length); ++i) {
+                    const std::string entry(reinterpret_cast<const char *>(&block[offset]), length);
+                    offset += length;
+
+                    const auto separator = entry.find('=');
+                    if (separator == std::string::npos) {
+                        continue;
+                    }
+                    auto key = entry.substr(0, separator);
+                    std::transform(
+                        key.begin(), key.end(), key.begin(), [](unsigned char c) { return std::toupper(c); });
+                    const auto value = entry.substr(separator + 1);
+
+                    if (key == "TITLE") {
+                        appendValue(tags.title, value);
+                    }
+                    else if (key == "ARTIST") {
+                        appendValue(tags.artist, value);
+                    }
+                    else if (key == "ALBUM") {
+                        appendValue(tags.album, value);
+                    }
+                    else if (key == "GENRE") {
+                        appendValue(tags.genre, value);
+                    }
+                    else if (key == "DESCRIPTION") {
+                        appendValue(description, value);
+                    }
+                    else if (key == "COMMENT") {
+                        appendValue(comment, value);
+                    }
+                    else if (key == "DATE" && date.empty()) {
+                        date = value;
+                    }
+                    else if (key == "TRACKNUMBER" && trackNumber.empty()) {
+                        trackNumber = value;
+                    }
+                }
+
+                tags.comment = description.empty() ? comment : description;
+                tags.year    = leadingNumber(date);
+                tags.track   = leadingNumber(trackNumber);
+            }
+
+            std::optional<ParsedTags> parse(Reader &reader)
+            {
+                constexpr std::size_t markerSize      = 4;
+                constexpr std::size_t blockHeaderSize = 4;
+                constexpr std::size_t streamInfoSize  = 34;
+                constexpr std::uint8_t lastBlockFlag  = 0x80;
+
+                std::array<std::uint8_t, markerSize> marker{};
+                if (!reader.read(0, marker.data(), marker.size()) || !startsWith(marker.data(), "fLaC")) {
+                    return std::nullopt;
+                }
+
+                ParsedTags tags;
+                std::uint64_t sampleFrames = 0;
+                bool streamInfoFound       = false;
+                std::size_t position       = markerSize;
+                bool lastBlock             = false;
+                while (!lastBlock) {
+                    std::array<std::uint8_t, blockHeaderSize> blockHeader{};
+                    if (!reader.read(position, blockHeader.data(), blockHeader.size())) {
+                        return std::nullopt;
+                    }
+                    lastBlock            = (blockHeader[0] & lastBlockFlag) != 0;
+                    const auto type      = static_cast<BlockType>(blockHeader[0] & ~lastBlockFlag);
+                    const auto blockSize = readBigEndian32(blockHeader.data()) & 0x00ffffff;
+                    const auto dataStart = position + blockHeader.size();
+                    position             = dataStart + blockSize;
+
+                    if (type == BlockType::StreamInfo && blockSize >= streamInfoSize) {
+                        std::array<std::uint8_t, streamInfoSize> info{};
+                        if (!reader.read(dataStart, info.data(), info.size())) {
+                            return std::nullopt;
+                        }
+                        tags.sample_rate = static_cast<std::uint32_t>(info[10]) << 12 | info[11] << 4 | info[12] >> 4;
+                        tags.num_channel = ((info[12] >> 1) & 0x07) + 1;
+                        streamInfoFound  = true;
+
+                        sampleFrames = static_cast<std::uint64_t>(info[13] & 0x0f) << 32 | readBigEndian32(&info[14]);
+                    }
+                    else if (type == BlockType::VorbisComment) {
+                        if (blockSize > maxVorbisCommentSize) {
+                            return std::nullopt;
+                        }
+                        const auto block = reader.read(dataStart, blockSize);
+                        if (!block.has_value()) {
+                            return std::nullopt;
+                        }
+                        parseVorbisComment(*block, tags);
+                    }
+                    // pictures, seek tables and padding are skipped without being read
+                }
+
+                const auto trailingSize = trailingTagsSize(reader, false);
+                if (!streamInfoFound || !trailingSize.has_value() || position + *trailingSize > reader.length()) {
+                    return std::nullopt;
+                }
+                if (sampleFrames > 0 && tags.sample_rate > 0) {
+                    const auto streamLength = reader.length() - position - *trailingSize;
+                    const auto lengthMs     = static_cast<double>(sampleFrames) * 1000.0 / tags.sample_rate;
+                    tags.duration_s         = static_cast<std::uint32_t>(lengthMs + 0.5) / 1000;
+                    tags.bitrate            = static_cast<std::uint32_t>(streamLength * 8.0 / lengthMs + 0.5);
+                }
+                return tags;
+            }
+        } // namespace flac
+    }     // namespace
+
+    std::optional<ParsedTags> parseHeaders(const std::string &filePath)
+    {
+        Reader reader{filePath};
+        if (!reader.isOpen()) {
+            return std::nullopt;
+        }
+
+        std::array<std::uint8_t, 4> magic{};
+        if (!reader.read(0, magic.data(), magic.size())) {
+            return std::nullopt;
+        }
+        if (startsWith(magic.data(), "ID3")) {
+            return parseMp3(reader);
+        }
+        if (startsWith(magic.data(), "fLaC")) {
+            return flac::parse(reader);
+        }
+        return std::nullopt;
+    }
+} // namespace tags::fetcher::detail
@@ -0,0 +1,35 @@
+// Copyright (c) 2017-2023, Mudita Sp. z.o.o. All rights reserved.
+// For licensing, see https://github.com/mudita/MuditaOS/LICENSE.md
+
+#pragma once
+
+#include <cstdint>
+#include <optional>
+#include <string>
+
+namespace tags::fetcher::detail
+{
+    /// Raw tags and audio properties, before title fallback and duration split are applied
+    struct ParsedTags
+    {
+        std::string title;
+        std::string artist;
+        std::string album;
+        std::string genre;
+        std::string comment;
+        std::uint32_t year        = 0;
+        std::uint32_t track       = 0;
+        std::uint32_t duration_s  = 0;
+        std::uint32_t sample_rate = 0;
+        std::uint32_t num_channel = 0;
+        std::uint32_t bitrate     = 0;
+    };
+
+    /// Reads tags straight from the ID3v2 (MP3) or Vorbis comment (FLAC) headers, touching only the first few
+    /// kilobytes of the file. Returns std::nullopt whenever the file uses a feature the fast path does not handle
+    /// (other containers, unsynchronisation, compressed frames, numeric genres...) - TagLib has to be used then.
+    std::optional<ParsedTags> parseHeaders(const std::string &filePath);
+
+    /// Reads tags with TagLib, which handles every supported format but reads whole metadata blocks
+    std::optional<ParsedTags> parseWithTagLib(const std::string &filePath);
+} // namespace tags::fetcher::detail
@@ -2,14 +2,29 @@
 // For licensing, see https://github.com/mudita/MuditaOS/LICENSE.md
 
 #include "TagsFetcher.hpp"
+#include "HeaderParser.hpp"
 #include <riff/wav/wavproperties.h>
 #include "fileref.h"
+#include <mutex.hpp>
 #include <time/time_constants.hpp>
 
+#include <algorithm>
+#include <list>
+#include <unordered_map>
+#include <sys/stat.h>
+
+#if defined(TARGET_Linux)
+#include <atomic>
+#include <thread>
+#endif
+
 namespace tags::fetcher
 {
     namespace
     {
+        /// Enough to cover the songs repository window of the music player
+        constexpr std::size_t tagsCacheCapacity = 32;
+
         bool isFormatSupported(TagLib::AudioProperties *properties)
         {
             /* WAV formats from taglib wav properties :
@@ -33,64 +48,223 @@ namespace tags::fetcher
             }
             return path;
         }
+    } // namespace
+
+    std::optional<detail::ParsedTags> detail::parseWithTagLib(const std::string &filePath)
+    {
+        const TagLib::ConstMemoryConstrainedFileRef tagReader(filePath.c_str(), TAGSFETCHER_MAX_TAG_SIZE);
+        const auto tags = tagReader.tag();
+        if (!tagReader.isNull() && (tags != nullptr)) {
+            const auto properties = tagReader.audioProperties();
+
+            if (!isFormatSupported(properties)) {
+                return std::nullopt;
+            }
 
-        std::optional<Tags> fetchTagsInternal(const std::string &filePath)
+            constexpr bool unicode = true;
+
+            return detail::ParsedTags{.title       = tags->title().to8Bit(unicode),
+                                      .artist      = tags->artist().to8Bit(unicode),
+                                      .album       = tags->album().to8Bit(unicode),
+                                      .genre       = tags->genre().to8Bit(unicode),
+                                      .comment     = tags->comment().to8Bit(unicode),
+                                      .year        = tags->year(),
+                                      .track       = tags->track(),
+                                      .duration_s  = static_cast<uint32_t>(properties->length()),
+                                      .sample_rate = static_cast<uint32_t>(properties->sampleRate()),
+                                      .num_channel = static_cast<uint32_t>(properties->channels()),
+                                      .bitrate     = static_cast<uint32_t>(properties->bitrate())};
+        }
+
+        return {};
+    }
+
+    namespace
+    {
+        Tags createTags(const std::string &filePath, const detail::ParsedTags &parsed)
         {
-            const TagLib::ConstMemoryConstrainedFileRef tagReader(filePath.c_str(), TAGSFETCHER_MAX_TAG_SIZE);
-            const auto tags = tagReader.tag();
-            if (!tagReader.isNull() && (tags != nullptr)) {
-                const auto properties = tagReader.audioProperties();
+            auto title = parsed.title;
+            if (title.empty()) {
+                title = getTitleFromFilePath(filePath);
+            }
 
-                if (!isFormatSupported(properties)) {
-                    return std::nullopt;
-                }
+            const uint32_t total_duration_s = parsed.duration_s;
+            const uint32_t duration_min     = total_duration_s / utils::time::secondsInMinute;
+            const uint32_t duration_hour    = duration_min / utils::time::secondsInMinute;
+            const uint32_t duration_sec     = total_duration_s % utils::time::secondsInMinute;
 
-                constexpr bool unicode = true;
+            return Tags{total_duration_s,
+                        duration_hour,
+                        duration_min,
+                        duration_sec,
+                        parsed.sample_rate,
+                        parsed.num_channel,
+                        parsed.bitrate,
+                        parsed.artist,
+                        parsed.genre,
+                        title,
+                        parsed.album,
+                        parsed.year,
+                        filePath,
+                        parsed.comment,
+                        parsed.track};
+        }
 
-                const auto artist  = tags->artist().to8Bit(unicode);
-                const auto album   = tags->album().to8Bit(unicode);
-                const auto genre   = tags->genre().to8Bit(unicode);
-                const auto year    = tags->year();
-                const auto comment = tags->comment().to8Bit(unicode);
-                const auto track   = tags->track();
+        /// Doesn't touch the cache, so it may be run by threads which are not RTOS tasks
+        Tags parseTags(const std::string &filePath)
+        {
+            auto parsed = detail::parseHeaders(filePath);
+            if (!parsed.has_value()) {
+                parsed = detail::parseWithTagLib(filePath);
+            }
+            if (!parsed.has_value()) {
+                return Tags{filePath, getTitleFromFilePath(filePath)};
+            }
+            return createTags(filePath, *parsed);
+        }
 
-                auto title = tags->title().to8Bit(unicode);
-                if (title.empty()) {
-                    title = getTitleFromFilePath(filePath);
+        /// Least recently used tags, keyed by path and validated with the file stamp
+        class TagsCache
+        {
+          public:
+            static TagsCache &get()
+            {
+                static TagsCache instance;
+                return instance;
+            }
+
+            std::optional<Tags> find(const std::string &filePath, const FileStamp &stamp)
+            {
+                cpp_freertos::LockGuard lock(mutex);
+                const auto it = index.find(filePath);
+                if (it == index.end()) {
+                    return std::nullopt;
                 }
+                if (!(it->second->stamp == stamp)) {
+                    entries.erase(it->second);
+                    index.erase(it);
+                    return std::nullopt;
+                }
+                entries.splice(entries.begin(), entries, it->second);
+                return it->second->tags;
+            }
 
-                const uint32_t total_duration_s = properties->length();
-                const uint32_t duration_min     = total_duration_s / utils::time::secondsInMinute;
-                const uint32_t duration_hour    = duration_min / utils::time::secondsInMinute;
-                const uint32_t duration_sec     = total_duration_s % utils::time::secondsInMinute;
-                const uint32_t sample_rate      = properties->sampleRate();
-                const uint32_t num_channel      = properties->channels();
-                const uint32_t bitrate          = properties->bitrate();
-
-                return Tags{total_duration_s,
-                            duration_hour,
-                            duration_min,
-                            duration_sec,
-                            sample_rate,
-                            num_channel,
-                            bitrate,
-                            artist,
-                            genre,
-                            title,
-                            album,
-                            year,
-                            filePath,
-                            comment,
-                            track};
+            void insert(const FileStamp &stamp, const Tags &tags)
+            {
+                cpp_freertos::LockGuard lock(mutex);
+                if (const auto it = index.find(tags.filePath); it != index.end()) {
+                    entries.erase(it->second);
+                    index.erase(it);
+                }
+                entries.push_front(Entry{stamp, tags});
+                index.emplace(tags.filePath, entries.begin());
+                if (entries.size() > tagsCacheCapacity) {
+                    index.erase(entries.back().tags.filePath);
+                    entries.pop_back();
+                }
             }
 
-            return {};
+          private:
+            struct Entry
+            {
+                FileStamp stamp;
+                Tags tags;
+            };
+
+            /// most recently used first
+            std::list<Entry> entries;
+            std::unordered_map<std::string, std::list<Entry>::iterator> index;
+            cpp_freertos::MutexStandard mutex;
+        };
+
+        void parseAll(const std::vector<std::string> &filePaths,
+                      const std::vector<std::size_t> &indexes,
+                      std::vector<Tags> &results,
+                      std::size_t workers)
+        {
+#if defined(TARGET_Linux)
+            workers = std::min(workers, indexes.size());
+            if (workers > 1) {
+                std::atomic<std::size_t> next{0};
+                auto work = [&]() {
+                    for (auto i = next++; i < indexes.size(); i = next++) {
+                        results[indexes[i]] = parseTags(filePaths[indexes[i]]);
+                    }
+                };
+                std::vector<std::thread> threads;
+                for (std::size_t i = 0; i < workers; ++i) {
+                    threads.emplace_back(work);
+                }
+                for (auto &thread : threads) {
+                    thread.join();
+                }
+                return;
+            }
+#else
+            static_cast<void>(workers);
+#endif
+            for (const auto i : indexes) {
+                results[i] = parseTags(filePaths[i]);
+            }
         }
     } // namespace
 
+    std::optional<FileStamp> getFileStamp(const std::string &filePath)
+    {
+        struct stat fileStat
+        {};
+        if (::stat(filePath.c_str(), &fileStat) != 0) {
+            return std::nullopt;
+        }
+        return FileStamp{.size  = static_cast<std::uint64_t>(fileStat.st_size),
+                         .mtime = static_cast<std::uint32_t>(fileStat.st_mtime)};
+    }
+
     Tags fetchTags(const std::string &filePath)
     {
-        return fetchTagsInternal(filePath).value_or(Tags{filePath, getTitleFromFilePath(filePath)});
+        const auto stamp = getFileStamp(filePath);
+        if (stamp.has_value()) {
+            if (auto cached = TagsCache::get().find(filePath, *stamp); cached.has_value()) {
+                return std::move(*cached);
+            }
+        }
+
+        auto tags = parseTags(filePath);
+        if (stamp.has_value()) {
+            TagsCache::get().insert(*stamp, tags);
+        }
+        return tags;
+    }
+
+    std::vector<Tags> fetchTags(const std::vector<std::string> &filePaths, std::size_t workers)
+    {
+        std::vector<Tags> results(filePaths.size());
+        std::vector<std::optional<FileStamp>> stamps(filePaths.size());
+        std::vector<std::size_t> misses;
+
+        for (std::size_t i = 0; i < filePaths.size(); ++i) {
+            stamps[i] = getFileStamp(filePaths[i]);
+            if (stamps[i].has_value()) {
+                if (auto cached = TagsCache::get().find(filePaths[i], *stamps[i]); cached.has_value()) {
+                    results[i] = std::move(*cached);
+                    continue;
+                }
+            }
+            misses.push_back(i);
+        }
+
+        parseAll(filePaths, misses, results, workers);
+
+        for (const auto i : misses) {
+            if (stamps[i].has_value()) {
+                TagsCache::get().insert(*stamps[i], results[i]);
+            }
+        }
+        return results;
     }
 
+    void cacheTags(const FileStamp &stamp, const Tags &tags)
+    {
+        TagsCache::get().insert(stamp, tags);
+    }
 } // namespace tags::fetcher
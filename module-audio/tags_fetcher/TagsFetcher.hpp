@@ -8,6 +8,7 @@
 #include <optional>
 #include <string>
 #include <utility>
+#include <vector>
 
 namespace tags::fetcher
 {
@@ -64,5 +65,29 @@ namespace tags::fetcher
         {}
     };
 
+    /// Identifies the version of a file the tags were read from - cached tags are valid as long as it matches
+    struct FileStamp
+    {
+        std::uint64_t size  = 0;
+        std::uint32_t mtime = 0;
+
+        bool operator==(const FileStamp &other) const
+        {
+            return size == other.size && mtime == other.mtime;
+        }
+    };
+
+    std::optional<FileStamp> getFileStamp(const std::string &filePath);
+
+    /// Served from the tags cache if the file did not change since its tags were read, parsed otherwise.
+    /// Thread safe.
     Tags fetchTags(const std::string &fileName);
+
+    /// Fetches tags of many files, results are in the order of filePaths. On Linux files are parsed by up to
+    /// `workers` threads, on target the calling task parses them one by one.
+    std::vector<Tags> fetchTags(const std::vector<std::string> &filePaths, std::size_t workers);
+
+    /// Puts tags already known from elsewhere (e.g. the multimedia database) into the tags cache,
+    /// so that fetching them again doesn't require parsing the file
+    void cacheTags(const FileStamp &stamp, const Tags &tags);
 } // namespace tags::fetcher
@@ -5,7 +5,7 @@
 #include "macros.h"
 #include "bsp_eink.h"
 #include "eink_dimensions.hpp"
-#include "eink_binarization_luts.h"
+#include "bsp/eink/eink_frame_transform.hpp"
 
 #include <math.h>
 
@@ -52,418 +52,10 @@ static EinkWaveforms_e s_einkConfiguredWaveform =
 static CACHEABLE_SECTION_SDRAM(uint8_t s_einkServiceRotatedBuf[BOARD_EINK_DISPLAY_RES_X * BOARD_EINK_DISPLAY_RES_Y / 2 +
                                                                2]); // Plus 2 for the EPD command and BPP config
 
-/**
- * @brief This lut is used for convertion of the 4bp input grayscale pixel to the 1bpp output pixel
- */
-static std::uint8_t s_einkMaskLut_1Bpp[16] = {0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1};
-
-/**
- * @brief This lut is used for convertion of the 4bp input grayscale pixel to the 2bpp output pixel
- */
-static std::uint8_t s_einkMaskLut_2Bpp[16] = {0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2, 3, 3, 3, 3};
-
 /* External variable definitions */
 
 /* Internal function prototypes */
 
-/**
- *  This function makes rotation of the image from the standard GUI coordinate system to the coord system used by the
- * ED028TC1 display.
- *
- *  @note IT ROTATES only the 1Bpp image
- *
- *  @param uint8_t* dataIn          [in]  - input image to be translated. Each byte of that array must represent the
- * single pixel
- *  @param uint16_t x               [in]  - x coordinate of image in pixels
- *  @param uint16_t y               [in]  - y coordinate of image in pixels
- *  @param uint16_t windowWidthPx   [in]  - width of the image in pixels
- *  @param uint16_t windowHeightPx  [in]  - height of the image in pixels
- *  @param uint8_t* dataOut         [out] - the buffer for rotated image
- *  @param invertColors[in] - true if colors of the image are to be inverted, false otherwise
- *
- * @note Assumed dataIn coordinate system is the standard image coordinates system:
- *
- *   (0,0)   X
- *       *-------->
- *       |
- *     Y |
- *       |
- *       v
- *
- *
- * The result of the function is such a conversion of the dataIn array to make the Eink display show it the very same
- * way in its own coordinate system which is:
- *
- *              displayWidth
- *                 _______  ^
- *                |       | |
- *                |       | |
- *  displayHeight |       | |
- *                |       | |
- *                |_______| |  X
- *                   \ /    |
- *    signal tape -  | |    |
- *                          |
- *                 <--------*
- *                    Y     (0,0)
- *
- * @return
- */
-static std::uint8_t *s_EinkTransformFrameCoordinateSystem_1Bpp(const std::uint8_t *dataIn,
-                                                               std::uint16_t windowWidthPx,
-                                                               std::uint16_t windowHeightPx,
-                                                               std::uint8_t *dataOut,
-                                                               EinkDisplayColorMode_e invertColors);
-
-/**
- *  This function makes rotation of the image from the standard GUI coordinate system to the coord system used by the
- * ED028TC1 display.
- *
- *  @note IT ROTATES only the 2Bpp image
- *
- *  @param uint8_t* dataIn          [in]  - input image to be translated. Each byte of that array must represent the
- * single pixel
- *  @param uint16_t x               [in]  - x coordinate of image in pixels
- *  @param uint16_t y               [in]  - y coordinate of image in pixels
- *  @param uint16_t windowWidthPx   [in]  - width of the image in pixels
- *  @param uint16_t windowHeightPx  [in]  - height of the image in pixels
- *  @param uint8_t* dataOut         [out] - the buffer for rotated image
- *  @param invertColors[in] - true if colors of the image are to be inverted, false otherwise
- *
- * @note Assumed dataIn coordinate system is the standard image coordinates system:
- *
- *   (0,0)   X
- *       *-------->
- *       |
- *     Y |
- *       |
- *       v
- *
- *
- * The result of the function is such a conversion of the dataIn array to make the Eink display show it the very same
- * way in its own coordinate system which is:
- *
- *              displayWidth
- *                 _______  ^
- *                |       | |
- *                |       | |
- *  displayHeight |       | |
- *                |       | |
- *                |_______| |  X
- *                   \ /    |
- *    signal tape -  | |    |
- *                          |
- *                 <--------*
- *                    Y     (0,0)
- *
- * @return
- */
-static std::uint8_t *s_EinkTransformFrameCoordinateSystem_2Bpp(const std::uint8_t *dataIn,
-                                                               std::uint16_t windowWidthPx,
-                                                               std::uint16_t windowHeightPx,
-                                                               std::uint8_t *dataOut,
-                                                               EinkDisplayColorMode_e invertColors);
-
-/**
- *  This function makes rotation of the image from the standard GUI coordinate system to the coord system used by the
- * ED028TC1 display.
- *
- *  @note IT ROTATES only the 3Bpp image
- *
- *  @param uint8_t* dataIn          [in]  - input image to be translated. Each byte of that array must represent the
- * single pixel
- *  @param uint16_t x               [in]  - x coordinate of image in pixels
- *  @param uint16_t y               [in]  - y coordinate of image in pixels
- *  @param uint16_t windowWidthPx   [in]  - width of the image in pixels
- *  @param uint16_t windowHeightPx  [in]  - height of the image in pixels
- *  @param uint8_t* dataOut         [out] - the buffer for rotated image
- *  @param invertColors[in] - true if colors of the image are to be inverted, false otherwise
- *
- * @note Assumed dataIn coordinate system is the standard image coordinates system:
- *
- *   (0,0)   X
- *       *-------->
- *       |
- *     Y |
- *       |
- *       v
- *
- *
- * The result of the function is such a conversion of the dataIn array to make the Eink display show it the very same
- * way in its own coordinate system which is:
- *
- *              displayWidth
- *                 _______  ^
- *                |       | |
- *                |       | |
- *  displayHeight |       | |
- *                |       | |
- *                |_______| |  X
- *                   \ /    |
- *    signal tape -  | |    |
- *                          |
- *                 <--------*
- *                    Y     (0,0)
- *
- * @return
- */
-static std::uint8_t *s_EinkTransformFrameCoordinateSystem_3Bpp(const std::uint8_t *dataIn,
-                                                               std::uint16_t windowWidthPx,
-                                                               std::uint16_t windowHeightPx,
-                                                               std::uint8_t *dataOut,
-                                                               EinkDisplayColorMode_e invertColors);
-
-/**
- *  This function makes rotation of the image from the standard GUI coordinate system to the coord system used by the
- * ED028TC1 display.
- *
- *  @note IT ROTATES only the 4Bpp image
- *
- *  @param uint8_t* dataIn          [in]  - input image to be translated. Each byte of that array must represent the
- * single pixel
- *  @param uint16_t x               [in]  - x coordinate of image in pixels
- *  @param uint16_t y               [in]  - y coordinate of image in pixels
- *  @param uint16_t windowWidthPx   [in]  - width of the image in pixels
- *  @param uint16_t windowHeightPx  [in]  - height of the image in pixels
- *  @param uint8_t* dataOut         [out] - the buffer for rotated image
- *  @param invertColors[in] - true if colors of the image are to be inverted, false otherwise
- *
- * @note Assumed dataIn coordinate system is the standard image coordinates system:
- *
- *   (0,0)   X
- *       *-------->
- *       |
- *     Y |
- *       |
- *       v
- *
- *
- * The result of the function is such a conversion of the dataIn array to make the Eink display show it the very same
- * way in its own coordinate system which is:
- *
- *              displayWidth
- *                 _______  ^
- *                |       | |
- *                |       | |
- *  displayHeight |       | |
- *                |       | |
- *                |_______| |  X
- *                   \ /    |
- *    signal tape -  | |    |
- *                          |
- *                 <--------*
- *                    Y     (0,0)
- *
- * @return
- */
-static std::uint8_t *s_EinkTransformFrameCoordinateSystem_4Bpp(const std::uint8_t *dataIn,
-                                                               std::uint16_t windowWidthPx,
-                                                               std::uint16_t windowHeightPx,
-                                                               std::uint8_t *dataOut,
-                                                               EinkDisplayColorMode_e invertColors);
-
-/**
- *  This function makes rotation of the image from the standard GUI coordinate system to the coord system used by the
- * ED028TC1 display.
- *
- *  @note IT ROTATES only the 1Bpp image. It also makes sure that the image is black and white only
- *
- *  @param uint8_t* dataIn          [in]  - input image to be translated. Each byte of that array must represent the
- * single pixel
- *  @param uint16_t x               [in]  - x coordinate of image in pixels
- *  @param uint16_t y               [in]  - y coordinate of image in pixels
- *  @param uint16_t windowWidthPx   [in]  - width of the image in pixels
- *  @param uint16_t windowHeightPx  [in]  - height of the image in pixels
- *  @param uint8_t* dataOut         [out] - the buffer for rotated image
- *  @param invertColors[in] - true if colors of the image are to be inverted, false otherwise
- *
- * @note Assumed dataIn coordinate system is the standard image coordinates system:
- *
- *   (0,0)   X
- *       *-------->
- *       |
- *     Y |
- *       |
- *       v
- *
- *
- * The result of the function is such a conversion of the dataIn array to make the Eink display show it the very same
- * way in its own coordinate system which is:
- *
- *              displayWidth
- *                 _______  ^
- *                |       | |
- *                |       | |
- *  displayHeight |       | |
- *                |       | |
- *                |_______| |  X
- *                   \ /    |
- *    signal tape -  | |    |
- *                          |
- *                 <--------*
- *                    Y     (0,0)
- *
- * @return
- */
-static std::uint8_t *s_EinkTransformAnimationFrameCoordinateSystem_1Bpp(const std::uint8_t *dataIn,
-                                                                        std::uint16_t windowWidthPx,
-                                                                        std::uint16_t windowHeightPx,
-                                                                        std::uint8_t *dataOut,
-                                                                        EinkDisplayColorMode_e invertColors);
-
-/**
- *  This function makes rotation of the image from the standard GUI coordinate system to the coord system used by the
- * ED028TC1 display.
- *
- *  @note IT ROTATES only the 2Bpp image. It also makes sure that the image is black and white only
- *
- *  @param uint8_t* dataIn          [in]  - input image to be translated. Each byte of that array must represent the
- * single pixel
- *  @param uint16_t x               [in]  - x coordinate of image in pixels
- *  @param uint16_t y               [in]  - y coordinate of image in pixels
- *  @param uint16_t windowWidthPx   [in]  - width of the image in pixels
- *  @param uint16_t windowHeightPx  [in]  - height of the image in pixels
- *  @param uint8_t* dataOut         [out] - the buffer for rotated image
- *  @param invertColors[in] - true if colors of the image are to be inverted, false otherwise
- *
- * @note Assumed dataIn coordinate system is the standard image coordinates system:
- *
- *   (0,0)   X
- *       *-------->
- *       |
- *     Y |
- *       |
- *       v
- *
- *
- * The result of the function is such a conversion of the dataIn array to make the Eink display show it the very same
- * way in its own coordinate system which is:
- *
- *              displayWidth
- *                 _______  ^
- *                |       | |
- *                |       | |
- *  displayHeight |       | |
- *                |       | |
- *                |_______| |  X
- *                   \ /    |
- *    signal tape -  | |    |
- *                          |
- *                 <--------*
- *                    Y     (0,0)
- *
- * @return
- */
-static std::uint8_t *s_EinkTransformAnimationFrameCoordinateSystem_2Bpp(const std::uint8_t *dataIn,
-                                                                        std::uint16_t windowWidthPx,
-                                                                        std::uint16_t windowHeightPx,
-                                                                        std::uint8_t *dataOut,
-                                                                        EinkDisplayColorMode_e invertColors);
-
-/**
- *  This function makes rotation of the image from the standard GUI coordinate system to the coord system used by the
- * ED028TC1 display.
- *
- *  @note IT ROTATES only the 3Bpp image. It also makes sure that the image is black and white only
- *
- *  @param uint8_t* dataIn          [in]  - input image to be translated. Each byte of that array must represent the
- * single pixel
- *  @param uint16_t x               [in]  - x coordinate of image in pixels
- *  @param uint16_t y               [in]  - y coordinate of image in pixels
- *  @param uint16_t windowWidthPx   [in]  - width of the image in pixels
- *  @param uint16_t windowHeightPx  [in]  - height of the image in pixels
- *  @param uint8_t* dataOut         [out] - the buffer for rotated image
- *  @param invertColors[in] - true if colors of the image are to be inverted, false otherwise
- *
- * @note Assumed dataIn coordinate system is the standard image coordinates system:
- *
- *   (0,0)   X
- *       *-------->
- *       |
- *     Y |
- *       |
- *       v
- *
- *
- * The result of the function is such a conversion of the dataIn array to make the Eink display show it the very same
- * way in its own coordinate system which is:
- *
- *              displayWidth
- *                 _______  ^
- *                |       | |
- *                |       | |
- *  displayHeight |       | |
- *                |       | |
- *                |_______| |  X
- *                   \ /    |
- *    signal tape -  | |    |
- *                          |
- *                 <--------*
- *                    Y     (0,0)
- *
- * @return
- */
-static std::uint8_t *s_EinkTransformAnimationFrameCoordinateSystem_3Bpp(const std::uint8_t *dataIn,
-                                                                        std::uint16_t windowWidthPx,
-                                                                        std::uint16_t windowHeightPx,
-                                                                        std::uint8_t *dataOut,
-                                                                        EinkDisplayColorMode_e invertColors);
-
-/**
- *  This function makes rotation of the image from the standard GUI coordinate system to the coord system used by the
- * ED028TC1 display.
- *
- *  @note IT ROTATES only the 4Bpp image. It also makes sure that the image is black and white only
- *
- *  @param uint8_t* dataIn          [in]  - input image to be translated. Each byte of that array must represent the
- * single pixel
- *  @param uint16_t x               [in]  - x coordinate of image in pixels
- *  @param uint16_t y               [in]  - y coordinate of image in pixels
- *  @param uint16_t windowWidthPx   [in]  - width of the image in pixels
- *  @param uint16_t windowHeightPx  [in]  - height of the image in pixels
- *  @param uint8_t* dataOut         [out] - the buffer for rotated image
- *  @param invertColors[in] - true if colors of the image are to be inverted, false otherwise
- *
- * @note Assumed dataIn coordinate system is the standard image coordinates system:
- *
- *   (0,0)   X
- *       *-------->
- *       |
- *     Y |
- *       |
- *       v
- *
- *
- * The result of the function is such a conversion of the dataIn array to make the Eink display show it the very same
- * way in its own coordinate system which is:
- *
- *              displayWidth
- *                 _______  ^
- *                |       | |
- *                |       | |
- *  displayHeight |       | |
- *                |       | |
- *                |_______| |  X
- *                   \ /    |
- *    signal tape -  | |    |
- *                          |
- *                 <--------*
- *                    Y     (0,0)
- *
- * @return
- */
-
-/*
- * Not rotating version of s_EinkTransformAnimationFrameCoordinateSystem_4Bpp.
- * It is used when EINK_ROTATE_90_CLOCKWISE is not defined.
- */
-
-static std::uint8_t *s_EinkTransformFrameCoordinateSystemNoRotation_4Bpp(const std::uint8_t *dataIn,
-                                                                         std::uint16_t windowWidthPx,
-                                                                         std::uint16_t windowHeightPx,
-                                                                         std::uint8_t *dataOut,
-                                                                         EinkDisplayColorMode_e invertColors);
-
 /* Function bodies */
 
 void EinkChangeDisplayUpdateTimings(EinkDisplayTimingsMode_e timingsMode)
@@ -814,55 +406,32 @@ EinkStatus_e EinkUpdateFrame(EinkFrame_t frame,
     s_einkServiceRotatedBuf[0] = EinkDataStartTransmission1;
     s_einkServiceRotatedBuf[1] = bpp - 1; //  0 - 1Bpp, 1 - 2Bpp, 2 - 3Bpp, 3 - 4Bpp
 
-    if ((s_einkConfiguredWaveform == EinkWaveformA2) || (s_einkConfiguredWaveform == EinkWaveformDU2)) {
-        switch (bpp) {
-        case Eink1Bpp: {
-            s_EinkTransformAnimationFrameCoordinateSystem_1Bpp(
-                buffer, frame.width, frame.height, s_einkServiceRotatedBuf + 2, invertColors);
-        } break;
-        case Eink2Bpp: {
-            s_EinkTransformAnimationFrameCoordinateSystem_2Bpp(
-                buffer, frame.width, frame.height, s_einkServiceRotatedBuf + 2, invertColors);
-        } break;
-        case Eink3Bpp: {
-            s_EinkTransformAnimationFrameCoordinateSystem_3Bpp(
-                buffer, frame.width, frame.height, s_einkServiceRotatedBuf + 2, invertColors);
-        } break;
-        case Eink4Bpp: {
+    const bool isAnimationWaveform =
+        (s_einkConfiguredWaveform == EinkWaveformA2) || (s_einkConfiguredWaveform == EinkWaveformDU2);
+
+    const bool invert  = invertColors == EinkDisplayColorModeInverted;
+    const auto dataOut = s_einkServiceRotatedBuf + 2;
+    const bsp::eink::FrameWindow window{buffer, BOARD_EINK_DISPLAY_RES_X, frame.width, frame.height};
+
+    switch (bpp) {
+    case Eink1Bpp:
+        bsp::eink::rotateFrame1Bpp(window, dataOut, invert);
+        break;
+    case Eink2Bpp:
+        // Animation waveforms handle only black and white pixels
+        bsp::eink::rotateFrame2Bpp(window, dataOut, isAnimationWaveform, invert);
+        break;
+    case Eink3Bpp:
+        // The 3bpp is coded the same way as the 4bpp
+        bsp::eink::rotateFrame4Bpp(window, dataOut, invert);
+        break;
+    case Eink4Bpp:
 #if defined(EINK_ROTATE_90_CLOCKWISE)
-            s_EinkTransformFrameCoordinateSystem_4Bpp(
-                buffer, frame.width, frame.height, s_einkServiceRotatedBuf + 2, invertColors);
+        bsp::eink::rotateFrame4Bpp(window, dataOut, invert);
 #else
-            s_EinkTransformFrameCoordinateSystemNoRotation_4Bpp(
-                buffer, frame.width, frame.height, s_einkServiceRotatedBuf + 2, invertColors);
+        bsp::eink::packFrame4Bpp(window, dataOut, invert);
 #endif
-        } break;
-        }
-    }
-    else {
-        switch (bpp) {
-        case Eink1Bpp: {
-            s_EinkTransformFrameCoordinateSystem_1Bpp(
-                buffer, frame.width, frame.height, s_einkServiceRotatedBuf + 2, invertColors);
-        } break;
-        case Eink2Bpp: {
-            s_EinkTransformFrameCoordinateSystem_2Bpp(
-                buffer, frame.width, frame.height, s_einkServiceRotatedBuf + 2, invertColors);
-        } break;
-        case Eink3Bpp: {
-            s_EinkTransformFrameCoordinateSystem_3Bpp(
-                buffer, frame.width, frame.height, s_einkServiceRotatedBuf + 2, invertColors);
-        } break;
-        case Eink4Bpp: {
-#if defined(EINK_ROTATE_90_CLOCKWISE)
-            s_EinkTransformFrameCoordinateSystem_4Bpp(
-                buffer, frame.width, frame.height, s_einkServiceRotatedBuf + 2, invertColors);
-#else
-            s_EinkTransformFrameCoordinateSystemNoRotation_4Bpp(
-                buffer, frame.width, frame.height, s_einkServiceRotatedBuf + 2, invertColors);
-#endif
-        } break;
-        }
+        break;
     }
 
     buf[0] = EinkDataStartTransmissionWindow; // set display window
@@ -1041,312 +610,3 @@ __attribute__((optimize("O3"))) void EinkARGBToLuminance(const std::uint8_t *dat
         dst++;
     }
 }
-
-__attribute__((optimize("O1"))) static std::uint8_t *s_EinkTransformFrameCoordinateSystem_1Bpp(
-    const std::uint8_t *dataIn,
-    std::uint16_t windowWidthPx,
-    std::uint16_t windowHeightPx,
-    std::uint8_t *dataOut,
-    EinkDisplayColorMode_e invertColors)
-{
-    // In 1bpp mode there are 8 pixels in the byte
-    const std::uint8_t pixelsInByte = 8;
-
-    std::uint8_t pixels    = 0;
-    std::uint8_t *outArray = dataOut;
-
-    for (std::int32_t inputCol = windowWidthPx - 1; inputCol >= 0; --inputCol) {
-        for (std::int32_t inputRow = windowHeightPx - 1; inputRow >= 7; inputRow -= pixelsInByte) {
-            // HACK: Did not create the loop for accessing pixels and merging them in the single byte for better
-            // performance.
-            //       Wanted to avoid unneeded loop count increasing and jump operations which for large amount of data
-            //       take considerable amount of time.
-            std::uint32_t index = inputRow * BOARD_EINK_DISPLAY_RES_X + inputCol;
-
-            // Use the LUT to convert the input pixel from 4bpp to 1bpp
-            std::uint8_t firstPixel   = s_einkMaskLut_1Bpp[dataIn[index - 0 * BOARD_EINK_DISPLAY_RES_X]];
-            std::uint8_t secondPixel  = s_einkMaskLut_1Bpp[dataIn[index - 1 * BOARD_EINK_DISPLAY_RES_X]];
-            std::uint8_t thirdPixel   = s_einkMaskLut_1Bpp[dataIn[index - 2 * BOARD_EINK_DISPLAY_RES_X]];
-            std::uint8_t fourthPixel  = s_einkMaskLut_1Bpp[dataIn[index - 3 * BOARD_EINK_DISPLAY_RES_X]];
-            std::uint8_t fifthPixel   = s_einkMaskLut_1Bpp[dataIn[index - 4 * BOARD_EINK_DISPLAY_RES_X]];
-            std::uint8_t sixthPixel   = s_einkMaskLut_1Bpp[dataIn[index - 5 * BOARD_EINK_DISPLAY_RES_X]];
-            std::uint8_t seventhPixel = s_einkMaskLut_1Bpp[dataIn[index - 6 * BOARD_EINK_DISPLAY_RES_X]];
-            std::uint8_t eightPixel   = s_einkMaskLut_1Bpp[dataIn[index - 7 * BOARD_EINK_DISPLAY_RES_X]];
-
-            // Put the pixels in order: Most left positioned pixel at the most significant side of byte
-            pixels = (firstPixel << 7) | (secondPixel << 6) | (thirdPixel << 5) | (fourthPixel << 4) |
-                     (fifthPixel << 3) | (sixthPixel << 2) | (seventhPixel << 1) | (eightPixel << 0);
-
-            if (invertColors) {
-                pixels = ~pixels;
-            }
-
-            *outArray = pixels;
-            ++outArray;
-        }
-    }
-
-    return dataOut;
-}
-
-__attribute__((optimize("O1"))) static std::uint8_t *s_EinkTransformFrameCoordinateSystem_2Bpp(
-    const std::uint8_t *dataIn,
-    std::uint16_t windowWidthPx,
-    std::uint16_t windowHeightPx,
-    std::uint8_t *dataOut,
-    EinkDisplayColorMode_e invertColors)
-{
-    // In 2bpp mode there are 4 pixels in the byte
-    const std::uint8_t pixelsInByte = 8;
-    std::uint16_t pixels            = 0;
-    std::uint16_t *outArray         = (std::uint16_t *)dataOut;
-    std::uint8_t temp               = 0;
-
-    for (std::int32_t inputCol = windowWidthPx - 1; inputCol >= 0; --inputCol) {
-        for (std::int32_t inputRow = windowHeightPx - 1; inputRow >= 7; inputRow -= pixelsInByte) {
-            // HACK: Did not create the loop for accessing pixels and merging them in the single byte for better
-            // performance.
-            //       Wanted to avoid unneeded loop count increasing and jump operations which for large amount of data
-            //       take considerable amount of time.
-            std::uint32_t index = inputRow * BOARD_EINK_DISPLAY_RES_X + inputCol;
-
-            // Use the LUT to convert the input pixel from 4bpp to 2bpp and put 4 pixels in single byte
-            temp = (s_einkMaskLut_2Bpp[dataIn[index - 0 * BOARD_EINK_DISPLAY_RES_X]] << 6);
-            temp |= (s_einkMaskLut_2Bpp[dataIn[index - 1 * BOARD_EINK_DISPLAY_RES_X]] << 4);
-            temp |= (s_einkMaskLut_2Bpp[dataIn[index - 2 * BOARD_EINK_DISPLAY_RES_X]] << 2);
-            temp |= (s_einkMaskLut_2Bpp[dataIn[index - 3 * BOARD_EINK_DISPLAY_RES_X]] << 0);
-
-            // Push the 4 pixels into the proper place in the uint16_t
-            pixels = temp << 0;
-
-            // Use the LUT to convert the input pixel from 4bpp to 2bpp and put 4 pixels in single byte
-            temp = (s_einkMaskLut_2Bpp[dataIn[index - 4 * BOARD_EINK_DISPLAY_RES_X]] << 6);
-            temp |= (s_einkMaskLut_2Bpp[dataIn[index - 5 * BOARD_EINK_DISPLAY_RES_X]] << 4);
-            temp |= (s_einkMaskLut_2Bpp[dataIn[index - 6 * BOARD_EINK_DISPLAY_RES_X]] << 2);
-            temp |= (s_einkMaskLut_2Bpp[dataIn[index - 7 * BOARD_EINK_DISPLAY_RES_X]] << 0);
-
-            // Push the 4 pixels into the proper place in the uint16_t
-            pixels |= temp << 8;
-
-            if (invertColors) {
-                pixels = ~pixels;
-            }
-
-            *outArray = pixels;
-            ++outArray;
-        }
-    }
-
-    return dataOut;
-}
-
-__attribute__((optimize("O1"))) static std::uint8_t *s_EinkTransformFrameCoordinateSystem_3Bpp(
-    const std::uint8_t *dataIn,
-    std::uint16_t windowWidthPx,
-    std::uint16_t windowHeightPx,
-    std::uint8_t *dataOut,
-    EinkDisplayColorMode_e invertColors)
-{
-    // The 4bpp is coded the same way as the 3bpp
-    return s_EinkTransformFrameCoordinateSystem_4Bpp(dataIn, windowWidthPx, windowHeightPx, dataOut, invertColors);
-}
-
-__attribute__((optimize("O1"))) static std::uint8_t *s_EinkTransformAnimationFrameCoordinateSystem_1Bpp(
-    const std::uint8_t *dataIn,
-    std::uint16_t windowWidthPx,
-    std::uint16_t windowHeightPx,
-    std::uint8_t *dataOut,
-    EinkDisplayColorMode_e invertColors)
-{
-    // In 1bpp mode there are 8 pixels in the byte
-    const std::uint8_t pixelsInByte = 8;
-    std::uint8_t pixels             = 0;
-    std::uint8_t *outArray          = dataOut;
-
-    for (std::int32_t inputCol = windowWidthPx - 1; inputCol >= 0; --inputCol) {
-        for (std::int32_t inputRow = windowHeightPx - 1; inputRow >= 7; inputRow -= pixelsInByte) {
-            // HACK: Did not create the loop for accessing pixels and merging them in the single byte for better
-            // performance.
-            //       Wanted to avoid unneeded loop count increasing and jump operations which for large amount of data
-            //       take considerable amount of time.
-
-            std::uint32_t index = inputRow * BOARD_EINK_DISPLAY_RES_X + inputCol;
-
-            // Use the LUT to convert the input pixel from 4bpp to 1bpp
-            std::uint8_t firstPixel   = s_einkMaskLut_1Bpp[dataIn[index - 0 * BOARD_EINK_DISPLAY_RES_X]];
-            std::uint8_t secondPixel  = s_einkMaskLut_1Bpp[dataIn[index - 1 * BOARD_EINK_DISPLAY_RES_X]];
-            std::uint8_t thirdPixel   = s_einkMaskLut_1Bpp[dataIn[index - 2 * BOARD_EINK_DISPLAY_RES_X]];
-            std::uint8_t fourthPixel  = s_einkMaskLut_1Bpp[dataIn[index - 3 * BOARD_EINK_DISPLAY_RES_X]];
-            std::uint8_t fifthPixel   = s_einkMaskLut_1Bpp[dataIn[index - 4 * BOARD_EINK_DISPLAY_RES_X]];
-            std::uint8_t sixthPixel   = s_einkMaskLut_1Bpp[dataIn[index - 5 * BOARD_EINK_DISPLAY_RES_X]];
-            std::uint8_t seventhPixel = s_einkMaskLut_1Bpp[dataIn[index - 6 * BOARD_EINK_DISPLAY_RES_X]];
-            std::uint8_t eightPixel   = s_einkMaskLut_1Bpp[dataIn[index - 7 * BOARD_EINK_DISPLAY_RES_X]];
-
-            // Put the pixels in order: Most left positioned pixel at the most significant side of byte
-            pixels = (firstPixel << 7) | (secondPixel << 6) | (thirdPixel << 5) | (fourthPixel << 4) |
-                     (fifthPixel << 3) | (sixthPixel << 2) | (seventhPixel << 1) | (eightPixel << 0);
-
-            if (invertColors) {
-                pixels = ~pixels;
-            }
-
-            *outArray = pixels;
-            ++outArray;
-        }
-    }
-
-    return dataOut;
-}
-
-__attribute__((optimize("O1"))) static std::uint8_t *s_EinkTransformAnimationFrameCoordinateSystem_2Bpp(
-    const std::uint8_t *dataIn,
-    std::uint16_t windowWidthPx,
-    std::uint16_t windowHeightPx,
-    std::uint8_t *dataOut,
-    EinkDisplayColorMode_e invertColors)
-{
-    // In 2bpp mode there are 4 pixels in the byte
-    const std::uint8_t pixelsInByte = 8;
-    std::uint16_t pixels            = 0;
-    std::uint16_t *outArray         = (std::uint16_t *)dataOut;
-    std::uint8_t temp               = 0;
-    for (std::int32_t inputCol = windowWidthPx - 1; inputCol >= 0; --inputCol) {
-        for (std::int32_t inputRow = windowHeightPx - 1; inputRow >= 7; inputRow -= pixelsInByte) {
-            // HACK: Did not create the loop for accessing pixels and merging them in the single byte for better
-            // performance.
-            //       Wanted to avoid unneeded loop count increasing and jump operations which for large amount of data
-            //       take considerable amount of time.
-            std::uint32_t index = inputRow * BOARD_EINK_DISPLAY_RES_X + inputCol;
-
-            // Use the LUT to convert the input pixel from 4bpp to 2bpp and put 4 pixels in single byte
-            temp = (s_einkMaskLut_2Bpp[dataIn[index - 0 * BOARD_EINK_DISPLAY_RES_X]] << 6);
-            temp |= (s_einkMaskLut_2Bpp[dataIn[index - 1 * BOARD_EINK_DISPLAY_RES_X]] << 4);
-            temp |= (s_einkMaskLut_2Bpp[dataIn[index - 2 * BOARD_EINK_DISPLAY_RES_X]] << 2);
-            temp |= (s_einkMaskLut_2Bpp[dataIn[index - 3 * BOARD_EINK_DISPLAY_RES_X]] << 0);
-
-            // Use the LUT to binarize the 2bpp pixels value and push them into the proper place in the uint16_t
-            pixels = einkBinarizationLUT_2bpp[temp] << 0;
-
-            // Use the LUT to convert the input pixel from 4bpp to 2bpp and put 4 pixels in single byte
-            temp = (s_einkMaskLut_2Bpp[dataIn[index - 4 * BOARD_EINK_DISPLAY_RES_X]] << 6);
-            temp |= (s_einkMaskLut_2Bpp[dataIn[index - 5 * BOARD_EINK_DISPLAY_RES_X]] << 4);
-            temp |= (s_einkMaskLut_2Bpp[dataIn[index - 6 * BOARD_EINK_DISPLAY_RES_X]] << 2);
-            temp |= (s_einkMaskLut_2Bpp[dataIn[index - 7 * BOARD_EINK_DISPLAY_RES_X]] << 0);
-
-            // Use the LUT to binarize the 2bpp pixels value and push them into the proper place in the uint16_t
-            pixels |= einkBinarizationLUT_2bpp[temp] << 8;
-            if (invertColors) {
-                pixels = ~pixels;
-            }
-
-            *outArray = pixels;
-            ++outArray;
-        }
-    }
-
-    return dataOut;
-}
-
-__attribute__((optimize("O3"))) static std::uint8_t *s_EinkTransformAnimationFrameCoordinateSystem_3Bpp(
-    const std::uint8_t *dataIn,
-    std::uint16_t windowWidthPx,
-    std::uint16_t windowHeightPx,
-    std::uint8_t *dataOut,
-    EinkDisplayColorMode_e invertColors)
-{
-    // The 4bpp is coded the same way as the 3bpp
-    return s_EinkTransformFrameCoordinateSystem_4Bpp(dataIn, windowWidthPx, windowHeightPx, dataOut, invertColors);
-}
-
-__attribute__((optimize("O1"))) static std::uint8_t *s_EinkTransformFrameCoordinateSystem_4Bpp(
-    const std::uint8_t *dataIn,
-    std::uint16_t windowWidthPx,
-    std::uint16_t windowHeightPx,
-    std::uint8_t *dataOut,
-    EinkDisplayColorMode_e invertColors)
-{
-    // In 3bpp and 4bpp modes there are 2 pixels in the byte. Using 8bpp to process the whole uint32_t at once for
-    // faster execution
-    const std::uint8_t pixelsInByte = 8;
-
-    std::uint32_t pixels    = 0;
-    std::uint32_t *outArray = (std::uint32_t *)dataOut;
-
-    for (std::int32_t inputCol = windowWidthPx - 1; inputCol >= 0; --inputCol) {
-        for (std::int32_t inputRow = windowHeightPx - 1; inputRow >= 7; inputRow -= pixelsInByte) {
-            // HACK: Did not create the loop for accessing pixels and merging them in the single byte for better
-            // performance.
-            //       Wanted to avoid unneeded loop count increasing and jump operations which for large amount of data
-            //       take considerable amount of time. Using 8 pixels at a time for better performance
-            std::uint32_t index = inputRow * BOARD_EINK_DISPLAY_RES_X + inputCol;
-
-            std::uint8_t firstPixelPair =
-                (dataIn[index - 0 * BOARD_EINK_DISPLAY_RES_X] << 4) | dataIn[index - 1 * BOARD_EINK_DISPLAY_RES_X];
-            std::uint8_t secondPixelPair =
-                (dataIn[index - 2 * BOARD_EINK_DISPLAY_RES_X] << 4) | dataIn[index - 3 * BOARD_EINK_DISPLAY_RES_X];
-            std::uint8_t thirdPixelPair =
-                (dataIn[index - 4 * BOARD_EINK_DISPLAY_RES_X] << 4) | dataIn[index - 5 * BOARD_EINK_DISPLAY_RES_X];
-            std::uint8_t fourthPixelPair =
-                (dataIn[index - 6 * BOARD_EINK_DISPLAY_RES_X] << 4) | dataIn[index - 7 * BOARD_EINK_DISPLAY_RES_X];
-
-            // Put the pixels in the uint32_t for faster processing
-            pixels = firstPixelPair | (secondPixelPair << 8) | (thirdPixelPair << 16) | (fourthPixelPair << 24);
-
-            if (invertColors) {
-                pixels = ~pixels;
-            }
-
-            // Put the pixels in order: Most left positioned pixel at the most significant side of byte
-            *outArray = pixels;
-            ++outArray;
-        }
-    }
-
-    return dataOut;
-}
-
-__attribute__((optimize("O1"))) static std::uint8_t *s_EinkTransformFrameCoordinateSystemNoRotation_4Bpp(
-    const std::uint8_t *dataIn,
-    std::uint16_t windowWidthPx,
-    std::uint16_t windowHeightPx,
-    std::uint8_t *dataOut,
-    EinkDisplayColorMode_e invertColors)
-{
-    // In 3bpp and 4bpp modes there are 2 pixels in the byte. Using 8bpp to process the whole uint32_t at once for
-    // faster execution
-    const std::uint8_t pixelsInByte = 8;
-
-    std::uint32_t pixels    = 0;
-    std::uint32_t *outArray = (std::uint32_t *)dataOut;
-    std::int32_t inputRow   = 0;
-    std::int32_t inputCol   = 0;
-
-    for (inputRow = 0; inputRow < windowHeightPx; ++inputRow) {
-        for (inputCol = windowWidthPx - 7; inputCol >= 0; inputCol -= pixelsInByte) {
-            // HACK: Did not create the loop for accessing pixels and merging them in the single byte for better
-            // performance.
-            //       Wanted to avoid unneeded loop count increasing and jump operations which for large amount of data
-            //       take considerable amount of time. Using 8 pixels at a time for better performance
-            std::uint32_t index = inputRow * BOARD_EINK_DISPLAY_RES_X + inputCol;
-
-            // Get 4x 2 adjacent pixels to process them as uint32_t for better execution timings
-            std::uint8_t firstPixelPair  = (dataIn[index]) | (dataIn[index + 1] << 4);
-            std::uint8_t secondPixelPair = (dataIn[index + 2]) | (dataIn[index + 3] << 4);
-            std::uint8_t thirdPixelPair  = (dataIn[index + 4]) | (dataIn[index + 5] << 4);
-            std::uint8_t fourthPixelPair = (dataIn[index + 6]) | (dataIn[index + 7] << 4);
-
-            // Put the pixels in the uint32_t for faster processing
-            pixels = (firstPixelPair << 24) | (secondPixelPair << 16) | (thirdPixelPair << 8) | (fourthPixelPair);
-
-            if (invertColors) {
-                pixels = ~pixels;
-            }
-
-            // Put the pixels in order: Most left positioned pixel at the most significant side of byte
-            *outArray = pixels;
-            ++outArray;
-        }
-    }
-
-    return dataOut;
-}
@@ -0,0 +1,135 @@
+// Copyright (c) 2017-2023, Mudita Sp. z.o.o. All rights reserved.
+// For licensing, see https://github.com/mudita/MuditaOS/LICENSE.md
+
+#include "eink_frame_transform.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+
+#if __BYTE_ORDER__ != __ORDER_LITTLE_ENDIAN__
+#error "Eink frame kernels assume a little endian target"
+#endif
+
+namespace bsp::eink
+{
+    namespace
+    {
+        using Word = std::uint64_t;
+
+        /// Pixels (bytes) loaded from a row at once, also the width of a column tile
+        constexpr std::size_t pixelsInWord = sizeof(Word);
+
+        constexpr Word bytesMask(std::uint8_t mask)
+        {
+            return Word{mask} * 0x0101010101010101ULL;
+        }
+
+        constexpr Word lanesMask(std::uint16_t mask)
+        {
+            return Word{mask} * 0x0001000100010001ULL;
+        }
+
+        Word loadPixels(const std::uint8_t *pixels, std::size_t count)
+        {
+            Word word{0};
+            std::memcpy(&word, pixels, count);
+            return word;
+        }
+
+        /// Rotates the window packing `rowsPerByte` vertically adjacent pixels into every output byte.
+        /// `packBytes` merges words loaded from those rows (the lowest row first) into a word whose n-th byte
+        /// is the output byte of the n-th column of the tile.
+        template <std::size_t rowsPerByte, typename PackBytes>
+        void rotate(const FrameWindow &window, std::uint8_t *out, bool invertColors, PackBytes packBytes)
+        {
+            constexpr std::size_t rowsInGroup = 8;
+            const std::size_t bytesPerColumn  = window.height / rowsInGroup * rowsInGroup / rowsPerByte;
+            const Word invertMask             = invertColors ? ~Word{0} : Word{0};
+
+            for (std::size_t column = 0; column < window.width; column += pixelsInWord) {
+                const auto tileWidth = std::min<std::size_t>(pixelsInWord, window.width - column);
+                // Rightmost column of the tile is the first one in the output
+                auto tileOut = out + (window.width - column - tileWidth) * bytesPerColumn;
+
+                for (std::size_t byte = 0; byte < bytesPerColumn; ++byte) {
+                    const auto bottomRow = window.height - 1 - byte * rowsPerByte;
+                    std::array<Word, rowsPerByte> rows;
+                    for (std::size_t i = 0; i < rowsPerByte; ++i) {
+                        rows[i] = loadPixels(window.data + (bottomRow - i) * window.stride + column, tileWidth);
+                    }
+
+                    const auto packed = packBytes(rows) ^ invertMask;
+                    for (std::size_t i = 0; i < tileWidth; ++i) {
+                        const auto columnOut = tileOut + (tileWidth - 1 - i) * bytesPerColumn;
+                        columnOut[byte]      = static_cast<std::uint8_t>(packed >> (8 * i));
+                    }
+                }
+            }
+        }
+    } // namespace
+
+    std::size_t rotatedFrameSize(const FrameWindow &window, unsigned bitsPerPixel)
+    {
+        constexpr auto rowsInGroup = 8;
+        const auto bytesPerGroup   = bitsPerPixel == 3 ? 4 : bitsPerPixel;
+        return static_cast<std::size_t>(window.width) * (window.height / rowsInGroup) * bytesPerGroup;
+    }
+
+    void rotateFrame1Bpp(const FrameWindow &window, std::uint8_t *out, bool invertColors)
+    {
+        // Pixels brighter than the half of the scale are white
+        rotate<8>(window, out, invertColors, [](const std::array<Word, 8> &rows) {
+            Word packed{0};
+            for (std::size_t i = 0; i < rows.size(); ++i) {
+                packed |= ((rows[i] >> 3) & bytesMask(0x01)) << (7 - i);
+            }
+            return packed;
+        });
+    }
+
+    void rotateFrame2Bpp(const FrameWindow &window, std::uint8_t *out, bool binarize, bool invertColors)
+    {
+        rotate<4>(window, out, invertColors, [binarize](const std::array<Word, 4> &rows) {
+            Word packed{0};
+            for (std::size_t i = 0; i < rows.size(); ++i) {
+                packed |= ((rows[i] >> 2) & bytesMask(0x03)) << (6 - 2 * i);
+            }
+            if (binarize) {
+                // Only the pixels having both bits set stay white
+                const auto white = packed & (packed >> 1) & bytesMask(0x55);
+                packed           = white | (white << 1);
+            }
+            return packed;
+        });
+    }
+
+    void rotateFrame4Bpp(const FrameWindow &window, std::uint8_t *out, bool invertColors)
+    {
+        rotate<2>(window, out, invertColors, [](const std::array<Word, 2> &rows) {
+            return ((rows[0] << 4) & bytesMask(0xF0)) | rows[1];
+        });
+    }
+
+    void packFrame4Bpp(const FrameWindow &window, std::uint8_t *out, bool invertColors)
+    {
+        constexpr std::int32_t pixelsInGroup = pixelsInWord;
+        const std::uint32_t invertMask       = invertColors ? ~std::uint32_t{0} : std::uint32_t{0};
+
+        for (std::size_t row = 0; row < window.height; ++row) {
+            const auto rowData = window.data + row * window.stride;
+            // Rows are sent mirrored, 8 pixels at a time, in the groups the panel has always been fed with
+            for (std::int32_t column = window.width - 7; column >= 0; column -= pixelsInGroup) {
+                const auto pixels = loadPixels(rowData + column, pixelsInWord);
+                // Merge every two adjacent pixels into the lower byte of their 16-bit lane
+                const auto pairs = (pixels & lanesMask(0x00FF)) | ((pixels >> 4) & lanesMask(0x00F0));
+                // Lanes go out in the reversed order
+                const auto lanes = ((pairs & 0xFF) << 24) | (pairs & 0xFF0000) | ((pairs >> 24) & 0xFF00) |
+                                   ((pairs >> 48) & 0xFF);
+                const auto word = static_cast<std::uint32_t>(lanes) ^ invertMask;
+                std::memcpy(out, &word, sizeof(word));
+                out += sizeof(word);
+            }
+        }
+    }
+} // namespace bsp::eink
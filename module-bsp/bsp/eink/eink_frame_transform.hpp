@@ -0,0 +1,43 @@
+// Copyright (c) 2017-2023, Mudita Sp. z.o.o. All rights reserved.
+// For licensing, see https://github.com/mudita/MuditaOS/LICENSE.md
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+/// Board independent kernels converting the GUI frame buffer into the ED028TC1 transfer format.
+///
+/// The input is the 8bpp GUI buffer holding one 4bpp gray level (0-15) per byte, rows `stride` bytes apart.
+/// The rotating kernels turn the window 90 degrees into the display coordinate system: the output is written
+/// column by column, starting from the rightmost column of the window, and every column from its bottom row up.
+/// Rows which don't fill a whole group of 8 pixels at the top of the window are skipped.
+///
+/// The kernels pack 8 columns at a time, reading whole words from 8 consecutive rows, so the input is walked
+/// row-wise in narrow tiles instead of pixel by pixel down the columns.
+namespace bsp::eink
+{
+    struct FrameWindow
+    {
+        const std::uint8_t *data;
+        std::size_t stride;
+        std::uint16_t width;
+        std::uint16_t height;
+    };
+
+    /// Number of bytes the rotating kernels write for the window
+    std::size_t rotatedFrameSize(const FrameWindow &window, unsigned bitsPerPixel);
+
+    /// 1 bit per pixel, the most significant bit is the lowest row of the group
+    void rotateFrame1Bpp(const FrameWindow &window, std::uint8_t *out, bool invertColors);
+
+    /// 2 bits per pixel, 4 pixels per byte. With `binarize` set (A2/DU2 waveforms) every pixel but the
+    /// brightest level is turned to black.
+    void rotateFrame2Bpp(const FrameWindow &window, std::uint8_t *out, bool binarize, bool invertColors);
+
+    /// 4 bits per pixel, 2 pixels per byte - also used for 3bpp mode which has the same transfer format
+    void rotateFrame4Bpp(const FrameWindow &window, std::uint8_t *out, bool invertColors);
+
+    /// 4 bits per pixel without rotation, for displays mounted in the GUI orientation
+    void packFrame4Bpp(const FrameWindow &window, std::uint8_t *out, bool invertColors);
+} // namespace bsp::eink
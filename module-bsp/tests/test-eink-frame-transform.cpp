@@ -0,0 +1,205 @@
+// Copyright (c) 2017-2023, Mudita Sp. z.o.o. All rights reserved.
+// For licensing, see https://github.com/mudita/MuditaOS/LICENSE.md
+
+#include <catch2/catch.hpp>
+#include <module-bsp/bsp/eink/eink_frame_transform.hpp>
+#include <module-bsp/board/rt1051/bsp/eink/eink_binarization_luts.h>
+
+#include <chrono>
+#include <functional>
+#include <iostream>
+#include <random>
+#include <vector>
+
+using namespace bsp::eink;
+
+namespace
+{
+    /// Per-pixel loops the ED028TC1 driver used before, kept as the golden reference
+    namespace reference
+    {
+        constexpr std::uint8_t maskLut1Bpp[16] = {0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1};
+        constexpr std::uint8_t maskLut2Bpp[16] = {0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2, 3, 3, 3, 3};
+
+        void rotate1Bpp(const FrameWindow &window, std::uint8_t *out, bool invert)
+        {
+            for (std::int32_t col = window.width - 1; col >= 0; --col) {
+                for (std::int32_t row = window.height - 1; row >= 7; row -= 8) {
+                    std::uint8_t pixels = 0;
+                    for (std::int32_t i = 0; i < 8; ++i) {
+                        pixels |= maskLut1Bpp[window.data[(row - i) * window.stride + col]] << (7 - i);
+                    }
+                    *out++ = invert ? ~pixels : pixels;
+                }
+            }
+        }
+
+        void rotate2Bpp(const FrameWindow &window, std::uint8_t *out, bool binarize, bool invert)
+        {
+            for (std::int32_t col = window.width - 1; col >= 0; --col) {
+                for (std::int32_t row = window.height - 1; row >= 7; row -= 8) {
+                    for (std::int32_t half = 0; half < 2; ++half) {
+                        std::uint8_t pixels = 0;
+                        for (std::int32_t i = 0; i < 4; ++i) {
+                            pixels |= maskLut2Bpp[window.data[(row - 4 * half - i) * window.stride + col]]
+                                      << (6 - 2 * i);
+                        }
+                        if (binarize) {
+                            pixels = einkBinarizationLUT_2bpp[pixels];
+                        }
+                        *out++ = invert ? ~pixels : pixels;
+                    }
+                }
+            }
+        }
+
+        void rotate4Bpp(const FrameWindow &window, std::uint8_t *out, bool invert)
+        {
+            for (std::int32_t col = window.width - 1; col >= 0; --col) {
+                for (std::int32_t row = window.height - 1; row >= 7; row -= 8) {
+                    for (std::int32_t pair = 0; pair < 4; ++pair) {
+                        const auto index    = (row - 2 * pair) * window.stride + col;
+                        std::uint8_t pixels = (window.data[index] << 4) | window.data[index - window.stride];
+                        *out++              = invert ? ~pixels : pixels;
+                    }
+                }
+            }
+        }
+
+        void pack4Bpp(const FrameWindow &window, std::uint8_t *out, bool invert)
+        {
+            for (std::int32_t row = 0; row < window.height; ++row) {
+                for (std::int32_t col = window.width - 7; col >= 0; col -= 8) {
+                    const auto index = row * window.stride + col;
+                    for (std::int32_t pair = 3; pair >= 0; --pair) {
+                        std::uint8_t pixels = window.data[index + 2 * pair] | (window.data[index + 2 * pair + 1] << 4);
+                        *out++              = invert ? ~pixels : pixels;
+                    }
+                }
+            }
+        }
+    } // namespace reference
+
+    /// Frame of 4bpp gray levels, with one spare byte as the unrotated kernel reads one pixel past the row
+    std::vector<std::uint8_t> makeFrame(std::size_t width, std::size_t height, std::uint32_t seed)
+    {
+        std::vector<std::uint8_t> frame(width * height + 1);
+        std::mt19937 generator{seed};
+        std::uniform_int_distribution<int> grayLevel{0, 15};
+        for (auto &pixel : frame) {
+            pixel = grayLevel(generator);
+        }
+        return frame;
+    }
+
+    using Kernel = std::function<void(const FrameWindow &, std::uint8_t *, bool)>;
+
+    void requireSameAsReference(const FrameWindow &window, std::size_t outSize, Kernel kernel, Kernel golden)
+    {
+        for (const auto invert : {false, true}) {
+            std::vector<std::uint8_t> out(outSize + 1, 0xA5);
+            std::vector<std::uint8_t> expected(outSize + 1, 0xA5);
+            kernel(window, out.data(), invert);
+            golden(window, expected.data(), invert);
+            REQUIRE(out == expected);
+        }
+    }
+
+    const std::vector<FrameWindow> windowsOf(const std::vector<std::uint8_t> &frame, std::size_t stride)
+    {
+        const auto data = frame.data();
+        return {FrameWindow{data, stride, 480, 600},
+                FrameWindow{data, stride, 480, 60},
+                FrameWindow{data + 13 * stride + 5, stride, 37, 203},
+                FrameWindow{data + 7, stride, 8, 8},
+                FrameWindow{data + 3 * stride, stride, 5, 7},
+                FrameWindow{data, stride, 0, 16}};
+    }
+} // namespace
+
+TEST_CASE("Eink frame transform - golden pattern")
+{
+    // Single white pixel in the bottom right corner of an 8x8 window, everything else black
+    std::vector<std::uint8_t> frame(8 * 8, 0);
+    frame[7 * 8 + 7] = 15;
+    const FrameWindow window{frame.data(), 8, 8, 8};
+
+    SECTION("1bpp")
+    {
+        std::vector<std::uint8_t> out(rotatedFrameSize(window, 1));
+        rotateFrame1Bpp(window, out.data(), false);
+        REQUIRE(out == std::vector<std::uint8_t>{0x80, 0, 0, 0, 0, 0, 0, 0});
+    }
+
+    SECTION("2bpp")
+    {
+        std::vector<std::uint8_t> out(rotatedFrameSize(window, 2));
+        rotateFrame2Bpp(window, out.data(), false, true);
+        REQUIRE(out.front() == 0x3F);
+        REQUIRE(std::all_of(out.begin() + 1, out.end(), [](auto byte) { return byte == 0xFF; }));
+    }
+
+    SECTION("4bpp")
+    {
+        std::vector<std::uint8_t> out(rotatedFrameSize(window, 4));
+        rotateFrame4Bpp(window, out.data(), false);
+        REQUIRE(out.size() == 32);
+        REQUIRE(out.front() == 0xF0);
+        REQUIRE(std::all_of(out.begin() + 1, out.end(), [](auto byte) { return byte == 0; }));
+    }
+}
+
+TEST_CASE("Eink frame transform - same output as the per-pixel driver loops")
+{
+    for (const auto stride : {480U, 600U}) {
+        const auto frame = makeFrame(stride, 600, stride);
+        for (const auto &window : windowsOf(frame, stride)) {
+            if (window.width > stride) {
+                continue;
+            }
+            requireSameAsReference(window, rotatedFrameSize(window, 1), rotateFrame1Bpp, reference::rotate1Bpp);
+            requireSameAsReference(window, rotatedFrameSize(window, 4), rotateFrame4Bpp, reference::rotate4Bpp);
+            for (const auto binarize : {false, true}) {
+                using namespace std::placeholders;
+                requireSameAsReference(window,
+                                       rotatedFrameSize(window, 2),
+                                       std::bind(rotateFrame2Bpp, _1, _2, binarize, _3),
+                                       std::bind(reference::rotate2Bpp, _1, _2, binarize, _3));
+            }
+            requireSameAsReference(
+                window, window.width * window.height / 2, packFrame4Bpp, reference::pack4Bpp);
+        }
+    }
+}
+
+TEST_CASE("Eink frame transform - throughput", "[.benchmark]")
+{
+    constexpr auto width      = 480;
+    constexpr auto height     = 600;
+    constexpr auto iterations = 200;
+
+    const auto frame = makeFrame(width, height, 0);
+    const FrameWindow window{frame.data(), width, width, height};
+    std::vector<std::uint8_t> out(width * height / 2 + 1);
+
+    const auto measure = [&](const char *name, const Kernel &kernel) {
+        const auto start = std::chrono::steady_clock::now();
+        for (auto i = 0; i < iterations; ++i) {
+            kernel(window, out.data(), i % 2 == 0);
+        }
+        const auto elapsed = std::chrono::steady_clock::now() - start;
+        const auto us      = std::chrono::duration_cast<std::chrono::microseconds>(elapsed).count();
+        std::cout << name << ": " << static_cast<double>(us) / iterations << " us/frame, "
+                  << static_cast<double>(width) * height * iterations / us << " Mpx/s" << std::endl;
+    };
+
+    using namespace std::placeholders;
+    measure("1bpp per-pixel", reference::rotate1Bpp);
+    measure("1bpp", rotateFrame1Bpp);
+    measure("2bpp per-pixel", std::bind(reference::rotate2Bpp, _1, _2, true, _3));
+    measure("2bpp", std::bind(rotateFrame2Bpp, _1, _2, true, _3));
+    measure("4bpp per-pixel", reference::rotate4Bpp);
+    measure("4bpp", rotateFrame4Bpp);
+    measure("4bpp unrotated per-pixel", reference::pack4Bpp);
+    measure("4bpp unrotated", packFrame4Bpp);
+}
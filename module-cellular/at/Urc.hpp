@@ -1,4 +1,4 @@
-// Copyright (c) 2017-2021, Mudita Sp. z.o.o. All rights reserved.
+// Copyright (c) 2017-2023, Mudita Sp. z.o.o. All rights reserved.
 // For licensing, see https://github.com/mudita/MuditaOS/LICENSE.md
 
 #pragma once
@@ -6,6 +6,8 @@
 #include <Utils.hpp>
 #include "UrcHandler.hpp"
 
+#include <string_view>
+
 namespace at::urc
 
 {
@@ -13,12 +15,15 @@ namespace at::urc
     {
       public:
         /**
-         * Parses Urc body and constructs an instance.
+         * Parses Urc body and constructs an instance. The body is copied once, body and parameters are views into
+         * that copy, hence Urc can't be copied nor moved.
          * @param urcBody - Urc message body without the header
          * @param urcHead - Urc message head
-         * @param tokenDelimiter - sign that separates parameters in Urc message
          */
-        Urc(const std::string &urcBody, const std::string &urcHead = std::string());
+        Urc(std::string_view urcBody, std::string_view urcHead = {});
+
+        Urc(const Urc &) = delete;
+        Urc &operator=(const Urc &) = delete;
 
         virtual ~Urc() = default;
 
@@ -35,7 +40,7 @@ namespace at::urc
          * Gets vector of strings that represent Urc parameters.
          * @return vector or parameters in order of appearance in message
          */
-        auto getTokens() const -> std::vector<std::string>;
+        auto getTokens() const -> const std::vector<std::string_view> &;
 
         /**
          * Gets Urc body stripped of urc header.
@@ -43,7 +48,7 @@ namespace at::urc
          */
         auto getUrcBody() const -> std::string
         {
-            return urcBody;
+            return std::string{urcBody};
         }
 
         /**
@@ -71,17 +76,18 @@ namespace at::urc
         }
 
       protected:
-        std::vector<std::string> tokens;
-        std::string urcBody;
+        std::string message;
         std::string urcHead;
+        std::string_view urcBody;
+        std::vector<std::string_view> tokens;
 
         bool isUrcHandled = false;
 
         /**
          * Splits Urc into head and tokenized data, cleans tokens from whitespaces and quotes
-         * @param str - string to be split
+         * @param str - string to be split, tokens are views into it
          */
-        virtual void split(const std::string &str);
+        virtual void split(std::string_view str);
     };
 
 } // namespace at::urc
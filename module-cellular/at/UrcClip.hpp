@@ -1,4 +1,4 @@
-// Copyright (c) 2017-2021, Mudita Sp. z.o.o. All rights reserved.
+// Copyright (c) 2017-2023, Mudita Sp. z.o.o. All rights reserved.
 // For licensing, see https://github.com/mudita/MuditaOS/LICENSE.md
 
 #pragma once
@@ -31,10 +31,6 @@ namespace at::urc
         };
 
         static constexpr std::string_view head = "+CLIP";
-        static bool isURC(const std::string &uHead)
-        {
-            return uHead.find(Clip::head) != std::string::npos;
-        }
 
         using Urc::Urc;
 
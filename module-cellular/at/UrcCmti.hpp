@@ -1,4 +1,4 @@
-// Copyright (c) 2017-2021, Mudita Sp. z.o.o. All rights reserved.
+// Copyright (c) 2017-2023, Mudita Sp. z.o.o. All rights reserved.
 // For licensing, see https://github.com/mudita/MuditaOS/LICENSE.md
 
 #pragma once
@@ -17,10 +17,6 @@ namespace at::urc
 
       public:
         static constexpr std::string_view head = "+CMTI";
-        static auto isURC(const std::string &uHead) -> bool
-        {
-            return uHead.find(Cmti::head) != std::string::npos;
-        }
 
         using Urc::Urc;
 
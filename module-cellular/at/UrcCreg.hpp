@@ -1,4 +1,4 @@
-// Copyright (c) 2017-2021, Mudita Sp. z.o.o. All rights reserved.
+// Copyright (c) 2017-2023, Mudita Sp. z.o.o. All rights reserved.
 // For licensing, see https://github.com/mudita/MuditaOS/LICENSE.md
 
 #pragma once
@@ -24,10 +24,6 @@ namespace at::urc
 
       public:
         static constexpr std::string_view head = "+CREG";
-        static bool isURC(const std::string &uHead)
-        {
-            return uHead.find(Creg::head) != std::string::npos;
-        }
 
         using Urc::Urc;
 
@@ -1,4 +1,4 @@
-// Copyright (c) 2017-2021, Mudita Sp. z.o.o. All rights reserved.
+// Copyright (c) 2017-2023, Mudita Sp. z.o.o. All rights reserved.
 // For licensing, see https://github.com/mudita/MuditaOS/LICENSE.md
 
 #pragma once
@@ -19,7 +19,7 @@ namespace at::urc
 
         bool valid_ = true;
 
-        auto split(const std::string &str) -> void override;
+        auto split(std::string_view str) -> void override;
         [[nodiscard]] auto getDCS() const noexcept -> std::optional<int>;
 
       public:
@@ -35,9 +35,8 @@ namespace at::urc
 
         static constexpr std::string_view head = "+CUSD";
 
-        explicit Cusd(const std::string &urcBody, const std::string &urcHead = {});
+        explicit Cusd(std::string_view urcBody, std::string_view urcHead = {});
 
-        static auto isURC(const std::string &uHead) -> bool;
         [[nodiscard]] auto isValid() const noexcept -> bool override;
         [[nodiscard]] auto isActionNeeded() const noexcept -> bool;
         [[nodiscard]] auto getMessage() const noexcept -> std::optional<std::string>;
@@ -1,11 +1,12 @@
-// Copyright (c) 2017-2022, Mudita Sp. z.o.o. All rights reserved.
+// Copyright (c) 2017-2023, Mudita Sp. z.o.o. All rights reserved.
 // For licensing, see https://github.com/mudita/MuditaOS/LICENSE.md
 
 #pragma once
 
-#include <memory>
 #include "Urc.hpp"
+
 #include <memory>
+#include <string_view>
 
 namespace at::urc
 {
@@ -13,10 +14,11 @@ namespace at::urc
     {
       public:
         /**
-         * Instantiates concrete Urc class on a base of Urc message body.
+         * Instantiates concrete Urc class on a base of Urc message body. The head is looked up in a sorted table of
+         * known heads, the longest matching head selects the Urc class.
          * @param urcMessage - Urc message to be parsed
          * @return pointer to Urc
          */
-        static std::unique_ptr<Urc> Create(const std::string &urcMessage);
+        static std::unique_ptr<Urc> Create(std::string_view urcMessage);
     };
 } // namespace at::urc
@@ -1,4 +1,4 @@
-// Copyright (c) 2017-2021, Mudita Sp. z.o.o. All rights reserved.
+// Copyright (c) 2017-2023, Mudita Sp. z.o.o. All rights reserved.
 // For licensing, see https://github.com/mudita/MuditaOS/LICENSE.md
 
 #pragma once
@@ -12,12 +12,6 @@ namespace at::urc
       public:
         static constexpr std::string_view head_immediate = "POWERED DOWN";
         static constexpr std::string_view head_normal    = "NORMAL POWER DOWN";
-        static auto isURC(const std::string &uHead) -> bool
-        {
-            auto isImmediatePowerDown = uHead.find(PoweredDown::head_immediate) != std::string::npos;
-            auto isNormalPowerDown    = uHead.find(PoweredDown::head_normal) != std::string::npos;
-            return isImmediatePowerDown || isNormalPowerDown;
-        }
 
         using Urc::Urc;
 
@@ -1,4 +1,4 @@
-// Copyright (c) 2017-2021, Mudita Sp. z.o.o. All rights reserved.
+// Copyright (c) 2017-2023, Mudita Sp. z.o.o. All rights reserved.
 // For licensing, see https://github.com/mudita/MuditaOS/LICENSE.md
 
 #pragma once
@@ -11,8 +11,7 @@ namespace at::urc
 {
     class QSimstat : public Urc
     {
-        static constexpr std::string_view head = "+QSIMSTAT";
-        const size_t minParametersCount        = 2;
+        const size_t minParametersCount = 2;
 
         enum class Tokens
         {
@@ -21,10 +20,7 @@ namespace at::urc
         };
 
       public:
-        static bool isURC(const std::string &uHead)
-        {
-            return uHead.find(QSimstat::head) != std::string::npos;
-        }
+        static constexpr std::string_view head = "+QSIMSTAT";
 
         using Urc::Urc;
 
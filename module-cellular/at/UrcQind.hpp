@@ -1,4 +1,4 @@
-// Copyright (c) 2017-2021, Mudita Sp. z.o.o. All rights reserved.
+// Copyright (c) 2017-2023, Mudita Sp. z.o.o. All rights reserved.
 // For licensing, see https://github.com/mudita/MuditaOS/LICENSE.md
 
 #pragma once
@@ -11,11 +11,10 @@ namespace at::urc
 {
     class Qind : public Urc
     {
-
-        const std::string type_csq           = "csq";
-        const std::string type_fota          = "FOTA";
-        const std::string type_act           = "act";
-        const std::string_view type_sms_done = "SMS DONE";
+        static constexpr std::string_view type_csq      = "csq";
+        static constexpr std::string_view type_fota     = "FOTA";
+        static constexpr std::string_view type_act      = "act";
+        static constexpr std::string_view type_sms_done = "SMS DONE";
 
         static const auto invalid_rssi_low  = 99;
         static const auto invalid_rssi_high = 199;
@@ -57,10 +56,6 @@ namespace at::urc
         };
 
         static constexpr std::string_view head = "+QIND";
-        static auto isURC(const std::string &uHead) -> bool
-        {
-            return uHead.find(Qind::head) != std::string::npos;
-        }
 
         using Urc::Urc;
 
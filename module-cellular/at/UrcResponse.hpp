@@ -1,4 +1,4 @@
-// Copyright (c) 2017-2021, Mudita Sp. z.o.o. All rights reserved.
+// Copyright (c) 2017-2023, Mudita Sp. z.o.o. All rights reserved.
 // For licensing, see https://github.com/mudita/MuditaOS/LICENSE.md
 
 #pragma once
@@ -10,7 +10,6 @@ namespace at::urc
     class UrcResponse : public Urc
     {
       public:
-        // this table has to be aligned with responseBodies
         enum class URCResponseType
         {
             Ok,
@@ -23,17 +22,7 @@ namespace at::urc
             NoAnswer
         };
 
-        static auto isURC(const std::string &uHead) -> std::optional<URCResponseType>
-        {
-            for (auto &resp : urcResponses) {
-                if (uHead.find(resp.second) != std::string::npos) {
-                    return resp.first;
-                }
-            }
-            return std::nullopt;
-        }
-
-        explicit UrcResponse(URCResponseType type) : Urc(std::string()), type(type){};
+        explicit UrcResponse(URCResponseType type) : Urc(std::string_view{}), type(type){};
 
         auto getURCResponseType() const noexcept -> URCResponseType;
 
@@ -44,16 +33,5 @@ namespace at::urc
 
       private:
         URCResponseType type;
-
-        static constexpr std::array<std::pair<URCResponseType, std::string_view>, 8> urcResponses = {{
-            {URCResponseType::Ok, "OK"},
-            {URCResponseType::Connect, "CONNECT"},
-            {URCResponseType::Ring, "RING"},
-            {URCResponseType::NoCarrier, "NO CARRIER"},
-            {URCResponseType::Error, "ERROR"},
-            {URCResponseType::NoDialtone, "NO DIALTONE"},
-            {URCResponseType::Busy, "BUSY"},
-            {URCResponseType::NoAnswer, "NO ANSWER"},
-        }};
     };
 } // namespace at::urc
@@ -1,4 +1,4 @@
-// Copyright (c) 2017-2021, Mudita Sp. z.o.o. All rights reserved.
+// Copyright (c) 2017-2023, Mudita Sp. z.o.o. All rights reserved.
 // For licensing, see https://github.com/mudita/MuditaOS/LICENSE.md
 
 #pragma once
@@ -24,11 +24,6 @@ namespace at::urc
         static constexpr std::string_view headUnsolicited = "+CRING";
         static constexpr std::string_view headNormal      = "RING";
 
-        static auto isURC(const std::string &uHead) -> bool
-        {
-            return uHead.find(Ring::headUnsolicited) == 0 || uHead.find(Ring::headNormal) == 0;
-        }
-
         using Urc::Urc;
 
         [[nodiscard]] auto isValid() const noexcept -> bool override;
@@ -0,0 +1,38 @@
+// Copyright (c) 2017-2023, Mudita Sp. z.o.o. All rights reserved.
+// For licensing, see https://github.com/mudita/MuditaOS/LICENSE.md
+
+#pragma once
+
+#include <string_view>
+#include <vector>
+
+namespace at::urc
+{
+    /// Urc message split at the head delimiter, both parts are views into the message
+    struct UrcMessage
+    {
+        std::string_view head; ///< Trimmed head, the whole trimmed message if it has no ':'
+        std::string_view body; ///< Untrimmed text after ':', the whole message if it has no ':'
+    };
+
+    /**
+     * Strips whitespaces from both ends of the text.
+     * @param text - text to be trimmed
+     * @return view into the text
+     */
+    auto trim(std::string_view text) noexcept -> std::string_view;
+
+    /**
+     * Splits Urc message into its head and body without copying it.
+     * @param message - Urc message to be split
+     */
+    auto splitMessage(std::string_view message) noexcept -> UrcMessage;
+
+    /**
+     * Splits Urc body into parameters without copying them. Parameters are separated with ',', trimmed and stripped
+     * of the enclosing quotes. Trailing delimiter doesn't start an empty parameter.
+     * @param body - Urc body without the head
+     * @param tokens - views into the body, in order of appearance
+     */
+    void tokenize(std::string_view body, std::vector<std::string_view> &tokens);
+} // namespace at::urc
@@ -92,7 +92,7 @@ namespace at
             {AT::DISABLE_TIME_ZONE_REPORTING, std::make_shared<Cmd>("AT+CTZR=0")},
             {AT::ENABLE_NETWORK_REGISTRATION_URC, std::make_shared<Cmd>("AT+CREG=2")},
             {AT::SET_SMS_TEXT_MODE_UCS2, std::make_shared<Cmd>("AT+CSMP=17,167,0,8")},
-            {AT::LIST_MESSAGES, std::make_shared<Cmd>("AT+CMGL=\"ALL\"")},
+            {AT::LIST_MESSAGES, std::make_shared<Cmd>("AT+CMGL=\"ALL\"", 180s)},
             {AT::GET_IMEI, std::make_shared<Cmd>("AT+GSN")},
             {AT::CCFC, std::make_shared<Cmd>("AT+CCFC=")},
             {AT::CCWA, std::make_shared<Cmd>("AT+CCWA=")},
@@ -1,29 +1,23 @@
-// Copyright (c) 2017-2021, Mudita Sp. z.o.o. All rights reserved.
+// Copyright (c) 2017-2023, Mudita Sp. z.o.o. All rights reserved.
 // For licensing, see https://github.com/mudita/MuditaOS/LICENSE.md
 
 #include <Urc.hpp>
-#include <algorithm>
+#include <UrcTokenizer.hpp>
 
 namespace at::urc
 {
-    Urc::Urc(const std::string &urcBody, const std::string &urcHead) : urcBody(utils::trim(urcBody)), urcHead(urcHead)
+    Urc::Urc(std::string_view urcBody, std::string_view urcHead)
+        : message(urcBody), urcHead(urcHead), urcBody(trim(message))
     {
-        split(urcBody);
+        split(message);
     }
 
-    void Urc::split(const std::string &str)
+    void Urc::split(std::string_view str)
     {
-        constexpr char tokenDelimiter = ',';
-
-        tokens                            = utils::split(str, tokenDelimiter);
-        constexpr auto urcStringDelimiter = "\"";
-        for (auto &t : tokens) {
-            utils::findAndReplaceAll(t, urcStringDelimiter, "");
-            t = utils::trim(t);
-        }
+        tokenize(str, tokens);
     }
 
-    auto Urc::getTokens() const -> std::vector<std::string>
+    auto Urc::getTokens() const -> const std::vector<std::string_view> &
     {
         return tokens;
     }
@@ -1,4 +1,4 @@
-// Copyright (c) 2017-2021, Mudita Sp. z.o.o. All rights reserved.
+// Copyright (c) 2017-2023, Mudita Sp. z.o.o. All rights reserved.
 // For licensing, see https://github.com/mudita/MuditaOS/LICENSE.md
 
 #include "UrcClip.hpp"
@@ -15,7 +15,7 @@ std::string Clip::getNumber() const
     if (!isValid()) {
         return std::string();
     }
-    return tokens[magic_enum::enum_integer(Tokens::Number)];
+    return std::string{tokens[magic_enum::enum_integer(Tokens::Number)]};
 };
 
 std::optional<Clip::AddressType> Clip::getType() const
@@ -24,7 +24,7 @@ std::optional<Clip::AddressType> Clip::getType() const
         return std::nullopt;
     }
 
-    auto addressType = utils::getNumericValue<int>(tokens[magic_enum::enum_integer(Tokens::Type)]);
+    auto addressType = utils::getNumericValue<int>(std::string{tokens[magic_enum::enum_integer(Tokens::Type)]});
 
     constexpr auto addressTypes = magic_enum::enum_values<Clip::AddressType>();
     for (const auto &type : addressTypes) {
@@ -45,7 +45,7 @@ std::optional<std::string> Clip::getSubaddr() const
     if (tokens[magic_enum::enum_integer(Tokens::Subaddr)].empty()) {
         return std::nullopt;
     }
-    return tokens[magic_enum::enum_integer(Tokens::Subaddr)];
+    return std::string{tokens[magic_enum::enum_integer(Tokens::Subaddr)]};
 };
 
 std::optional<std::string> Clip::getSatype() const
@@ -57,7 +57,7 @@ std::optional<std::string> Clip::getSatype() const
     if (tokens[magic_enum::enum_integer(Tokens::Satype)].empty()) {
         return std::nullopt;
     }
-    return tokens[magic_enum::enum_integer(Tokens::Satype)];
+    return std::string{tokens[magic_enum::enum_integer(Tokens::Satype)]};
 };
 
 std::optional<std::string> Clip::getAlpha() const
@@ -69,7 +69,7 @@ std::optional<std::string> Clip::getAlpha() const
     if (tokens[magic_enum::enum_integer(Tokens::Alpha)].empty()) {
         return std::nullopt;
     }
-    return tokens[magic_enum::enum_integer(Tokens::Alpha)];
+    return std::string{tokens[magic_enum::enum_integer(Tokens::Alpha)]};
 };
 
 std::optional<std::string> Clip::getCLIValidity() const
@@ -81,5 +81,5 @@ std::optional<std::string> Clip::getCLIValidity() const
     if (tokens[magic_enum::enum_integer(Tokens::CLIValidity)].empty()) {
         return std::nullopt;
     }
-    return tokens[magic_enum::enum_integer(Tokens::CLIValidity)];
+    return std::string{tokens[magic_enum::enum_integer(Tokens::CLIValidity)]};
 };
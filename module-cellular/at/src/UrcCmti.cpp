@@ -1,4 +1,4 @@
-// Copyright (c) 2017-2021, Mudita Sp. z.o.o. All rights reserved.
+// Copyright (c) 2017-2023, Mudita Sp. z.o.o. All rights reserved.
 // For licensing, see https://github.com/mudita/MuditaOS/LICENSE.md
 
 #include "UrcCmti.hpp"
@@ -15,7 +15,7 @@ std::string Cmti::getMemory() const
     if (!isValid()) {
         return std::string();
     }
-    return tokens[Tokens::Mem];
+    return std::string{tokens[Tokens::Mem]};
 }
 
 std::string Cmti::getIndex() const
@@ -23,5 +23,5 @@ std::string Cmti::getIndex() const
     if (!isValid()) {
         return std::string();
     }
-    return tokens[Tokens::Index];
+    return std::string{tokens[Tokens::Index]};
 }
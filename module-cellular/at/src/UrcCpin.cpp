@@ -1,4 +1,4 @@
-// Copyright (c) 2017-2021, Mudita Sp. z.o.o. All rights reserved.
+// Copyright (c) 2017-2023, Mudita Sp. z.o.o. All rights reserved.
 // For licensing, see https://github.com/mudita/MuditaOS/LICENSE.md
 
 #include "UrcCpin.hpp"
@@ -44,7 +44,7 @@ auto Cpin::getMessage() const noexcept -> std::optional<std::string>
     if (!isValid()) {
         return std::nullopt;
     }
-    return tokens[Tokens::State];
+    return std::string{tokens[Tokens::State]};
 }
 
 auto Cpin::getState() const noexcept -> std::optional<at::SimState>
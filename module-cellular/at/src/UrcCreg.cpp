@@ -1,4 +1,4 @@
-// Copyright (c) 2017-2021, Mudita Sp. z.o.o. All rights reserved.
+// Copyright (c) 2017-2023, Mudita Sp. z.o.o. All rights reserved.
 // For licensing, see https://github.com/mudita/MuditaOS/LICENSE.md
 
 #include <UrcCreg.hpp>
@@ -26,7 +26,7 @@ auto Creg::getStatus() const noexcept -> Store::Network::Status
     if (isValid()) {
         int statusInt;
         try {
-            statusInt = std::stoi(tokens[Tokens::Stat]);
+            statusInt = std::stoi(std::string{tokens[Tokens::Stat]});
         }
         catch (const std::exception &e) {
             return Store::Network::Status::Unknown;
@@ -43,7 +43,7 @@ auto Creg::getStatus() const noexcept -> Store::Network::Status
 auto Creg::getLocation() const noexcept -> std::optional<std::string>
 {
     if (isValid() && isExtended()) {
-        auto location = tokens[Tokens::Lac];
+        auto location = std::string{tokens[Tokens::Lac]};
         utils::findAndReplaceAll(location, "\"", "");
         return location;
     }
@@ -54,7 +54,7 @@ auto Creg::getLocation() const noexcept -> std::optional<std::string>
 auto Creg::getCellId() const noexcept -> std::optional<std::string>
 {
     if (isValid() && isExtended()) {
-        auto cellId = tokens[Tokens::Ci];
+        auto cellId = std::string{tokens[Tokens::Ci]};
         utils::findAndReplaceAll(cellId, "\"", "");
         return cellId;
     }
@@ -67,7 +67,7 @@ auto Creg::getAccessTechnology() const noexcept -> Store::Network::AccessTechnol
     if (isValid() && isExtended()) {
         int accessTechnologyInt;
         try {
-            accessTechnologyInt = std::stoi(tokens[Tokens::Act]);
+            accessTechnologyInt = std::stoi(std::string{tokens[Tokens::Act]});
         }
         catch (const std::exception &e) {
             return Store::Network::AccessTechnology::Unknown;
@@ -1,4 +1,4 @@
-// Copyright (c) 2017-2021, Mudita Sp. z.o.o. All rights reserved.
+// Copyright (c) 2017-2023, Mudita Sp. z.o.o. All rights reserved.
 // For licensing, see https://github.com/mudita/MuditaOS/LICENSE.md
 
 #include "../UrcCtze.hpp"
@@ -16,7 +16,7 @@ auto Ctze::isValid() const noexcept -> bool
 
 int Ctze::getTimeZoneOffset() const
 {
-    const std::string &tzOffsetToken = tokens[static_cast<uint32_t>(Tokens::GMTDifference)];
+    const std::string tzOffsetToken{tokens[static_cast<uint32_t>(Tokens::GMTDifference)]};
 
     auto offsetInQuartersOfHour = utils::getNumericValue<int>(tzOffsetToken);
 
@@ -32,8 +32,8 @@ int Ctze::getTimeZoneOffset() const
 
 std::string Ctze::getTimeZoneString() const
 {
-    std::string timeZoneStr = tokens[static_cast<uint32_t>(Tokens::GMTDifference)] + "," +
-                              tokens[static_cast<uint32_t>(Tokens::DaylightSavingsAdjustment)];
+    std::string timeZoneStr{tokens[static_cast<uint32_t>(Tokens::GMTDifference)]};
+    timeZoneStr.append(",").append(tokens[static_cast<uint32_t>(Tokens::DaylightSavingsAdjustment)]);
     timeZoneStr.erase(remove_if(timeZoneStr.begin(), timeZoneStr.end(), isspace), timeZoneStr.end());
     return timeZoneStr;
 }
@@ -41,8 +41,9 @@ std::string Ctze::getTimeZoneString() const
 const struct tm Ctze::getGMTTime(void) const
 {
     struct tm timeinfo = {};
-    std::stringstream stream(tokens[static_cast<uint32_t>(Tokens::Date)] + "," +
-                             tokens[static_cast<uint32_t>(Tokens::Time)]);
+    std::string dateTimeStr{tokens[static_cast<uint32_t>(Tokens::Date)]};
+    dateTimeStr.append(",").append(tokens[static_cast<uint32_t>(Tokens::Time)]);
+    std::stringstream stream(dateTimeStr);
     stream >> std::get_time(&timeinfo, "%Y/%m/%d,%H:%M:%S");
     if (stream.fail()) {
         LOG_ERROR("Failed to parse Ctze time");
@@ -56,13 +57,14 @@ auto Ctze::getTimeInfo() const noexcept -> tm
 
     std::tm timeinfo{};
     if (isValid()) {
-        std::string dateTimeStr(tokens[Tokens::Date] + "," + tokens[Tokens::Time]);
+        std::string dateTimeStr{tokens[Tokens::Date]};
+        dateTimeStr.append(",").append(tokens[Tokens::Time]);
 
         std::stringstream stream(dateTimeStr);
         date::sys_seconds tp;
         stream >> date::parse("%Y/%m/%d,%H:%M:%S", tp);
 
-        auto gmtDifferenceStr = tokens[Tokens::GMTDifference];
+        const std::string gmtDifferenceStr{tokens[Tokens::GMTDifference]};
 
         int gmtDifference = utils::getNumericValue<int>(gmtDifferenceStr);
         auto time         = system_clock::to_time_t(tp) +
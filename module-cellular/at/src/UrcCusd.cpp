@@ -7,20 +7,15 @@
 
 using namespace at::urc;
 
-auto Cusd::isURC(const std::string &uHead) -> bool
-{
-    return uHead == head;
-}
-
 auto Cusd::Handle(UrcHandler &h) -> void
 {
     h.Handle(*this);
 }
 
-Cusd::Cusd(const std::string &urcBody, const std::string &urcHead) : Urc(urcBody, urcHead)
+Cusd::Cusd(std::string_view urcBody, std::string_view urcHead) : Urc(urcBody, urcHead)
 {
     try {
-        split(urcBody);
+        split(message);
 
         // MOS-858: decide whether to try to display anything or to bail out
         int constexpr supportedAlphabets[]{0, 15};
@@ -58,7 +53,7 @@ auto Cusd::getMessage() const noexcept -> std::optional<std::string>
     }
 
     if (auto const &messageToken = tokens[Tokens::Response]; !messageToken.empty()) {
-        return std::make_optional(messageToken);
+        return std::make_optional(std::string{messageToken});
     }
 
     return std::nullopt;
@@ -66,34 +61,36 @@ auto Cusd::getMessage() const noexcept -> std::optional<std::string>
 
 auto Cusd::getStatus() const noexcept -> StatusType
 {
-    return *magic_enum::enum_cast<StatusType>(std::stoi(tokens[Tokens::Status]));
+    return *magic_enum::enum_cast<StatusType>(std::stoi(std::string{tokens[Tokens::Status]}));
 }
 
 auto Cusd::getDCS() const noexcept -> std::optional<int>
 {
     if (auto const &dcsToken = tokens[Tokens::DCS]; !dcsToken.empty()) {
-        return std::make_optional(std::stoi(dcsToken));
+        return std::make_optional(std::stoi(std::string{dcsToken}));
     }
 
     return std::nullopt;
 }
 
-auto Cusd::split(const std::string &str) -> void
+auto Cusd::split(std::string_view str) -> void
 {
     auto constexpr maxNumberOfDcsTokens = 3;
     tokens.resize(maxNumberOfDcsTokens);
 
     using namespace re2;
-    re2::StringPiece input(str);
+    re2::StringPiece input(str.data(), str.size());
+    re2::StringPiece token;
 
     auto constexpr numberOfStatusTypes = magic_enum::enum_count<StatusType>();
     static_assert(numberOfStatusTypes <= 9,
                   "StatusType: too many enum entries to handle - please revise regex/algorithm");
     std::string const regexForStatus(" ([0-" + std::to_string(numberOfStatusTypes) + "])");
 
-    if (!RE2::Consume(&input, regexForStatus, &tokens[Tokens::Status])) {
+    if (!RE2::Consume(&input, regexForStatus, &token)) {
         throw std::runtime_error("unrecognized CUSD status field or corrupted CUSD format");
     }
+    tokens[Tokens::Status] = std::string_view(token.data(), token.size());
 
     auto noFurtherInput = [&input]() { return input == "\r\n"; };
 
@@ -115,7 +112,7 @@ auto Cusd::split(const std::string &str) -> void
         auto messageStartPosition = startQuotationMarkPosition + 1;
         auto messageEndPosition   = endQuotationMarkPosition;
         auto messageLength        = messageEndPosition - messageStartPosition;
-        tokens[Tokens::Response]  = input.substr(messageStartPosition, messageLength).as_string();
+        tokens[Tokens::Response]  = std::string_view(input.data() + messageStartPosition, messageLength);
     }
 
     input.remove_prefix(endQuotationMarkPosition + 1);
@@ -123,7 +120,8 @@ auto Cusd::split(const std::string &str) -> void
         return;
     }
 
-    if (!RE2::FullMatch(input, ",([0-9]+)\r\n", &tokens[Tokens::DCS])) {
+    if (!RE2::FullMatch(input, ",([0-9]+)\r\n", &token)) {
         throw std::runtime_error("corrupted CUSD format");
     }
+    tokens[Tokens::DCS] = std::string_view(token.data(), token.size());
 }
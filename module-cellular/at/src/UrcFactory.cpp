@@ -2,6 +2,7 @@
 // For licensing, see https://github.com/mudita/MuditaOS/LICENSE.md
 
 #include <UrcFactory.hpp>
+#include <UrcTokenizer.hpp>
 
 #include <UrcCreg.hpp>
 #include <UrcCtze.hpp>
@@ -16,53 +17,111 @@
 #include <UrcRing.hpp>
 #include <UrcQSimstat.hpp>
 
+#include <algorithm>
+#include <array>
+
 using namespace at::urc;
 
-std::unique_ptr<Urc> UrcFactory::Create(const std::string &urcMessage)
+namespace
 {
-    if (urcMessage.empty()) {
-        return std::make_unique<Urc>(std::string());
-    }
-    const auto headDelimiter = ':';
-    const auto it            = std::find(urcMessage.begin(), urcMessage.end(), headDelimiter);
-    const auto &head         = utils::trim(std::string(urcMessage.begin(), it));
-    const auto &body         = std::string(it == urcMessage.end() ? urcMessage.begin() : it + 1, urcMessage.end());
+    using Creator = std::unique_ptr<Urc> (*)(std::string_view body);
 
-    if (Ctze::isURC(head)) {
-        return std::make_unique<Ctze>(body);
-    }
-    else if (Creg::isURC(head)) {
-        return std::make_unique<Creg>(body);
-    }
-    else if (Qind::isURC(head)) {
-        return std::make_unique<Qind>(body);
-    }
-    else if (Cusd::isURC(head)) {
-        return std::make_unique<Cusd>(body);
-    }
-    else if (Cmti::isURC(head)) {
-        return std::make_unique<Cmti>(body);
-    }
-    else if (Clip::isURC(head)) {
-        return std::make_unique<Clip>(body);
-    }
-    else if (Cpin::isURC(head)) {
-        return std::make_unique<Cpin>(body);
+    enum class Match
+    {
+        Prefix, ///< Head starts with the entry, e.g. "+CREG 0" without the delimiter
+        Exact   ///< Head is equal to the entry
+    };
+
+    struct Entry
+    {
+        std::string_view head;
+        Match match;
+        Creator create;
+    };
+
+    template <typename T>
+    std::unique_ptr<Urc> create(std::string_view body)
+    {
+        return std::make_unique<T>(body);
     }
-    else if (PoweredDown::isURC(head)) {
-        return std::make_unique<PoweredDown>(body);
+
+    template <UrcResponse::URCResponseType type>
+    std::unique_ptr<Urc> createResponse(std::string_view)
+    {
+        return std::make_unique<UrcResponse>(type);
     }
-    else if (Ring::isURC(head)) {
-        return std::make_unique<Ring>(body);
+
+    using ResponseType = UrcResponse::URCResponseType;
+
+    /// Has to be sorted by the head, so the heads which are prefixes of the looked up one precede it
+    constexpr std::array urcTable{
+        Entry{Clip::head, Match::Prefix, create<Clip>},
+        Entry{Cmti::head, Match::Prefix, create<Cmti>},
+        Entry{Cpin::head, Match::Prefix, create<Cpin>},
+        Entry{Creg::head, Match::Prefix, create<Creg>},
+        Entry{Ring::headUnsolicited, Match::Prefix, create<Ring>},
+        Entry{Ctze::head, Match::Prefix, create<Ctze>},
+        Entry{Cusd::head, Match::Exact, create<Cusd>},
+        Entry{Qind::head, Match::Prefix, create<Qind>},
+        Entry{Qiurc::head, Match::Prefix, create<Qiurc>},
+        Entry{QSimstat::head, Match::Prefix, create<QSimstat>},
+        Entry{"BUSY", Match::Prefix, createResponse<ResponseType::Busy>},
+        Entry{"CONNECT", Match::Prefix, createResponse<ResponseType::Connect>},
+        Entry{"ERROR", Match::Prefix, createResponse<ResponseType::Error>},
+        Entry{"NO ANSWER", Match::Prefix, createResponse<ResponseType::NoAnswer>},
+        Entry{"NO CARRIER", Match::Prefix, createResponse<ResponseType::NoCarrier>},
+        Entry{"NO DIALTONE", Match::Prefix, createResponse<ResponseType::NoDialtone>},
+        Entry{PoweredDown::head_normal, Match::Prefix, create<PoweredDown>},
+        Entry{"OK", Match::Prefix, createResponse<ResponseType::Ok>},
+        Entry{PoweredDown::head_immediate, Match::Prefix, create<PoweredDown>},
+        Entry{Ring::headNormal, Match::Prefix, create<Ring>},
+    };
+
+    constexpr bool isSorted(const decltype(urcTable) &table)
+    {
+        for (std::size_t i = 1; i < table.size(); ++i) {
+            if (!(table[i - 1].head < table[i].head)) {
+                return false;
+            }
+        }
+        return true;
     }
-    else if (auto type = UrcResponse::isURC(head)) {
-        return std::make_unique<UrcResponse>(type.value());
+    static_assert(isSorted(urcTable), "Urc table has to be sorted by the head");
+
+    const Entry *findEntry(std::string_view head)
+    {
+        if (head.empty()) {
+            return nullptr;
+        }
+
+        // Entries which are prefixes of the head sort before it, the closest one is the longest
+        auto it = std::upper_bound(
+            urcTable.begin(), urcTable.end(), head, [](std::string_view h, const Entry &e) { return h < e.head; });
+        while (it != urcTable.begin()) {
+            --it;
+            if (it->head.front() != head.front()) {
+                break;
+            }
+            if (head.compare(0, it->head.size(), it->head) != 0) {
+                continue;
+            }
+            if (it->match == Match::Prefix || it->head.size() == head.size()) {
+                return it;
+            }
+        }
+        return nullptr;
     }
-    else if (Qiurc::isURC(head)) {
-        return std::make_unique<Qiurc>(body);
+} // namespace
+
+std::unique_ptr<Urc> UrcFactory::Create(std::string_view urcMessage)
+{
+    if (urcMessage.empty()) {
+        return std::make_unique<Urc>(std::string_view{});
     }
-    else if (QSimstat::isURC(head)) {
-        return std::make_unique<QSimstat>(body);
+
+    const auto [head, body] = splitMessage(urcMessage);
+    if (const auto entry = findEntry(head); entry != nullptr) {
+        return entry->create(body);
     }
 
     return std::make_unique<Urc>(body, head);
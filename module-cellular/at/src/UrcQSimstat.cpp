@@ -1,4 +1,4 @@
-// Copyright (c) 2017-2021, Mudita Sp. z.o.o. All rights reserved.
+// Copyright (c) 2017-2023, Mudita Sp. z.o.o. All rights reserved.
 // For licensing, see https://github.com/mudita/MuditaOS/LICENSE.md
 
 #include "UrcQSimstat.hpp"
@@ -12,7 +12,7 @@ auto QSimstat::isValid() const noexcept -> bool
 auto QSimstat::getInsertedStatus() const noexcept -> std::optional<at::SimInsertedStatus>
 {
     auto status = 0;
-    if (utils::toNumeric(tokens[magic_enum::enum_integer(Tokens::InsertedStatus)], status) &&
+    if (utils::toNumeric(std::string{tokens[magic_enum::enum_integer(Tokens::InsertedStatus)]}, status) &&
         magic_enum::enum_contains<SimInsertedStatus>(status)) {
         return static_cast<SimInsertedStatus>(status);
     }
@@ -21,7 +21,7 @@ auto QSimstat::getInsertedStatus() const noexcept -> std::optional<at::SimInsert
 auto QSimstat::getEnabled() const noexcept -> std::optional<at::SimInsertedStatusEnable>
 {
     auto enabled = 0;
-    if (utils::toNumeric(tokens[magic_enum::enum_integer(Tokens::Enable)], enabled) &&
+    if (utils::toNumeric(std::string{tokens[magic_enum::enum_integer(Tokens::Enable)]}, enabled) &&
         magic_enum::enum_contains<at::SimInsertedStatusEnable>(enabled)) {
         return static_cast<at::SimInsertedStatusEnable>(enabled);
     }
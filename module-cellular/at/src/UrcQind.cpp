@@ -41,7 +41,7 @@ auto Qind::getFotaStage() const noexcept -> std::optional<FotaStage>
 auto Qind::getFotaParameter() const noexcept -> std::string
 {
     if (isFotaValid() && tokens.size() > fotaMinTokenSize) {
-        return tokens[Param];
+        return std::string{tokens[Param]};
     }
     return std::string();
 }
@@ -56,8 +56,8 @@ auto Qind::validate(enum CSQ check) const noexcept -> bool
 {
     try {
         if (isCsq()) {
-            int rssi = std::stoi(tokens[RSSI]);
-            int ber  = std::stoi(tokens[BER]);
+            int rssi = std::stoi(std::string{tokens[RSSI]});
+            int ber  = std::stoi(std::string{tokens[BER]});
             LOG_DEBUG("> %d %d", rssi, ber);
             switch (check) {
             case RSSI:
@@ -80,7 +80,7 @@ auto Qind::getRSSI() const noexcept -> std::optional<int>
     if (isCsq()) {
         int rssi;
         try {
-            rssi = std::stoi(tokens[RSSI]);
+            rssi = std::stoi(std::string{tokens[RSSI]});
         }
         catch (const std::exception &e) {
             return std::nullopt;
@@ -99,7 +99,7 @@ auto Qind::getBER() const noexcept -> std::optional<int>
     if (isCsq()) {
         int ber;
         try {
-            ber = std::stoi(tokens[BER]);
+            ber = std::stoi(std::string{tokens[BER]});
         }
         catch (const std::exception &e) {
             return std::nullopt;
@@ -124,7 +124,7 @@ auto Qind::isAct() const noexcept -> bool
 auto Qind::getAct() const noexcept -> std::string
 {
     if (isAct()) {
-        return tokens[ACT::ACTVALUE];
+        return std::string{tokens[ACT::ACTVALUE]};
     }
 
     return "";
@@ -1,4 +1,4 @@
-// Copyright (c) 2017-2021, Mudita Sp. z.o.o. All rights reserved.
+// Copyright (c) 2017-2023, Mudita Sp. z.o.o. All rights reserved.
 // For licensing, see https://github.com/mudita/MuditaOS/LICENSE.md
 
 #include "UrcQiurc.hpp"
@@ -26,7 +26,7 @@ auto Qiurc::getFirstParam() const noexcept -> std::optional<std::string>
 {
     if (getType()) {
         if (isValid() && (*getType() == QIUrcMessages::DeactivateContext)) {
-            return tokens[Tokens::FirstParam];
+            return std::string{tokens[Tokens::FirstParam]};
         }
     }
     return std::nullopt;
@@ -0,0 +1,64 @@
+// Copyright (c) 2017-2023, Mudita Sp. z.o.o. All rights reserved.
+// For licensing, see https://github.com/mudita/MuditaOS/LICENSE.md
+
+#include <UrcTokenizer.hpp>
+
+#include <algorithm>
+
+namespace at::urc
+{
+    namespace
+    {
+        constexpr std::string_view whitespace = " \n\r\t\f\v";
+        constexpr auto headDelimiter          = ':';
+        constexpr auto tokenDelimiter         = ',';
+        constexpr auto stringDelimiter        = '"';
+
+        auto stripQuotes(std::string_view token) noexcept -> std::string_view
+        {
+            if (!token.empty() && token.front() == stringDelimiter) {
+                token.remove_prefix(1);
+            }
+            if (!token.empty() && token.back() == stringDelimiter) {
+                token.remove_suffix(1);
+            }
+            return token;
+        }
+    } // namespace
+
+    auto trim(std::string_view text) noexcept -> std::string_view
+    {
+        const auto start = text.find_first_not_of(whitespace);
+        if (start == std::string_view::npos) {
+            return {};
+        }
+        const auto end = text.find_last_not_of(whitespace);
+        return text.substr(start, end - start + 1);
+    }
+
+    auto splitMessage(std::string_view message) noexcept -> UrcMessage
+    {
+        const auto pos = message.find(headDelimiter);
+        if (pos == std::string_view::npos) {
+            return {trim(message), message};
+        }
+        return {trim(message.substr(0, pos)), message.substr(pos + 1)};
+    }
+
+    void tokenize(std::string_view body, std::vector<std::string_view> &tokens)
+    {
+        tokens.clear();
+        if (body.empty()) {
+            return;
+        }
+        tokens.reserve(std::count(body.begin(), body.end(), tokenDelimiter) + 1);
+
+        std::size_t start = 0;
+        while (start < body.size()) {
+            const auto end   = std::min(body.find(tokenDelimiter, start), body.size());
+            const auto token = body.substr(start, end - start);
+            tokens.push_back(trim(stripQuotes(trim(token))));
+            start = end + 1;
+        }
+    }
+} // namespace at::urc
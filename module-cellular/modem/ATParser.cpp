@@ -5,6 +5,8 @@
 #include "bsp/cellular/bsp_cellular.hpp"
 #include <service-cellular/CellularMessage.hpp>
 #include "ticks.hpp"
+#include <array>
+#include <string_view>
 #include <utility>
 #include <vector>
 
@@ -17,42 +19,37 @@ ATParser::ATParser(bsp::Cellular *cellular) : Channel{new uint8_t[at::defaultRec
     responseBuffer = xMessageBufferCreate(at::defaultMessageBufferSize);
 }
 
-/// plz see 12.7 summary of urc in documentation
-std::vector<ATParser::Urc> ATParser::parseUrc()
+namespace
 {
-    size_t maxPos = 0, pos = 0;
-
-    std::vector<std::pair<std::string, ATParser::Urc>> vals = {
+    /// plz see 12.7 summary of urc in documentation
+    constexpr std::array<std::pair<std::string_view, ATParser::Urc>, 2> powerUpUrcs = {{
         {"RDY", ATParser::Urc::MeInitializationSuccessful},
         {"+CFUN: 1", ATParser::Urc::FullFuncionalityAvailable},
-    };
+    }};
+    constexpr std::string_view fotaUrc = "+QIND: \"FOTA\"";
+} // namespace
 
+std::vector<ATParser::Urc> ATParser::parseUrc()
+{
     std::vector<ATParser::Urc> resp;
-    resp.reserve(vals.size() + 1);
     cpp_freertos::LockGuard lock(mutex);
+    const std::string_view buffer{urcBuffer};
 
-    for (const auto &el : vals) {
-        pos = urcBuffer.find(el.first);
-        if (pos != std::string::npos) {
-            resp.push_back(el.second);
-            maxPos = std::max(pos + el.first.length(), maxPos);
-            LOG_SENSITIVE(LOGDEBUG, "%s", ("[URC]: " + el.first).c_str());
+    for (const auto &[text, urc] : powerUpUrcs) {
+        if (buffer.find(text) != std::string_view::npos) {
+            resp.push_back(urc);
+            LOG_SENSITIVE(LOGDEBUG, "[URC]: %.*s", static_cast<int>(text.size()), text.data());
         }
     }
 
-    if (urcBuffer.find("+QIND: \"FOTA\"") != std::string::npos) {
+    if (buffer.find(fotaUrc) != std::string_view::npos) {
         resp.push_back(ATParser::Urc::Fota);
         return resp;
     }
 
-    // manage string buffer
-    if (maxPos == 0) {}
-    else if (urcBuffer.size() >= maxPos) {
+    if (!resp.empty()) {
         urcBuffer.erase();
     }
-    else {
-        urcBuffer = urcBuffer.substr(maxPos);
-    }
 
     return resp;
 }
@@ -63,7 +60,8 @@ at::Result ATParser::processNewData(sys::Service *service, const bsp::cellular::
 
     {
         cpp_freertos::LockGuard lock(mutex);
-        urcBuffer.append(cellularResult.getDataAsString());
+        const auto &data = cellularResult.getData();
+        urcBuffer.append(data.begin(), data.end());
     }
 
     auto ret = parseUrc();
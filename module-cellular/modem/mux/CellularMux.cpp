@@ -148,8 +148,8 @@ bool baudDetectTestAT(ATParser *parser, BaudTestStep &step, BaudTestStep nextSte
 void closeCMux(std::unique_ptr<bsp::Cellular> &pv_cellular)
 {
     LOG_INFO("Closing mux mode");
-    CellularMuxFrame::frame_t frame = createCMUXExitFrame();
-    pv_cellular->write(static_cast<void *>(frame.serialize().data()), frame.serialize().size());
+    auto frame = createCMUXExitFrame().serialize();
+    pv_cellular->write(static_cast<void *>(frame.data()), frame.size());
     vTaskDelay(1000); // GSM module needs some time to close multiplexer
 }
 
@@ -448,25 +448,39 @@ CellularMux::ConfState CellularMux::startMultiplexer()
     return ConfState::Success;
 }
 
-void CellularMux::sendFrameToChannel(bsp::cellular::CellularResult &resultStruct)
+void CellularMux::sendFrameToChannel(const Channels &channels,
+                                     bsp::cellular::CellularResultCode resultCode,
+                                     const std::uint8_t *frame,
+                                     std::size_t size)
 {
-    auto frame = CellularMuxFrame{resultStruct.getData()};
+    if (frame == nullptr) {
+        for (const auto &chan : channels) {
+            if (static_cast<Channel>(chan->getDLCI()) == Channel::Control) {
+                chan->parseInputData(resultCode, nullptr, 0);
+                return;
+            }
+        }
+        return;
+    }
+    if (size < 2) {
+        return;
+    }
+
+    const auto decoded = cellular::mux::decode(frame, size);
+    if (decoded.status != cellular::mux::FrameStatus::OK) {
+        resultCode = bsp::cellular::CellularResultCode::CMUXFrameError;
+    }
 
+    const DLCI_t frameDLCI = frame[1] >> 2;
     for (const auto &chan : channels) {
-        if (frame.getFrameDLCI() == chan->getDLCI()) {
-            if (frame.getData().empty()) {
+        if (frameDLCI == chan->getDLCI()) {
+            if (decoded.size == 0) {
                 // Control frame contains no data
-                resultStruct.setData(frame.getSerData());
+                chan->parseInputData(resultCode, frame, size);
             }
             else {
-                resultStruct.setData(frame.getData());
+                chan->parseInputData(resultCode, decoded.data, decoded.size);
             }
-
-            if (frame.getFrameStatus() != CellularMuxFrame::OK) {
-                resultStruct.setResultCode(bsp::cellular::CellularResultCode::CMUXFrameError);
-            }
-
-            chan->parseInputData(&resultStruct);
             return;
         }
     }
@@ -474,24 +488,27 @@ void CellularMux::sendFrameToChannel(bsp::cellular::CellularResult &resultStruct
 
 void CellularMux::parseCellularResultCMUX(bsp::cellular::CellularDMAResultStruct &result)
 {
-    static std::vector<uint8_t> currentFrame;
-    static bool frameStartDetected = false;
-
     for (auto i = 0U; i < result.dataSize; ++i) {
         uint8_t character = gsl::at(result.data, i);
+        if (frameStartDetected && receivedFrameLength == receivedFrame.size()) {
+            LOG_ERROR("Received frame longer than %zu bytes, dropping it", receivedFrame.size());
+            receivedFrameLength = 0;
+            frameStartDetected  = false;
+        }
+
         if (frameStartDetected || character == TS0710_FLAG) {
-            currentFrame.push_back(character);
+            receivedFrame[receivedFrameLength++] = character;
 
             // Check if frame is complete only in case of TS0710_FLAG
             if (frameStartDetected && character == TS0710_FLAG) {
-                if (currentFrame.size() == 2) {
-                    currentFrame.erase(currentFrame.begin());
+                if (receivedFrameLength == 2) {
+                    // The first flag closed the previous frame
+                    receivedFrameLength = 1;
                 }
-                if (CellularMuxFrame::isComplete(currentFrame)) {
+                if (cellular::mux::isComplete(receivedFrame.data(), receivedFrameLength)) {
                     frameStartDetected = false;
-                    bsp::cellular::CellularResult cellularResult{{result.resultCode, currentFrame}};
-                    sendFrameToChannel(cellularResult);
-                    currentFrame.clear();
+                    sendFrameToChannel(channels, result.resultCode, receivedFrame.data(), receivedFrameLength);
+                    receivedFrameLength = 0;
                     continue;
                 }
             }
@@ -520,7 +537,7 @@ void CellularMux::processError(bsp::cellular::CellularDMAResultStruct &result)
         parser->processNewData(parentService, cellularResult);
     }
     else if (mode == CellularMux::Mode::CMUX || mode == CellularMux::Mode::CMUX_SETUP) {
-        sendFrameToChannel(cellularResult);
+        sendFrameToChannel(channels, result.resultCode, nullptr, 0);
     }
 }
 
@@ -188,6 +188,7 @@ repeated until a response is obtained or action is taken by a higher layer.
 
 */
 
+#include <array>
 #include <memory>
 #include <vector>
 #include <queue>
@@ -252,6 +253,7 @@ class CellularMux
         IncomingCallIndicator = 0x40,
         DataValid             = 0x80,
     };
+    using Channels = std::vector<std::unique_ptr<DLCChannel>>;
 
   private:
     Mode mode = Mode::AT;
@@ -264,9 +266,15 @@ class CellularMux
     const uint32_t taskPriority = 0;
     xTaskHandle taskHandle      = nullptr;
 
-    std::vector<std::unique_ptr<DLCChannel>> channels;
+    Channels channels;
     DLCChannel::Callback_t controlCallback = nullptr;
 
+    /// Frames announced with the 0xFF length indicator by Quectel modems may exceed the negotiated frame size
+    static constexpr std::size_t receivedFrameCapacity = 4 * cellular::mux::maxFrameLength;
+    std::array<std::uint8_t, receivedFrameCapacity> receivedFrame{};
+    std::size_t receivedFrameLength = 0;
+    bool frameStartDetected         = false;
+
     friend void workerTaskFunction(void *ptr);
 
     enum class EchoCancellerStrength
@@ -284,9 +292,16 @@ class CellularMux
     size_t flushReceiveData();
     void processData(bsp::cellular::CellularDMAResultStruct &result);
     void processError(bsp::cellular::CellularDMAResultStruct &result);
-    void sendFrameToChannel(bsp::cellular::CellularResult &resultStruct);
 
   public:
+    /// @brief pass received frame to the channel of its DLCI
+    /// @param frame complete frame, or nullptr for a DMA error, which belongs to no frame and is reported on the
+    /// control channel
+    static void sendFrameToChannel(const Channels &channels,
+                                   bsp::cellular::CellularResultCode resultCode,
+                                   const std::uint8_t *frame,
+                                   std::size_t size);
+
     CellularMux(PortSpeed_e portSpeed, sys::Service *parent);
     CellularMux() = delete;
 
@@ -0,0 +1,172 @@
+// Copyright (c) 2017-2023, Mudita Sp. z.o.o. All rights reserved.
+// For licensing, see https://github.com/mudita/MuditaOS/LICENSE.md
+
+#include "CellularMuxCodec.h"
+
+#include <log/log.hpp>
+
+#include <cstring>
+
+namespace cellular::mux
+{
+    namespace
+    {
+        constexpr std::uint8_t crcTable[256] = { // reversed, 8-bit, poly=0x07
+            0x00, 0x91, 0xE3, 0x72, 0x07, 0x96, 0xE4, 0x75, 0x0E, 0x9F, 0xED, 0x7C, 0x09, 0x98, 0xEA, 0x7B, 0x1C, 0x8D,
+            0xFF, 0x6E, 0x1B, 0x8A, 0xF8, 0x69, 0x12, 0x83, 0xF1, 0x60, 0x15, 0x84, 0xF6, 0x67, 0x38, 0xA9, 0xDB, 0x4A,
+            0x3F, 0xAE, 0xDC, 0x4D, 0x36, 0xA7, 0xD5, 0x44, 0x31, 0xA0, 0xD2, 0x43, 0x24, 0xB5, 0xC7, 0x56, 0x23, 0xB2,
+            0xC0, 0x51, 0x2A, 0xBB, 0xC9, 0x58, 0x2D, 0xBC, 0xCE, 0x5F, 0x70, 0xE1, 0x93, 0x02, 0x77, 0xE6, 0x94, 0x05,
+            0x7E, 0xEF, 0x9D, 0x0C, 0x79, 0xE8, 0x9A, 0x0B, 0x6C, 0xFD, 0x8F, 0x1E, 0x6B, 0xFA, 0x88, 0x19, 0x62, 0xF3,
+            0x81, 0x10, 0x65, 0xF4, 0x86, 0x17, 0x48, 0xD9, 0xAB, 0x3A, 0x4F, 0xDE, 0xAC, 0x3D, 0x46, 0xD7, 0xA5, 0x34,
+            0x41, 0xD0, 0xA2, 0x33, 0x54, 0xC5, 0xB7, 0x26, 0x53, 0xC2, 0xB0, 0x21, 0x5A, 0xCB, 0xB9, 0x28, 0x5D, 0xCC,
+            0xBE, 0x2F, 0xE0, 0x71, 0x03, 0x92, 0xE7, 0x76, 0x04, 0x95, 0xEE, 0x7F, 0x0D, 0x9C, 0xE9, 0x78, 0x0A, 0x9B,
+            0xFC, 0x6D, 0x1F, 0x8E, 0xFB, 0x6A, 0x18, 0x89, 0xF2, 0x63, 0x11, 0x80, 0xF5, 0x64, 0x16, 0x87, 0xD8, 0x49,
+            0x3B, 0xAA, 0xDF, 0x4E, 0x3C, 0xAD, 0xD6, 0x47, 0x35, 0xA4, 0xD1, 0x40, 0x32, 0xA3, 0xC4, 0x55, 0x27, 0xB6,
+            0xC3, 0x52, 0x20, 0xB1, 0xCA, 0x5B, 0x29, 0xB8, 0xCD, 0x5C, 0x2E, 0xBF, 0x90, 0x01, 0x73, 0xE2, 0x97, 0x06,
+            0x74, 0xE5, 0x9E, 0x0F, 0x7D, 0xEC, 0x99, 0x08, 0x7A, 0xEB, 0x8C, 0x1D, 0x6F, 0xFE, 0x8B, 0x1A, 0x68, 0xF9,
+            0x82, 0x13, 0x61, 0xF0, 0x85, 0x14, 0x66, 0xF7, 0xA8, 0x39, 0x4B, 0xDA, 0xAF, 0x3E, 0x4C, 0xDD, 0xA6, 0x37,
+            0x45, 0xD4, 0xA1, 0x30, 0x42, 0xD3, 0xB4, 0x25, 0x57, 0xC6, 0xB3, 0x22, 0x50, 0xC1, 0xBA, 0x2B, 0x59, 0xC8,
+            0xBD, 0x2C, 0x5E, 0xCF};
+
+        /// Value of the CRC computed over the fields followed by their valid FCS
+        constexpr std::uint8_t validFcsResidue = 0xCF;
+        /// Length indicator Quectel modems put in some UIH frames, their end has to be found by the closing flag
+        constexpr std::uint8_t quectelLengthIndicator = 0xFF;
+        constexpr std::size_t minFrameLength         = 4;
+        constexpr std::size_t shortHeaderLength      = 4;
+        constexpr std::size_t longHeaderLength       = 5;
+        constexpr std::uint8_t pollFinalBit          = 1 << 4;
+
+        std::uint8_t crc(const std::uint8_t *fields, std::size_t size, std::uint8_t value = 0xFF)
+        {
+            for (std::size_t i = 0; i < size; ++i) {
+                value = crcTable[value ^ fields[i]];
+            }
+            return value;
+        }
+
+        bool hasLongLength(const std::uint8_t *frame)
+        {
+            return (frame[3] & 0x01) == 0;
+        }
+
+        /// GSM 07.10 par. 5.3.6: the FCS of UIH frames covers only the address, control and length fields
+        std::size_t checkedFieldsLength(std::uint8_t control, std::size_t headerLength, std::size_t frameLength)
+        {
+            return control == static_cast<std::uint8_t>(TypeOfFrame_e::UIH) ? headerLength - 1 : frameLength - 3;
+        }
+    } // namespace
+
+    std::uint8_t fcs(const std::uint8_t *fields, std::size_t size)
+    {
+        return 0xFF - crc(fields, size);
+    }
+
+    std::size_t encode(
+        std::uint8_t address, std::uint8_t control, const std::uint8_t *payload, std::size_t size, std::uint8_t *out)
+    {
+        std::size_t position = 0;
+        out[position++]      = flag;
+        out[position++]      = address | 0x01; // EA = 1
+        out[position++]      = control;
+        if (size > maxShortLength) {
+            const auto length = static_cast<std::uint16_t>(size << 1); // E/A = 0, long length
+            out[position++]   = static_cast<std::uint8_t>(length & 0x00FF);
+            out[position++]   = static_cast<std::uint8_t>(length >> 8);
+        }
+        else {
+            out[position++] = static_cast<std::uint8_t>((size << 1) | 0x01); // E/A = 1, short length
+        }
+
+        const auto headerLength = position;
+        if (size > 0) {
+            std::memcpy(out + position, payload, size);
+            position += size;
+        }
+
+        const auto frameLength = position + 2;
+        out[position++]        = fcs(out + 1, checkedFieldsLength(control, headerLength, frameLength));
+        out[position++]        = flag;
+        return position;
+    }
+
+    FrameView decode(const std::uint8_t *frame, std::size_t size)
+    {
+        FrameView view;
+        if (size < minFrameLength) {
+            LOG_ERROR("Trying to deserialize empty frame");
+            return view;
+        }
+
+        std::size_t headerLength = shortHeaderLength;
+        std::size_t length       = 0;
+        std::size_t frameLength  = 0;
+        if (frame[3] == quectelLengthIndicator) {
+            const auto end = std::memchr(frame + 1, flag, size - 1);
+            frameLength    = end != nullptr ? static_cast<const std::uint8_t *>(end) - frame + 1 : size + 1;
+            if (frameLength < shortHeaderLength + 2) {
+                LOG_ERROR("The size of the hacked frame is less than 6 bytes. Dropping...");
+                return view;
+            }
+            length = frameLength - shortHeaderLength - 2;
+        }
+        else if (hasLongLength(frame)) {
+            headerLength = longHeaderLength;
+            length       = size > longHeaderLength ? (frame[3] >> 1) | (frame[4] << 7) : 0;
+            frameLength  = headerLength + length + 2;
+        }
+        else {
+            length      = frame[3] >> 1;
+            frameLength = headerLength + length + 2;
+        }
+
+        if (frame[0] != flag || frameLength > size || frame[frameLength - 1] != flag) {
+            LOG_ERROR("Received frame has incorrect leading/trailing flags. Dropping.");
+            view.status = FrameStatus::IncorrectStartStopFlags;
+            return view;
+        }
+
+        const auto control = static_cast<std::uint8_t>(frame[2] & ~pollFinalBit);
+        const auto residue =
+            crc(frame + frameLength - 2, 1, crc(frame + 1, checkedFieldsLength(control, headerLength, frameLength)));
+        // Faulty Quectel UIH frames and UA frames are accepted regardless of their FCS
+        if (residue != validFcsResidue && frame[3] != quectelLengthIndicator &&
+            control != static_cast<std::uint8_t>(TypeOfFrame_e::UA)) {
+            LOG_ERROR("Received frame FCS [0x%02X] != 0xCF error. Dropping.", residue);
+            view.status = FrameStatus::CRCError;
+            return view;
+        }
+
+        view.status  = FrameStatus::OK;
+        view.address = frame[1];
+        view.control = control;
+        view.data    = frame + headerLength;
+        view.size    = length;
+        return view;
+    }
+
+    bool isComplete(const std::uint8_t *frame, std::size_t size)
+    {
+        if (size < minFrameLength) {
+            return false; // check if buffer has enough data to get length
+        }
+
+        if (frame[0] != flag || frame[size - 1] != flag) {
+            return false;
+        }
+
+        std::size_t length = 0;
+        if (!hasLongLength(frame)) {
+            length = frame[3] >> 1;
+        }
+        else if (size > minFrameLength) {
+            length = (frame[3] >> 1) + (frame[4] << 7);
+        }
+        else {
+            return false;
+        }
+
+        // include the second length byte if present
+        return size >= shortHeaderLength + 2 + length + (hasLongLength(frame) ? 1 : 0);
+    }
+} // namespace cellular::mux
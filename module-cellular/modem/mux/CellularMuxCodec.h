@@ -0,0 +1,57 @@
+// Copyright (c) 2017-2023, Mudita Sp. z.o.o. All rights reserved.
+// For licensing, see https://github.com/mudita/MuditaOS/LICENSE.md
+
+#pragma once
+
+#include "CellularMuxTypes.h"
+
+#include <cstddef>
+#include <cstdint>
+
+/// GSM 07.10 basic option frames encoded and decoded in place, over buffers owned by the caller.
+/// Nothing is allocated on the way, the decoded payload is a view into the received frame.
+namespace cellular::mux
+{
+    inline constexpr std::uint8_t flag          = 0xF9;
+    inline constexpr std::size_t maxShortLength = 127;
+    /// Both flags, address, control, long length indicator and FCS
+    inline constexpr std::size_t frameOverhead = 7;
+    /// Longest frame sent or received in the basic option, which limits the payload to `maxShortLength`
+    inline constexpr std::size_t maxFrameLength = maxShortLength + frameOverhead;
+
+    enum class FrameStatus : std::uint8_t
+    {
+        OK,
+        EmptyFrame,
+        IncorrectStartStopFlags,
+        CRCError,
+    };
+
+    struct FrameView
+    {
+        FrameStatus status       = FrameStatus::EmptyFrame;
+        std::uint8_t address     = 0;
+        std::uint8_t control     = 0; ///< Without the P/F bit
+        const std::uint8_t *data = nullptr;
+        std::size_t size         = 0;
+
+        DLCI_t getDLCI() const noexcept
+        {
+            return address >> 2;
+        }
+    };
+
+    /// Frame check sequence of the fields, ones complement of the reversed CRC-8 (x^8 + x^2 + x + 1)
+    std::uint8_t fcs(const std::uint8_t *fields, std::size_t size);
+
+    /// Writes the frame into `out`, which has to hold at least `size + frameOverhead` bytes
+    /// @return length of the frame
+    std::size_t encode(
+        std::uint8_t address, std::uint8_t control, const std::uint8_t *payload, std::size_t size, std::uint8_t *out);
+
+    /// Decodes the frame starting at `frame[0]`, the payload isn't copied
+    FrameView decode(const std::uint8_t *frame, std::size_t size);
+
+    /// Whether the buffer holds the whole frame announced by its length indicator
+    bool isComplete(const std::uint8_t *frame, std::size_t size);
+} // namespace cellular::mux
@@ -3,15 +3,14 @@
 
 #include "DLCChannel.h"
 
-#include "CellularMuxData.h"
-#include "CellularMuxFrame.h"
-
 #include <log/log.hpp>
 #include <ticks.hpp>
 #include <Utils.hpp>
 #include <magic_enum.hpp>
 #include <gsl/util>
 
+#include <algorithm>
+
 DLCChannel::DLCChannel(DLCI_t DLCI, const std::string &name, bsp::Cellular *cellular, const Callback_t &callback)
     : Channel{new uint8_t[at::defaultReceiveBufferSize]}, name{name}, DLCI{DLCI}, pvCellular{cellular}
 {
@@ -40,24 +39,37 @@ bool DLCChannel::init()
     return active;
 }
 
-void DLCChannel::sendData(std::vector<uint8_t> &data)
+void DLCChannel::sendData(const std::uint8_t *data, std::size_t size)
 {
-    CellularMuxData(DLCI, chanParams, data, pvCellular);
+    const auto address = static_cast<std::uint8_t>(DLCI << 2); // C/R = 0
+    const auto control = static_cast<std::uint8_t>(TypeOfFrame_e::UIH);
+
+    // Data which doesn't fit in a single frame is sent in several ones
+    do {
+        const auto part   = std::min(size, cellular::mux::maxShortLength);
+        const auto length = cellular::mux::encode(address, control, data, part, txFrame.data());
+        pvCellular->write(txFrame.data(), length);
+        data += part;
+        size -= part;
+    } while (size > 0);
 }
 
 bool DLCChannel::establish()
 {
     LOG_SENSITIVE(LOGDEBUG, "Sending %s frame to DLCI %i", TypeOfFrame_text[chanParams.TypeOfFrame].c_str(), DLCI);
 
-    CellularMuxFrame frame_c(CellularMuxFrame::frame_t(static_cast<uint8_t>(DLCI << 2) | (1 << 1),
-                                                       static_cast<uint8_t>(chanParams.TypeOfFrame)));
+    const auto length = cellular::mux::encode(static_cast<uint8_t>(DLCI << 2) | (1 << 1),
+                                              static_cast<uint8_t>(chanParams.TypeOfFrame),
+                                              nullptr,
+                                              0,
+                                              txFrame.data());
 
     awaitingResponseFlag.set();
 
     bool result = false;
 
     for (int retries = 0; retries < chanParams.MaxNumOfRetransmissions; ++retries) {
-        pvCellular->write(static_cast<void *>(frame_c.getSerData().data()), frame_c.getSerData().size());
+        pvCellular->write(txFrame.data(), length);
 
         auto startTime = std::chrono::steady_clock::now();
         auto endTime   = startTime + std::chrono::milliseconds{300};
@@ -88,8 +100,7 @@ void DLCChannel::cmdInit()
 
 void DLCChannel::cmdSend(std::string cmd)
 {
-    std::vector<uint8_t> data(cmd.begin(), cmd.end());
-    sendData(data);
+    sendData(reinterpret_cast<const std::uint8_t *>(cmd.data()), cmd.size());
 }
 
 size_t DLCChannel::cmdReceive(uint8_t *result, std::chrono::milliseconds timeout)
@@ -164,21 +175,28 @@ std::vector<std::string> DLCChannel::sendCommandPrompt(const char *cmd,
     return tokens;
 }
 
-at::Result DLCChannel::parseInputData(bsp::cellular::CellularResult *cellularResult) const
+at::Result DLCChannel::parseInputData(bsp::cellular::CellularResultCode resultCode,
+                                      const std::uint8_t *data,
+                                      std::size_t size)
 {
     at::Result result;
 
     if (awaitingResponseFlag.state()) {
-        if (!xMessageBufferSend(responseBuffer,
-                                (void *)cellularResult->getSerialized().get(),
-                                cellularResult->getSerializedSize(),
-                                pdMS_TO_TICKS(at::defaultBufferTimeoutMs.count()))) {
+        // Serialized the same way as bsp::cellular::CellularResultStruct, without a temporary copy
+        if (size >= rxMessage.size()) {
+            LOG_ERROR("DLC message too long: %zu", size);
+            size = rxMessage.size() - 1;
+        }
+        rxMessage[0] = static_cast<std::uint8_t>(resultCode);
+        std::copy_n(data, size, rxMessage.begin() + 1);
+        if (!xMessageBufferSend(
+                responseBuffer, rxMessage.data(), size + 1, pdMS_TO_TICKS(at::defaultBufferTimeoutMs.count()))) {
             LOG_DEBUG("DLC message buffer full!");
             result.code = at::Result::Code::FULL_MSG_BUFFER;
         }
     }
     else if (pvCallback != nullptr) {
-        std::string receivedData = cellularResult->getDataAsString();
+        std::string receivedData(reinterpret_cast<const char *>(data), size);
         pvCallback(receivedData);
     }
     else {
@@ -190,7 +208,7 @@ at::Result DLCChannel::parseInputData(bsp::cellular::CellularResult *cellularRes
 
 bool DLCChannel::evaluateEstablishResponse(bsp::cellular::CellularResult &response) const
 {
-    auto frame = CellularMuxFrame{response.getData()};
-    return (frame.getFrameDLCI() == DLCI &&
-            (frame.getFrame().Control == (static_cast<uint8_t>(TypeOfFrame_e::UA) & ~(1 << 4))));
+    const auto &data = response.getData();
+    const auto frame = cellular::mux::decode(data.data(), data.size());
+    return (frame.getDLCI() == DLCI && (frame.control == (static_cast<uint8_t>(TypeOfFrame_e::UA) & ~(1 << 4))));
 }
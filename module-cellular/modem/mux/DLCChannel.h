@@ -1,8 +1,9 @@
-// Copyright (c) 2017-2021, Mudita Sp. z.o.o. All rights reserved.
+// Copyright (c) 2017-2023, Mudita Sp. z.o.o. All rights reserved.
 // For licensing, see https://github.com/mudita/MuditaOS/LICENSE.md
 
 #pragma once
 
+#include <array>
 #include <string>
 #include <utility>
 #include <vector>
@@ -14,6 +15,7 @@
 #include <bsp/cellular/CellularResult.hpp>
 
 #include "modem/ATCommon.hpp"
+#include "CellularMuxCodec.h"
 #include "CellularMuxTypes.h"
 
 class DLCChannel : public at::Channel
@@ -28,6 +30,10 @@ class DLCChannel : public at::Channel
     DLC_ESTABL_SystemParameters_t chanParams{};
     Callback_t pvCallback;
     bsp::Cellular *pvCellular = nullptr;
+    /// Frames are encoded in place, commands are sent by one task at a time like the responses are awaited
+    std::array<std::uint8_t, cellular::mux::maxFrameLength> txFrame{};
+    /// Result code followed by the payload, as passed to the task awaiting the response
+    std::array<std::uint8_t, at::defaultReceiveBufferSize> rxMessage{};
 
   public:
     DLCChannel(DLCI_t DLCI, const std::string &name, bsp::Cellular *cellular, const Callback_t &callback = nullptr);
@@ -37,7 +43,7 @@ class DLCChannel : public at::Channel
 
     bool init();
     bool establish();
-    void sendData(std::vector<uint8_t> &data);
+    void sendData(const std::uint8_t *data, std::size_t size);
 
     virtual void cmdInit() override final;
     virtual void cmdSend(std::string cmd) override final;
@@ -48,7 +54,8 @@ class DLCChannel : public at::Channel
                                                size_t rxCount,
                                                std::chrono::milliseconds timeout = std::chrono::milliseconds{300});
 
-    at::Result parseInputData(bsp::cellular::CellularResult *cellularResult) const;
+    /// @param data payload of the received frame, or the whole frame if it carries no payload
+    at::Result parseInputData(bsp::cellular::CellularResultCode resultCode, const std::uint8_t *data, std::size_t size);
 
     bool evaluateEstablishResponse(bsp::cellular::CellularResult &response) const;
 
@@ -0,0 +1,571 @@
+// Copyright (c) 2017-2023, Mudita Sp. z.o.o. All rights reserved.
+// For licensing, see https://github.com/mudita/MuditaOS/LICENSE.md
+
+#include "ModemSimulator.hpp"
+
+#include <modem/mux/CellularMuxCodec.h>
+#include <log/log.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cerrno>
+#include <cstdio>
+#include <cstring>
+
+#include <fcntl.h>
+#include <poll.h>
+#include <stdlib.h>
+#include <termios.h>
+#include <unistd.h>
+
+namespace cellular::simulator
+{
+    namespace
+    {
+        constexpr std::uint8_t pollFinalBit       = 0x10;
+        constexpr std::uint8_t commandBit         = 0x02; ///< C/R bit of the address and of the control messages
+        constexpr std::uint8_t extensionBit       = 0x01;
+        constexpr std::uint8_t typeSabm           = 0x2F;
+        constexpr std::uint8_t typeUa             = 0x63;
+        constexpr std::uint8_t typeDisc           = 0x43;
+        constexpr std::uint8_t typeUih            = 0xEF;
+        constexpr std::uint8_t controlCld         = 0xC1;
+        constexpr std::uint8_t controlMsc         = 0xE1;
+        constexpr std::uint8_t controlNsc         = 0x11;
+        constexpr std::uint8_t readyToCommunicate = 0x04;
+        constexpr std::uint8_t readyToReceive     = 0x08;
+
+        constexpr auto pollTimeoutMs  = 50;
+        constexpr auto readBufferSize = 1024;
+        constexpr auto smsTimestamp   = "23/01/02,12:00:00+04";
+
+        /// GSM 07.10 par. 5.2.1.2: commands of the responder and its responses have the C/R bit set the other way
+        /// round than the ones of the initiator, which is the stack
+        std::uint8_t addressOf(std::uint8_t dlci, bool response)
+        {
+            return static_cast<std::uint8_t>(dlci << 2) | (response ? commandBit : 0) | extensionBit;
+        }
+
+        /// Name of the command without its parameters, i.e. the part before `=` or `?`
+        std::string nameOf(const std::string &command)
+        {
+            return command.substr(0, command.find_first_of("=?"));
+        }
+
+        std::string toUcs2(const std::string &text)
+        {
+            std::string hex;
+            hex.reserve(text.size() * 4);
+            std::array<char, 5> digits;
+            for (const auto c : text) {
+                std::snprintf(digits.data(), digits.size(), "%04X", static_cast<unsigned char>(c));
+                hex += digits.data();
+            }
+            return hex;
+        }
+
+        const std::vector<std::pair<std::string, std::vector<std::string>>> defaultResponses = {
+            {"ATI", {"Quectel", "EC25", "Revision: EC25EFAR06A03M4G"}},
+            {"AT+CSQ", {"+CSQ: 20,99"}},
+            {"AT+CPIN?", {"+CPIN: READY"}},
+            {"AT+CREG?", {"+CREG: 2,1"}},
+            {"AT+CFUN?", {"+CFUN: 1"}},
+            {"AT+QSIMSTAT?", {"+QSIMSTAT: 1,1"}},
+            {"AT+QDAI?", {"+QDAI: 1,0,0,3,0,1,1,1"}},
+            {"AT+COPS?", {"+COPS: 0,0,\"Simulated\",7"}},
+        };
+
+        const std::vector<std::string> powerUpUrcs = {"RDY", "+CFUN: 1", "+CPIN: READY", "+QIND: SMS DONE"};
+    } // namespace
+
+    ModemSimulator::ModemSimulator(std::string linkPath) : linkPath(std::move(linkPath))
+    {
+        responses.insert(defaultResponses.begin(), defaultResponses.end());
+    }
+
+    ModemSimulator::~ModemSimulator()
+    {
+        stop();
+    }
+
+    bool ModemSimulator::start(bool sendPowerUpUrcs)
+    {
+        masterFd = posix_openpt(O_RDWR | O_NOCTTY);
+        if (masterFd < 0 || grantpt(masterFd) != 0 || unlockpt(masterFd) != 0) {
+            LOG_ERROR("Failed to create pseudo-terminal: %s", std::strerror(errno));
+            stop();
+            return false;
+        }
+
+        std::array<char, 64> name{};
+        if (ptsname_r(masterFd, name.data(), name.size()) != 0) {
+            LOG_ERROR("Failed to get pseudo-terminal name: %s", std::strerror(errno));
+            stop();
+            return false;
+        }
+        slavePath = name.data();
+
+        // Slave is kept open so that the master can be read while the stack reopens the port
+        slaveFd = open(slavePath.c_str(), O_RDWR | O_NOCTTY);
+        termios tio{};
+        if (slaveFd < 0 || tcgetattr(slaveFd, &tio) != 0) {
+            LOG_ERROR("Failed to open %s: %s", slavePath.c_str(), std::strerror(errno));
+            stop();
+            return false;
+        }
+        cfmakeraw(&tio);
+        tcsetattr(slaveFd, TCSANOW, &tio);
+
+        if (!linkPath.empty()) {
+            unlink(linkPath.c_str());
+            if (symlink(slavePath.c_str(), linkPath.c_str()) != 0) {
+                LOG_ERROR("Failed to link %s to %s: %s", linkPath.c_str(), slavePath.c_str(), std::strerror(errno));
+                stop();
+                return false;
+            }
+        }
+
+        running = true;
+        thread  = std::thread(&ModemSimulator::worker, this);
+
+        if (sendPowerUpUrcs) {
+            for (const auto &urc : powerUpUrcs) {
+                sendUrc(urc);
+            }
+        }
+        return true;
+    }
+
+    void ModemSimulator::stop()
+    {
+        running = false;
+        if (thread.joinable()) {
+            thread.join();
+        }
+        if (slaveFd >= 0) {
+            close(slaveFd);
+            slaveFd = -1;
+        }
+        if (masterFd >= 0) {
+            close(masterFd);
+            masterFd = -1;
+        }
+        if (!linkPath.empty()) {
+            unlink(linkPath.c_str());
+        }
+    }
+
+    const std::string &ModemSimulator::getPortPath() const noexcept
+    {
+        return linkPath.empty() ? slavePath : linkPath;
+    }
+
+    void ModemSimulator::setResponse(const std::string &command, std::vector<std::string> lines)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        responses[command] = std::move(lines);
+    }
+
+    void ModemSimulator::setResult(const std::string &command, std::string result)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        results[command] = std::move(result);
+    }
+
+    void ModemSimulator::sendUrc(const std::string &urc)
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        ++statistics.urcs;
+        sendText("\r\n" + urc + "\r\n", Channel::Notifications);
+        flush(lock);
+    }
+
+    void ModemSimulator::urcStorm(const std::string &urc, std::size_t count)
+    {
+        for (std::size_t i = 0; i < count; ++i) {
+            sendUrc(urc);
+        }
+    }
+
+    std::vector<std::uint32_t> ModemSimulator::smsBurst(const std::string &number,
+                                                        const std::string &text,
+                                                        std::size_t parts)
+    {
+        parts = std::clamp<std::size_t>(parts, 1, text.size() > 0 ? text.size() : 1);
+        const auto partLength = (text.size() + parts - 1) / parts;
+
+        std::vector<std::uint32_t> indexes;
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            const auto reference = nextSmsReference++;
+            for (std::size_t part = 0; part < parts; ++part) {
+                auto header = "+QCMGR: \"REC UNREAD\",\"" + toUcs2(number) + "\",,\"" + smsTimestamp + "\"";
+                if (parts > 1) {
+                    header += "," + std::to_string(reference) + "," + std::to_string(part + 1) + "," +
+                              std::to_string(parts);
+                }
+                const auto index = nextSmsIndex++;
+                messages[index]  = Sms{std::move(header), toUcs2(text.substr(part * partLength, partLength))};
+                indexes.push_back(index);
+            }
+        }
+
+        for (const auto index : indexes) {
+            sendUrc("+CMTI: \"ME\"," + std::to_string(index));
+        }
+        return indexes;
+    }
+
+    void ModemSimulator::sendPacketData(const std::uint8_t *data, std::size_t size)
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        if (!multiplexed) {
+            LOG_ERROR("Packet data can be sent only in the CMUX mode");
+            return;
+        }
+        for (std::size_t offset = 0; offset < size; offset += mux::maxShortLength) {
+            const auto part = std::min(size - offset, mux::maxShortLength);
+            sendFrame(addressOf(static_cast<std::uint8_t>(Channel::Data), false), typeUih, data + offset, part);
+        }
+        flush(lock);
+    }
+
+    void ModemSimulator::setDataLoopback(bool enabled)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        loopback = enabled;
+    }
+
+    bool ModemSimulator::isMultiplexed() const noexcept
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        return multiplexed;
+    }
+
+    Statistics ModemSimulator::getStatistics() const
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        return statistics;
+    }
+
+    void ModemSimulator::resetStatistics()
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        statistics = Statistics{};
+    }
+
+    void ModemSimulator::worker()
+    {
+        std::array<std::uint8_t, readBufferSize> buffer;
+        pollfd descriptor{masterFd, POLLIN, 0};
+
+        while (running) {
+            const auto ready = poll(&descriptor, 1, pollTimeoutMs);
+            if (ready < 0 && errno != EINTR) {
+                LOG_ERROR("Pseudo-terminal poll failed: %s", std::strerror(errno));
+                break;
+            }
+            if (ready <= 0 || (descriptor.revents & POLLIN) == 0) {
+                continue;
+            }
+
+            const auto size = read(masterFd, buffer.data(), buffer.size());
+            if (size > 0) {
+                receive(buffer.data(), size);
+            }
+        }
+    }
+
+    void ModemSimulator::receive(const std::uint8_t *data, std::size_t size)
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        statistics.bytesReceived += size;
+        input.insert(input.end(), data, data + size);
+        if (multiplexed) {
+            parseFrames();
+        }
+        else {
+            parseCommands();
+        }
+        flush(lock);
+    }
+
+    void ModemSimulator::parseCommands()
+    {
+        auto begin = input.begin();
+        for (auto end = std::find(begin, input.end(), '\r'); end != input.end() && !multiplexed;
+             end      = std::find(begin, input.end(), '\r')) {
+            std::string command(begin, end);
+            begin = end + 1;
+
+            command.erase(0, command.find_first_not_of("\n "));
+            if (!command.empty()) {
+                handleCommand(command, Channel::Commands);
+            }
+        }
+        input.erase(input.begin(), begin);
+
+        // Frames sent right after the AT+CMUX response
+        if (multiplexed && !input.empty()) {
+            parseFrames();
+        }
+    }
+
+    void ModemSimulator::parseFrames()
+    {
+        constexpr std::size_t shortHeaderLength = 4;
+
+        std::size_t position = 0;
+        while (multiplexed) {
+            // Skip the garbage before the opening flag and the flags between the frames
+            const auto start = std::find(input.begin() + position, input.end(), mux::flag);
+            position         = start - input.begin();
+            while (position + 1 < input.size() && input[position + 1] == mux::flag) {
+                ++position;
+            }
+
+            const auto available = input.size() - position;
+            if (available < shortHeaderLength) {
+                break;
+            }
+            const auto frame        = input.data() + position;
+            const auto longLength   = (frame[3] & 0x01) == 0;
+            const auto headerLength = shortHeaderLength + (longLength ? 1 : 0);
+            if (available < headerLength) {
+                break;
+            }
+            const auto length      = longLength ? (frame[3] >> 1) | (frame[4] << 7) : frame[3] >> 1;
+            const auto frameLength = headerLength + length + 2;
+            if (available < frameLength) {
+                break;
+            }
+
+            const auto decoded = mux::decode(frame, frameLength);
+            if (decoded.status != mux::FrameStatus::OK) {
+                ++statistics.framesDropped;
+                // Resynchronize on the next flag
+                ++position;
+                continue;
+            }
+
+            ++statistics.framesReceived;
+            position += frameLength;
+            handleFrame(decoded.address, decoded.control, decoded.data, decoded.size);
+        }
+
+        input.erase(input.begin(), input.begin() + std::min(position, input.size()));
+        // The stack left the CMUX mode, the rest is AT text again
+        if (!multiplexed && !input.empty()) {
+            parseCommands();
+        }
+    }
+
+    void ModemSimulator::handleFrame(std::uint8_t address,
+                                     std::uint8_t control,
+                                     const std::uint8_t *data,
+                                     std::size_t size)
+    {
+        const auto dlci = static_cast<std::uint8_t>(address >> 2);
+
+        switch (control) {
+        case typeSabm:
+            sendFrame(addressOf(dlci, true), typeUa | pollFinalBit, nullptr, 0);
+            if (dlci != static_cast<std::uint8_t>(Channel::Control)) {
+                // Quectel modems report the state of every channel opened
+                const std::array<std::uint8_t, 4> msc = {controlMsc | commandBit,
+                                                         (2 << 1) | extensionBit,
+                                                         addressOf(dlci, true),
+                                                         readyToCommunicate | readyToReceive | extensionBit};
+                sendFrame(addressOf(0, false), typeUih, msc.data(), msc.size());
+            }
+            break;
+        case typeDisc:
+            sendFrame(addressOf(dlci, true), typeUa | pollFinalBit, nullptr, 0);
+            if (dlci == static_cast<std::uint8_t>(Channel::Control)) {
+                multiplexed = false;
+            }
+            break;
+        case typeUih:
+            if (dlci == static_cast<std::uint8_t>(Channel::Control)) {
+                handleControlMessage(data, size);
+            }
+            else if (dlci == static_cast<std::uint8_t>(Channel::Data)) {
+                statistics.dataReceived += size;
+                if (loopback) {
+                    sendFrame(addressOf(dlci, false), typeUih, data, size);
+                }
+            }
+            else {
+                // Commands split by the stack into several frames aren't joined, they don't exceed a frame
+                std::string text(reinterpret_cast<const char *>(data), size);
+                for (std::size_t begin = 0, end = text.find('\r'); end != std::string::npos;
+                     begin = end + 1, end = text.find('\r', begin)) {
+                    const auto command = text.substr(begin, end - begin);
+                    if (!command.empty()) {
+                        handleCommand(command, static_cast<Channel>(dlci));
+                    }
+                }
+            }
+            break;
+        default:
+            LOG_ERROR("Unsupported frame 0x%02X on DLCI %d", control, dlci);
+            break;
+        }
+    }
+
+    void ModemSimulator::handleControlMessage(const std::uint8_t *data, std::size_t size)
+    {
+        if (size < 2) {
+            return;
+        }
+
+        const auto type = static_cast<std::uint8_t>(data[0] & ~commandBit);
+        if ((data[0] & commandBit) == 0) {
+            return; // response to the MSC sent by the simulator
+        }
+
+        switch (type) {
+        case controlCld: {
+            const std::array<std::uint8_t, 2> response = {controlCld, extensionBit};
+            sendFrame(addressOf(0, false), typeUih, response.data(), response.size());
+            multiplexed = false;
+        } break;
+        case controlMsc: {
+            std::vector<std::uint8_t> response(data, data + size);
+            response[0] = controlMsc;
+            sendFrame(addressOf(0, false), typeUih, response.data(), response.size());
+        } break;
+        default: {
+            const std::array<std::uint8_t, 3> response = {controlNsc, (1 << 1) | extensionBit, data[0]};
+            sendFrame(addressOf(0, false), typeUih, response.data(), response.size());
+        } break;
+        }
+    }
+
+    void ModemSimulator::handleCommand(const std::string &command, Channel channel)
+    {
+        ++statistics.commands;
+        if (echo) {
+            sendText(command + "\r", channel);
+        }
+
+        std::string result = "OK";
+        std::vector<std::string> lines;
+        const auto name = nameOf(command);
+
+        if (command == "ATE0" || command == "ATE1") {
+            echo = command.back() == '1';
+        }
+        else if (name == "AT+QCMGR" || name == "AT+CMGD") {
+            lines = handleSmsCommand(command, result);
+        }
+        else if (auto scripted = results.find(command); scripted != results.end()) {
+            result = scripted->second;
+        }
+        else if (auto scripted = responses.find(command); scripted != responses.end()) {
+            lines = scripted->second;
+        }
+        else if (auto scripted = responses.find(name); scripted != responses.end()) {
+            lines = scripted->second;
+        }
+        else if (name != "AT" && name != "AT+CMUX") {
+            ++statistics.unknownCommands;
+        }
+
+        sendLines(lines, result, channel);
+
+        if (name == "AT+CMUX") {
+            multiplexed = true;
+        }
+    }
+
+    std::vector<std::string> ModemSimulator::handleSmsCommand(const std::string &command, std::string &result)
+    {
+        constexpr auto invalidIndex = "+CMS ERROR: 321";
+
+        std::uint32_t index = 0;
+        if (std::sscanf(command.c_str() + nameOf(command).size(), "=%u", &index) != 1) {
+            result = "ERROR";
+            return {};
+        }
+
+        const auto message = messages.find(index);
+        if (message == messages.end()) {
+            result = invalidIndex;
+            return {};
+        }
+
+        if (nameOf(command) == "AT+CMGD") {
+            messages.erase(message);
+            return {};
+        }
+        return {message->second.header, message->second.text};
+    }
+
+    void ModemSimulator::sendLines(const std::vector<std::string> &lines, const std::string &result, Channel channel)
+    {
+        std::string text;
+        for (const auto &line : lines) {
+            text += "\r\n" + line + "\r\n";
+        }
+        text += "\r\n" + result + "\r\n";
+        sendText(text, channel);
+    }
+
+    void ModemSimulator::sendText(const std::string &text, Channel channel)
+    {
+        const auto data = reinterpret_cast<const std::uint8_t *>(text.data());
+        if (!multiplexed) {
+            queue(data, text.size());
+            return;
+        }
+
+        for (std::size_t offset = 0; offset < text.size(); offset += mux::maxShortLength) {
+            const auto part = std::min(text.size() - offset, mux::maxShortLength);
+            sendFrame(addressOf(static_cast<std::uint8_t>(channel), false), typeUih, data + offset, part);
+        }
+    }
+
+    void ModemSimulator::sendFrame(std::uint8_t address,
+                                   std::uint8_t control,
+                                   const std::uint8_t *data,
+                                   std::size_t size)
+    {
+        std::array<std::uint8_t, mux::maxFrameLength> frame;
+        const auto length = mux::encode(address, control, data, size, frame.data());
+        ++statistics.framesSent;
+        queue(frame.data(), length);
+    }
+
+    void ModemSimulator::queue(const std::uint8_t *data, std::size_t size)
+    {
+        statistics.bytesSent += size;
+        output.insert(output.end(), data, data + size);
+    }
+
+    void ModemSimulator::flush(std::unique_lock<std::mutex> &lock)
+    {
+        const auto pending = std::move(output);
+        output.clear();
+
+        std::lock_guard<std::mutex> writeLock(writeMutex);
+        lock.unlock();
+        write(pending.data(), pending.size());
+    }
+
+    void ModemSimulator::write(const std::uint8_t *data, std::size_t size)
+    {
+        while (size > 0 && masterFd >= 0) {
+            const auto written = ::write(masterFd, data, size);
+            if (written < 0) {
+                if (errno == EINTR) {
+                    continue;
+                }
+                LOG_ERROR("Pseudo-terminal write failed: %s", std::strerror(errno));
+                return;
+            }
+            data += written;
+            size -= written;
+        }
+    }
+} // namespace cellular::simulator
@@ -0,0 +1,138 @@
+// Copyright (c) 2017-2023, Mudita Sp. z.o.o. All rights reserved.
+// For licensing, see https://github.com/mudita/MuditaOS/LICENSE.md
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+/// Quectel-like modem behind a pseudo-terminal, for running and measuring the cellular stack without hardware.
+///
+/// The simulator owns the master side of the pty, the stack opens the slave one as its serial port
+/// (`SERIAL_PORT` on Linux). It answers AT commands in the text mode and after `AT+CMUX` switches to
+/// the GSM 07.10 basic option: the channels are opened with SABM, every UIH frame on DLCI 1-3 carries
+/// AT commands, URCs are sent on the Notifications channel and packet data on the Data one.
+namespace cellular::simulator
+{
+    struct Statistics
+    {
+        std::size_t commands        = 0; ///< AT commands answered
+        std::size_t unknownCommands = 0; ///< Commands without a scripted response, answered with OK
+        std::size_t urcs            = 0;
+        std::size_t framesReceived  = 0;
+        std::size_t framesSent      = 0;
+        std::size_t framesDropped   = 0; ///< Received frames with a wrong FCS or flags
+        std::size_t bytesReceived   = 0;
+        std::size_t bytesSent       = 0;
+        std::size_t dataReceived    = 0; ///< Payload received on the Data channel
+    };
+
+    class ModemSimulator
+    {
+      public:
+        /// Channels of the stack, see `CellularMux::Channel`
+        enum class Channel : std::uint8_t
+        {
+            Control       = 0,
+            Commands      = 1,
+            Notifications = 2,
+            Data          = 3,
+        };
+
+        /// @param linkPath if not empty, a symlink to the slave device is created there
+        explicit ModemSimulator(std::string linkPath = {});
+        ~ModemSimulator();
+
+        ModemSimulator(const ModemSimulator &) = delete;
+        ModemSimulator &operator=(const ModemSimulator &) = delete;
+
+        /// Opens the pty and starts answering, sending the power up URCs first
+        bool start(bool sendPowerUpUrcs = true);
+        void stop();
+
+        /// Slave device the stack should open, the symlink if one was requested
+        const std::string &getPortPath() const noexcept;
+
+        /// Lines sent before the final OK when `command` is received. The command is matched as a whole
+        /// first and then by its name, i.e. the part before `=` or `?`
+        void setResponse(const std::string &command, std::vector<std::string> lines);
+        /// Final result code sent for `command` instead of OK, e.g. ERROR or +CME ERROR: 10
+        void setResult(const std::string &command, std::string result);
+
+        void sendUrc(const std::string &urc);
+        void urcStorm(const std::string &urc, std::size_t count);
+
+        /// Stores `text` as a message split into `parts` concatenated parts and notifies each of them with
+        /// +CMTI, the parts are read with AT+QCMGR just like on the modem
+        /// @return indexes of the stored parts
+        std::vector<std::uint32_t> smsBurst(const std::string &number, const std::string &text, std::size_t parts);
+
+        /// Sends the bytes on the Data channel, split into frames of the maximal size
+        void sendPacketData(const std::uint8_t *data, std::size_t size);
+        /// Echoes everything received on the Data channel back
+        void setDataLoopback(bool enabled);
+
+        bool isMultiplexed() const noexcept;
+        Statistics getStatistics() const;
+        void resetStatistics();
+
+      private:
+        struct Sms
+        {
+            std::string header;
+            std::string text;
+        };
+
+        void worker();
+        void receive(const std::uint8_t *data, std::size_t size);
+        void parseCommands();
+        void parseFrames();
+        void handleFrame(std::uint8_t address, std::uint8_t control, const std::uint8_t *data, std::size_t size);
+        void handleControlMessage(const std::uint8_t *data, std::size_t size);
+
+        /// Answers one AT command, `channel` is the DLCI it came on
+        void handleCommand(const std::string &command, Channel channel);
+        std::vector<std::string> handleSmsCommand(const std::string &command, std::string &result);
+
+        void sendLines(const std::vector<std::string> &lines, const std::string &result, Channel channel);
+        void sendText(const std::string &text, Channel channel);
+        void sendFrame(std::uint8_t address, std::uint8_t control, const std::uint8_t *data, std::size_t size);
+        /// Queues the bytes for the pty, they are written by `flush` once the state is unlocked
+        void queue(const std::uint8_t *data, std::size_t size);
+        /// Writes the queued bytes, releasing `lock` first so that a full pty doesn't block the other threads
+        void flush(std::unique_lock<std::mutex> &lock);
+        void write(const std::uint8_t *data, std::size_t size);
+
+        std::string linkPath;
+        std::string slavePath;
+        int masterFd = -1;
+        int slaveFd  = -1;
+
+        std::thread thread;
+        std::atomic_bool running{false};
+        /// Guards the state below, scripted calls come from other threads
+        mutable std::mutex mutex;
+        /// Keeps the bytes queued by the threads in order, taken before `mutex` is released
+        std::mutex writeMutex;
+
+        bool multiplexed = false;
+        bool echo        = true;
+        bool loopback    = false;
+        std::vector<std::uint8_t> input;
+        std::vector<std::uint8_t> output;
+
+        std::map<std::string, std::vector<std::string>> responses;
+        std::map<std::string, std::string> results;
+        std::map<std::uint32_t, Sms> messages;
+        std::uint32_t nextSmsIndex    = 0;
+        std::uint8_t nextSmsReference = 0;
+
+        Statistics statistics;
+    };
+} // namespace cellular::simulator
@@ -0,0 +1,98 @@
+// Copyright (c) 2017-2023, Mudita Sp. z.o.o. All rights reserved.
+// For licensing, see https://github.com/mudita/MuditaOS/LICENSE.md
+
+#include "ModemSimulator.hpp"
+
+#include <iostream>
+#include <sstream>
+
+namespace
+{
+    constexpr auto usage = "Commands:\n"
+                           "  urc <text>                     send the URC\n"
+                           "  storm <count> <text>           send the URC <count> times\n"
+                           "  sms <parts> <number> <text>    deliver the message split into <parts>\n"
+                           "  data <size>                    send <size> bytes on the Data channel\n"
+                           "  loopback on|off                echo the Data channel back\n"
+                           "  response <command> <line>      answer <command> with <line> and OK\n"
+                           "  stats                          print the statistics\n"
+                           "  quit\n";
+
+    std::string restOf(std::istringstream &stream)
+    {
+        std::string rest;
+        std::getline(stream >> std::ws, rest);
+        return rest;
+    }
+
+    void printStatistics(const cellular::simulator::Statistics &statistics)
+    {
+        std::cout << "commands: " << statistics.commands << " (unknown: " << statistics.unknownCommands << ")\n"
+                  << "urcs: " << statistics.urcs << "\n"
+                  << "frames: " << statistics.framesReceived << " received, " << statistics.framesSent << " sent, "
+                  << statistics.framesDropped << " dropped\n"
+                  << "bytes: " << statistics.bytesReceived << " received, " << statistics.bytesSent << " sent\n"
+                  << "data: " << statistics.dataReceived << " received" << std::endl;
+    }
+} // namespace
+
+int main(int argc, char *argv[])
+{
+    cellular::simulator::ModemSimulator modem{argc > 1 ? argv[1] : ""};
+    if (!modem.start()) {
+        std::cerr << "Failed to start the modem simulator" << std::endl;
+        return 1;
+    }
+    std::cout << "Modem simulator listening on " << modem.getPortPath() << "\n" << usage << std::flush;
+
+    std::string line;
+    while (std::getline(std::cin, line)) {
+        std::istringstream stream{line};
+        std::string command;
+        stream >> command;
+
+        if (command == "urc") {
+            modem.sendUrc(restOf(stream));
+        }
+        else if (command == "storm") {
+            std::size_t count = 0;
+            stream >> count;
+            modem.urcStorm(restOf(stream), count);
+        }
+        else if (command == "sms") {
+            std::size_t parts = 0;
+            std::string number;
+            stream >> parts >> number;
+            modem.smsBurst(number, restOf(stream), parts);
+        }
+        else if (command == "data") {
+            std::size_t size = 0;
+            stream >> size;
+            std::vector<std::uint8_t> data(size);
+            for (std::size_t i = 0; i < size; ++i) {
+                data[i] = static_cast<std::uint8_t>(i);
+            }
+            modem.sendPacketData(data.data(), data.size());
+        }
+        else if (command == "loopback") {
+            modem.setDataLoopback(restOf(stream) == "on");
+        }
+        else if (command == "response") {
+            std::string atCommand;
+            stream >> atCommand;
+            modem.setResponse(atCommand, {restOf(stream)});
+        }
+        else if (command == "stats") {
+            printStatistics(modem.getStatistics());
+        }
+        else if (command == "quit") {
+            break;
+        }
+        else if (!command.empty()) {
+            std::cout << usage << std::flush;
+        }
+    }
+
+    modem.stop();
+    return 0;
+}
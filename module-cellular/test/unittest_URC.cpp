@@ -1,10 +1,11 @@
-// Copyright (c) 2017-2022, Mudita Sp. z.o.o. All rights reserved.
+// Copyright (c) 2017-2023, Mudita Sp. z.o.o. All rights reserved.
 // For licensing, see https://github.com/mudita/MuditaOS/LICENSE.md
 
 #include "Utils.hpp"
 #include <algorithm>
 #include <cstdint>
 #include <string>
+#include <typeindex>
 
 #include <catch2/catch.hpp>
 #include <time/time_conversion.hpp>
@@ -23,6 +24,7 @@
 #include "UrcResponse.hpp"
 #include <at/UrcQSimstat.hpp>
 #include "UrcFactory.hpp"
+#include "UrcTokenizer.hpp"
 #include "SimState.hpp"
 #include <at/SimInsertedState.hpp>
 
@@ -983,3 +985,105 @@ TEST_CASE("QSimstat")
         REQUIRE(qsimstat->getEnabled() == at::SimInsertedStatusEnable::Disable);
     }
 }
+
+TEST_CASE("Urc tokenizer")
+{
+    std::vector<std::string_view> tokens;
+
+    SECTION("Parameters are trimmed and unquoted")
+    {
+        at::urc::tokenize(" \"D509\" , 1,\r\n \" 80D413D \"\r\n", tokens);
+        REQUIRE(tokens == std::vector<std::string_view>{"D509", "1", "80D413D"});
+    }
+
+    SECTION("Empty parameters")
+    {
+        at::urc::tokenize("", tokens);
+        REQUIRE(tokens.empty());
+
+        at::urc::tokenize(",", tokens);
+        REQUIRE(tokens == std::vector<std::string_view>{""});
+
+        at::urc::tokenize("145,,,", tokens);
+        REQUIRE(tokens == std::vector<std::string_view>{"145", "", ""});
+    }
+
+    SECTION("Tokens are views into the body")
+    {
+        const std::string body = "\"csq\",100,50";
+        at::urc::tokenize(body, tokens);
+        REQUIRE(tokens.size() == 3);
+        for (const auto &token : tokens) {
+            REQUIRE(token.data() >= body.data());
+            REQUIRE(token.data() + token.size() <= body.data() + body.size());
+        }
+    }
+
+    SECTION("Message split")
+    {
+        auto message = at::urc::splitMessage("\r\n+CREG : 1\r\n");
+        REQUIRE(message.head == "+CREG");
+        REQUIRE(message.body == " 1\r\n");
+
+        message = at::urc::splitMessage("\r\nRING\r\n");
+        REQUIRE(message.head == "RING");
+        REQUIRE(message.body == "\r\nRING\r\n");
+    }
+}
+
+TEST_CASE("Urc factory dispatch")
+{
+    SECTION("The longest head wins")
+    {
+        auto urc = at::urc::UrcFactory::Create("+CRING: VOICE");
+        REQUIRE(getURC<at::urc::Ring>(urc));
+
+        urc = at::urc::UrcFactory::Create("NO CARRIER");
+        auto rsp = getURC<at::urc::UrcResponse>(urc);
+        REQUIRE(rsp);
+        REQUIRE(rsp->getURCResponseType() == at::urc::UrcResponse::URCResponseType::NoCarrier);
+    }
+
+    SECTION("Unknown head")
+    {
+        auto urc = at::urc::UrcFactory::Create("+QIURD: 1");
+        REQUIRE(typeid(*urc) == typeid(at::urc::Urc));
+        REQUIRE(urc->isValid());
+        REQUIRE(urc->getTokens() == std::vector<std::string_view>{"1"});
+
+        urc = at::urc::UrcFactory::Create("\r\n");
+        REQUIRE(typeid(*urc) == typeid(at::urc::Urc));
+        REQUIRE_FALSE(urc->isValid());
+    }
+
+    SECTION("Body outlives the message")
+    {
+        auto message = std::make_unique<std::string>("+QIND: \"act\",\"LTE\"");
+        auto urc     = at::urc::UrcFactory::Create(*message);
+        message.reset();
+        auto qind = getURC<at::urc::Qind>(urc);
+        REQUIRE(qind);
+        REQUIRE(qind->getAct() == "LTE");
+    }
+}
+
+TEST_CASE("Urc factory - registration storm")
+{
+    const std::vector<std::pair<std::string, std::type_index>> storm = {
+        {"\r\n+CREG: 1,\"D509\",\"80D413D\",7\r\n", typeid(at::urc::Creg)},
+        {"\r\n+QIND: \"csq\",31,99\r\n", typeid(at::urc::Qind)},
+        {"\r\n+QIND: \"act\",\"HSDPA&HSUPA\"\r\n", typeid(at::urc::Qind)},
+        {"\r\n+CREG: 5\r\n", typeid(at::urc::Creg)},
+        {"\r\n+CTZE: \"+08\",1,\"2020/10/21,13:49:57\"\r\n", typeid(at::urc::Ctze)},
+        {"\r\n+QSIMSTAT: 1,1\r\n", typeid(at::urc::QSimstat)},
+    };
+
+    // The same messages interleaved many times, as during network registration
+    for (auto i = 0; i < 100; ++i) {
+        for (const auto &[message, type] : storm) {
+            auto urc = at::urc::UrcFactory::Create(message);
+            REQUIRE(urc->isValid());
+            REQUIRE(std::type_index(typeid(*urc)) == type);
+        }
+    }
+}
@@ -1,11 +1,16 @@
-// Copyright (c) 2017-2022, Mudita Sp. z.o.o. All rights reserved.
+// Copyright (c) 2017-2023, Mudita Sp. z.o.o. All rights reserved.
 // For licensing, see https://github.com/mudita/MuditaOS/LICENSE.md
 
 #include <catch2/catch.hpp>
 #include <modem/mux/CellularMuxFrame.h>
 #include <modem/mux/CellularMuxTypes.h>
+#include <modem/mux/CellularMux.h>
 #include <bsp/cellular/bsp_cellular.hpp>
 
+#include <array>
+#include <memory>
+#include <string>
+
 TEST_CASE("TS0170 frame")
 {
 
@@ -79,3 +84,159 @@ TEST_CASE("TS0170 frame")
         REQUIRE(frame.isComplete(frame.getSerData()) == false);
     }
 }
+
+TEST_CASE("CMUX codec")
+{
+    constexpr auto DLCI = 2;
+    const auto address  = static_cast<uint8_t>(DLCI << 2);
+    const auto control  = static_cast<uint8_t>(TypeOfFrame_e::UIH);
+    std::array<uint8_t, cellular::mux::maxFrameLength * 2> buffer{};
+
+    SECTION("Encoded SABM frame")
+    {
+        const auto length = cellular::mux::encode(
+            1 << 1, static_cast<uint8_t>(TypeOfFrame_e::SABM), nullptr, 0, buffer.data());
+        const std::vector<uint8_t> expected{0xf9, 0x03, 0x3f, 0x01, 0x1c, 0xf9};
+        REQUIRE(std::vector<uint8_t>(buffer.begin(), buffer.begin() + length) == expected);
+    }
+
+    SECTION("Long payload")
+    {
+        const std::vector<uint8_t> payload(200, 'A');
+        const auto length = cellular::mux::encode(address, control, payload.data(), payload.size(), buffer.data());
+        REQUIRE(length == payload.size() + cellular::mux::frameOverhead);
+        REQUIRE(buffer[3] == static_cast<uint8_t>(payload.size() << 1));
+        REQUIRE(buffer[4] == static_cast<uint8_t>(payload.size() >> 7));
+        REQUIRE(cellular::mux::isComplete(buffer.data(), length));
+
+        const auto decoded = cellular::mux::decode(buffer.data(), length);
+        REQUIRE(decoded.status == cellular::mux::FrameStatus::OK);
+        REQUIRE(std::vector<uint8_t>(decoded.data, decoded.data + decoded.size) == payload);
+    }
+
+    SECTION("Encoded command")
+    {
+        const std::string command("AT\r");
+        const auto length = cellular::mux::encode(
+            address, control, reinterpret_cast<const uint8_t *>(command.data()), command.size(), buffer.data());
+        const std::vector<uint8_t> expected{0xf9, 0x09, 0xef, 0x07, 0x41, 0x54, 0x0d, 0x35, 0xf9};
+        REQUIRE(std::vector<uint8_t>(buffer.begin(), buffer.begin() + length) == expected);
+    }
+
+    SECTION("Payload decoded in place")
+    {
+        const std::vector<uint8_t> frame{0xf9, 0x09, 0xef, 0x07, 0x41, 0x54, 0x0d, 0x35, 0xf9};
+        const auto decoded = cellular::mux::decode(frame.data(), frame.size());
+        REQUIRE(decoded.status == cellular::mux::FrameStatus::OK);
+        REQUIRE(decoded.getDLCI() == DLCI);
+        REQUIRE(decoded.data == frame.data() + 4);
+        REQUIRE(decoded.size == 3);
+    }
+
+    SECTION("Payload containing the flag")
+    {
+        const std::vector<uint8_t> payload{0x41, TS0710_FLAG, 0x0d};
+        const auto length = cellular::mux::encode(address, control, payload.data(), payload.size(), buffer.data());
+        REQUIRE(cellular::mux::isComplete(buffer.data(), length));
+
+        const auto decoded = cellular::mux::decode(buffer.data(), length);
+        REQUIRE(decoded.status == cellular::mux::FrameStatus::OK);
+        REQUIRE(std::vector<uint8_t>(decoded.data, decoded.data + decoded.size) == payload);
+    }
+
+    SECTION("Corrupted frames")
+    {
+        std::vector<uint8_t> frame{0xf9, 0x09, 0xef, 0x07, 0x41, 0x54, 0x0d, 0x36, 0xf9};
+        REQUIRE(cellular::mux::decode(frame.data(), frame.size()).status == cellular::mux::FrameStatus::CRCError);
+
+        frame.pop_back();
+        REQUIRE(cellular::mux::decode(frame.data(), frame.size()).status ==
+                cellular::mux::FrameStatus::IncorrectStartStopFlags);
+        REQUIRE(cellular::mux::decode(frame.data(), 2).status == cellular::mux::FrameStatus::EmptyFrame);
+    }
+
+    SECTION("Quectel frame delimited by the closing flag")
+    {
+        const std::vector<uint8_t> frame{0xf9, 0x09, 0xef, 0xff, 0x41, 0x54, 0x0d, 0x00, 0xf9};
+        const auto decoded = cellular::mux::decode(frame.data(), frame.size());
+        REQUIRE(decoded.status == cellular::mux::FrameStatus::OK);
+        REQUIRE(decoded.size == 3);
+    }
+}
+
+TEST_CASE("CMUX codec - same frames as CellularMuxFrame")
+{
+    const auto address = static_cast<uint8_t>(3 << 2);
+    const auto control = static_cast<uint8_t>(TypeOfFrame_e::UIH);
+    std::array<uint8_t, cellular::mux::maxFrameLength> buffer{};
+
+    for (std::size_t size = 0; size <= cellular::mux::maxShortLength; ++size) {
+        std::vector<uint8_t> payload(size);
+        for (std::size_t i = 0; i < size; ++i) {
+            payload[i] = static_cast<uint8_t>(i * 7);
+        }
+
+        CellularMuxFrame::frame_t frame{address, control};
+        frame.data            = payload;
+        const auto serialized = frame.serialize();
+
+        const auto length = cellular::mux::encode(address, control, payload.data(), payload.size(), buffer.data());
+        REQUIRE(std::vector<uint8_t>(buffer.begin(), buffer.begin() + length) == serialized);
+
+        const auto decoded = cellular::mux::decode(serialized.data(), serialized.size());
+        REQUIRE(decoded.status == cellular::mux::FrameStatus::OK);
+        REQUIRE(std::vector<uint8_t>(decoded.data, decoded.data + decoded.size) ==
+                CellularMuxFrame{serialized}.getData());
+    }
+}
+
+namespace
+{
+    class AwaitingChannel : public DLCChannel
+    {
+      public:
+        AwaitingChannel(DLCI_t DLCI, const std::string &name) : DLCChannel(DLCI, name, nullptr)
+        {
+            awaitingResponseFlag.set();
+        }
+    };
+} // namespace
+
+TEST_CASE("CMUX - DMA error is reported on the control channel")
+{
+    CellularMux::Channels channels;
+    channels.push_back(std::make_unique<AwaitingChannel>(0, "Control"));
+    channels.push_back(std::make_unique<AwaitingChannel>(1, "Commands"));
+    auto &control  = *channels[0];
+    auto &commands = *channels[1];
+
+    std::array<uint8_t, at::defaultMessageBufferSize> received{};
+
+    SECTION("Error")
+    {
+        CellularMux::sendFrameToChannel(
+            channels, bsp::cellular::CellularResultCode::ReceivingNotStarted, nullptr, 0);
+
+        REQUIRE(control.cmdReceive(received.data(), std::chrono::milliseconds{0}) == 1);
+        REQUIRE(received[0] == static_cast<uint8_t>(bsp::cellular::CellularResultCode::ReceivingNotStarted));
+        REQUIRE(commands.cmdReceive(received.data(), std::chrono::milliseconds{0}) == 0);
+    }
+
+    SECTION("Frame")
+    {
+        const std::string command{"AT\r"};
+        std::array<uint8_t, cellular::mux::maxFrameLength> frame{};
+        const auto length = cellular::mux::encode(static_cast<uint8_t>(1 << 2),
+                                                  static_cast<uint8_t>(TypeOfFrame_e::UIH),
+                                                  reinterpret_cast<const uint8_t *>(command.data()),
+                                                  command.size(),
+                                                  frame.data());
+        CellularMux::sendFrameToChannel(
+            channels, bsp::cellular::CellularResultCode::ReceivedAndIdle, frame.data(), length);
+
+        REQUIRE(control.cmdReceive(received.data(), std::chrono::milliseconds{0}) == 0);
+        REQUIRE(commands.cmdReceive(received.data(), std::chrono::milliseconds{0}) == 4);
+        REQUIRE(received[0] == static_cast<uint8_t>(bsp::cellular::CellularResultCode::ReceivedAndIdle));
+        REQUIRE(std::string(received.begin() + 1, received.begin() + 4) == "AT\r");
+    }
+}
@@ -0,0 +1,619 @@
+// Copyright (c) 2017-2023, Mudita Sp. z.o.o. All rights reserved.
+// For licensing, see https://github.com/mudita/MuditaOS/LICENSE.md
+
+#include <catch2/catch.hpp>
+#include <ModemSimulator.hpp>
+#include <bsp/cellular/bsp_cellular.hpp>
+#include <modem/ATParser.hpp>
+#include <modem/mux/CellularMux.h>
+#include <modem/mux/CellularMuxCodec.h>
+#include <UrcCmti.hpp>
+#include <UrcFactory.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <iostream>
+#include <optional>
+#include <thread>
+
+#include <fcntl.h>
+#include <poll.h>
+#include <termios.h>
+#include <unistd.h>
+
+using cellular::simulator::ModemSimulator;
+namespace mux = cellular::mux;
+
+namespace
+{
+    constexpr std::uint8_t typeSabm = 0x3F; // with the P/F bit, as sent by DLCChannel
+    constexpr std::uint8_t typeUa   = 0x63;
+    constexpr std::uint8_t typeUih  = 0xEF;
+    constexpr auto timeout          = std::chrono::seconds{2};
+
+    struct Frame
+    {
+        std::uint8_t dlci;
+        std::uint8_t control;
+        std::string payload;
+    };
+
+    /// The stack side of the serial port, talking over the pty just like `LinuxCellular` does
+    class Client
+    {
+      public:
+        explicit Client(const std::string &port) : fd(open(port.c_str(), O_RDWR | O_NOCTTY))
+        {
+            termios tio{};
+            tcgetattr(fd, &tio);
+            cfmakeraw(&tio);
+            tcsetattr(fd, TCSANOW, &tio);
+        }
+
+        ~Client()
+        {
+            close(fd);
+        }
+
+        bool isOpen() const
+        {
+            return fd >= 0;
+        }
+
+        void send(const std::string &text)
+        {
+            send(reinterpret_cast<const std::uint8_t *>(text.data()), text.size());
+        }
+
+        void send(std::uint8_t dlci, std::uint8_t control, const std::string &payload = {})
+        {
+            std::array<std::uint8_t, mux::maxFrameLength> frame;
+            const auto address = static_cast<std::uint8_t>(dlci << 2) | (control == typeSabm ? 0x02 : 0);
+            const auto length  = mux::encode(
+                address, control, reinterpret_cast<const std::uint8_t *>(payload.data()), payload.size(), frame.data());
+            send(frame.data(), length);
+        }
+
+        /// Text received in the AT mode up to and including `end`
+        std::optional<std::string> readUntil(const std::string &end)
+        {
+            const auto deadline = std::chrono::steady_clock::now() + timeout;
+            do {
+                const auto found = std::search(buffer.begin(), buffer.end(), end.begin(), end.end());
+                if (found != buffer.end()) {
+                    std::string text(buffer.begin(), found + end.size());
+                    buffer.erase(buffer.begin(), found + end.size());
+                    return text;
+                }
+            } while (receive(deadline));
+            return std::nullopt;
+        }
+
+        std::optional<Frame> readFrame()
+        {
+            const auto deadline = std::chrono::steady_clock::now() + timeout;
+            do {
+                buffer.erase(buffer.begin(), std::find(buffer.begin(), buffer.end(), mux::flag));
+                if (buffer.size() < 4 || (buffer[3] & 0x01) == 0) {
+                    continue; // the simulator sends only short frames
+                }
+                const auto frameLength = (buffer[3] >> 1) + 6U;
+                if (buffer.size() < frameLength) {
+                    continue;
+                }
+                const auto frame = mux::decode(buffer.data(), frameLength);
+                Frame decoded{static_cast<std::uint8_t>(frame.getDLCI()),
+                              frame.control,
+                              std::string(reinterpret_cast<const char *>(frame.data), frame.size)};
+                buffer.erase(buffer.begin(), buffer.begin() + frameLength);
+                if (frame.status == mux::FrameStatus::OK) {
+                    return decoded;
+                }
+            } while (receive(deadline));
+            return std::nullopt;
+        }
+
+        /// Payload of the UIH frames received on `dlci` up to and including `end`
+        std::optional<std::string> readUntil(std::uint8_t dlci, const std::string &end)
+        {
+            std::string text;
+            while (text.size() < end.size() || text.compare(text.size() - end.size(), end.size(), end) != 0) {
+                const auto frame = readFrame();
+                if (!frame) {
+                    return std::nullopt;
+                }
+                if (frame->dlci == dlci && frame->control == typeUih) {
+                    text += frame->payload;
+                }
+            }
+            return text;
+        }
+
+      private:
+        void send(const std::uint8_t *data, std::size_t size)
+        {
+            while (size > 0) {
+                const auto written = write(fd, data, size);
+                if (written <= 0) {
+                    return;
+                }
+                data += written;
+                size -= written;
+            }
+        }
+
+        bool receive(std::chrono::steady_clock::time_point deadline)
+        {
+            const auto left =
+                std::chrono::duration_cast<std::chrono::milliseconds>(deadline - std::chrono::steady_clock::now());
+            pollfd descriptor{fd, POLLIN, 0};
+            if (left.count() <= 0 || poll(&descriptor, 1, left.count()) <= 0) {
+                return false;
+            }
+
+            std::array<std::uint8_t, 4096> data;
+            const auto size = read(fd, data.data(), data.size());
+            if (size <= 0) {
+                return false;
+            }
+            buffer.insert(buffer.end(), data.begin(), data.begin() + size);
+            return true;
+        }
+
+        int fd;
+        std::vector<std::uint8_t> buffer;
+    };
+
+    /// Takes both sides through the CMUX setup done by `CellularMux::startMultiplexer`
+    void enterCmux(ModemSimulator &modem, Client &client)
+    {
+        client.send("ATE0\r");
+        REQUIRE(client.readUntil("OK\r\n"));
+        client.send("AT+CMUX=0,0,7,127,10,3,30,10,2\r");
+        REQUIRE(client.readUntil("\r\nOK\r\n"));
+        REQUIRE(modem.isMultiplexed());
+
+        for (std::uint8_t dlci = 0; dlci <= static_cast<std::uint8_t>(ModemSimulator::Channel::Data); ++dlci) {
+            client.send(dlci, typeSabm);
+            const auto ua = client.readFrame();
+            REQUIRE(ua);
+            REQUIRE(ua->control == typeUa);
+            REQUIRE(ua->dlci == dlci);
+
+            if (dlci != 0) {
+                // Modem status of the channel
+                const auto msc = client.readFrame();
+                REQUIRE(msc);
+                REQUIRE(msc->dlci == 0);
+                REQUIRE(msc->payload.size() == 4);
+                REQUIRE(msc->payload[0] == '\xE3');
+            }
+        }
+    }
+
+    /// Serial port of the stack like `LinuxCellular`, which guards the port with a FreeRTOS mutex that can't be
+    /// waited for without the scheduler running
+    class PtyCellular : public bsp::Cellular
+    {
+      public:
+        explicit PtyCellular(const std::string &port) : fd(open(port.c_str(), O_RDWR | O_NOCTTY))
+        {
+            termios tio{};
+            tcgetattr(fd, &tio);
+            cfmakeraw(&tio);
+            tcsetattr(fd, TCSANOW, &tio);
+        }
+
+        ~PtyCellular()
+        {
+            close(fd);
+        }
+
+        ssize_t read(void *buf, size_t nbytes, std::chrono::milliseconds timeoutMs) override
+        {
+            auto result     = static_cast<bsp::cellular::CellularDMAResultStruct *>(buf);
+            nbytes          = std::min(nbytes, sizeof(result->data));
+            const auto size = ::read(fd, result->data, nbytes);
+            if (size > 0) {
+                result->resultCode = bsp::cellular::CellularResultCode::ReceivedAndIdle;
+                result->dataSize   = size;
+            }
+            return size;
+        }
+
+        ssize_t write(void *buf, size_t nbytes) override
+        {
+            auto data = static_cast<const std::uint8_t *>(buf);
+            for (auto left = nbytes; left > 0;) {
+                const auto written = ::write(fd, data, left);
+                if (written <= 0) {
+                    return -1;
+                }
+                data += written;
+                left -= written;
+            }
+            return nbytes;
+        }
+
+        uint32_t wait(std::chrono::milliseconds timeoutMs) override
+        {
+            pollfd descriptor{fd, POLLIN, 0};
+            return poll(&descriptor, 1, timeoutMs.count()) > 0 ? 1 : 0;
+        }
+
+        void powerUp() override
+        {}
+        void powerDown() override
+        {}
+        void restart() override
+        {}
+        void informModemHostAsleep() override
+        {}
+        void informModemHostWakeup() override
+        {}
+        void enterSleep() override
+        {}
+        void exitSleep() override
+        {}
+        void setSpeed(uint32_t portSpeed) override
+        {}
+        void setSendingAllowed(bool state) override
+        {}
+        bool getSendingAllowed() const noexcept override
+        {
+            return true;
+        }
+        void selectAntenna(bsp::cellular::antenna antenna) override
+        {}
+        bsp::cellular::antenna getAntenna() override
+        {
+            return bsp::cellular::antenna::lowBand;
+        }
+        bsp::Board getBoard() override
+        {
+            return bsp::Board::Linux;
+        }
+
+      private:
+        int fd;
+    };
+
+    /// The stack between the serial port and ServiceCellular: `ATParser` in the AT mode and the channels fed by
+    /// `CellularMux::sendFrameToChannel` in the CMUX mode. The receiving thread does what the `CellularMux` worker
+    /// task does, the tests don't run the FreeRTOS scheduler
+    class Stack
+    {
+      public:
+        explicit Stack(const std::string &port) : cellular(port), parser(&cellular)
+        {
+            worker = std::thread(&Stack::receive, this);
+        }
+
+        ~Stack()
+        {
+            running = false;
+            worker.join();
+        }
+
+        ATParser &getParser()
+        {
+            return parser;
+        }
+
+        /// Switches to the CMUX mode and opens the channels like `CellularMux::startMultiplexer`
+        bool startMultiplexer(const DLCChannel::Callback_t &onNotification)
+        {
+            if (parser.cmd("AT+CMUX=0,0,7,127,10,3,30,10,2").code != at::Result::Code::OK) {
+                return false;
+            }
+
+            channels.push_back(std::make_unique<DLCChannel>(0, "Control", &cellular));
+            channels.push_back(std::make_unique<DLCChannel>(1, "Commands", &cellular));
+            channels.push_back(std::make_unique<DLCChannel>(2, "Notifications", &cellular, onNotification));
+            multiplexed = true;
+
+            return std::all_of(channels.begin(), channels.end(), [](const auto &channel) { return channel->init(); });
+        }
+
+        DLCChannel &get(CellularMux::Channel channel)
+        {
+            return *channels.at(static_cast<std::size_t>(channel));
+        }
+
+      private:
+        void receive()
+        {
+            constexpr auto pollTimeout = std::chrono::milliseconds{50};
+            bsp::cellular::CellularDMAResultStruct result{};
+
+            while (running) {
+                if (cellular.wait(pollTimeout) == 0) {
+                    continue;
+                }
+                result.dataSize = 0;
+                cellular.read(&result, bsp::cellular::CellularDMAResultStruct::getMaxSize(), pollTimeout);
+                if (result.dataSize == 0) {
+                    continue;
+                }
+
+                if (!multiplexed) {
+                    bsp::cellular::CellularResult cellularResult{result};
+                    parser.processNewData(nullptr, cellularResult);
+                    continue;
+                }
+
+                for (std::size_t i = 0; i < result.dataSize; ++i) {
+                    const auto character = result.data[i];
+                    if ((frameLength == 0 && character != mux::flag) || frameLength == frame.size()) {
+                        frameLength = 0;
+                        continue;
+                    }
+                    frame[frameLength++] = character;
+                    if (character != mux::flag || frameLength == 1) {
+                        continue;
+                    }
+                    if (frameLength == 2) {
+                        // The flag closed the previous frame
+                        frameLength = 1;
+                    }
+                    else if (mux::isComplete(frame.data(), frameLength)) {
+                        CellularMux::sendFrameToChannel(channels, result.resultCode, frame.data(), frameLength);
+                        frameLength = 0;
+                    }
+                }
+            }
+        }
+
+        PtyCellular cellular;
+        ATParser parser;
+        CellularMux::Channels channels;
+        std::atomic_bool multiplexed{false};
+        std::atomic_bool running{true};
+        std::array<std::uint8_t, mux::maxFrameLength> frame{};
+        std::size_t frameLength = 0;
+        std::thread worker;
+    };
+
+    constexpr auto commands      = static_cast<std::uint8_t>(ModemSimulator::Channel::Commands);
+    constexpr auto notifications = static_cast<std::uint8_t>(ModemSimulator::Channel::Notifications);
+    constexpr auto data          = static_cast<std::uint8_t>(ModemSimulator::Channel::Data);
+} // namespace
+
+TEST_CASE("Modem simulator - AT mode")
+{
+    ModemSimulator modem;
+    REQUIRE(modem.start());
+    Client client{modem.getPortPath()};
+    REQUIRE(client.isOpen());
+
+    REQUIRE(client.readUntil("+QIND: SMS DONE\r\n") == "\r\nRDY\r\n\r\n+CFUN: 1\r\n\r\n+CPIN: READY\r\n"
+                                                       "\r\n+QIND: SMS DONE\r\n");
+
+    SECTION("Echo")
+    {
+        client.send("AT\r");
+        REQUIRE(client.readUntil("OK\r\n") == "AT\r\r\nOK\r\n");
+        client.send("ATE0\r");
+        REQUIRE(client.readUntil("OK\r\n") == "ATE0\r\r\nOK\r\n");
+        client.send("AT\r");
+        REQUIRE(client.readUntil("OK\r\n") == "\r\nOK\r\n");
+    }
+
+    SECTION("Scripted responses")
+    {
+        client.send("ATE0\r");
+        REQUIRE(client.readUntil("OK\r\n"));
+
+        client.send("AT+CSQ\r");
+        REQUIRE(client.readUntil("OK\r\n") == "\r\n+CSQ: 20,99\r\n\r\nOK\r\n");
+
+        modem.setResponse("AT+CSQ", {"+CSQ: 5,99"});
+        client.send("AT+CSQ\r");
+        REQUIRE(client.readUntil("OK\r\n") == "\r\n+CSQ: 5,99\r\n\r\nOK\r\n");
+
+        modem.setResult("AT+CPIN=1234", "+CME ERROR: 16");
+        client.send("AT+CPIN=1234\r");
+        REQUIRE(client.readUntil("16\r\n") == "\r\n+CME ERROR: 16\r\n");
+
+        client.send("AT+QSCLK=1\r");
+        REQUIRE(client.readUntil("OK\r\n") == "\r\nOK\r\n");
+        REQUIRE(modem.getStatistics().unknownCommands == 1);
+    }
+}
+
+TEST_CASE("Modem simulator - CMUX mode")
+{
+    ModemSimulator modem;
+    REQUIRE(modem.start(false));
+    Client client{modem.getPortPath()};
+    enterCmux(modem, client);
+
+    SECTION("Commands")
+    {
+        client.send(commands, typeUih, "AT+CSQ\r");
+        REQUIRE(client.readUntil(commands, "OK\r\n") == "\r\n+CSQ: 20,99\r\n\r\nOK\r\n");
+    }
+
+    SECTION("Long responses are split into frames")
+    {
+        const std::string line(300, 'x');
+        modem.setResponse("AT+QENG", {line});
+        client.send(commands, typeUih, "AT+QENG=\"servingcell\"\r");
+        REQUIRE(client.readUntil(commands, "OK\r\n") == "\r\n" + line + "\r\n\r\nOK\r\n");
+    }
+
+    SECTION("Multipart SMS")
+    {
+        const auto indexes = modem.smsBurst("+48123", "Hello world", 2);
+        REQUIRE(indexes.size() == 2);
+
+        for (const auto index : indexes) {
+            const auto text = client.readUntil(notifications, "\r\n");
+            REQUIRE(text);
+            auto urc = at::urc::UrcFactory::Create(*text);
+            REQUIRE(urc);
+            auto cmti = dynamic_cast<at::urc::Cmti *>(urc.get());
+            REQUIRE(cmti != nullptr);
+            REQUIRE(cmti->getIndex() == std::to_string(index));
+        }
+
+        client.send(commands, typeUih, "AT+QCMGR=" + std::to_string(indexes[1]) + "\r");
+        REQUIRE(client.readUntil(commands, "OK\r\n") ==
+                "\r\n+QCMGR: \"REC UNREAD\",\"002B00340038003100320033\",,\"23/01/02,12:00:00+04\",0,2,2\r\n"
+                "\r\n0077006F0072006C0064\r\n\r\nOK\r\n");
+
+        client.send(commands, typeUih, "AT+CMGD=" + std::to_string(indexes[1]) + "\r");
+        REQUIRE(client.readUntil(commands, "OK\r\n"));
+        client.send(commands, typeUih, "AT+QCMGR=" + std::to_string(indexes[1]) + "\r");
+        REQUIRE(client.readUntil(commands, "321\r\n"));
+    }
+
+    SECTION("Packet data")
+    {
+        modem.setDataLoopback(true);
+        const std::string packet(100, '\x7E');
+        client.send(data, typeUih, packet);
+        REQUIRE(client.readUntil(data, packet) == packet);
+        REQUIRE(modem.getStatistics().dataReceived == packet.size());
+    }
+
+    SECTION("Close down")
+    {
+        client.send(0, typeUih, "\xC3\x01");
+        const auto frame = client.readFrame();
+        REQUIRE(frame);
+        REQUIRE(frame->payload == "\xC1\x01");
+        REQUIRE(!modem.isMultiplexed());
+
+        client.send("AT\r");
+        REQUIRE(client.readUntil("OK\r\n") == "\r\nOK\r\n");
+    }
+}
+
+TEST_CASE("Modem simulator - cellular stack")
+{
+    using namespace std::chrono;
+    constexpr auto iterations = 200;
+
+    ModemSimulator modem;
+    REQUIRE(modem.start(false));
+    Stack stack{modem.getPortPath()};
+    auto &parser = stack.getParser();
+    REQUIRE(parser.cmd("ATE0").code == at::Result::Code::OK);
+
+    const auto isCsq = [](const at::Result &result) {
+        return result.code == at::Result::Code::OK &&
+               std::find(result.response.begin(), result.response.end(), "+CSQ: 20,99") != result.response.end();
+    };
+
+    SECTION("AT mode")
+    {
+        modem.resetStatistics();
+        for (auto i = 0; i < iterations; ++i) {
+            REQUIRE(isCsq(parser.cmd("AT+CSQ")));
+        }
+        REQUIRE(modem.getStatistics().commands == iterations);
+    }
+
+    SECTION("CMUX mode")
+    {
+        std::atomic_size_t urcs{0};
+        REQUIRE(stack.startMultiplexer([&urcs](std::string &data) {
+            for (auto pos = data.find("+CREG: 1"); pos != std::string::npos; pos = data.find("+CREG: 1", pos + 1)) {
+                ++urcs;
+            }
+        }));
+        auto &channel = stack.get(CellularMux::Channel::Commands);
+
+        // The storm is sent from another thread while the commands are answered
+        modem.resetStatistics();
+        std::thread storm([&modem] { modem.urcStorm("+CREG: 1", iterations); });
+        for (auto i = 0; i < iterations; ++i) {
+            REQUIRE(isCsq(channel.cmd("AT+CSQ")));
+        }
+        storm.join();
+
+        const auto deadline = steady_clock::now() + timeout;
+        while (urcs < iterations && steady_clock::now() < deadline) {
+            std::this_thread::sleep_for(milliseconds{1});
+        }
+        REQUIRE(urcs == iterations);
+
+        const auto statistics = modem.getStatistics();
+        REQUIRE(statistics.commands == iterations);
+        REQUIRE(statistics.urcs == iterations);
+        REQUIRE(statistics.framesDropped == 0);
+    }
+}
+
+TEST_CASE("Modem simulator - throughput", "[.benchmark]")
+{
+    using namespace std::chrono;
+    constexpr auto iterations = 2000;
+
+    ModemSimulator modem;
+    REQUIRE(modem.start(false));
+    Client client{modem.getPortPath()};
+
+    const auto report = [](const char *name, steady_clock::duration elapsed, double count, const char *unit) {
+        const auto us = duration_cast<microseconds>(elapsed).count();
+        std::cout << name << ": " << static_cast<double>(us) / count << " us, " << count * 1e6 / us << " " << unit
+                  << std::endl;
+    };
+
+    client.send("ATE0\r");
+    REQUIRE(client.readUntil("OK\r\n"));
+    auto start = steady_clock::now();
+    for (auto i = 0; i < iterations; ++i) {
+        client.send("AT+CSQ\r");
+        REQUIRE(client.readUntil("OK\r\n"));
+    }
+    report("AT commands", steady_clock::now() - start, iterations, "commands/s");
+
+    enterCmux(modem, client);
+    start = steady_clock::now();
+    for (auto i = 0; i < iterations; ++i) {
+        client.send(commands, typeUih, "AT+CSQ\r");
+        REQUIRE(client.readUntil(commands, "OK\r\n"));
+    }
+    report("CMUX commands", steady_clock::now() - start, iterations, "commands/s");
+
+    // Latency from the URC being sent till the stack got it parsed
+    steady_clock::duration latency{};
+    for (auto i = 0; i < iterations; ++i) {
+        start = steady_clock::now();
+        modem.sendUrc("+QIND: \"csq\",21,99");
+        const auto text = client.readUntil(notifications, "99\r\n");
+        REQUIRE(text);
+        REQUIRE(at::urc::UrcFactory::Create(*text));
+        latency += steady_clock::now() - start;
+    }
+    report("URC latency", latency, iterations, "URCs/s");
+
+    // Sent from another thread, the storm doesn't fit in the pty buffer
+    start = steady_clock::now();
+    std::thread storm([&modem] { modem.urcStorm("+CREG: 1", iterations); });
+    for (auto i = 0; i < iterations; ++i) {
+        REQUIRE(client.readUntil(notifications, "\r\n"));
+    }
+    storm.join();
+    report("URC storm", steady_clock::now() - start, iterations, "URCs/s");
+
+    constexpr auto packetSize = 1500;
+    constexpr auto packets    = 500;
+    const std::string packet(packetSize, 'p');
+    modem.setDataLoopback(true);
+    start = steady_clock::now();
+    for (auto i = 0; i < packets; ++i) {
+        for (std::size_t offset = 0; offset < packet.size(); offset += mux::maxShortLength) {
+            client.send(data, typeUih, packet.substr(offset, mux::maxShortLength));
+        }
+        REQUIRE(client.readUntil(data, packet));
+    }
+    const auto elapsed = steady_clock::now() - start;
+    report("Mux loopback", elapsed, packets, "packets/s");
+    std::cout << "Mux throughput: "
+              << 2.0 * packetSize * packets / duration_cast<microseconds>(elapsed).count() * 1e6 / 1024 << " KiB/s"
+              << std::endl;
+}
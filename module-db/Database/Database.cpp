@@ -5,7 +5,9 @@
 
 #include <log/log.hpp>
 #include <gsl/util>
+#include <algorithm>
 #include <cstring>
+#include <vector>
 
 /* Declarations *********************/
 extern sqlite3_vfs *sqlite3_ecophonevfs(void);
@@ -67,6 +69,7 @@ extern "C"
 
 constexpr auto dbApplicationId = 0x65727550; // ASCII for "Pure"
 constexpr auto enabled         = 1;
+constexpr auto storeBufferSize = 16 * 1024;
 
 Database::Database(const char *name, bool readOnly)
     : dbConnection(nullptr), dbName(name), queryStatementBuffer{nullptr}, isInitialized_(false)
@@ -242,7 +245,7 @@ void Database::pragmaQuery(const std::string &pragmaStatement)
     }
 }
 
-bool Database::storeIntoFile(const std::filesystem::path &syncPath)
+bool Database::commitPendingTransaction()
 {
     // kind of workaround-fix for creating the sync package - if somehow DB can't be properly
     // vacuumed into file, the transaction is still outgoing (probably nested transaction)
@@ -255,12 +258,66 @@ bool Database::storeIntoFile(const std::filesystem::path &syncPath)
         }
         LOG_INFO("SQLITE3 autocommit after commit: %d", sqlite3_get_autocommit(dbConnection));
     }
+    return true;
+}
+
+std::uint64_t Database::queryPragmaValue(const char *pragma)
+{
+    const auto results = query(pragma);
+    if (!results || results->getRowCount() == 0) {
+        return 0;
+    }
+    return (*results)[0].getUInt64();
+}
+
+bool Database::storeIntoStream(StreamSink &sink)
+{
+    if (!commitPendingTransaction()) {
+        return false;
+    }
+
+    sqlite3_file *file = nullptr;
+    if (sqlite3_file_control(dbConnection, "main", SQLITE_FCNTL_FILE_POINTER, &file) != SQLITE_OK ||
+        file == nullptr || file->pMethods == nullptr) {
+        LOG_ERROR("Store database: %s into stream - no database file", dbName.c_str());
+        return false;
+    }
 
-    LOG_INFO("Store database: %s, into file: %s - STARTED", dbName.c_str(), syncPath.c_str());
-    if (const auto rc = execute("VACUUM main INTO '%q';", syncPath.c_str()); !rc) {
-        LOG_ERROR("Store database: %s, into file: %s - FAILED", dbName.c_str(), syncPath.c_str());
+    // Pages are read bypassing the pager, the read transaction keeps them consistent until streamed.
+    // Committed transactions are always written to the file as the database doesn't use WAL.
+    if (!execute("BEGIN;")) {
         return false;
     }
-    LOG_INFO("Store database: %s, into file: %s - SUCCEEDED", dbName.c_str(), syncPath.c_str());
+    auto endTransaction = gsl::finally([this] { execute("COMMIT;"); });
+
+    const auto pageSize  = queryPragmaValue("PRAGMA page_size;");
+    const auto pageCount = queryPragmaValue("PRAGMA page_count;");
+    if (pageSize == 0 || pageCount == 0) {
+        LOG_ERROR("Store database: %s into stream - can't get the database size", dbName.c_str());
+        return false;
+    }
+
+    LOG_INFO("Store database: %s into stream - STARTED", dbName.c_str());
+    const std::uint64_t imageSize = pageSize * pageCount;
+    if (!sink.begin(imageSize)) {
+        return false;
+    }
+
+    const auto pagesPerRead = std::max<std::uint64_t>(storeBufferSize / pageSize, 1);
+    std::vector<std::uint8_t> buffer(pagesPerRead * pageSize);
+
+    for (std::uint64_t offset = 0; offset < imageSize; offset += buffer.size()) {
+        const auto readSize = static_cast<int>(std::min<std::uint64_t>(buffer.size(), imageSize - offset));
+        if (const auto rc = file->pMethods->xRead(file, buffer.data(), readSize, offset); rc != SQLITE_OK) {
+            LOG_ERROR("Store database: %s into stream - read error: %d", dbName.c_str(), rc);
+            return false;
+        }
+        if (!sink.write(buffer.data(), readSize)) {
+            LOG_ERROR("Store database: %s into stream - FAILED", dbName.c_str());
+            return false;
+        }
+    }
+
+    LOG_INFO("Store database: %s into stream - SUCCEEDED", dbName.c_str());
     return true;
 }
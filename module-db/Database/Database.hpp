@@ -1,4 +1,4 @@
-﻿// Copyright (c) 2017-2022, Mudita Sp. z.o.o. All rights reserved.
+﻿// Copyright (c) 2017-2023, Mudita Sp. z.o.o. All rights reserved.
 // For licensing, see https://github.com/mudita/MuditaOS/LICENSE.md
 
 #pragma once
@@ -19,6 +19,16 @@ class DatabaseInitialisationError : public std::runtime_error
 class Database
 {
   public:
+    /// Receives the database image streamed by storeIntoStream
+    class StreamSink
+    {
+      public:
+        virtual ~StreamSink() = default;
+        /// Called once before any data with the size of the whole image
+        virtual bool begin(std::size_t imageSize) = 0;
+        virtual bool write(const std::uint8_t *data, std::size_t size) = 0;
+    };
+
     explicit Database(const char *name, bool readOnly = false);
     virtual ~Database();
 
@@ -32,7 +42,9 @@ class Database
     // Must be invoked before closing system in order to properly close OS layer
     static bool deinitialize();
 
-    bool storeIntoFile(const std::filesystem::path &syncPath);
+    /// Streams a consistent copy of the database pages straight from the database file, so no temporary copy of the
+    /// database is needed
+    bool storeIntoStream(StreamSink &sink);
 
     uint32_t getLastInsertRowId();
     void pragmaQuery(const std::string &pragmaStatement);
@@ -57,6 +69,9 @@ class Database
 
     void populateDbAppId();
 
+    bool commitPendingTransaction();
+    std::uint64_t queryPragmaValue(const char *pragma);
+
     /*
      * Arguments:
      *
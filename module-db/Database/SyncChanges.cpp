@@ -0,0 +1,158 @@
+// Copyright (c) 2017-2023, Mudita Sp. z.o.o. All rights reserved.
+// For licensing, see https://github.com/mudita/MuditaOS/LICENSE.md
+
+#include "SyncChanges.hpp"
+#include "Database.hpp"
+
+#include <json11.hpp>
+#include <log/log.hpp>
+
+#include <algorithm>
+#include <cctype>
+#include <cstdlib>
+#include <vector>
+
+namespace db::sync
+{
+    namespace
+    {
+        constexpr auto separator = '.';
+
+        struct Column
+        {
+            std::string name;
+            bool isInteger;
+        };
+
+        /// Same rule as the SQLite type affinity: a declared type containing "INT" holds integers
+        bool hasIntegerAffinity(std::string type)
+        {
+            std::transform(type.begin(), type.end(), type.begin(), [](unsigned char c) { return std::toupper(c); });
+            return type.find("INT") != std::string::npos;
+        }
+
+        std::vector<Column> columnsOf(Database &db, const std::string &table)
+        {
+            std::vector<Column> columns;
+            const auto result = db.query("PRAGMA table_info('%q');", table.c_str());
+            if (result == nullptr || result->getRowCount() == 0) {
+                return columns;
+            }
+            do {
+                // cid, name, type, notnull, dflt_value, pk
+                columns.push_back(Column{(*result)[1].getString(), hasIntegerAffinity((*result)[2].getString())});
+            } while (result->nextRow());
+            return columns;
+        }
+
+        json11::Json::array changedRows(Database &db, const std::string &table, unsigned long long since)
+        {
+            json11::Json::array rows;
+            const auto columns = columnsOf(db, table);
+            const auto result  = db.query("SELECT t.* FROM '%q' t INNER JOIN sync_changes c ON c.row_id = t._id "
+                                         "WHERE c.table_name = '%q' AND c.deleted = 0 AND c.counter > %llu;",
+                                         table.c_str(),
+                                         table.c_str(),
+                                         since);
+            if (result == nullptr || result->getRowCount() == 0) {
+                return rows;
+            }
+            const auto count = std::min<std::size_t>(columns.size(), result->getFieldCount());
+            do {
+                json11::Json::object row;
+                for (std::size_t i = 0; i < count; ++i) {
+                    const auto &field = (*result)[i];
+                    if (columns[i].isInteger) {
+                        row[columns[i].name] = static_cast<double>(field.getInt64());
+                    }
+                    else {
+                        row[columns[i].name] = field.getString();
+                    }
+                }
+                rows.emplace_back(std::move(row));
+            } while (result->nextRow());
+            return rows;
+        }
+
+        json11::Json::array deletedRows(Database &db, const std::string &table, unsigned long long since)
+        {
+            json11::Json::array ids;
+            const auto result = db.query(
+                "SELECT row_id FROM sync_changes WHERE table_name = '%q' AND deleted = 1 AND counter > %llu;",
+                table.c_str(),
+                since);
+            if (result == nullptr || result->getRowCount() == 0) {
+                return ids;
+            }
+            do {
+                ids.emplace_back(static_cast<double>((*result)[0].getInt64()));
+            } while (result->nextRow());
+            return ids;
+        }
+    } // namespace
+
+    std::optional<Token> Token::parse(const std::string &text)
+    {
+        const auto position = text.find(separator);
+        if (position == std::string::npos || position == 0 || position + 1 == text.size() ||
+            text.find_first_not_of("0123456789", position + 1) != std::string::npos ||
+            text.find_first_not_of("0123456789") != position) {
+            return std::nullopt;
+        }
+
+        Token token;
+        token.generation = std::strtoull(text.c_str(), nullptr, 10);
+        token.counter    = std::strtoull(text.c_str() + position + 1, nullptr, 10);
+        return token;
+    }
+
+    std::string Token::toString() const
+    {
+        return std::to_string(generation) + separator + std::to_string(counter);
+    }
+
+    std::optional<Token> currentToken(Database &db)
+    {
+        const auto result = db.query("SELECT generation, counter FROM sync_state WHERE _id = 1;");
+        if (result == nullptr || result->getRowCount() == 0) {
+            return std::nullopt;
+        }
+        return Token{(*result)[0].getUInt64(), (*result)[1].getUInt64()};
+    }
+
+    std::optional<std::string> exportChangesSince(Database &db, const Token &since, std::size_t maxChanges)
+    {
+        const auto current = currentToken(db);
+        if (!current.has_value() || current->generation != since.generation || current->counter < since.counter) {
+            LOG_INFO("Sync token doesn't match %s, the whole database has to be synced", db.getName().c_str());
+            return std::nullopt;
+        }
+
+        const auto sinceCounter = static_cast<unsigned long long>(since.counter);
+        const auto changes      = db.query("SELECT COUNT(*) FROM sync_changes WHERE counter > %llu;", sinceCounter);
+        if (changes == nullptr || changes->getRowCount() == 0) {
+            return std::nullopt;
+        }
+        if (const auto count = (*changes)[0].getUInt64(); count > maxChanges) {
+            LOG_INFO("Too many changes in %s to sync them separately: %llu",
+                     db.getName().c_str(),
+                     static_cast<unsigned long long>(count));
+            return std::nullopt;
+        }
+
+        json11::Json::object tables;
+        if (const auto names = db.query("SELECT DISTINCT table_name FROM sync_changes WHERE counter > %llu;",
+                                        sinceCounter);
+            names != nullptr && names->getRowCount() > 0) {
+            do {
+                const auto &table = (*names)[0].getString();
+                tables[table]     = json11::Json::object{{"changed", changedRows(db, table, sinceCounter)},
+                                                     {"deleted", deletedRows(db, table, sinceCounter)}};
+            } while (names->nextRow());
+        }
+
+        return json11::Json(json11::Json::object{
+                                {"since", since.toString()}, {"token", current->toString()}, {"tables", tables}})
+            .dump();
+    }
+} // namespace db::sync
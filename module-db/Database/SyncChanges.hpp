@@ -0,0 +1,46 @@
+// Copyright (c) 2017-2023, Mudita Sp. z.o.o. All rights reserved.
+// For licensing, see https://github.com/mudita/MuditaOS/LICENSE.md
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <optional>
+#include <string>
+
+class Database;
+
+/// Change tracking of the databases synchronized with the desktop client.
+///
+/// Triggers installed by the migration scripts bump the `sync_state` counter on every insert, update and delete
+/// of a tracked table and record the counter value of the last change of every row in `sync_changes`. Deleted
+/// rows stay there as tombstones, so a client can be sent only the rows changed since its last sync.
+namespace db::sync
+{
+    /// Position in the change history of a database, handed to the client with every sync package.
+    /// `generation` is drawn when the database is created, so tokens of a recreated database are rejected.
+    struct Token
+    {
+        std::uint64_t generation = 0;
+        std::uint64_t counter    = 0;
+
+        static std::optional<Token> parse(const std::string &text);
+        std::string toString() const;
+    };
+
+    /// Tokens received from the client, by the name of the database (e.g. "sms")
+    using Tokens = std::map<std::string, std::string>;
+
+    /// Token of the latest change, empty if the database doesn't track changes
+    std::optional<Token> currentToken(Database &db);
+
+    /// JSON document holding the rows of the tracked tables changed after `since` and the ids of the rows
+    /// deleted since then:
+    ///
+    ///     {"since": "<token>", "token": "<token>", "tables": {"<table>": {"changed": [{...}], "deleted": [ids]}}}
+    ///
+    /// Empty if the token doesn't come from this database or more than `maxChanges` rows have changed,
+    /// in both cases the client has to be sent the whole database.
+    std::optional<std::string> exportChangesSince(Database &db, const Token &since, std::size_t maxChanges);
+} // namespace db::sync
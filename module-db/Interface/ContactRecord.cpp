@@ -2,6 +2,7 @@
 // For licensing, see https://github.com/mudita/MuditaOS/LICENSE.md
 
 #include "ContactRecord.hpp"
+#include "ContactsCache.hpp"
 #include "queries/phonebook/QueryContactAdd.hpp"
 #include "queries/phonebook/QueryContactGetByID.hpp"
 #include "queries/phonebook/QueryContactGetByNumberID.hpp"
@@ -38,6 +39,7 @@ auto ContactRecordInterface::Add(ContactRecord &rec) -> bool
     if (rec.numbers.size() > 2) {
         LOG_WARN("Contact has more than 2 numbers");
     }
+    contactDB->cache().clear();
 
     if (hasContactRecordSameNumbers(rec)) {
         LOG_ERROR("New record can not have 2 same numbers");
@@ -100,11 +102,13 @@ auto ContactRecordInterface::Add(ContactRecord &rec) -> bool
 
 auto ContactRecordInterface::BlockByID(uint32_t id, const bool shouldBeBlocked) -> bool
 {
+    contactDB->cache().clear();
     return contactDB->contacts.BlockByID(id, shouldBeBlocked);
 }
 
 auto ContactRecordInterface::RemoveByID(uint32_t id) -> bool
 {
+    contactDB->cache().clear();
     auto contact = contactDB->contacts.getByIdWithTemporary(id);
     if (contact.isValid()) {
         auto currentGroups = contactDB->groups.getGroupsForContact(id);
@@ -137,6 +141,7 @@ auto ContactRecordInterface::Update(const ContactRecord &rec) -> bool
     if (rec.numbers.size() > 2) {
         LOG_WARN("Contact has more than 2 numbers");
     }
+    contactDB->cache().clear();
 
     ContactsTableRow contact = contactDB->contacts.getByIdWithTemporary(rec.ID);
     if (!contact.isValid()) {
@@ -1204,6 +1209,10 @@ auto ContactRecordInterface::GetByNumber(const utils::PhoneNumber::View &numberV
 
 auto ContactRecordInterface::GetByNumberID(std::uint32_t numberId) -> std::optional<ContactRecord>
 {
+    if (auto cached = contactDB->cache().findContact(numberId); cached.has_value()) {
+        return cached;
+    }
+
     auto numberRecord = contactDB->number.getById(numberId);
     if (!numberRecord.isValid()) {
         return std::nullopt;
@@ -1214,6 +1223,7 @@ auto ContactRecordInterface::GetByNumberID(std::uint32_t numberId) -> std::optio
     if (!contactRecord.isValid()) {
         return std::nullopt;
     }
+    contactDB->cache().insertContact(numberId, contactRecord);
     return contactRecord;
 }
 
@@ -1252,6 +1262,15 @@ auto ContactRecordInterface::MatchByNumber(const utils::PhoneNumber::View &numbe
                                            const std::uint32_t contactIDToIgnore)
     -> std::optional<ContactRecordInterface::ContactNumberMatch>
 {
+    // Matches ignoring a contact are made when the contacts are edited, so they aren't worth caching
+    const auto cacheable = contactIDToIgnore == 0u;
+    const auto cacheKey  = cacheable ? ContactsCache::makeKey(numberView, matchLevel) : std::string{};
+    if (cacheable) {
+        if (auto cached = contactDB->cache().findMatch(cacheKey); cached.has_value()) {
+            return cached;
+        }
+    }
+
     utils::PhoneNumber phoneNumber;
     try {
         phoneNumber = utils::PhoneNumber(numberView);
@@ -1284,12 +1303,20 @@ auto ContactRecordInterface::MatchByNumber(const utils::PhoneNumber::View &numbe
         auto numberIDs       = splitNumberIDs(contactTableRow.numbersID);
         assert(!numberIDs.empty());
         auto numberID = numberIDs[0];
-        return ContactRecordInterface::ContactNumberMatch(GetByIdWithTemporary(contactID), contactID, numberID);
+        ContactNumberMatch match(GetByIdWithTemporary(contactID), contactID, numberID);
+        if (cacheable) {
+            contactDB->cache().insertMatch(cacheKey, match);
+        }
+        return match;
     }
 
     auto contactID = matchedNumber->getContactID();
     auto numberID  = matchedNumber->getNumberID();
-    return ContactRecordInterface::ContactNumberMatch(GetByIdWithTemporary(contactID), contactID, numberID);
+    ContactNumberMatch match(GetByIdWithTemporary(contactID), contactID, numberID);
+    if (cacheable) {
+        contactDB->cache().insertMatch(cacheKey, match);
+    }
+    return match;
 }
 
 auto ContactRecordInterface::GetBySpeedDial(const UTF8 &speedDial) -> std::unique_ptr<std::vector<ContactRecord>>
@@ -1459,9 +1486,17 @@ ContactRecordInterface::ContactNumberMatch::ContactNumberMatch(ContactRecord rec
 
 auto ContactRecordInterface::GetNumberById(std::uint32_t numberId) -> utils::PhoneNumber::View
 {
+    if (auto cached = contactDB->cache().findNumber(numberId); cached.has_value()) {
+        return *cached;
+    }
+
     const auto row = contactDB->number.getById(numberId);
     try {
-        return utils::PhoneNumber(row.numberUser, row.numbere164).getView();
+        auto numberView = utils::PhoneNumber(row.numberUser, row.numbere164).getView();
+        if (row.isValid()) {
+            contactDB->cache().insertNumber(numberId, numberView);
+        }
+        return numberView;
     }
     catch (const utils::PhoneNumber::Error &e) {
         LOG_ERROR(
@@ -0,0 +1,48 @@
+// Copyright (c) 2017-2023, Mudita Sp. z.o.o. All rights reserved.
+// For licensing, see https://github.com/mudita/MuditaOS/LICENSE.md
+
+#include "ContactsCache.hpp"
+
+auto ContactsCache::makeKey(const utils::PhoneNumber::View &numberView, utils::PhoneNumber::Match matchLevel)
+    -> std::string
+{
+    return numberView.getEntered() + '/' + numberView.getE164() + '/' +
+           std::to_string(static_cast<int>(matchLevel));
+}
+
+auto ContactsCache::findMatch(const std::string &key) -> std::optional<Match>
+{
+    return matches.find(key);
+}
+
+void ContactsCache::insertMatch(const std::string &key, const Match &match)
+{
+    matches.insert(key, match);
+}
+
+auto ContactsCache::findContact(std::uint32_t numberID) -> std::optional<ContactRecord>
+{
+    return contacts.find(numberID);
+}
+
+void ContactsCache::insertContact(std::uint32_t numberID, const ContactRecord &contact)
+{
+    contacts.insert(numberID, contact);
+}
+
+auto ContactsCache::findNumber(std::uint32_t numberID) -> std::optional<utils::PhoneNumber::View>
+{
+    return numbers.find(numberID);
+}
+
+void ContactsCache::insertNumber(std::uint32_t numberID, const utils::PhoneNumber::View &numberView)
+{
+    numbers.insert(numberID, numberView);
+}
+
+void ContactsCache::clear()
+{
+    matches.clear();
+    contacts.clear();
+    numbers.clear();
+}
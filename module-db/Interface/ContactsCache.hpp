@@ -0,0 +1,85 @@
+// Copyright (c) 2017-2023, Mudita Sp. z.o.o. All rights reserved.
+// For licensing, see https://github.com/mudita/MuditaOS/LICENSE.md
+
+#pragma once
+
+#include "ContactRecord.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <utility>
+
+/// Most recently resolved numbers, so the call log, the threads list and the notifications don't query the contacts
+/// database for each of their rows. The cache is owned by the contacts database and cleared on every change of the
+/// contacts, it isn't synchronised as the database is used by a single service.
+class ContactsCache
+{
+  public:
+    static constexpr std::size_t capacity = 32;
+
+    using Match = ContactRecordInterface::ContactNumberMatch;
+
+    /// Key of the number matched with the given level
+    static auto makeKey(const utils::PhoneNumber::View &numberView, utils::PhoneNumber::Match matchLevel)
+        -> std::string;
+
+    auto findMatch(const std::string &key) -> std::optional<Match>;
+    void insertMatch(const std::string &key, const Match &match);
+
+    auto findContact(std::uint32_t numberID) -> std::optional<ContactRecord>;
+    void insertContact(std::uint32_t numberID, const ContactRecord &contact);
+
+    auto findNumber(std::uint32_t numberID) -> std::optional<utils::PhoneNumber::View>;
+    void insertNumber(std::uint32_t numberID, const utils::PhoneNumber::View &numberView);
+
+    void clear();
+
+  private:
+    template <typename Key, typename Value>
+    class Entries
+    {
+      public:
+        auto find(const Key &key) -> std::optional<Value>
+        {
+            const auto it = index.find(key);
+            if (it == index.end()) {
+                return std::nullopt;
+            }
+            entries.splice(entries.begin(), entries, it->second);
+            return it->second->second;
+        }
+
+        void insert(const Key &key, const Value &value)
+        {
+            if (const auto it = index.find(key); it != index.end()) {
+                entries.erase(it->second);
+                index.erase(it);
+            }
+            entries.emplace_front(key, value);
+            index.emplace(key, entries.begin());
+            if (entries.size() > capacity) {
+                index.erase(entries.back().first);
+                entries.pop_back();
+            }
+        }
+
+        void clear()
+        {
+            index.clear();
+            entries.clear();
+        }
+
+      private:
+        /// most recently used first
+        std::list<std::pair<Key, Value>> entries;
+        std::unordered_map<Key, typename std::list<std::pair<Key, Value>>::iterator> index;
+    };
+
+    Entries<std::string, Match> matches;
+    Entries<std::uint32_t, ContactRecord> contacts;
+    Entries<std::uint32_t, utils::PhoneNumber::View> numbers;
+};
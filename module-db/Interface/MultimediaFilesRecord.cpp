@@ -81,6 +81,12 @@ namespace db::multimedia_files
         if (typeid(*query) == typeid(query::GetByPath)) {
             return runQueryImplGetByPath(std::static_pointer_cast<query::GetByPath>(query));
         }
+        if (typeid(*query) == typeid(query::AddBatch)) {
+            return runQueryImplAddBatch(std::static_pointer_cast<query::AddBatch>(query));
+        }
+        if (typeid(*query) == typeid(query::GetChanged)) {
+            return runQueryImplGetChanged(std::static_pointer_cast<query::GetChanged>(query));
+        }
         return nullptr;
     }
 
@@ -94,6 +100,16 @@ namespace db::multimedia_files
         return response;
     }
 
+    std::unique_ptr<query::AddResult> MultimediaFilesRecordInterface::runQueryImplAddBatch(
+        const std::shared_ptr<query::AddBatch> &query)
+    {
+        const auto result = database->files.addBatch(query->getRecords());
+
+        auto response = std::make_unique<query::AddResult>(result);
+        response->setRequestQuery(query);
+        return response;
+    }
+
     std::unique_ptr<query::AddOrEditResult> MultimediaFilesRecordInterface::runQueryImplAddOrEdit(
         const std::shared_ptr<query::AddOrEdit> &query)
     {
@@ -134,6 +150,16 @@ namespace db::multimedia_files
         return response;
     }
 
+    std::unique_ptr<query::GetChangedResult> MultimediaFilesRecordInterface::runQueryImplGetChanged(
+        const std::shared_ptr<query::GetChanged> &query)
+    {
+        auto files = database->files.getChanged(query->files);
+
+        auto response = std::make_unique<query::GetChangedResult>(std::move(files));
+        response->setRequestQuery(query);
+        return response;
+    }
+
     std::unique_ptr<query::GetLimitedResult> MultimediaFilesRecordInterface::runQueryImplGetLimited(
         const std::shared_ptr<query::GetLimited> &query)
     {
@@ -16,6 +16,7 @@ namespace db::multimedia_files
 namespace db::multimedia_files::query
 {
     class Add;
+    class AddBatch;
     class AddOrEdit;
     class AddOrEditResult;
     class AddResult;
@@ -27,6 +28,8 @@ namespace db::multimedia_files::query
     class GetArtistsLimited;
     class GetArtistsLimitedResult;
     class GetByPath;
+    class GetChanged;
+    class GetChangedResult;
     class GetCount;
     class GetCountAlbums;
     class GetCountArtists;
@@ -65,6 +68,8 @@ namespace db::multimedia_files
             const std::shared_ptr<db::multimedia_files::query::Add> &query);
         std::unique_ptr<db::multimedia_files::query::EditResult> runQueryImplEdit(
             const std::shared_ptr<db::multimedia_files::query::Edit> &query);
+        std::unique_ptr<db::multimedia_files::query::AddResult> runQueryImplAddBatch(
+            const std::shared_ptr<db::multimedia_files::query::AddBatch> &query);
         std::unique_ptr<db::multimedia_files::query::AddOrEditResult> runQueryImplAddOrEdit(
             const std::shared_ptr<db::multimedia_files::query::AddOrEdit> &query);
         std::unique_ptr<db::multimedia_files::query::GetResult> runQueryImplGet(
@@ -97,6 +102,8 @@ namespace db::multimedia_files
             const std::shared_ptr<db::multimedia_files::query::GetCountForAlbum> &query);
         std::unique_ptr<db::multimedia_files::query::GetResult> runQueryImplGetByPath(
             const std::shared_ptr<db::multimedia_files::query::GetByPath> &query);
+        std::unique_ptr<db::multimedia_files::query::GetChangedResult> runQueryImplGetChanged(
+            const std::shared_ptr<db::multimedia_files::query::GetChanged> &query);
         std::unique_ptr<db::multimedia_files::query::RemoveResult> runQueryImplRemoveByPath(
             const std::shared_ptr<db::multimedia_files::query::RemoveByPath> &query);
 
@@ -4,6 +4,7 @@
 #include "SMSRecord.hpp"
 #include "Common/Query.hpp"
 #include "ContactRecord.hpp"
+#include "ContactsCache.hpp"
 #include "ThreadRecord.hpp"
 #include "queries/messages/sms/QuerySMSAdd.hpp"
 #include "queries/messages/sms/QuerySMSGet.hpp"
@@ -91,6 +92,45 @@ bool SMSRecordInterface::Add(const SMSRecord &rec)
 
     return true;
 }
+
+bool SMSRecordInterface::AddBatch(const std::vector<SMSRecord> &records)
+{
+    // Temporary contacts of unknown senders are created on the way, so both databases take part
+    if (!smsDB->execute("BEGIN TRANSACTION;")) {
+        return false;
+    }
+    if (!contactsDB->execute("BEGIN TRANSACTION;")) {
+        smsDB->execute("ROLLBACK;");
+        return false;
+    }
+
+    const auto rollback = [this]() {
+        contactsDB->execute("ROLLBACK;");
+        // the rolled back temporary contacts could have been cached
+        contactsDB->cache().clear();
+        smsDB->execute("ROLLBACK;");
+    };
+
+    for (const auto &record : records) {
+        if (!Add(record)) {
+            LOG_ERROR("Cannot add batch of %zu messages", records.size());
+            rollback();
+            return false;
+        }
+    }
+    if (!contactsDB->execute("COMMIT;")) {
+        LOG_ERROR("Cannot commit contacts of batch of %zu messages", records.size());
+        rollback();
+        return false;
+    }
+    // The temporary contacts are stored already, the records added again one by one are matched with them
+    if (!smsDB->execute("COMMIT;")) {
+        LOG_ERROR("Cannot commit batch of %zu messages", records.size());
+        smsDB->execute("ROLLBACK;");
+        return false;
+    }
+    return true;
+}
 uint32_t SMSRecordInterface::GetCount()
 {
     return smsDB->sms.count();
@@ -310,6 +350,9 @@ std::unique_ptr<db::QueryResult> SMSRecordInterface::runQuery(std::shared_ptr<db
     else if (typeid(*query) == typeid(db::query::SMSAdd)) {
         return addQuery(query);
     }
+    else if (typeid(*query) == typeid(db::query::SMSAddBatch)) {
+        return addBatchQuery(query);
+    }
     else if (typeid(*query) == typeid(db::query::SMSRemove)) {
         return removeQuery(query);
     }
@@ -417,6 +460,14 @@ std::unique_ptr<db::QueryResult> SMSRecordInterface::addQuery(const std::shared_
     response->setRecordID(record.ID);
     return response;
 }
+
+std::unique_ptr<db::QueryResult> SMSRecordInterface::addBatchQuery(const std::shared_ptr<db::Query> &query)
+{
+    const auto localQuery = static_cast<const db::query::SMSAddBatch *>(query.get());
+    auto response         = std::make_unique<db::query::SMSAddBatchResult>(AddBatch(localQuery->records));
+    response->setRequestQuery(query);
+    return response;
+}
 std::unique_ptr<db::QueryResult> SMSRecordInterface::removeQuery(const std::shared_ptr<db::Query> &query)
 {
     const auto localQuery = static_cast<const db::query::SMSRemove *>(query.get());
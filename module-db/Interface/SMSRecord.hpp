@@ -1,4 +1,4 @@
-// Copyright (c) 2017-2022, Mudita Sp. z.o.o. All rights reserved.
+// Copyright (c) 2017-2023, Mudita Sp. z.o.o. All rights reserved.
 // For licensing, see https://github.com/mudita/MuditaOS/LICENSE.md
 
 #pragma once
@@ -53,6 +53,8 @@ class SMSRecordInterface : public RecordInterface<SMSRecord, SMSRecordField>
     ~SMSRecordInterface() = default;
 
     bool Add(const SMSRecord &rec) override final;
+    /// Adds the records in a single transaction, nothing is added if any of them fails
+    bool AddBatch(const std::vector<SMSRecord> &records);
     bool RemoveByID(uint32_t id) override final;
     bool RemoveByField(SMSRecordField field, const char *str) override final;
     bool Update(const SMSRecord &recUpdated) override final;
@@ -85,6 +87,7 @@ class SMSRecordInterface : public RecordInterface<SMSRecord, SMSRecordField>
     std::unique_ptr<db::QueryResult> getByTextQuery(const std::shared_ptr<db::Query> &query);
     std::unique_ptr<db::QueryResult> getCountQuery(const std::shared_ptr<db::Query> &query);
     std::unique_ptr<db::QueryResult> addQuery(const std::shared_ptr<db::Query> &query);
+    std::unique_ptr<db::QueryResult> addBatchQuery(const std::shared_ptr<db::Query> &query);
     std::unique_ptr<db::QueryResult> removeQuery(const std::shared_ptr<db::Query> &query);
     std::unique_ptr<db::QueryResult> updateQuery(const std::shared_ptr<db::Query> &query);
     std::unique_ptr<db::QueryResult> getQuery(const std::shared_ptr<db::Query> &query);
@@ -20,7 +20,8 @@ namespace db::multimedia_files
             result[0].getUInt32(),    // ID
             {result[1].getString(),   // path
              result[2].getString(),   // mediaType
-             result[3].getUInt32()},  // size
+             result[3].getUInt32(),   // size
+             result[15].getUInt32()}, // mtime
             {result[4].getString(),   // title
              {result[5].getString(),  // artist
               result[6].getString()}, // album title
@@ -64,9 +65,9 @@ namespace db::multimedia_files
     bool MultimediaFilesTable::add(TableRow entry)
     {
         return db->execute("INSERT INTO files (path, media_type, size, title, artist, album, "
-                           "comment, genre, year, track, song_length, bitrate, sample_rate, channels) "
-                           "VALUES(" str_c str_c u32_c str_c str_c str_c str_c str_c u32_c u32_c u32_c u32_c u32_c u32_
-                           ") "
+                           "comment, genre, year, track, song_length, bitrate, sample_rate, channels, mtime) "
+                           "VALUES(" str_c str_c u32_c str_c str_c str_c str_c str_c u32_c u32_c u32_c u32_c u32_c u32_c
+                               u32_ ") "
                            "ON CONFLICT(path) DO UPDATE SET "
                            "path = excluded.path, "
                            "media_type = excluded.media_type, "
@@ -81,7 +82,8 @@ namespace db::multimedia_files
                            "song_length = excluded.song_length, "
                            "bitrate = excluded.bitrate, "
                            "sample_rate = excluded.sample_rate, "
-                           "channels = excluded.channels;",
+                           "channels = excluded.channels, "
+                           "mtime = excluded.mtime;",
                            entry.fileInfo.path.c_str(),
                            entry.fileInfo.mediaType.c_str(),
                            entry.fileInfo.size,
@@ -95,7 +97,35 @@ namespace db::multimedia_files
                            entry.audioProperties.songLength,
                            entry.audioProperties.bitrate,
                            entry.audioProperties.sampleRate,
-                           entry.audioProperties.channels);
+                           entry.audioProperties.channels,
+                           entry.fileInfo.mtime);
+    }
+
+    bool MultimediaFilesTable::addBatch(const std::vector<TableRow> &entries)
+    {
+        if (!db->execute("BEGIN TRANSACTION;")) {
+            return false;
+        }
+        for (const auto &entry : entries) {
+            if (!add(entry)) {
+                db->execute("ROLLBACK;");
+                return false;
+            }
+        }
+        return db->execute("COMMIT;");
+    }
+
+    auto MultimediaFilesTable::getChanged(const std::vector<FileInfo> &files) -> std::vector<FileInfo>
+    {
+        std::vector<FileInfo> changed;
+        for (const auto &file : files) {
+            auto retQuery = db->query("SELECT size, mtime FROM files WHERE path=" str_ ";", file.path.c_str());
+            if ((retQuery == nullptr) || (retQuery->getRowCount() == 0) ||
+                ((*retQuery)[0].getUInt32() != file.size) || ((*retQuery)[1].getUInt32() != file.mtime)) {
+                changed.push_back(file);
+            }
+        }
+        return changed;
     }
 
     bool MultimediaFilesTable::removeById(uint32_t id)
@@ -123,7 +153,7 @@ namespace db::multimedia_files
     {
         return db->execute("UPDATE files SET path=" str_c "media_type=" str_c "size=" u32_c "title=" str_c
                            "artist=" str_c "album=" str_c "comment=" str_c "genre=" str_c "year=" u32_c "track=" u32_c
-                           "song_length=" u32_c "bitrate=" u32_c "sample_rate=" u32_c "channels=" u32_
+                           "song_length=" u32_c "bitrate=" u32_c "sample_rate=" u32_c "channels=" u32_c "mtime=" u32_
                            " WHERE _id=" u32_ ";",
                            entry.fileInfo.path.c_str(),
                            entry.fileInfo.mediaType.c_str(),
@@ -139,6 +169,7 @@ namespace db::multimedia_files
                            entry.audioProperties.bitrate,
                            entry.audioProperties.sampleRate,
                            entry.audioProperties.channels,
+                           entry.fileInfo.mtime,
                            entry.ID);
     }
 
@@ -150,7 +181,7 @@ namespace db::multimedia_files
                            "INSERT OR IGNORE INTO files (path) VALUES (" str_ "); "
                            "UPDATE files SET path=" str_c "media_type=" str_c "size=" u32_c "title=" str_c
                            "artist=" str_c "album=" str_c "comment=" str_c "genre=" str_c "year=" u32_c "track=" u32_c
-                           "song_length=" u32_c "bitrate=" u32_c "sample_rate=" u32_c "channels=" u32_
+                           "song_length=" u32_c "bitrate=" u32_c "sample_rate=" u32_c "channels=" u32_c "mtime=" u32_
                            " WHERE path=" str_ "; "
                            "COMMIT;",
                            path.c_str(),
@@ -168,6 +199,7 @@ namespace db::multimedia_files
                            entry.audioProperties.bitrate,
                            entry.audioProperties.sampleRate,
                            entry.audioProperties.channels,
+                           entry.fileInfo.mtime,
                            path.c_str());
     }
 
@@ -41,6 +41,7 @@ namespace db::multimedia_files
         std::string path{};
         std::string mediaType{}; /// mime type e.g. "audio/mp3"
         std::size_t size{};      /// in bytes
+        std::uint32_t mtime{};   /// last modification time, in seconds since epoch
     };
 
     struct TableRow : public Record
@@ -67,7 +68,8 @@ namespace db::multimedia_files
         song_length,
         bitrate,
         sample_rate,
-        channels
+        channels,
+        mtime
     };
 
     class MultimediaFilesTable : public Table<TableRow, TableFields>
@@ -109,6 +111,11 @@ namespace db::multimedia_files
         /// @note entry.ID is skipped
         bool addOrUpdate(TableRow entry, std::string oldPath = "");
 
+        /// Adds or updates all entries in a single transaction
+        bool addBatch(const std::vector<TableRow> &entries);
+        /// @return files which are not in the table yet or whose size or modification time differs
+        auto getChanged(const std::vector<FileInfo> &files) -> std::vector<FileInfo>;
+
       private:
         auto getFieldName(TableFields field) -> std::string;
     };
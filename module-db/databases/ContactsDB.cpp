@@ -1,7 +1,8 @@
-// Copyright (c) 2017-2021, Mudita Sp. z.o.o. All rights reserved.
+// Copyright (c) 2017-2023, Mudita Sp. z.o.o. All rights reserved.
 // For licensing, see https://github.com/mudita/MuditaOS/LICENSE.md
 
 #include "ContactsDB.hpp"
+#include "module-db/Interface/ContactsCache.hpp"
 
 uint32_t ContactsDB::favouritesId = 0;
 uint32_t ContactsDB::iceId        = 0;
@@ -9,7 +10,8 @@ uint32_t ContactsDB::blockedId    = 0;
 uint32_t ContactsDB::temporaryId  = 0;
 
 ContactsDB::ContactsDB(const char *name)
-    : Database(name), contacts(this), name(this), number(this), ringtones(this), address(this), groups(this)
+    : Database(name), contacts(this), name(this), number(this), ringtones(this), address(this), groups(this),
+      contactsCache(std::make_unique<ContactsCache>())
 {
 
     if (favouritesId == 0) {
@@ -25,3 +27,5 @@ ContactsDB::ContactsDB(const char *name)
         temporaryId = groups.temporaryId();
     }
 }
+
+ContactsDB::~ContactsDB() = default;
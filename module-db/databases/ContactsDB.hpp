@@ -1,4 +1,4 @@
-// Copyright (c) 2017-2021, Mudita Sp. z.o.o. All rights reserved.
+// Copyright (c) 2017-2023, Mudita Sp. z.o.o. All rights reserved.
 // For licensing, see https://github.com/mudita/MuditaOS/LICENSE.md
 
 #pragma once
@@ -11,11 +11,15 @@
 #include "module-db/Tables/ContactsAddressTable.hpp"
 #include "module-db/Tables/ContactsGroups.hpp"
 
+#include <memory>
+
+class ContactsCache;
+
 class ContactsDB : public Database
 {
   public:
     ContactsDB(const char *name);
-    ~ContactsDB() = default;
+    ~ContactsDB();
 
     ContactsTable contacts;
     ContactsNameTable name;
@@ -41,7 +45,15 @@ class ContactsDB : public Database
         return temporaryId;
     }
 
+    /// Contacts resolved by their numbers, has to be cleared on every change of the contacts
+    ContactsCache &cache() noexcept
+    {
+        return *contactsCache;
+    }
+
   private:
+    std::unique_ptr<ContactsCache> contactsCache;
+
     static uint32_t favouritesId;
     static uint32_t iceId;
     static uint32_t blockedId;
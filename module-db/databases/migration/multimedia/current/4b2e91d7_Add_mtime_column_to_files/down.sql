@@ -0,0 +1,9 @@
+-- Copyright (c) 2017-2023, Mudita Sp. z.o.o. All rights reserved.
+-- For licensing, see https://github.com/mudita/MuditaOS/LICENSE.md
+
+-- Message: Add mtime column to files
+-- Revision: 4b2e91d7-5c0a-4f3e-9d61-2a8c7f03b5e4
+-- Create Date: 2023-11-08 09:12:40
+
+ALTER TABLE files
+DROP COLUMN mtime;
@@ -1,4 +1,4 @@
-// Copyright (c) 2017-2021, Mudita Sp. z.o.o. All rights reserved.
+// Copyright (c) 2017-2023, Mudita Sp. z.o.o. All rights reserved.
 // For licensing, see https://github.com/mudita/MuditaOS/LICENSE.md
 
 #include "QuerySMSAdd.hpp"
@@ -27,4 +27,25 @@ namespace db::query
     {
         return result;
     }
+
+    SMSAddBatch::SMSAddBatch(std::vector<SMSRecord> records) : Query(Query::Type::Create), records{std::move(records)}
+    {}
+
+    std::string SMSAddBatch::debugInfo() const
+    {
+        return "SMSAddBatch"s;
+    }
+
+    SMSAddBatchResult::SMSAddBatchResult(bool result) : result{result}
+    {}
+
+    std::string SMSAddBatchResult::debugInfo() const
+    {
+        return "SMSAddBatchResult"s;
+    }
+
+    bool SMSAddBatchResult::succeed() const noexcept
+    {
+        return result;
+    }
 } // namespace db::query
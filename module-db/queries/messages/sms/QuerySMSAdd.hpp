@@ -1,9 +1,10 @@
-// Copyright (c) 2017-2021, Mudita Sp. z.o.o. All rights reserved.
+// Copyright (c) 2017-2023, Mudita Sp. z.o.o. All rights reserved.
 // For licensing, see https://github.com/mudita/MuditaOS/LICENSE.md
 
 #pragma once
 
 #include <cstdint>
+#include <vector>
 
 #include <Common/Query.hpp>
 #include <module-db/Interface/SMSRecord.hpp>
@@ -31,4 +32,27 @@ namespace db::query
         SMSRecord record;
         bool result;
     };
+
+    /// Adds all the records in a single transaction, none of them is added if any fails
+    class SMSAddBatch : public Query
+    {
+      public:
+        explicit SMSAddBatch(std::vector<SMSRecord> records);
+
+        [[nodiscard]] std::string debugInfo() const override;
+        std::vector<SMSRecord> records;
+    };
+
+    class SMSAddBatchResult : public QueryResult
+    {
+      public:
+        explicit SMSAddBatchResult(bool result);
+
+        [[nodiscard]] std::string debugInfo() const override;
+
+        [[nodiscard]] bool succeed() const noexcept;
+
+      private:
+        bool result;
+    };
 } // namespace db::query
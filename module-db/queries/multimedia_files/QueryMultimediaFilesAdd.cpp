@@ -31,6 +31,20 @@ namespace db::multimedia_files::query
         return std::string{"AddResult"};
     }
 
+    AddBatch::AddBatch(std::vector<MultimediaFilesRecord> records)
+        : Query(Query::Type::Create), records(std::move(records))
+    {}
+
+    auto AddBatch::getRecords() const -> const std::vector<MultimediaFilesRecord> &
+    {
+        return records;
+    }
+
+    auto AddBatch::debugInfo() const -> std::string
+    {
+        return std::string{"AddBatch"};
+    }
+
     AddOrEdit::AddOrEdit(const MultimediaFilesRecord &record, std::string oldPath)
         : Query(Query::Type::Create), record(record), oldPath(oldPath)
     {}
@@ -8,6 +8,7 @@
 #include <Common/Query.hpp>
 
 #include <string>
+#include <vector>
 
 namespace db::multimedia_files::query
 {
@@ -31,6 +32,17 @@ namespace db::multimedia_files::query
         [[nodiscard]] auto debugInfo() const -> std::string override;
     };
 
+    /// Adds or updates all records in a single transaction
+    class AddBatch : public Query
+    {
+        const std::vector<MultimediaFilesRecord> records;
+
+      public:
+        explicit AddBatch(std::vector<MultimediaFilesRecord> records);
+        [[nodiscard]] auto getRecords() const -> const std::vector<MultimediaFilesRecord> &;
+        [[nodiscard]] auto debugInfo() const -> std::string override;
+    };
+
     class AddOrEdit : public Query
     {
         const MultimediaFilesRecord record;
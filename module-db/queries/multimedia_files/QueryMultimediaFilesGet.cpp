@@ -33,4 +33,25 @@ namespace db::multimedia_files::query
     {
         return std::string{"GetResult"};
     }
+
+    GetChanged::GetChanged(std::vector<FileInfo> files) : Query(Query::Type::Read), files(std::move(files))
+    {}
+
+    auto GetChanged::debugInfo() const -> std::string
+    {
+        return std::string{"GetChanged"};
+    }
+
+    GetChangedResult::GetChangedResult(std::vector<FileInfo> files) : files(std::move(files))
+    {}
+
+    auto GetChangedResult::getResult() const -> const std::vector<FileInfo> &
+    {
+        return files;
+    }
+
+    auto GetChangedResult::debugInfo() const -> std::string
+    {
+        return std::string{"GetChangedResult"};
+    }
 } // namespace db::multimedia_files::query
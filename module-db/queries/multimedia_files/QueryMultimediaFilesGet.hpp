@@ -8,6 +8,7 @@
 #include <module-db/Interface/MultimediaFilesRecord.hpp>
 
 #include <string>
+#include <vector>
 
 namespace db::multimedia_files::query
 {
@@ -40,4 +41,25 @@ namespace db::multimedia_files::query
         [[nodiscard]] auto debugInfo() const -> std::string override;
     };
 
+    /// Filters out files which are already in the database with the same size and modification time
+    class GetChanged : public Query
+    {
+      public:
+        const std::vector<FileInfo> files;
+        explicit GetChanged(std::vector<FileInfo> files);
+
+        [[nodiscard]] auto debugInfo() const -> std::string override;
+    };
+
+    class GetChangedResult : public QueryResult
+    {
+        const std::vector<FileInfo> files;
+
+      public:
+        explicit GetChangedResult(std::vector<FileInfo> files);
+        [[nodiscard]] auto getResult() const -> const std::vector<FileInfo> &;
+
+        [[nodiscard]] auto debugInfo() const -> std::string override;
+    };
+
 } // namespace db::multimedia_files::query
@@ -761,6 +761,72 @@ TEST_CASE("Check if new contact record exists in DB as a temporary contact")
     }
 }
 
+TEST_CASE("Contacts resolved by numbers are cached until the contacts change")
+{
+    db::tests::DatabaseUnderTest<ContactsDB> contactsDb{"contacts.db", db::tests::getPurePhoneScriptsPath()};
+
+    auto records = ContactRecordInterface(&contactsDb.get());
+    ContactRecord testContactRecord;
+
+    testContactRecord.primaryName     = "PrimaryNameTest";
+    testContactRecord.alternativeName = "AlternativeNameTest";
+    testContactRecord.numbers         = std::vector<ContactRecord::Number>({
+        ContactRecord::Number("600123456", "+48600123456", ContactNumberType::HOME),
+    });
+
+    REQUIRE(records.Add(testContactRecord));
+
+    const auto numberView = testContactRecord.numbers[0].number;
+    const auto match      = records.MatchByNumber(numberView);
+    REQUIRE(match.has_value());
+    REQUIRE(match->contact.primaryName == "PrimaryNameTest");
+    REQUIRE(records.GetByNumberID(match->numberId).value().primaryName == "PrimaryNameTest");
+    REQUIRE(records.GetNumberById(match->numberId).getE164() == "+48600123456");
+
+    // change the name behind the interface back, only the cached contacts see the old one
+    auto contactRow     = contactsDb.get().contacts.getById(testContactRecord.ID);
+    auto nameRow        = contactsDb.get().name.getById(contactRow.nameID);
+    nameRow.namePrimary = "Bypassed";
+    REQUIRE(contactsDb.get().name.update(nameRow));
+
+    SECTION("Cached")
+    {
+        REQUIRE(records.MatchByNumber(numberView).value().contact.primaryName == "PrimaryNameTest");
+        REQUIRE(records.GetByNumberID(match->numberId).value().primaryName == "PrimaryNameTest");
+        REQUIRE(ContactRecordInterface(&contactsDb.get()).GetByNumberID(match->numberId).value().primaryName ==
+                "PrimaryNameTest");
+    }
+
+    SECTION("Invalidated by update")
+    {
+        testContactRecord.primaryName = "UpdatedName";
+        REQUIRE(records.Update(testContactRecord));
+
+        REQUIRE(records.MatchByNumber(numberView).value().contact.primaryName == "UpdatedName");
+        REQUIRE(records.GetByNumberID(match->numberId).value().primaryName == "UpdatedName");
+    }
+
+    SECTION("Invalidated by removal")
+    {
+        REQUIRE(records.RemoveByID(testContactRecord.ID));
+
+        REQUIRE(records.MatchByNumber(numberView).value().contact.isTemporary());
+        REQUIRE(records.GetByNumberID(match->numberId).value().isTemporary());
+    }
+
+    SECTION("Invalidated by a new contact")
+    {
+        ContactRecord anotherTestContactRecord;
+        anotherTestContactRecord.primaryName = "PrimaryNameTest2";
+        anotherTestContactRecord.numbers     = std::vector<ContactRecord::Number>({
+            ContactRecord::Number("600123451", "+48600123451", ContactNumberType::HOME),
+        });
+        REQUIRE(records.Add(anotherTestContactRecord));
+
+        REQUIRE(records.MatchByNumber(numberView).value().contact.primaryName == "Bypassed");
+    }
+}
+
 TEST_CASE("Check replacement of number in place in db when only different is having of country code")
 {
     db::tests::DatabaseUnderTest<ContactsDB> contactsDb{"contacts.db", db::tests::getPurePhoneScriptsPath()};
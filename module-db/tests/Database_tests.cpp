@@ -0,0 +1,114 @@
+// Copyright (c) 2017-2023, Mudita Sp. z.o.o. All rights reserved.
+// For licensing, see https://github.com/mudita/MuditaOS/LICENSE.md
+
+#include <catch2/catch.hpp>
+#include "Helpers.hpp"
+
+#include "Database/Database.hpp"
+#include "module-db/databases/SmsDB.hpp"
+
+#include <filesystem>
+#include <fstream>
+
+namespace
+{
+    class FileSink : public Database::StreamSink
+    {
+      public:
+        explicit FileSink(const std::filesystem::path &path) : file(path, std::ios::binary)
+        {}
+
+        bool begin(std::size_t size) override
+        {
+            imageSize = size;
+            return file.is_open();
+        }
+
+        bool write(const std::uint8_t *data, std::size_t size) override
+        {
+            file.write(reinterpret_cast<const char *>(data), size);
+            written += size;
+            return file.good();
+        }
+
+        std::size_t imageSize = 0;
+        std::size_t written   = 0;
+
+      private:
+        std::ofstream file;
+    };
+
+    void addMessages(SmsDB &db, std::uint32_t count)
+    {
+        SMSTableRow row{Record(0),
+                        .threadID  = 0,
+                        .contactID = 0,
+                        .date      = 0,
+                        .errorCode = 0,
+                        .body      = "Lorem ipsum dolor sit amet, consectetur adipiscing elit, sed do eiusmod tempor",
+                        .type      = SMSType::INBOX};
+
+        db.execute("BEGIN;");
+        for (std::uint32_t i = 0; i < count; ++i) {
+            row.date = i;
+            db.sms.add(row);
+        }
+        db.execute("COMMIT;");
+    }
+} // namespace
+
+TEST_CASE("Database - store into stream")
+{
+    const auto copyPath = std::filesystem::path{"sms-copy.db"};
+    std::filesystem::remove(copyPath);
+
+    {
+        db::tests::DatabaseUnderTest<SmsDB> smsDb{"sms.db", db::tests::getPurePhoneScriptsPath()};
+        addMessages(smsDb.get(), 200);
+        const auto count = smsDb.get().sms.count();
+        REQUIRE(count == 200);
+
+        // Transaction left open by a failed operation is committed before streaming
+        smsDb.get().execute("BEGIN;");
+
+        FileSink sink{copyPath};
+        REQUIRE(smsDb.get().storeIntoStream(sink));
+        REQUIRE(sink.imageSize > 0);
+        REQUIRE(sink.written == sink.imageSize);
+
+        SmsDB copy{copyPath.c_str()};
+        REQUIRE(copy.isInitialized());
+        REQUIRE(copy.sms.count() == count);
+
+        // The source stays usable
+        addMessages(smsDb.get(), 1);
+        REQUIRE(smsDb.get().sms.count() == count + 1);
+    }
+
+    std::filesystem::remove(copyPath);
+}
+
+TEST_CASE("Database - store a large database into stream")
+{
+    constexpr auto messagesCount = 5000;
+    // Size of the buffer the image is streamed through
+    constexpr auto bufferSize = 16 * 1024;
+    const auto copyPath       = std::filesystem::path{"sms-large-copy.db"};
+    std::filesystem::remove(copyPath);
+
+    {
+        db::tests::DatabaseUnderTest<SmsDB> smsDb{"sms.db", db::tests::getPurePhoneScriptsPath()};
+        addMessages(smsDb.get(), messagesCount);
+
+        FileSink sink{copyPath};
+        REQUIRE(smsDb.get().storeIntoStream(sink));
+        REQUIRE(sink.imageSize > bufferSize);
+        REQUIRE(sink.written == sink.imageSize);
+
+        SmsDB copy{copyPath.c_str()};
+        REQUIRE(copy.isInitialized());
+        REQUIRE(copy.sms.count() == messagesCount);
+    }
+
+    std::filesystem::remove(copyPath);
+}
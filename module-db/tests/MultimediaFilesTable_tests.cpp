@@ -14,6 +14,8 @@
 #include <queries/multimedia_files/QueryMultimediaFilesCount.hpp>
 
 #include <algorithm>
+#include <filesystem>
+#include <fstream>
 using namespace db::multimedia_files;
 
 const std::vector<std::string> artists = {{""}, {"Just an artist"}, {"Mega artist"}, {"Super artist"}};
@@ -207,6 +209,35 @@ TEST_CASE("Multimedia DB tests")
             }
         }
 
+        SECTION("Add batch")
+        {
+            REQUIRE(db.get().files.removeAll());
+            REQUIRE(db.get().files.addBatch(records));
+            REQUIRE(db.get().files.count() == records.size());
+
+            auto updated                   = records;
+            updated.front().fileInfo.mtime = 1234;
+            REQUIRE(db.get().files.addBatch(updated));
+            REQUIRE(db.get().files.count() == records.size());
+            REQUIRE(db.get().files.getByPath(records.front().fileInfo.path).fileInfo.mtime == 1234);
+        }
+
+        SECTION("Get changed")
+        {
+            const auto unchanged = records[0].fileInfo;
+            auto resized         = records[1].fileInfo;
+            resized.size += 1;
+            auto modified = records[2].fileInfo;
+            modified.mtime += 1;
+            const db::multimedia_files::FileInfo added{.path = "user/new.mp3", .size = 1, .mtime = 1};
+
+            const auto changed = db.get().files.getChanged({unchanged, resized, modified, added});
+            REQUIRE(changed.size() == 3);
+            REQUIRE(changed[0].path == resized.path);
+            REQUIRE(changed[1].path == modified.path);
+            REQUIRE(changed[2].path == added.path);
+        }
+
         SECTION("getLimitOffset")
         {
             auto size = records.size();
@@ -667,3 +698,70 @@ TEST_CASE("Multimedia DB tests")
         }
     }
 }
+
+TEST_CASE("Multimedia DB - startup indexing of a generated directory tree")
+{
+    namespace fs = std::filesystem;
+
+    constexpr auto directories      = 10;
+    constexpr auto filesPerDir      = 20;
+    constexpr std::size_t batchSize = 16;
+
+    db::tests::DatabaseUnderTest<MultimediaFilesDB> db{"multimedia.db", db::tests::getScriptsPath()};
+    auto &files = db.get().files;
+
+    const auto root = fs::temp_directory_path() / "multimedia-indexing";
+    fs::remove_all(root);
+    for (int dir = 0; dir < directories; ++dir) {
+        const auto dirPath = root / ("artist" + std::to_string(dir));
+        fs::create_directories(dirPath);
+        for (int file = 0; file < filesPerDir; ++file) {
+            std::ofstream(dirPath / ("song" + std::to_string(file) + ".mp3")) << "ID3";
+        }
+    }
+
+    auto walk = [&root]() {
+        std::vector<FileInfo> found;
+        for (const auto &entry : fs::recursive_directory_iterator(root)) {
+            if (entry.is_regular_file()) {
+                found.push_back(FileInfo{.path      = entry.path().string(),
+                                         .mediaType = "audio/mpeg",
+                                         .size      = static_cast<std::size_t>(entry.file_size()),
+                                         .mtime     = 1});
+            }
+        }
+        return found;
+    };
+    auto toRecord = [](const FileInfo &info) { return TableRow{Record{DB_ID_NONE}, .fileInfo = info}; };
+    // Indexes the files the way the startup indexer does, returns the number of the files stored
+    auto indexTree = [&files, &toRecord](const std::vector<FileInfo> &found) {
+        std::size_t indexed = 0;
+        for (std::size_t i = 0; i < found.size(); i += batchSize) {
+            const auto last    = std::min(found.size(), i + batchSize);
+            const auto changed = files.getChanged({found.begin() + i, found.begin() + last});
+            std::vector<TableRow> batch;
+            std::transform(changed.begin(), changed.end(), std::back_inserter(batch), toRecord);
+            REQUIRE(files.addBatch(batch));
+            indexed += batch.size();
+        }
+        return indexed;
+    };
+
+    auto found = walk();
+    REQUIRE(found.size() == directories * filesPerDir);
+    REQUIRE(indexTree(found) == found.size());
+    REQUIRE(files.count() == found.size());
+
+    // Nothing is stored again when the tree is rescanned unchanged
+    REQUIRE(indexTree(walk()) == 0);
+
+    // Only the modified files are stored again
+    constexpr auto modified = 3;
+    for (auto i = 0; i < modified; ++i) {
+        std::ofstream(found[i * filesPerDir].path, std::ios::app) << "TAG";
+    }
+    REQUIRE(indexTree(walk()) == modified);
+    REQUIRE(files.count() == found.size());
+
+    fs::remove_all(root);
+}
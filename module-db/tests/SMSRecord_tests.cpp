@@ -1,4 +1,4 @@
-// Copyright (c) 2017-2022, Mudita Sp. z.o.o. All rights reserved.
+// Copyright (c) 2017-2023, Mudita Sp. z.o.o. All rights reserved.
 // For licensing, see https://github.com/mudita/MuditaOS/LICENSE.md
 
 #include "Helpers.hpp"
@@ -16,6 +16,7 @@
 #include <cstdint>
 #include <cstdio>
 #include <cstring>
+#include <module-db/queries/messages/sms/QuerySMSAdd.hpp>
 #include <module-db/queries/messages/sms/QuerySMSGetForList.hpp>
 
 struct test
@@ -195,6 +196,71 @@ TEST_CASE("SMS Record tests")
         REQUIRE(smsRecInterface.Add(recordIN));
     }
 
+    SECTION("SMS Record add batch")
+    {
+        recordIN.type    = SMSType::INBOX;
+        auto recordIN2   = recordIN;
+        recordIN2.number = numberTest2;
+        recordIN2.body   = bodyTest2;
+        recordIN2.date   = dateTest + 1;
+        auto recordIN3   = recordIN;
+        recordIN3.date   = dateTest + 2;
+
+        REQUIRE(smsRecInterface.AddBatch({recordIN, recordIN2, recordIN3}));
+        REQUIRE(smsRecInterface.GetCount() == 3);
+
+        // Messages from the same sender land in the same thread, the newest ones come first
+        auto records = smsRecInterface.GetLimitOffset(0, 100);
+        REQUIRE(records->size() == 3);
+        REQUIRE((*records)[0].threadID == (*records)[2].threadID);
+        REQUIRE((*records)[0].threadID != (*records)[1].threadID);
+
+        ThreadRecordInterface threadInterface(&smsDb.get(), &contactsDb.get());
+        auto thread = threadInterface.GetByID((*records)[0].threadID);
+        REQUIRE(thread.msgCount == 2);
+        REQUIRE(thread.unreadMsgCount == 2);
+
+        auto query  = std::make_shared<db::query::SMSAddBatch>(std::vector<SMSRecord>{recordIN2, recordIN2});
+        auto ret    = smsRecInterface.runQuery(query);
+        auto result = dynamic_cast<db::query::SMSAddBatchResult *>(ret.get());
+        REQUIRE(result != nullptr);
+        REQUIRE(result->succeed());
+        REQUIRE(smsRecInterface.GetCount() == 5);
+
+        // The batch leaves no transaction open
+        REQUIRE(smsRecInterface.Add(recordIN));
+        REQUIRE(smsRecInterface.GetCount() == 6);
+    }
+
+    SECTION("SMS Record add batch rollback")
+    {
+        recordIN.type          = SMSType::INBOX;
+        auto newSenderRecord   = recordIN;
+        newSenderRecord.number = utils::PhoneNumber("+48600999888", utils::country::Id::UNKNOWN).getView();
+        auto failingRecord     = recordIN;
+        failingRecord.body     = "Failing SMS";
+        REQUIRE(smsDb.get().execute("CREATE TEMP TRIGGER failing_sms BEFORE INSERT ON sms "
+                                    "WHEN NEW.body = 'Failing SMS' BEGIN SELECT RAISE(ABORT, 'failing sms'); END;"));
+        const auto numbersCount = contactsDb.get().number.count();
+
+        // Neither the messages nor the temporary contact of the new sender are kept
+        REQUIRE_FALSE(smsRecInterface.AddBatch({newSenderRecord, failingRecord}));
+        REQUIRE(smsRecInterface.GetCount() == 0);
+        REQUIRE(contactsDb.get().number.count() == numbersCount);
+
+        // Falling back to adding one by one stores the other records once, with a single temporary contact
+        REQUIRE(smsRecInterface.Add(newSenderRecord));
+        REQUIRE_FALSE(smsRecInterface.Add(failingRecord));
+        REQUIRE(smsRecInterface.GetCount() == 1);
+        REQUIRE(contactsDb.get().number.count() == numbersCount + 1);
+
+        auto records = smsRecInterface.GetLimitOffset(0, 100);
+        REQUIRE(records->size() == 1);
+        REQUIRE((*records)[0].number == newSenderRecord.number);
+        ThreadRecordInterface threadInterface(&smsDb.get(), &contactsDb.get());
+        REQUIRE(threadInterface.GetByID((*records)[0].threadID).msgCount == 1);
+    }
+
     SECTION("SMS Record Draft and Input test")
     {
         recordIN.type = SMSType::INBOX;
@@ -0,0 +1,117 @@
+// Copyright (c) 2017-2023, Mudita Sp. z.o.o. All rights reserved.
+// For licensing, see https://github.com/mudita/MuditaOS/LICENSE.md
+
+#include <catch2/catch.hpp>
+#include "Helpers.hpp"
+
+#include "Database/Database.hpp"
+#include "Database/SyncChanges.hpp"
+#include "module-db/databases/SmsDB.hpp"
+
+#include <json11.hpp>
+
+namespace
+{
+    constexpr auto maxChanges = 100;
+
+    SMSTableRow makeMessage(const std::string &body)
+    {
+        return SMSTableRow{Record(0),
+                           .threadID  = 0,
+                           .contactID = 0,
+                           .date      = 0,
+                           .errorCode = 0,
+                           .body      = body,
+                           .type      = SMSType::INBOX};
+    }
+
+    json11::Json exportChanges(Database &db, const db::sync::Token &since)
+    {
+        const auto changes = db::sync::exportChangesSince(db, since, maxChanges);
+        REQUIRE(changes.has_value());
+        std::string error;
+        const auto json = json11::Json::parse(*changes, error);
+        REQUIRE(error.empty());
+        return json;
+    }
+} // namespace
+
+TEST_CASE("Sync changes - token")
+{
+    const auto token = db::sync::Token::parse("1234.56");
+    REQUIRE(token.has_value());
+    REQUIRE(token->generation == 1234);
+    REQUIRE(token->counter == 56);
+    REQUIRE(token->toString() == "1234.56");
+
+    for (const auto &invalid : {"", "1234", "1234.", ".56", "12.34.56", "-1.5", "1.-5", "a.1", "1.1a"}) {
+        REQUIRE_FALSE(db::sync::Token::parse(invalid).has_value());
+    }
+}
+
+TEST_CASE("Sync changes - export since token")
+{
+    db::tests::DatabaseUnderTest<SmsDB> smsDb{"sms.db", db::tests::getPurePhoneScriptsPath()};
+    auto &db = smsDb.get();
+
+    const auto initial = db::sync::currentToken(db);
+    REQUIRE(initial.has_value());
+
+    REQUIRE(db.sms.add(makeMessage("first")));
+    const auto firstID = db.getLastInsertRowId();
+    REQUIRE(db.sms.add(makeMessage("second")));
+    const auto afterAdding = db::sync::currentToken(db);
+    REQUIRE(afterAdding.has_value());
+    REQUIRE(afterAdding->generation == initial->generation);
+    REQUIRE(afterAdding->counter > initial->counter);
+
+    SECTION("Changed rows")
+    {
+        const auto changes = exportChanges(db, *initial);
+        REQUIRE(changes["since"].string_value() == initial->toString());
+        REQUIRE(changes["token"].string_value() == afterAdding->toString());
+
+        const auto &changed = changes["tables"]["sms"]["changed"].array_items();
+        REQUIRE(changed.size() == 2);
+        REQUIRE(changed[0]["_id"].int_value() == static_cast<int>(firstID));
+        REQUIRE(changed[0]["body"].string_value() == "first");
+        REQUIRE(changed[1]["body"].string_value() == "second");
+        REQUIRE(changes["tables"]["sms"]["deleted"].array_items().empty());
+    }
+
+    SECTION("Nothing changed since the latest token")
+    {
+        const auto changes = exportChanges(db, *afterAdding);
+        REQUIRE(changes["tables"].object_items().empty());
+    }
+
+    SECTION("Tombstones of deleted rows")
+    {
+        REQUIRE(db.sms.removeById(firstID));
+        const auto changes = exportChanges(db, *afterAdding);
+        REQUIRE(changes["tables"]["sms"]["changed"].array_items().empty());
+
+        const auto &deleted = changes["tables"]["sms"]["deleted"].array_items();
+        REQUIRE(deleted.size() == 1);
+        REQUIRE(deleted[0].int_value() == static_cast<int>(firstID));
+
+        // Row added and deleted between the syncs is sent as deleted only
+        const auto sinceInitial = exportChanges(db, *initial);
+        REQUIRE(sinceInitial["tables"]["sms"]["changed"].array_items().size() == 1);
+        REQUIRE(sinceInitial["tables"]["sms"]["deleted"].array_items().size() == 1);
+    }
+
+    SECTION("Token which doesn't match the database")
+    {
+        const auto otherGeneration = db::sync::Token{initial->generation + 1, initial->counter};
+        REQUIRE_FALSE(db::sync::exportChangesSince(db, otherGeneration, maxChanges).has_value());
+
+        const auto fromFuture = db::sync::Token{initial->generation, afterAdding->counter + 1};
+        REQUIRE_FALSE(db::sync::exportChangesSince(db, fromFuture, maxChanges).has_value());
+    }
+
+    SECTION("Too many changes")
+    {
+        REQUIRE_FALSE(db::sync::exportChangesSince(db, *initial, 1).has_value());
+    }
+}
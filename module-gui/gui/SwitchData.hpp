@@ -41,6 +41,8 @@ namespace gui
         };
         /// informs ApplicationManager to not close caller application when switching from app to app
         bool disableAppClose = false;
+        /// informs ApplicationManager to close caller application instead of keeping it in the background
+        bool forceAppClose = false;
         /// informs App window stack that requested window should be ignored on windows stack.
         ///
         /// This affects window back mechanics. Having switchWindow calls like that:
@@ -2,12 +2,14 @@
 // For licensing, see https://github.com/mudita/MuditaOS/LICENSE.md
 
 #include "DrawCommand.hpp"
+#include "DrawCommandArena.hpp"
 #include "Common.hpp"
 
 // gui components
 #include "Color.hpp"
 #include "Context.hpp"
 #include "ImageManager.hpp"
+#include "RasterCache.hpp"
 // renderers
 #include "renderers/LineRenderer.hpp"
 #include "renderers/ArcRenderer.hpp"
@@ -20,6 +22,7 @@
 // utils
 #include <log/log.hpp>
 // module-utils
+#include <algorithm>
 #include <cassert>
 
 #if DEBUG_FONT == 1
@@ -30,6 +33,16 @@
 
 namespace gui
 {
+    void *DrawCommand::operator new(std::size_t size)
+    {
+        return DrawCommandArena::getInstance().allocate(size);
+    }
+
+    void DrawCommand::operator delete(void *ptr) noexcept
+    {
+        DrawCommandArena::getInstance().deallocate(ptr);
+    }
+
     void Clear::draw(Context *ctx) const
     {
         ctx->fill(renderer::PixelRenderer::getColor(gui::ColorFullWhite.intensity));
@@ -84,7 +97,7 @@ namespace gui
             RectangleRenderer::drawFlat(
                 drawingContext, position, adjustedWidth, adjustedHeight, RectangleRenderer::DrawableStyle::from(*this));
         }
-        else {
+        else if (!rasterCached || !drawCached(drawingContext, position, adjustedWidth, adjustedHeight)) {
             RectangleRenderer::draw(
                 drawingContext, position, adjustedWidth, adjustedHeight, RectangleRenderer::DrawableStyle::from(*this));
         }
@@ -94,15 +107,71 @@ namespace gui
         }
     }
 
+    bool DrawRectangle::drawCached(Context *ctx, Point position, Length rectWidth, Length rectHeight) const
+    {
+        // the yaps stick out of the rectangle
+        const auto margin = static_cast<Position>(yapSize + penWidth + 1);
+        const auto key    = RasterCache::makeKey(RasterCache::Shape::Rectangle,
+                                              rectWidth,
+                                              rectHeight,
+                                              radius,
+                                              edges,
+                                              flatEdges,
+                                              corners,
+                                              yaps,
+                                              yapSize,
+                                              penWidth,
+                                              filled,
+                                              fillColor,
+                                              borderColor);
+        return RasterCache::getInstance().draw(ctx,
+                                               {position.x - margin, position.y - margin},
+                                               key,
+                                               rectWidth + 2 * margin,
+                                               rectHeight + 2 * margin,
+                                               [&](Context *raster) {
+                                                   renderer::RectangleRenderer::draw(
+                                                       raster,
+                                                       {margin, margin},
+                                                       rectWidth,
+                                                       rectHeight,
+                                                       renderer::RectangleRenderer::DrawableStyle::from(*this));
+                                               });
+    }
+
     void DrawArc::draw(Context *ctx) const
     {
-        renderer::ArcRenderer::draw(
-            ctx, center, radius, start, sweep, renderer::ArcRenderer::DrawableStyle::from(*this));
+        const auto style = renderer::ArcRenderer::DrawableStyle::from(*this);
+        if (rasterCached) {
+            const auto extent = static_cast<Position>(radius + width + 1);
+            const auto size   = static_cast<Length>(2 * extent + 1);
+            const auto key = RasterCache::makeKey(RasterCache::Shape::Arc, radius, start, sweep, width, borderColor);
+            if (RasterCache::getInstance().draw(
+                    ctx, {center.x - extent, center.y - extent}, key, size, size, [&](Context *raster) {
+                        renderer::ArcRenderer::draw(raster, {extent, extent}, radius, start, sweep, style);
+                    })) {
+                return;
+            }
+        }
+        renderer::ArcRenderer::draw(ctx, center, radius, start, sweep, style);
     }
 
     void DrawCircle::draw(Context *ctx) const
     {
-        renderer::CircleRenderer::draw(ctx, center, radius, renderer::CircleRenderer::DrawableStyle::from(*this));
+        const auto style = renderer::CircleRenderer::DrawableStyle::from(*this);
+        if (rasterCached) {
+            const auto extent = static_cast<Position>(radius + width + 1);
+            const auto size   = static_cast<Length>(2 * extent + 1);
+            const auto key    = RasterCache::makeKey(
+                RasterCache::Shape::Circle, radius, width, borderColor, filled, filled ? fillColor : ColorNoColor);
+            if (RasterCache::getInstance().draw(
+                    ctx, {center.x - extent, center.y - extent}, key, size, size, [&](Context *raster) {
+                        renderer::CircleRenderer::draw(raster, {extent, extent}, radius, style);
+                    })) {
+                return;
+            }
+        }
+        renderer::CircleRenderer::draw(ctx, center, radius, style);
     }
 
     void DrawText::drawChar(Context *ctx, const Point glyphOrigin, FontGlyph *glyph) const
@@ -130,10 +199,35 @@ namespace gui
         }
     }
 
+    DrawText::~DrawText()
+    {
+        DrawCommandArena::getInstance().deallocate(chars);
+    }
+
+    void DrawText::setText(const UTF8 &text, std::uint32_t textLength)
+    {
+        auto &arena = DrawCommandArena::getInstance();
+        arena.deallocate(chars);
+        chars  = nullptr;
+        length = std::min(textLength, text.length());
+        if (length == 0) {
+            return;
+        }
+        chars = static_cast<std::uint32_t *>(arena.allocate(length * sizeof(*chars)));
+        for (std::uint32_t i = 0; i < length; ++i) {
+            chars[i] = text[i];
+        }
+    }
+
+    std::uint32_t DrawText::getLength() const noexcept
+    {
+        return length;
+    }
+
     void DrawText::draw(Context *ctx) const
     {
         // check if there are any characters to draw in the string provided with message.
-        if (str.length() == 0) {
+        if (length == 0) {
             return;
         }
 
@@ -144,8 +238,8 @@ namespace gui
         uint32_t idLast = 0, idCurrent = 0;
         Point position = textOrigin;
 
-        for (uint32_t i = 0; i < str.length(); ++i) {
-            idCurrent        = str[i]; // id stands for glued together utf-16 with no order bytes (0xFF 0xFE)
+        for (uint32_t i = 0; i < length; ++i) {
+            idCurrent        = chars[i]; // id stands for glued together utf-16 with no order bytes (0xFF 0xFE)
             const auto glyph = font->getGlyph(idCurrent);
 
             const auto xDrawingPosition = origin.x + position.x + glyph->xoffset;
@@ -33,6 +33,10 @@ namespace gui
         virtual ~DrawCommand() = default;
 
         virtual void draw(Context *ctx) const = 0;
+
+        /// The commands are placed in DrawCommandArena
+        static void *operator new(std::size_t size);
+        static void operator delete(void *ptr) noexcept;
     };
 
     class Clear : public DrawCommand
@@ -80,8 +84,14 @@ namespace gui
         uint8_t penWidth{1};
         Color fillColor{ColorFullBlack};
         Color borderColor{ColorFullBlack};
+        // rounded rectangle is drawn from RasterCache
+        bool rasterCached{false};
 
         void draw(Context *ctx) const override;
+
+      private:
+        /// false if the rectangle is too big for the cache
+        bool drawCached(Context *ctx, Point position, Length rectWidth, Length rectHeight) const;
     };
 
     /**
@@ -96,6 +106,8 @@ namespace gui
         const Color borderColor;
         const Point center;
         const Length radius;
+        // arc is drawn from RasterCache
+        bool rasterCached{false};
 
         DrawArc(Point _center,
                 Length _radius,
@@ -145,14 +157,29 @@ namespace gui
         Point textOrigin{0, 0};
         Length textHeight{0};
 
-        UTF8 str{};
         uint8_t fontID{0};
         Color color{ColorFullBlack};
 
+        DrawText() = default;
+        ~DrawText() override;
+
+        DrawText(const DrawText &) = delete;
+        DrawText &operator=(const DrawText &) = delete;
+
+        /// Copies the characters of the text to the draw command arena
+        /// @param text : text to draw
+        /// @param length : number of the characters from the beginning of the text to draw
+        void setText(const UTF8 &text, std::uint32_t length);
+        [[nodiscard]] std::uint32_t getLength() const noexcept;
+
         void draw(Context *ctx) const override;
 
       private:
         void drawChar(Context *ctx, const Point glyphOrigin, FontGlyph *glyph) const;
+
+        /// decoded characters of the text
+        std::uint32_t *chars{nullptr};
+        std::uint32_t length{0};
     };
 
     /**
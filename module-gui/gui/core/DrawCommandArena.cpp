@@ -0,0 +1,115 @@
+// Copyright (c) 2017-2023, Mudita Sp. z.o.o. All rights reserved.
+// For licensing, see https://github.com/mudita/MuditaOS/LICENSE.md
+
+#include "DrawCommandArena.hpp"
+
+#include <new>
+
+namespace gui
+{
+    namespace
+    {
+        constexpr auto alignment = alignof(std::max_align_t);
+
+        constexpr std::size_t alignUp(std::size_t size)
+        {
+            return (size + alignment - 1) & ~(alignment - 1);
+        }
+    } // namespace
+
+    DrawCommandArena::DrawCommandArena()
+    {
+        freeBlocks.reserve(maxFreeBlocks);
+    }
+
+    DrawCommandArena::~DrawCommandArena()
+    {
+        for (auto block : freeBlocks) {
+            delete block;
+        }
+        if (current != nullptr && current->allocated == 0) {
+            delete current;
+        }
+    }
+
+    DrawCommandArena &DrawCommandArena::getInstance()
+    {
+        static DrawCommandArena arena;
+        return arena;
+    }
+
+    void *DrawCommandArena::allocate(std::size_t size)
+    {
+        const auto required = sizeof(Header) + alignUp(size);
+        if (required > blockSize) {
+            auto header = static_cast<Header *>(::operator new(required));
+            header->block = nullptr;
+            return header + 1;
+        }
+
+        cpp_freertos::LockGuard lock(mutex);
+        if (current == nullptr || current->used + required > blockSize) {
+            if (current != nullptr && current->allocated == 0) {
+                releaseBlock(current);
+            }
+            current = takeBlock();
+        }
+        auto header   = reinterpret_cast<Header *>(current->data + current->used);
+        header->block = current;
+        current->used += required;
+        ++current->allocated;
+        return header + 1;
+    }
+
+    void DrawCommandArena::deallocate(void *ptr) noexcept
+    {
+        if (ptr == nullptr) {
+            return;
+        }
+        auto header = static_cast<Header *>(ptr) - 1;
+        if (header->block == nullptr) {
+            ::operator delete(header);
+            return;
+        }
+
+        cpp_freertos::LockGuard lock(mutex);
+        auto block = header->block;
+        if (--block->allocated != 0) {
+            return;
+        }
+        if (block == current) {
+            // the frame has been rendered, the next one starts from the beginning of the block
+            block->used = 0;
+            return;
+        }
+        releaseBlock(block);
+    }
+
+    std::size_t DrawCommandArena::getBlocksCount() const
+    {
+        cpp_freertos::LockGuard lock(mutex);
+        return blocksCount;
+    }
+
+    DrawCommandArena::Block *DrawCommandArena::takeBlock()
+    {
+        if (!freeBlocks.empty()) {
+            auto block = freeBlocks.back();
+            freeBlocks.pop_back();
+            return block;
+        }
+        ++blocksCount;
+        return new Block;
+    }
+
+    void DrawCommandArena::releaseBlock(Block *block)
+    {
+        block->used = 0;
+        if (freeBlocks.size() < maxFreeBlocks) {
+            freeBlocks.push_back(block);
+            return;
+        }
+        --blocksCount;
+        delete block;
+    }
+} // namespace gui
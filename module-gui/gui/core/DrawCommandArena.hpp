@@ -0,0 +1,69 @@
+// Copyright (c) 2017-2023, Mudita Sp. z.o.o. All rights reserved.
+// For licensing, see https://github.com/mudita/MuditaOS/LICENSE.md
+
+#pragma once
+
+#include <mutex.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace gui
+{
+    /**
+     * @brief Memory of the draw commands.
+     *
+     * The commands of a frame are placed one after another in a block instead of being allocated one by one from
+     * the heap. A block is used again from its beginning once all of its commands are destroyed, i.e. once the frame
+     * has been rendered. The commands are built by the applications and destroyed by the renderer, so the arena
+     * can be used from any task.
+     */
+    class DrawCommandArena
+    {
+      public:
+        /// Size of a block, an allocation which doesn't fit in a block is taken from the heap
+        static constexpr std::size_t blockSize = 4096;
+        /// Number of the unused blocks kept for the next frames
+        static constexpr std::size_t maxFreeBlocks = 4;
+
+        DrawCommandArena();
+        ~DrawCommandArena();
+
+        DrawCommandArena(const DrawCommandArena &) = delete;
+        DrawCommandArena &operator=(const DrawCommandArena &) = delete;
+
+        static DrawCommandArena &getInstance();
+
+        [[nodiscard]] void *allocate(std::size_t size);
+        void deallocate(void *ptr) noexcept;
+
+        /// Number of the blocks, used and free
+        [[nodiscard]] std::size_t getBlocksCount() const;
+
+      private:
+        struct Block;
+
+        /// Precedes every allocation, points to its block or is null for the allocations taken from the heap
+        struct alignas(std::max_align_t) Header
+        {
+            Block *block;
+        };
+
+        struct Block
+        {
+            alignas(std::max_align_t) std::byte data[blockSize];
+            std::size_t used        = 0;
+            std::uint32_t allocated = 0;
+        };
+
+        [[nodiscard]] Block *takeBlock();
+        void releaseBlock(Block *block);
+
+        mutable cpp_freertos::MutexStandard mutex;
+        /// block the new allocations are placed in
+        Block *current = nullptr;
+        std::vector<Block *> freeBlocks;
+        std::size_t blocksCount = 0;
+    };
+} // namespace gui
@@ -0,0 +1,122 @@
+// Copyright (c) 2017-2023, Mudita Sp. z.o.o. All rights reserved.
+// For licensing, see https://github.com/mudita/MuditaOS/LICENSE.md
+
+#include "RasterCache.hpp"
+
+#include <algorithm>
+#include <cstring>
+
+namespace gui
+{
+    RasterCache &RasterCache::getInstance()
+    {
+        static RasterCache cache;
+        return cache;
+    }
+
+    void RasterCache::clear()
+    {
+        cpp_freertos::LockGuard lock(mutex);
+        rasters.clear();
+        size = 0;
+    }
+
+    std::size_t RasterCache::getSize() const
+    {
+        cpp_freertos::LockGuard lock(mutex);
+        return size;
+    }
+
+    std::size_t RasterCache::getRastersCount() const
+    {
+        cpp_freertos::LockGuard lock(mutex);
+        return rasters.size();
+    }
+
+    std::size_t RasterCache::Raster::getSize() const noexcept
+    {
+        return sizeof(Raster) + runs.size() * sizeof(Run) + pixels.size();
+    }
+
+    void RasterCache::hashBytes(Key &key, std::uint64_t value, std::size_t size)
+    {
+        // FNV-1a
+        for (std::size_t i = 0; i < size; ++i) {
+            key ^= (value >> (i * 8)) & 0xFFU;
+            key *= prime;
+        }
+    }
+
+    bool RasterCache::drawCached(Context *ctx, Point position, Key key, Length width, Length height)
+    {
+        cpp_freertos::LockGuard lock(mutex);
+        const auto it = std::find_if(rasters.begin(), rasters.end(), [&](const auto &raster) {
+            return raster.key == key && raster.width == width && raster.height == height;
+        });
+        if (it == rasters.end()) {
+            return false;
+        }
+        rasters.splice(rasters.begin(), rasters, it);
+        blit(ctx, position, *it);
+        return true;
+    }
+
+    void RasterCache::insert(Context *ctx, Point position, Key key, const Context &context)
+    {
+        Raster raster{key, context.getW(), context.getH(), {}, {}};
+        const auto data = context.getData();
+        for (std::uint16_t y = 0; y < context.getH(); ++y) {
+            const auto row = data + y * context.getW();
+            std::uint16_t x = 0;
+            while (x < context.getW()) {
+                if (row[x] == emptyPixel) {
+                    ++x;
+                    continue;
+                }
+                const auto begin = x;
+                while (x < context.getW() && row[x] != emptyPixel) {
+                    ++x;
+                }
+                raster.runs.push_back(Run{static_cast<std::int16_t>(begin),
+                                          static_cast<std::int16_t>(y),
+                                          static_cast<std::uint16_t>(x - begin)});
+                raster.pixels.insert(raster.pixels.end(), row + begin, row + x);
+            }
+        }
+        raster.runs.shrink_to_fit();
+        raster.pixels.shrink_to_fit();
+        blit(ctx, position, raster);
+
+        const auto rasterSize = raster.getSize();
+        if (rasterSize > capacity) {
+            return;
+        }
+        cpp_freertos::LockGuard lock(mutex);
+        while (size + rasterSize > capacity) {
+            size -= rasters.back().getSize();
+            rasters.pop_back();
+        }
+        size += rasterSize;
+        rasters.push_front(std::move(raster));
+    }
+
+    void RasterCache::blit(Context *ctx, Point position, const Raster &raster)
+    {
+        const auto data   = ctx->getData();
+        const auto width  = static_cast<Position>(ctx->getW());
+        const auto height = static_cast<Position>(ctx->getH());
+
+        auto pixels = raster.pixels.data();
+        for (const auto &run : raster.runs) {
+            const auto y     = position.y + run.y;
+            const auto begin = position.x + run.x;
+            const auto end   = begin + run.length;
+            const auto first = std::max<Position>(begin, 0);
+            const auto last  = std::min<Position>(end, width);
+            if (y >= 0 && y < height && first < last) {
+                std::memcpy(data + y * width + first, pixels + (first - begin), last - first);
+            }
+            pixels += run.length;
+        }
+    }
+} // namespace gui
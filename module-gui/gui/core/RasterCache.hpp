@@ -0,0 +1,148 @@
+// Copyright (c) 2017-2023, Mudita Sp. z.o.o. All rights reserved.
+// For licensing, see https://github.com/mudita/MuditaOS/LICENSE.md
+
+#pragma once
+
+#include "Color.hpp"
+#include "Context.hpp"
+
+#include <gui/Common.hpp>
+#include <mutex.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <type_traits>
+#include <vector>
+
+namespace gui
+{
+    /**
+     * @brief Rasters of the shapes which are expensive to draw, i.e. the rounded rectangles, the arcs and the circles.
+     *
+     * A shape is rasterized once into a context cleared with a value none of the colors maps to, the pixels it
+     * covered are kept as runs of the rows. The next frames copy the runs into place instead of rasterizing the shape
+     * from its geometry again. The rasters don't depend on the position of the shapes, so the same shapes drawn in
+     * different places share the raster.
+     */
+    class RasterCache
+    {
+      public:
+        using Key = std::uint64_t;
+
+        enum class Shape : std::uint8_t
+        {
+            Rectangle,
+            Arc,
+            Circle
+        };
+
+        /// Number of the bytes the kept rasters may take
+        static constexpr std::size_t capacity = 32 * 1024;
+        /// Shapes with a bigger bounding box are drawn without the cache, it's the size of the context a shape is
+        /// rasterized in for the first time
+        static constexpr std::size_t maxRasterArea = 480 * 480;
+
+        static RasterCache &getInstance();
+
+        /// Key of the shape, made of everything the raster depends on besides the position
+        template <typename... Params>
+        [[nodiscard]] static Key makeKey(Shape shape, const Params &...params);
+
+        /**
+         * @brief Draws the shape from its raster, the shape is rasterized first if it isn't cached.
+         *
+         * @param ctx : context to draw in
+         * @param position : position of the top left corner of the bounding box in the context
+         * @param width, height : size of the bounding box of the shape
+         * @param rasterize : function drawing the shape in the context of the bounding box size
+         * @return false if the shape is too big to be cached, it has to be drawn without the cache then
+         */
+        template <typename Rasterize>
+        bool draw(Context *ctx, Point position, Key key, Length width, Length height, Rasterize &&rasterize);
+
+        /// Drops the kept rasters, e.g. after the color scheme has changed
+        void clear();
+
+        [[nodiscard]] std::size_t getSize() const;
+        [[nodiscard]] std::size_t getRastersCount() const;
+
+      private:
+        static constexpr Key offsetBasis         = 14695981039346656037ULL;
+        static constexpr Key prime               = 1099511628211ULL;
+        static constexpr std::uint8_t emptyPixel = 0xFE;
+
+        struct Run
+        {
+            std::int16_t x;
+            std::int16_t y;
+            std::uint16_t length;
+        };
+
+        struct Raster
+        {
+            Key key;
+            Length width;
+            Length height;
+            std::vector<Run> runs;
+            std::vector<std::uint8_t> pixels;
+
+            [[nodiscard]] std::size_t getSize() const noexcept;
+        };
+
+        template <typename T>
+        static void hash(Key &key, const T &value);
+        static void hashBytes(Key &key, std::uint64_t value, std::size_t size);
+
+        /// Draws the cached raster, false if it isn't cached
+        bool drawCached(Context *ctx, Point position, Key key, Length width, Length height);
+        /// Keeps the covered pixels of the rasterized shape and draws them
+        void insert(Context *ctx, Point position, Key key, const Context &raster);
+        static void blit(Context *ctx, Point position, const Raster &raster);
+
+        mutable cpp_freertos::MutexStandard mutex;
+        /// the most recently used first
+        std::list<Raster> rasters;
+        std::size_t size = 0;
+    };
+
+    template <typename... Params>
+    RasterCache::Key RasterCache::makeKey(Shape shape, const Params &...params)
+    {
+        auto key = offsetBasis;
+        hash(key, shape);
+        (hash(key, params), ...);
+        return key;
+    }
+
+    template <typename T>
+    void RasterCache::hash(Key &key, const T &value)
+    {
+        if constexpr (std::is_same_v<T, Color>) {
+            hashBytes(key, value.intensity, sizeof(value.intensity));
+            hashBytes(key, value.alpha, sizeof(value.alpha));
+        }
+        else if constexpr (std::is_enum_v<T>) {
+            hashBytes(key, static_cast<std::uint64_t>(value), sizeof(value));
+        }
+        else {
+            static_assert(std::is_arithmetic_v<T>, "only the plain values are part of the key");
+            hashBytes(key, static_cast<std::uint64_t>(value), sizeof(value));
+        }
+    }
+
+    template <typename Rasterize>
+    bool RasterCache::draw(Context *ctx, Point position, Key key, Length width, Length height, Rasterize &&rasterize)
+    {
+        if (static_cast<std::size_t>(width) * height > maxRasterArea) {
+            return false;
+        }
+        if (!drawCached(ctx, position, key, width, height)) {
+            Context raster{static_cast<std::uint16_t>(width), static_cast<std::uint16_t>(height)};
+            raster.fill(emptyPixel);
+            rasterize(&raster);
+            insert(ctx, position, key, raster);
+        }
+        return true;
+    }
+} // namespace gui
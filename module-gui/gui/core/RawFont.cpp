@@ -119,8 +119,9 @@ namespace gui
         std::uint32_t current        = 0;
         std::uint32_t previous       = none_char_id;
 
-        for (std::uint32_t i = 0; i < str.length(); ++i, ++count) {
-            current = str[i];
+        const auto characters = str.characters();
+        for (auto character = characters.begin(); character != characters.end(); ++character, ++count) {
+            current = *character;
             textSpace += getCharPixelWidth(current, previous);
             if (availableSpace < textSpace) {
                 return count - 1;
@@ -182,8 +183,9 @@ namespace gui
         std::uint32_t idCurrent = 0;
         std::uint32_t idLast    = none_char_id;
 
-        for (std::uint32_t i = 0; i < count; ++i) {
-            idCurrent = str[start + i];
+        auto character = str.iteratorAt(start);
+        for (std::uint32_t i = 0; i < count; ++i, ++character) {
+            idCurrent = *character;
             width += getCharPixelWidth(idCurrent, idLast);
             idLast = idCurrent;
         }
@@ -1,4 +1,4 @@
-// Copyright (c) 2017-2022, Mudita Sp. z.o.o. All rights reserved.
+// Copyright (c) 2017-2023, Mudita Sp. z.o.o. All rights reserved.
 // For licensing, see https://github.com/mudita/MuditaOS/LICENSE.md
 
 // for memset
@@ -15,7 +15,7 @@ namespace gui
         renderer::PixelRenderer::updateColorScheme(scheme);
     }
 
-    void Renderer::render(Context *ctx, const std::list<std::unique_ptr<DrawCommand>> &commands) const
+    void Renderer::render(Context *ctx, const std::vector<std::unique_ptr<DrawCommand>> &commands) const
     {
         if (ctx == nullptr) {
             return;
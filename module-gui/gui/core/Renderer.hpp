@@ -1,9 +1,9 @@
-// Copyright (c) 2017-2022, Mudita Sp. z.o.o. All rights reserved.
+// Copyright (c) 2017-2023, Mudita Sp. z.o.o. All rights reserved.
 // For licensing, see https://github.com/mudita/MuditaOS/LICENSE.md
 
 #pragma once
 
-#include <list>
+#include <vector>
 
 #include <Math.hpp>
 
@@ -35,7 +35,7 @@ namespace gui
 
       public:
         void changeColorScheme(const std::unique_ptr<ColorScheme> &scheme) const;
-        void render(Context *ctx, const std::list<std::unique_ptr<DrawCommand>> &commands) const;
+        void render(Context *ctx, const std::vector<std::unique_ptr<DrawCommand>> &commands) const;
 
         template <typename... Commands>
         void render(Context &ctx, const Commands &...commands) const
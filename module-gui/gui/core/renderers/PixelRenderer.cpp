@@ -1,8 +1,9 @@
-// Copyright (c) 2017-2021, Mudita Sp. z.o.o. All rights reserved.
+// Copyright (c) 2017-2023, Mudita Sp. z.o.o. All rights reserved.
 // For licensing, see https://github.com/mudita/MuditaOS/LICENSE.md
 
 #include "PixelRenderer.hpp"
 #include "Context.hpp"
+#include "RasterCache.hpp"
 
 #include <cstring>
 
@@ -21,6 +22,8 @@ namespace gui::renderer
     void PixelRenderer::updateColorScheme(const std::unique_ptr<ColorScheme> &scheme)
     {
         colorScheme = *scheme;
+        // the rasters hold the colors of the previous scheme
+        RasterCache::getInstance().clear();
     }
 
     auto PixelRenderer::getColor(const uint8_t intensity) -> uint8_t
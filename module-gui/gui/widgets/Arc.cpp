@@ -1,4 +1,4 @@
-// Copyright (c) 2017-2021, Mudita Sp. z.o.o. All rights reserved.
+// Copyright (c) 2017-2023, Mudita Sp. z.o.o. All rights reserved.
 // For licensing, see https://github.com/mudita/MuditaOS/LICENSE.md
 
 #include <log/log.hpp>
@@ -109,7 +109,7 @@ namespace gui
         return start;
     }
 
-    void Arc::buildDrawListImplementation(std::list<Command> &commands)
+    void Arc::buildDrawListImplementation(std::vector<Command> &commands)
     {
         auto arc   = std::make_unique<DrawArc>(center, radius, start, sweep, focus ? focusPenWidth : penWidth, color);
         arc->areaX = widgetArea.x;
@@ -117,6 +117,8 @@ namespace gui
         arc->areaW = widgetArea.w;
         arc->areaH = widgetArea.h;
 
+        arc->rasterCached = rasterCached;
+
         commands.emplace_back(std::move(arc));
     }
 } // namespace gui
@@ -1,9 +1,9 @@
-// Copyright (c) 2017-2021, Mudita Sp. z.o.o. All rights reserved.
+// Copyright (c) 2017-2023, Mudita Sp. z.o.o. All rights reserved.
 // For licensing, see https://github.com/mudita/MuditaOS/LICENSE.md
 
 #pragma once
 
-#include <list>
+#include <vector>
 #include <cstdint>
 
 #include <Math.hpp>
@@ -48,7 +48,7 @@ namespace gui
         trigonometry::Degrees getSweepAngle() const noexcept;
         trigonometry::Degrees getStartAngle() const noexcept;
 
-        void buildDrawListImplementation(std::list<Command> &commands) override;
+        void buildDrawListImplementation(std::vector<Command> &commands) override;
 
       protected:
         Arc(Item *parent,
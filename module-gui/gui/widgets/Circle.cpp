@@ -1,4 +1,4 @@
-// Copyright (c) 2017-2021, Mudita Sp. z.o.o. All rights reserved.
+// Copyright (c) 2017-2023, Mudita Sp. z.o.o. All rights reserved.
 // For licensing, see https://github.com/mudita/MuditaOS/LICENSE.md
 
 #include <log/log.hpp>
@@ -75,7 +75,7 @@ namespace gui
           isFilled{_filled}, fillColor{_fillColor}, focusBorderColor{_focusBorderColor}
     {}
 
-    void Circle::buildDrawListImplementation(std::list<Command> &commands)
+    void Circle::buildDrawListImplementation(std::vector<Command> &commands)
     {
         auto circle = std::make_unique<DrawCircle>(
             center, radius, focus ? focusPenWidth : penWidth, focus ? focusBorderColor : color, isFilled, fillColor);
@@ -84,6 +84,8 @@ namespace gui
         circle->areaW = widgetArea.w;
         circle->areaH = widgetArea.h;
 
+        circle->rasterCached = rasterCached;
+
         commands.emplace_back(std::move(circle));
     }
 } // namespace gui
@@ -1,9 +1,9 @@
-// Copyright (c) 2017-2021, Mudita Sp. z.o.o. All rights reserved.
+// Copyright (c) 2017-2023, Mudita Sp. z.o.o. All rights reserved.
 // For licensing, see https://github.com/mudita/MuditaOS/LICENSE.md
 
 #pragma once
 
-#include <list>
+#include <vector>
 #include <cstdint>
 #include "Arc.hpp"
 #include "Common.hpp"
@@ -40,7 +40,7 @@ namespace gui
 
         Circle(Item *parent, const Circle::ShapeParams &params);
 
-        void buildDrawListImplementation(std::list<Command> &commands) override;
+        void buildDrawListImplementation(std::vector<Command> &commands) override;
 
       private:
         Circle(Item *parent,
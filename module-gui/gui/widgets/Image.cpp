@@ -1,4 +1,4 @@
-// Copyright (c) 2017-2021, Mudita Sp. z.o.o. All rights reserved.
+// Copyright (c) 2017-2023, Mudita Sp. z.o.o. All rights reserved.
 // For licensing, see https://github.com/mudita/MuditaOS/LICENSE.md
 
 #include "Image.hpp"
@@ -65,7 +65,7 @@ namespace gui
         set(id);
     }
 
-    void Image::buildDrawListImplementation(std::list<Command> &commands)
+    void Image::buildDrawListImplementation(std::vector<Command> &commands)
     {
         if (imageMap == nullptr) {
             LOG_ERROR("Unable to draw the image: ImageMap does not exist.");
@@ -1,9 +1,9 @@
-// Copyright (c) 2017-2021, Mudita Sp. z.o.o. All rights reserved.
+// Copyright (c) 2017-2023, Mudita Sp. z.o.o. All rights reserved.
 // For licensing, see https://github.com/mudita/MuditaOS/LICENSE.md
 
 #pragma once
 
-#include <list>
+#include <vector>
 
 #include "Rect.hpp"
 #include "../core/DrawCommand.hpp"
@@ -34,7 +34,7 @@ namespace gui
         bool set(int id);
         void set(const UTF8 &name, ImageTypeSpecifier specifier = ImageTypeSpecifier::None);
 
-        void buildDrawListImplementation(std::list<Command> &commands) override;
+        void buildDrawListImplementation(std::vector<Command> &commands) override;
         void accept(GuiVisitor &visitor) override;
     };
 
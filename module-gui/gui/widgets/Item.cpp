@@ -110,12 +110,18 @@ namespace gui
         visible = value;
     }
 
-    std::list<Command> Item::buildDrawList()
+    std::vector<Command> Item::buildDrawList()
+    {
+        auto commands = std::vector<Command>();
+        buildDrawList(commands);
+        return commands;
+    }
+
+    void Item::buildDrawList(std::vector<Command> &commands)
     {
         if (not visible) {
-            return {};
+            return;
         }
-        auto commands = std::list<Command>();
         if (preBuildDrawListHook != nullptr) {
             preBuildDrawListHook(commands);
         }
@@ -124,16 +130,12 @@ namespace gui
         if (postBuildDrawListHook != nullptr) {
             postBuildDrawListHook(commands);
         }
-        return commands;
     }
 
-    void Item::buildChildrenDrawList(std::list<Command> &commands)
+    void Item::buildChildrenDrawList(std::vector<Command> &commands)
     {
         for (auto widget : children) {
-            auto drawCommands = widget->buildDrawList();
-            if (!drawCommands.empty()) {
-                commands.splice(commands.end(), drawCommands);
-            }
+            widget->buildDrawList(commands);
         }
     }
 
@@ -1,4 +1,4 @@
-// Copyright (c) 2017-2022, Mudita Sp. z.o.o. All rights reserved.
+// Copyright (c) 2017-2023, Mudita Sp. z.o.o. All rights reserved.
 // For licensing, see https://github.com/mudita/MuditaOS/LICENSE.md
 
 #pragma once
@@ -14,6 +14,7 @@
 #include <list>                 // for list
 #include <memory>               // for unique_ptr
 #include <utility>              // for move
+#include <vector>               // for vector
 #include <core/DrawCommandForward.hpp>
 #include <module-gui/gui/widgets/visitor/GuiVisitor.hpp>
 #include <Timers/Timer.hpp>
@@ -108,6 +109,9 @@ namespace gui
         bool activeItem = true;
         /// flag that defines whether widget is visible (this is - should be rendered)
         bool visible;
+        /// flag that defines whether the shape of the widget (rounded rectangle, arc, circle) is drawn from
+        /// gui::RasterCache, meant for the shapes which don't change from frame to frame
+        bool rasterCached = false;
         /// policy for changing vertical size if Item is placed inside layout.
         LayoutVerticalPolicy verticalPolicy;
         /// policy for changing horizontal size if Item is placed inside layout.
@@ -296,23 +300,23 @@ namespace gui
         virtual void setBoundingBox(const BoundingBox &new_box);
         /// entry function to create commands to execute in renderer to draw on screen
         /// @note we should consider lazy evaluation prior to drawing on screen, rather than on each resize of elements
-        /// @return list of commands for renderer to draw elements on screen
-        virtual std::list<Command> buildDrawList() final;
+        /// @return commands for renderer to draw elements on screen, the whole tree of items is placed in one vector
+        virtual std::vector<Command> buildDrawList() final;
         /// Implementation of DrawList per Item to be drawn on screen
         /// This is called from buildDrawList before children elements are added
         /// should be = 0;
         /// @param : commands list of commands for renderer to draw elements on screen
-        virtual void buildDrawListImplementation(std::list<Command> &commands)
+        virtual void buildDrawListImplementation(std::vector<Command> &commands)
         {}
 
         /// pre hook function, if set it is executed before building draw command
         /// at Item::buildDrawListImplementation()
         /// @param `commandlist` : commands list of commands for renderer to draw elements on screen
-        std::function<void(std::list<Command> &)> preBuildDrawListHook = nullptr;
+        std::function<void(std::vector<Command> &)> preBuildDrawListHook = nullptr;
         /// post hook function, if set it is executed after building draw command
         /// at Item::buildDrawListImplementation()
         /// @param `commandlist` : commands list of commands for renderer to draw elements on screen
-        std::function<void(std::list<Command> &)> postBuildDrawListHook = nullptr;
+        std::function<void(std::vector<Command> &)> postBuildDrawListHook = nullptr;
         /// sets radius for item edges
         /// @note this should be moved to Rect
         virtual void setRadius(int value);
@@ -405,11 +409,13 @@ namespace gui
         virtual void updateDrawArea();
         /// builds draw commands for all of item's children
         /// @param `commandlist` : commands list of commands for renderer to draw elements on screen
-        virtual void buildChildrenDrawList(std::list<Command> &commands) final;
+        virtual void buildChildrenDrawList(std::vector<Command> &commands) final;
         /// Pointer to navigation object. It is added when object is set for one of the directions
         gui::Navigation *navigationDirections = nullptr;
 
       private:
+        /// appends the commands of the item and its children to the commands of the frame
+        void buildDrawList(std::vector<Command> &commands);
         /// list of attached timers to item.
         std::list<sys::Timer *> timers;
     };
@@ -1,4 +1,4 @@
-// Copyright (c) 2017-2021, Mudita Sp. z.o.o. All rights reserved.
+// Copyright (c) 2017-2023, Mudita Sp. z.o.o. All rights reserved.
 // For licensing, see https://github.com/mudita/MuditaOS/LICENSE.md
 
 #include <log/log.hpp>
@@ -52,7 +52,7 @@ namespace gui
         return maxValue;
     }
 
-    void ProgressBar::buildDrawListImplementation(std::list<Command> &commands)
+    void ProgressBar::buildDrawListImplementation(std::vector<Command> &commands)
     {
         uint32_t progressSize = maxValue == 0U ? 0 : (currentValue * widgetArea.w) / maxValue;
         drawArea.w            = progressSize;
@@ -68,6 +68,8 @@ namespace gui
 
     CircularProgressBar::CircularProgressBar(Item *parent, const Circle::ShapeParams &shape) : Circle{parent, shape}
     {
+        // the base circle and the indicator don't change, only the progress arc is rasterized on every frame
+        rasterCached = true;
         createWidgets();
         updateDrawArea();
     }
@@ -91,7 +93,8 @@ namespace gui
             .setPenWidth(penWidth + 1)
             .setBorderColor(ColorFullBlack)
             .setFillColor(ColorFullBlack);
-        progressIndicator = new Circle(this, indicatorParams);
+        progressIndicator               = new Circle(this, indicatorParams);
+        progressIndicator->rasterCached = true;
     }
 
     Point CircularProgressBar::calculateProgressIndicatorCenter() const
@@ -135,7 +138,7 @@ namespace gui
         return static_cast<float>(currentValue) / maxValue;
     }
 
-    void CircularProgressBar::buildDrawListImplementation(std::list<Command> &commands)
+    void CircularProgressBar::buildDrawListImplementation(std::vector<Command> &commands)
     {
         using namespace trigonometry;
 
@@ -156,6 +159,8 @@ namespace gui
         if (direction == ProgressDirection::CounterClockwise) {
             start -= sweep;
         };
+        // the base arc and the indicators don't change, only the progress arc is rasterized on every frame
+        rasterCached = true;
         createWidgets();
         updateDrawArea();
     }
@@ -190,7 +195,8 @@ namespace gui
             .setPenWidth(2)
             .setBorderColor(ColorFullBlack)
             .setFillColor(ColorFullBlack);
-        progressStartIndicator = new Circle(this, indicatorStartParams);
+        progressStartIndicator               = new Circle(this, indicatorStartParams);
+        progressStartIndicator->rasterCached = true;
 
         Circle::ShapeParams indicatorEndParams;
         indicatorEndParams.setCenterPoint(calculateEndIndicatorCenter())
@@ -198,7 +204,8 @@ namespace gui
             .setPenWidth(2)
             .setBorderColor(ColorFullBlack)
             .setFillColor(ColorFullBlack);
-        progressEndIndicator = new Circle(this, indicatorEndParams);
+        progressEndIndicator               = new Circle(this, indicatorEndParams);
+        progressEndIndicator->rasterCached = true;
     }
 
     Point ArcProgressBar::calculateStartIndicatorCenter() const
@@ -250,7 +257,7 @@ namespace gui
         return static_cast<float>(currentValue) / maxValue;
     }
 
-    void ArcProgressBar::buildDrawListImplementation(std::list<Command> &commands)
+    void ArcProgressBar::buildDrawListImplementation(std::vector<Command> &commands)
     {
         if (direction == ProgressDirection::Clockwise) {
             progressArc->setSweepAngle(std::ceil(getPercentageValue() * sweep));
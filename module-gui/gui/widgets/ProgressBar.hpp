@@ -1,4 +1,4 @@
-// Copyright (c) 2017-2021, Mudita Sp. z.o.o. All rights reserved.
+// Copyright (c) 2017-2023, Mudita Sp. z.o.o. All rights reserved.
 // For licensing, see https://github.com/mudita/MuditaOS/LICENSE.md
 
 #pragma once
@@ -32,7 +32,7 @@ namespace gui
         void setPercentageValue(unsigned int value) noexcept override;
         [[nodiscard]] int getMaximum() const noexcept override;
 
-        void buildDrawListImplementation(std::list<Command> &commands) override;
+        void buildDrawListImplementation(std::vector<Command> &commands) override;
         bool onDimensionChanged(const BoundingBox &oldDim, const BoundingBox &newDim) override;
 
       private:
@@ -53,7 +53,7 @@ namespace gui
         void setPercentageValue(unsigned int value) noexcept override;
         [[nodiscard]] int getMaximum() const noexcept override;
 
-        void buildDrawListImplementation(std::list<Command> &commands) override;
+        void buildDrawListImplementation(std::vector<Command> &commands) override;
         auto onDimensionChanged(const BoundingBox &oldDim, const BoundingBox &newDim) -> bool override;
 
       private:
@@ -85,7 +85,7 @@ namespace gui
         void setPercentageValue(unsigned int value) noexcept override;
         [[nodiscard]] int getMaximum() const noexcept override;
 
-        void buildDrawListImplementation(std::list<Command> &commands) override;
+        void buildDrawListImplementation(std::vector<Command> &commands) override;
         auto onDimensionChanged(const BoundingBox &oldDim, const BoundingBox &newDim) -> bool override;
 
       private:
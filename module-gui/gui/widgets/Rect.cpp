@@ -1,4 +1,4 @@
-// Copyright (c) 2017-2022, Mudita Sp. z.o.o. All rights reserved.
+// Copyright (c) 2017-2023, Mudita Sp. z.o.o. All rights reserved.
 // For licensing, see https://github.com/mudita/MuditaOS/LICENSE.md
 
 /*
@@ -93,7 +93,7 @@ namespace gui
         yapSize = value;
     }
 
-    void Rect::buildDrawListImplementation(std::list<Command> &commands)
+    void Rect::buildDrawListImplementation(std::vector<Command> &commands)
     {
         auto rect = std::make_unique<DrawRectangle>();
 
@@ -117,9 +117,10 @@ namespace gui
             rect->penWidth = penWidth;
         }
 
-        rect->filled      = filled;
-        rect->borderColor = borderColor;
-        rect->fillColor   = fillColor;
+        rect->filled       = filled;
+        rect->borderColor  = borderColor;
+        rect->fillColor    = fillColor;
+        rect->rasterCached = rasterCached;
 
         commands.emplace_back(std::move(rect));
     }
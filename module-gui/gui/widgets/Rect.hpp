@@ -1,9 +1,9 @@
-// Copyright (c) 2017-2021, Mudita Sp. z.o.o. All rights reserved.
+// Copyright (c) 2017-2023, Mudita Sp. z.o.o. All rights reserved.
 // For licensing, see https://github.com/mudita/MuditaOS/LICENSE.md
 
 #pragma once
 
-#include <list>
+#include <vector>
 #include <cstdint>
 #include "Item.hpp"
 #include "../core/Color.hpp"
@@ -50,7 +50,7 @@ namespace gui
         virtual void setYaps(RectangleYap yaps);
         virtual void setYapSize(unsigned short value);
         void setFilled(bool val);
-        void buildDrawListImplementation(std::list<Command> &commands) override;
+        void buildDrawListImplementation(std::vector<Command> &commands) override;
 
         void accept(GuiVisitor &visitor) override;
     };
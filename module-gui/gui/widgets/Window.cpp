@@ -1,4 +1,4 @@
-// Copyright (c) 2017-2021, Mudita Sp. z.o.o. All rights reserved.
+// Copyright (c) 2017-2023, Mudita Sp. z.o.o. All rights reserved.
 // For licensing, see https://github.com/mudita/MuditaOS/LICENSE.md
 
 /*
@@ -39,7 +39,7 @@ namespace gui
         return false;
     }
 
-    void Window::buildDrawListImplementation(std::list<Command> &commands)
+    void Window::buildDrawListImplementation(std::vector<Command> &commands)
     {
         auto clearCommand = std::make_unique<Clear>();
         commands.emplace_back(std::move(clearCommand));
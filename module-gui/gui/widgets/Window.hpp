@@ -3,7 +3,7 @@
 
 #pragma once
 
-#include <list>
+#include <vector>
 #include "Item.hpp"
 #include "Common.hpp"
 #include "SwitchData.hpp"
@@ -68,7 +68,7 @@ namespace gui
         bool onInput(const InputEvent &inputEvent) override;
         void accept(GuiVisitor &visitor) override;
 
-        void buildDrawListImplementation(std::list<Command> &commands) override;
+        void buildDrawListImplementation(std::vector<Command> &commands) override;
 
         /// used for window switching purposes
         std::string getName()
@@ -54,7 +54,7 @@ namespace gui
         setBorderColor(gui::ColorFullBlack);
         setEdges(RectangleEdge::All);
 
-        preBuildDrawListHook = [this](std::list<Command> &commands) { preBuildDrawListHookImplementation(commands); };
+        preBuildDrawListHook = [this](std::vector<Command> &commands) { preBuildDrawListHookImplementation(commands); };
     }
 
     Text::Text() : Text(nullptr, 0, 0, 0, 0)
@@ -470,7 +470,7 @@ namespace gui
         }
     }
 
-    void Text::preBuildDrawListHookImplementation(std::list<Command> &commands)
+    void Text::preBuildDrawListHookImplementation(std::vector<Command> &commands)
     {
         // we can't build elements to show just before showing.
         // why? because we need to know if these elements fit in
@@ -109,7 +109,7 @@ namespace gui
         auto checkMaxLinesLimit(const TextBlock &textBlock, unsigned int limitVal)
             -> std::tuple<AdditionBound, TextBlock>;
 
-        void preBuildDrawListHookImplementation(std::list<Command> &commands);
+        void preBuildDrawListHookImplementation(std::vector<Command> &commands);
         /// redrawing lines
         /// it redraws visible lines on screen and if needed requests resize in parent
         virtual auto drawLines() -> void;
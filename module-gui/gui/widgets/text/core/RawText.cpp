@@ -1,4 +1,4 @@
-// Copyright (c) 2017-2021, Mudita Sp. z.o.o. All rights reserved.
+// Copyright (c) 2017-2023, Mudita Sp. z.o.o. All rights reserved.
 // For licensing, see https://github.com/mudita/MuditaOS/LICENSE.md
 
 #include "RawText.hpp"
@@ -17,22 +17,21 @@ namespace gui
         widgetArea.h = this->font->info.line_height;
     }
 
-    UTF8 RawText::stripNewlineToDraw()
+    std::uint32_t RawText::getLengthToDraw() const
     {
-        auto textToDraw = text;
-        if (textToDraw.length() > 0 && textToDraw[textToDraw.length() - 1] == text::newline) {
-            textToDraw.removeChar(textToDraw.length() - 1);
+        const auto length = text.length();
+        if (length > 0 && text[length - 1] == text::newline) {
+            return length - 1;
         }
-
-        return textToDraw;
+        return length;
     }
 
-    void RawText::buildDrawListImplementation(std::list<Command> &commands)
+    void RawText::buildDrawListImplementation(std::vector<Command> &commands)
     {
         if (font) {
             auto cmd = std::make_unique<DrawText>();
 
-            cmd->str    = stripNewlineToDraw();
+            cmd->setText(text, getLengthToDraw());
             cmd->fontID = font->id;
             cmd->color  = color;
 
@@ -1,4 +1,4 @@
-// Copyright (c) 2017-2021, Mudita Sp. z.o.o. All rights reserved.
+// Copyright (c) 2017-2023, Mudita Sp. z.o.o. All rights reserved.
 // For licensing, see https://github.com/mudita/MuditaOS/LICENSE.md
 
 #pragma once
@@ -17,7 +17,8 @@ namespace gui
         RawFont *font = nullptr;
         UTF8 text     = "";
 
-        UTF8 stripNewlineToDraw();
+        /// number of the characters to draw, without the trailing newline
+        std::uint32_t getLengthToDraw() const;
 
       public:
         RawText(UTF8 text, RawFont *font, Color color);
@@ -37,6 +38,6 @@ namespace gui
             return font;
         }
 
-        void buildDrawListImplementation(std::list<Command> &commands) override;
+        void buildDrawListImplementation(std::vector<Command> &commands) override;
     };
 } // namespace gui
@@ -158,9 +158,29 @@ namespace gui
         cursorStartPosition = val;
     }
 
+    auto TextCursor::getEditedBlock() const -> EditedBlock
+    {
+        if (checkNpos() || currentBlock() == blocksEnd()) {
+            return {};
+        }
+        return {getBlockNumber(), BlockCursor::getPosition(), document->getBlocks().size(), currentBlock()->getEnd()};
+    }
+
+    void TextCursor::invalidateLines(const EditedBlock &edited, int shift)
+    {
+        const auto current = getEditedBlock();
+        if (edited.blockNumber == text::npos || current.blockNumber != edited.blockNumber ||
+            current.blocksCount != edited.blocksCount || current.end != edited.end) {
+            return;
+        }
+        text->lines->invalidateFrom(edited.blockNumber, edited.position, shift);
+    }
+
     void TextCursor::addChar(uint32_t utf_val)
     {
+        const auto edited = getEditedBlock();
         BlockCursor::addChar(utf_val);
+        invalidateLines(edited, 1);
 
         // lines need to be drawn before cursor move in case we have scrolling
         text->drawLines();
@@ -207,7 +227,9 @@ namespace gui
     bool TextCursor::removeChar()
     {
         moveCursor(NavigationDirection::LEFT);
+        const auto edited = getEditedBlock();
         if (BlockCursor::removeChar()) {
+            invalidateLines(edited, -1);
             text->drawLines();
             return true;
         }
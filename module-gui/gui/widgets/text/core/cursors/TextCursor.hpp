@@ -24,6 +24,20 @@ namespace gui
         CursorStartPosition cursorStartPosition = CursorStartPosition::DocumentEnd;
         unsigned int onScreenPosition           = 0;
 
+      private:
+        /// Block state before an edit, to tell if the edit stayed within the block
+        struct EditedBlock
+        {
+            unsigned int blockNumber = text::npos;
+            unsigned int position    = text::npos;
+            std::size_t blocksCount  = 0;
+            TextBlock::End end       = TextBlock::End::None;
+        };
+
+        [[nodiscard]] auto getEditedBlock() const -> EditedBlock;
+        /// Lets the text reuse lines not affected by the edit, if it changed only the text of the block
+        void invalidateLines(const EditedBlock &edited, int shift);
+
       public:
         static const unsigned int defaultWidth;
         enum class Move
@@ -75,6 +75,7 @@ namespace gui
             text->lines->previousLinesStart.pop_back();
             text->lines->drawStartConditions = {lineStartBlockNumber, lineStartBlockPosition};
 
+            text->lines->keepLayout();
             text->drawLines();
 
             auto moveCount = text->lines->first().length();
@@ -100,6 +101,7 @@ namespace gui
             text->lines->drawStartConditions = {text->lines->getLine(1)->getLineStartBlockNumber(),
                                                 text->lines->getLine(1)->getLineStartBlockPosition()};
 
+            text->lines->keepLayout();
             text->drawLines();
 
             // update cursor position on screen so it points in same place after scroll
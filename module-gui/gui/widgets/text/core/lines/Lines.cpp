@@ -21,6 +21,105 @@ namespace gui
         emplace(std::move(line));
     }
 
+    void Lines::discardReusableLines()
+    {
+        for (auto &reusable : reusableLines) {
+            reusable.line.erase();
+        }
+        reusableLines.clear();
+    }
+
+    auto Lines::keepLayout() -> void
+    {
+        if (!reusableLines.empty()) {
+            return;
+        }
+
+        // The last line is not kept, as it is not known where the layout continues after it
+        for (auto line = lines.begin(); line != lines.end() && std::next(line) != lines.end(); ++line) {
+            const auto next = std::next(line);
+            if (!line->isVisible() || next->getLineStartBlockNumber() == text::npos ||
+                line->getLineStartBlockNumber() == text::npos) {
+                break;
+            }
+            reusableLines.push_back(ReusableLine{
+                std::move(*line), {next->getLineStartBlockNumber(), next->getLineStartBlockPosition()}});
+        }
+        erase();
+    }
+
+    auto Lines::invalidateFrom(unsigned int blockNumber, unsigned int blockPosition, int shift) -> void
+    {
+        keepLayout();
+
+        const TextLineStartContition edit{blockNumber, blockPosition};
+        const auto lineStart = [](const TextLine &line) {
+            return TextLineStartContition{line.getLineStartBlockNumber(), line.getLineStartBlockPosition()};
+        };
+
+        auto reusable = reusableLines.begin();
+        while (reusable != reusableLines.end() && reusable->next < edit) {
+            ++reusable;
+        }
+        // Line before the edited one could take the beginning of the edited text now or wrap before it
+        if (reusable != reusableLines.begin()) {
+            --reusable;
+        }
+        while (reusable != reusableLines.end() && lineStart(reusable->line) <= edit) {
+            reusable->line.erase();
+            reusable = reusableLines.erase(reusable);
+        }
+
+        for (; reusable != reusableLines.end(); ++reusable) {
+            if (reusable->line.getLineStartBlockNumber() == blockNumber) {
+                reusable->line.moveLineStart(shift);
+            }
+            auto &[nextBlockNumber, nextBlockPosition] = reusable->next;
+            if (nextBlockNumber == blockNumber) {
+                nextBlockPosition += shift;
+            }
+        }
+    }
+
+    auto Lines::findReusableLine(const BlockCursor &drawCursor) -> TextLine *
+    {
+        if (!drawCursor) {
+            return nullptr;
+        }
+
+        const TextLineStartContition start{drawCursor.getBlockNumber(), drawCursor.getPosition()};
+        while (!reusableLines.empty()) {
+            auto &reusable = reusableLines.front();
+            const TextLineStartContition reusableStart{reusable.line.getLineStartBlockNumber(),
+                                                       reusable.line.getLineStartBlockPosition()};
+            if (reusableStart == start) {
+                return &reusable.line;
+            }
+            if (start < reusableStart) {
+                return nullptr;
+            }
+            // Lines left behind the layout won't be needed anymore
+            reusable.line.erase();
+            reusableLines.pop_front();
+        }
+        return nullptr;
+    }
+
+    void Lines::placeReusableLine(BlockCursor &drawCursor, Position lineXPosition, Position lineYPosition)
+    {
+        auto &reusable                                  = reusableLines.front();
+        const auto [nextBlockNumber, nextBlockPosition] = reusable.next;
+
+        emplace(std::move(reusable.line));
+        reusableLines.pop_front();
+
+        last().setPosition(lineXPosition, lineYPosition);
+
+        // Layout continues from the start of the next line, just like after scrolling
+        drawCursor = BlockCursor(
+            drawCursor.getDocument(), nextBlockPosition, nextBlockNumber, text->getTextFormat().getFont());
+    }
+
     auto Lines::linesVAlign(Length parentSize) -> void
     {
         for (auto &line : lines) {
@@ -39,8 +138,15 @@ namespace gui
         BlockCursor &drawCursor, Length w, Length h, Position lineYPosition, Position lineXPosition, TextType drawType)
         -> void
     {
+        if (drawType != TextType::MultiLine || w != layoutWidth) {
+            discardReusableLines();
+        }
+        layoutWidth = w;
+
         drawType == TextType::MultiLine ? drawMultiLine(drawCursor, w, h, lineYPosition, lineXPosition)
                                         : drawSingleLine(drawCursor, w, h, lineYPosition, lineXPosition);
+
+        discardReusableLines();
     }
 
     auto Lines::drawSingleLine(
@@ -64,6 +170,13 @@ namespace gui
         const Position initialTopPadding = lineYPosition;
 
         while (true) {
+            if (const auto reusable = findReusableLine(drawCursor);
+                reusable != nullptr && (lineYPosition + reusable->height()) <= (h + initialTopPadding)) {
+                placeReusableLine(drawCursor, lineXPosition, lineYPosition);
+                lineYPosition += last().height();
+                continue;
+            }
+
             auto textLine = gui::MultiTextLine(drawCursor, w);
 
             if (textLine.length() == 0 && textLine.getLineEnd()) {
@@ -100,8 +213,15 @@ namespace gui
                      unsigned int linesCount,
                      TextType drawType) -> void
     {
+        if (drawType != TextType::MultiLine || w != layoutWidth) {
+            discardReusableLines();
+        }
+        layoutWidth = w;
+
         drawType == TextType::MultiLine ? drawMultiLine(drawCursor, w, h, lineYPosition, lineXPosition, linesCount)
                                         : drawSingleLine(drawCursor, w, h, lineYPosition, lineXPosition);
+
+        discardReusableLines();
     }
 
     auto Lines::drawMultiLine(BlockCursor &drawCursor,
@@ -115,6 +235,18 @@ namespace gui
         Length initHeight                = text->getTextFormat().getFont()->info.line_height;
 
         while (true) {
+            if (const auto reusable = findReusableLine(drawCursor);
+                reusable != nullptr && lines.size() < linesCount &&
+                (lineYPosition + (reusable->height() > 0 ? reusable->height() : initHeight)) <=
+                    (h + initialTopPadding)) {
+                if (reusable->height() > 0) {
+                    initHeight = reusable->height();
+                }
+                placeReusableLine(drawCursor, lineXPosition, lineYPosition);
+                lineYPosition += last().height() + linesSpacing;
+                continue;
+            }
+
             auto textLine = gui::MultiTextLine(drawCursor, w, initHeight, underLineProperties);
 
             if ((textLine.height() > 0) && initHeight != textLine.height()) {
@@ -13,12 +13,24 @@ namespace gui
     class Lines
     {
       private:
+        /// Line laid out by the previous draw with the start of the line which followed it
+        struct ReusableLine
+        {
+            TextLine line;
+            TextLineStartContition next;
+        };
+
         Text *text = nullptr;
         std::list<TextLine> lines;
+        std::list<ReusableLine> reusableLines;
+        Length layoutWidth = 0;
         UnderLineProperties underLineProperties;
         unsigned int linesSpacing = 0;
 
         void addToInvisibleLines(TextLine line);
+        void discardReusableLines();
+        [[nodiscard]] auto findReusableLine(const BlockCursor &drawCursor) -> TextLine *;
+        void placeReusableLine(BlockCursor &drawCursor, Position lineXPosition, Position lineYPosition);
 
         auto drawMultiLine(BlockCursor &drawCursor, Length w, Length h, Position lineYPosition, Position lineXPosition)
             -> void;
@@ -44,6 +56,7 @@ namespace gui
         void reset()
         {
             erase();
+            discardReusableLines();
 
             stopCondition = LinesDrawStop::None;
             previousLinesStart.clear();
@@ -165,6 +178,15 @@ namespace gui
         auto linesHAlign(Length parentSize) -> void;
         auto linesVAlign(Length parentSize) -> void;
 
+        /// Keeps lines laid out so far for the next draw, which takes lines starting at the same place in the
+        /// document instead of measuring and building them again. Has to be called right before the draw and only if
+        /// the document wasn't changed in between - otherwise use invalidateFrom().
+        auto keepLayout() -> void;
+        /// Keeps the layout after `shift` characters were added (or removed, if negative) at the position of the
+        /// block, with no blocks added, removed or having their ends changed. The edited line and the one before it,
+        /// which might wrap differently now, are dropped. Lines further in the block are moved by `shift`.
+        auto invalidateFrom(unsigned int blockNumber, unsigned int blockPosition, int shift) -> void;
+
         auto addToPreviousLinesStartList(unsigned int lineStartBlockNumber, unsigned int lineStartBlockPosition)
             -> void;
 
@@ -19,6 +19,7 @@ namespace gui
         widthUsed              = from.widthUsed;
         heightUsed             = from.heightUsed;
         underline              = from.underline;
+        from.underline         = nullptr;
         underLineProperties    = from.underLineProperties;
         lineEnd                = from.lineEnd;
         end                    = from.end;
@@ -126,6 +126,12 @@ namespace gui
             return lineStartBlockPosition;
         }
 
+        /// moves start of the line after characters were added or removed before it in the same block
+        void moveLineStart(int shift) noexcept
+        {
+            lineStartBlockPosition += shift;
+        }
+
         [[nodiscard]] int32_t getX() const noexcept
         {
             return lineContent.front()->area().pos(Axis::X);
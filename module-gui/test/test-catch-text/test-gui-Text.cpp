@@ -99,6 +99,13 @@ namespace gui
         {
             this->expandMode = expandMode;
         }
+
+        void addCharacters(const UTF8 &characters)
+        {
+            for (unsigned int i = 0; i < characters.length(); i++) {
+                addChar(characters[i]);
+            }
+        }
     };
 } // namespace gui
 
@@ -1574,3 +1581,53 @@ TEST_CASE("Text word line breaking tests")
         REQUIRE((*text->lineGet(1)).getText(0) == testStringBlock2);
     }
 }
+
+TEST_CASE("Text incremental lines layout")
+{
+    mockup::fontManager();
+    using namespace gui;
+
+    const auto requireSameLines = [](TestText &edited) {
+        auto redrawn = std::make_unique<gui::TestText>();
+        redrawn->setMaximumSize(edited.area(Area::Max).w, edited.area(Area::Max).h);
+        redrawn->setText(edited.getText());
+
+        REQUIRE(edited.linesSize() == redrawn->linesSize());
+        auto redrawnLine = redrawn->linesGet().begin();
+        for (const auto &line : edited.linesGet()) {
+            REQUIRE(line.getText(0) == redrawnLine->getText(0));
+            REQUIRE(line.isVisible() == redrawnLine->isVisible());
+            REQUIRE(line.getLineStartBlockPosition() == redrawnLine->getLineStartBlockPosition());
+            if (line.isVisible() && line.length() > 0) {
+                REQUIRE(line.getX() == redrawnLine->getX());
+            }
+            ++redrawnLine;
+        }
+    };
+
+    auto text = std::make_unique<gui::TestText>();
+    text->setMaximumSize(150, 600);
+
+    SECTION("Typing at the end")
+    {
+        for (const auto &word : {"Lorem ", "ipsum ", "dolor ", "sit ", "amet, ", "consectetur ", "adipiscing "}) {
+            text->addCharacters(word);
+            requireSameLines(*text);
+        }
+    }
+
+    SECTION("Typing and removing in the middle")
+    {
+        text->setText("Lorem ipsum dolor sit amet, consectetur adipiscing elit, sed do eiusmod tempor");
+        text->moveCursor(NavigationDirection::LEFT, 40);
+
+        for (const auto character : {"x", "y", " ", "z", "LongLongLong", " "}) {
+            text->addCharacters(character);
+            requireSameLines(*text);
+        }
+        for (unsigned int i = 0; i < 20; i++) {
+            text->removeNCharacters(1);
+            requireSameLines(*text);
+        }
+    }
+}
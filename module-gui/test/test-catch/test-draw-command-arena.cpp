@@ -0,0 +1,75 @@
+// Copyright (c) 2017-2023, Mudita Sp. z.o.o. All rights reserved.
+// For licensing, see https://github.com/mudita/MuditaOS/LICENSE.md
+
+#include <catch2/catch.hpp>
+
+#include <module-gui/gui/core/DrawCommandArena.hpp>
+
+#include <cstring>
+#include <vector>
+
+using gui::DrawCommandArena;
+
+TEST_CASE("DrawCommandArena - allocations of a frame share a block")
+{
+    DrawCommandArena arena;
+    std::vector<void *> frame;
+    for (auto i = 0; i < 10; ++i) {
+        auto ptr = arena.allocate(64);
+        REQUIRE(ptr != nullptr);
+        std::memset(ptr, i, 64);
+        frame.push_back(ptr);
+    }
+    REQUIRE(arena.getBlocksCount() == 1);
+
+    for (auto ptr : frame) {
+        arena.deallocate(ptr);
+    }
+    REQUIRE(arena.getBlocksCount() == 1);
+}
+
+TEST_CASE("DrawCommandArena - block reused once the frame is released")
+{
+    DrawCommandArena arena;
+    auto first = arena.allocate(64);
+    arena.deallocate(first);
+    auto second = arena.allocate(64);
+    REQUIRE(second == first);
+    arena.deallocate(second);
+}
+
+TEST_CASE("DrawCommandArena - frames taking more than a block")
+{
+    DrawCommandArena arena;
+    constexpr auto size  = 256;
+    constexpr auto count = 3 * DrawCommandArena::blockSize / size;
+
+    std::vector<void *> frame;
+    for (auto i = 0U; i < count; ++i) {
+        frame.push_back(arena.allocate(size));
+    }
+    const auto blocks = arena.getBlocksCount();
+    REQUIRE(blocks > 1);
+
+    for (auto ptr : frame) {
+        arena.deallocate(ptr);
+    }
+    frame.clear();
+    for (auto i = 0U; i < count; ++i) {
+        frame.push_back(arena.allocate(size));
+    }
+    REQUIRE(arena.getBlocksCount() == blocks);
+    for (auto ptr : frame) {
+        arena.deallocate(ptr);
+    }
+}
+
+TEST_CASE("DrawCommandArena - allocation bigger than a block")
+{
+    DrawCommandArena arena;
+    auto ptr = arena.allocate(2 * DrawCommandArena::blockSize);
+    REQUIRE(ptr != nullptr);
+    std::memset(ptr, 0, 2 * DrawCommandArena::blockSize);
+    REQUIRE(arena.getBlocksCount() == 0);
+    arena.deallocate(ptr);
+}
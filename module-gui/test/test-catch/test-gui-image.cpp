@@ -1,9 +1,9 @@
-// Copyright (c) 2017-2022, Mudita Sp. z.o.o. All rights reserved.
+// Copyright (c) 2017-2023, Mudita Sp. z.o.o. All rights reserved.
 // For licensing, see https://github.com/mudita/MuditaOS/LICENSE.md
 
 #include <catch2/catch.hpp>
 
-#include <list>
+#include <vector>
 
 #include <module-gui/gui/core/DrawCommand.hpp>
 #include <module-gui/gui/core/ImageManager.hpp>
@@ -14,7 +14,7 @@ TEST_CASE("Constructing with empty image name")
     constexpr auto imageName = "";
     gui::Image image{nullptr, imageName};
 
-    std::list<gui::Command> commands;
+    std::vector<gui::Command> commands;
     image.buildDrawListImplementation(commands);
     REQUIRE(commands.empty());
 }
@@ -25,7 +25,7 @@ TEST_CASE("Setting an empty image name")
     gui::Image image{};
     image.set(imageName);
 
-    std::list<gui::Command> commands;
+    std::vector<gui::Command> commands;
     image.buildDrawListImplementation(commands);
     REQUIRE(commands.empty());
 }
@@ -36,7 +36,7 @@ TEST_CASE("Setting an incorrect image name")
     gui::Image image{};
     image.set(imageName);
 
-    std::list<gui::Command> commands;
+    std::vector<gui::Command> commands;
     image.buildDrawListImplementation(commands);
     REQUIRE(!commands.empty());
 }
@@ -47,7 +47,7 @@ TEST_CASE("Setting an incorrect image id")
     gui::Image image{};
     image.set(imageId);
 
-    std::list<gui::Command> commands;
+    std::vector<gui::Command> commands;
     image.buildDrawListImplementation(commands);
     REQUIRE(!commands.empty());
 }
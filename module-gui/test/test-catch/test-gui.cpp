@@ -1,15 +1,18 @@
-﻿// Copyright (c) 2017-2022, Mudita Sp. z.o.o. All rights reserved.
+﻿// Copyright (c) 2017-2023, Mudita Sp. z.o.o. All rights reserved.
 // For licensing, see https://github.com/mudita/MuditaOS/LICENSE.md
 
 /// These are random tests what could be salvaged from old tests
 
 #include "mock/InitializedFontManager.hpp"
 
+#include <cstdint>
 #include <memory>
 #include <functional>
+#include <vector>
 #include <catch2/catch.hpp>
 
 #include <module-gui/gui/core/BoundingBox.hpp>
+#include <module-gui/gui/core/DrawCommand.hpp>
 #include <module-gui/gui/widgets/text/Label.hpp>
 #include <module-gui/gui/widgets/BoxLayout.hpp>
 #include <module-gui/gui/widgets/Image.hpp>
@@ -138,3 +141,26 @@ TEST_CASE("Draw window with box layouts")
 
     hBox->addWidget(maxW3);
 }
+
+TEST_CASE("Draw list of the items tree")
+{
+    auto win = make_unique<gui::TestWindow>("MAIN");
+    win->setSize(480, 600);
+
+    auto parent = new gui::Rect(win.get(), 10, 10, 200, 200);
+    new gui::Rect(parent, 20, 20, 50, 50);
+    auto hidden = new gui::Rect(win.get(), 30, 30, 50, 50);
+    new gui::Rect(win.get(), 40, 40, 50, 50);
+    hidden->setVisible(false);
+
+    const auto commands = win->buildDrawList();
+
+    std::vector<std::int16_t> rectangles;
+    for (const auto &command : commands) {
+        if (dynamic_cast<gui::DrawRectangle *>(command.get()) != nullptr) {
+            rectangles.push_back(command->areaX);
+        }
+    }
+    REQUIRE(dynamic_cast<gui::Clear *>(commands.front().get()) != nullptr);
+    REQUIRE(rectangles == std::vector<std::int16_t>{10, 20, 40});
+}
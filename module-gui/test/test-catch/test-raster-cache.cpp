@@ -0,0 +1,137 @@
+// Copyright (c) 2017-2023, Mudita Sp. z.o.o. All rights reserved.
+// For licensing, see https://github.com/mudita/MuditaOS/LICENSE.md
+
+#include <catch2/catch.hpp>
+
+#include <module-gui/gui/core/RasterCache.hpp>
+
+#include <cstring>
+
+using gui::Context;
+using gui::RasterCache;
+
+namespace
+{
+    constexpr std::uint8_t shape = 0;
+
+    /// Frame of the square, the inside is left untouched
+    void drawFrame(Context *ctx, gui::Point position, gui::Length size)
+    {
+        const auto data   = ctx->getData();
+        const auto width  = ctx->getW();
+        const auto bottom = position.y + size - 1;
+        const auto right  = position.x + size - 1;
+        for (gui::Length i = 0; i < size; ++i) {
+            const auto x = position.x + i;
+            const auto y = position.y + i;
+
+            data[position.y * width + x] = shape;
+            data[bottom * width + x]     = shape;
+            data[y * width + position.x] = shape;
+            data[y * width + right]      = shape;
+        }
+    }
+
+    bool equal(const Context &lhs, const Context &rhs)
+    {
+        return lhs.getW() == rhs.getW() && lhs.getH() == rhs.getH() &&
+               std::memcmp(lhs.getData(), rhs.getData(), lhs.getW() * lhs.getH()) == 0;
+    }
+} // namespace
+
+TEST_CASE("RasterCache - cached shape drawn like the rasterized one")
+{
+    auto &cache = RasterCache::getInstance();
+    cache.clear();
+
+    constexpr gui::Length size = 10;
+    const auto key             = RasterCache::makeKey(RasterCache::Shape::Rectangle, size);
+    auto rasterizations        = 0;
+    const auto rasterize       = [&](Context *raster) {
+        ++rasterizations;
+        drawFrame(raster, {0, 0}, size);
+    };
+
+    Context expected{32, 32};
+    drawFrame(&expected, {5, 7}, size);
+
+    Context first{32, 32};
+    REQUIRE(cache.draw(&first, {5, 7}, key, size, size, rasterize));
+    REQUIRE(equal(first, expected));
+
+    Context second{32, 32};
+    REQUIRE(cache.draw(&second, {5, 7}, key, size, size, rasterize));
+    REQUIRE(equal(second, expected));
+    REQUIRE(rasterizations == 1);
+
+    SECTION("Same shape in another place")
+    {
+        Context moved{32, 32};
+        Context movedExpected{32, 32};
+        drawFrame(&movedExpected, {20, 1}, size);
+        REQUIRE(cache.draw(&moved, {20, 1}, key, size, size, rasterize));
+        REQUIRE(equal(moved, movedExpected));
+        REQUIRE(rasterizations == 1);
+    }
+
+    SECTION("Untouched pixels keep the background")
+    {
+        Context grey{32, 32};
+        grey.fill(9);
+        REQUIRE(cache.draw(&grey, {5, 7}, key, size, size, rasterize));
+        REQUIRE(grey.getPixel({6, 8}) == 9);
+        REQUIRE(grey.getPixel({5, 7}) == shape);
+    }
+
+    SECTION("Shape clipped by the context")
+    {
+        Context clipped{32, 32};
+        Context clippedExpected{32, 32};
+        REQUIRE(cache.draw(&clipped, {-5, 25}, key, size, size, rasterize));
+        clippedExpected.getData()[31 * 32 + 4] = shape;
+        for (auto x = 0; x < 5; ++x) {
+            clippedExpected.getData()[25 * 32 + x] = shape;
+        }
+        for (auto y = 25; y < 32; ++y) {
+            clippedExpected.getData()[y * 32 + 4] = shape;
+        }
+        REQUIRE(equal(clipped, clippedExpected));
+    }
+}
+
+TEST_CASE("RasterCache - keys")
+{
+    REQUIRE(RasterCache::makeKey(RasterCache::Shape::Arc, 10U, 0, 90) ==
+            RasterCache::makeKey(RasterCache::Shape::Arc, 10U, 0, 90));
+    REQUIRE(RasterCache::makeKey(RasterCache::Shape::Arc, 10U, 0, 90) !=
+            RasterCache::makeKey(RasterCache::Shape::Arc, 10U, 0, 91));
+    REQUIRE(RasterCache::makeKey(RasterCache::Shape::Arc, 10U) !=
+            RasterCache::makeKey(RasterCache::Shape::Circle, 10U));
+    REQUIRE(RasterCache::makeKey(RasterCache::Shape::Circle, gui::ColorFullBlack) !=
+            RasterCache::makeKey(RasterCache::Shape::Circle, gui::ColorFullWhite));
+}
+
+TEST_CASE("RasterCache - capacity")
+{
+    auto &cache = RasterCache::getInstance();
+    cache.clear();
+
+    constexpr gui::Length size = 100;
+    const auto fill            = [](Context *raster) { raster->fill(shape); };
+    Context ctx{size, size};
+    for (auto i = 0U; i < 2 * RasterCache::capacity / (size * size); ++i) {
+        REQUIRE(cache.draw(&ctx, {0, 0}, RasterCache::makeKey(RasterCache::Shape::Rectangle, i), size, size, fill));
+        REQUIRE(cache.getSize() <= RasterCache::capacity);
+    }
+    REQUIRE(cache.getRastersCount() < 2 * RasterCache::capacity / (size * size));
+
+    SECTION("Too big shape")
+    {
+        const auto key = RasterCache::makeKey(RasterCache::Shape::Rectangle, 0U);
+        REQUIRE(!cache.draw(&ctx, {0, 0}, key, 1000, 1000, fill));
+    }
+
+    cache.clear();
+    REQUIRE(cache.getSize() == 0);
+    REQUIRE(cache.getRastersCount() == 0);
+}
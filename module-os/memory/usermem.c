@@ -11,6 +11,7 @@
 #include <string.h>
 #include <stdlib.h>
 #include "macros.h"
+#include "usermem.h"
 
 /**
  * Sets heap size in SDRAM
@@ -127,6 +128,59 @@ static size_t xAllocatedMin = SIZE_MAX;
 static size_t xAllocatedMax = 0;
 static size_t xAllocatedSum = 0;
 
+#if (configUSER_HEAP_STATS == 1)
+/* Memory taken by each of the tasks. Allocations of tasks which don't fit in the table are not accounted, slots of
+tasks which freed all their memory are reused. */
+#define USERMEM_TASK_USAGE_SLOTS 48
+static struct usermem_task_usage xTasksUsage[ USERMEM_TASK_USAGE_SLOTS ];
+
+/* Requires the scheduler to be suspended */
+static struct usermem_task_usage *prvFindTaskUsage( TaskHandle_t xTask, BaseType_t xCreate )
+{
+    struct usermem_task_usage *pxFree = NULL;
+    for( size_t i = 0; i < USERMEM_TASK_USAGE_SLOTS; ++i )
+    {
+        if( xTasksUsage[ i ].task == xTask )
+        {
+            return &xTasksUsage[ i ];
+        }
+        if( pxFree == NULL && xTasksUsage[ i ].allocated == 0 )
+        {
+            pxFree = &xTasksUsage[ i ];
+        }
+    }
+    if( xCreate == pdFALSE || pxFree == NULL )
+    {
+        return NULL;
+    }
+    pxFree->task = xTask;
+    pxFree->peak = 0;
+    return pxFree;
+}
+
+static void prvTaskUsageAdd( TaskHandle_t xTask, size_t xSize )
+{
+    struct usermem_task_usage *pxUsage = prvFindTaskUsage( xTask, pdTRUE );
+    if( pxUsage != NULL )
+    {
+        pxUsage->allocated += xSize;
+        if( pxUsage->allocated > pxUsage->peak )
+        {
+            pxUsage->peak = pxUsage->allocated;
+        }
+    }
+}
+
+static void prvTaskUsageRemove( TaskHandle_t xTask, size_t xSize )
+{
+    struct usermem_task_usage *pxUsage = prvFindTaskUsage( xTask, pdFALSE );
+    if( pxUsage != NULL )
+    {
+        pxUsage->allocated -= ( xSize < pxUsage->allocated ) ? xSize : pxUsage->allocated;
+    }
+}
+#endif // configUSER_HEAP_STATS
+
 /* Gets set to the top bit of an size_t type.  When this bit in the xBlockSize
 member of an BlockLink_t structure is set then the block belongs to the
 application.  When the bit is free the block is still part of the free heap
@@ -273,6 +327,7 @@ void *usermalloc(size_t xWantedSize)
 #endif // configUSER_HEAP_EXTENDED_STATS
                         pxBlock->xAllocatingTask = xTaskGetCurrentTaskHandle();
                         pxBlock->xTimeAllocated  = xTaskGetTickCount();
+                        prvTaskUsageAdd( pxBlock->xAllocatingTask, pxBlock->xBlockSize & ~xBlockAllocatedBit );
 #endif // configUSER_HEAP_STATS
 
 #if (PROJECT_CONFIG_HEAP_INTEGRITY_CHECKS != 0)
@@ -374,6 +429,9 @@ void userfree(void *pv)
 
 						/* Add this block to the list of free blocks. */
 						xUserFreeBytesRemaining += pxLink->xBlockSize;
+#if (configUSER_HEAP_STATS == 1)
+						prvTaskUsageRemove( pxLink->xAllocatingTask, pxLink->xBlockSize );
+#endif
 						traceFREE( pv, pxLink->xBlockSize );
 						prvInsertBlockIntoFreeList( ( ( BlockLink_t * ) pxLink ) );
 #if (configUSER_HEAP_STATS == 1 && configUSER_HEAP_EXTENDED_STATS == 1)
@@ -487,6 +545,21 @@ size_t usermemGetAllocatedSum(void)
 	return xAllocatedSum;
 }
 
+size_t usermemGetTasksUsage(struct usermem_task_usage *usage, size_t cap)
+{
+    size_t count = 0;
+#if (configUSER_HEAP_STATS == 1)
+    vTaskSuspendAll();
+    for (size_t i = 0; i < USERMEM_TASK_USAGE_SLOTS && count < cap; ++i) {
+        if (xTasksUsage[i].task != NULL) {
+            usage[count++] = xTasksUsage[i];
+        }
+    }
+    (void)xTaskResumeAll();
+#endif
+    return count;
+}
+
 /*-----------------------------------------------------------*/
 
 static void prvHeapInit( void )
@@ -16,6 +16,14 @@
 extern "C" {
 #endif
 
+/// memory taken from the user heap by a task
+struct usermem_task_usage
+{
+    void *task;       /// handle of the allocating task
+    size_t allocated; /// bytes allocated now
+    size_t peak;      /// the most bytes allocated at once
+};
+
 void *usermalloc(size_t xWantedSize);
 
 void userfree(void *pv);
@@ -31,6 +39,10 @@ size_t usermemGetAllocatedMin(void);
 size_t usermemGetAllocatedMax(void);
 size_t usermemGetAllocatedSum(void);
 
+/// copies usage of up to `cap` tasks to `usage`, returns the number of tasks copied
+/// works only with configUSER_HEAP_STATS enabled
+size_t usermemGetTasksUsage(struct usermem_task_usage *usage, size_t cap);
+
 void *userrealloc(void *pv, size_t xWantedSize);
 
 #ifdef __cplusplus
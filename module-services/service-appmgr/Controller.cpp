@@ -19,6 +19,7 @@ namespace app::manager
         {
             if (data) {
                 data->disableAppClose = (onSwitchBehaviour == OnSwitchBehaviour::RunInBackground);
+                data->forceAppClose   = (onSwitchBehaviour == OnSwitchBehaviour::Close);
             }
         }
     } // namespace
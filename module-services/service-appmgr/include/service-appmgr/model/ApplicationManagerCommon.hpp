@@ -7,6 +7,7 @@
 #include "ApplicationsRegistry.hpp"
 #include "ActionsRegistry.hpp"
 #include "ApplicationStack.hpp"
+#include "WarmApplications.hpp"
 #include <service-appmgr/messages/Message.hpp>
 
 #include <apps-common/ApplicationLauncher.hpp>
@@ -82,7 +83,8 @@ namespace app::manager
       public:
         ApplicationManagerCommon(const ApplicationName &serviceName,
                                  std::vector<std::unique_ptr<app::ApplicationLauncher>> &&launchers,
-                                 const ApplicationName &_rootApplicationName);
+                                 const ApplicationName &_rootApplicationName,
+                                 WarmApplications::Config warmApplicationsConfig = {});
 
         auto InitHandler() -> sys::ReturnCodes override;
         auto DeinitHandler() -> sys::ReturnCodes override;
@@ -103,7 +105,11 @@ namespace app::manager
         }
         auto checkOnBoarding() -> bool;
         virtual void registerMessageHandlers();
-        auto handleSwitchApplication(SwitchRequest *msg, bool closeCurrentlyFocusedApp = true) -> bool;
+        /// @param keepCurrentlyFocusedAppWarm keep the closeable focused application running in the background instead
+        /// of closing it, unless the switch explicitly requested to close it
+        auto handleSwitchApplication(SwitchRequest *msg,
+                                     bool closeCurrentlyFocusedApp    = true,
+                                     bool keepCurrentlyFocusedAppWarm = true) -> bool;
         virtual void handleStart(StartAllowedMessage *msg);
         virtual auto handleActionOnFocusedApp(ActionEntry &action) -> ActionProcessStatus;
         virtual auto handleDisplayLanguageChange(DisplayLanguageChangeRequest *msg) -> bool;
@@ -118,6 +124,10 @@ namespace app::manager
         void startPendingApplicationOnCurrentClose();
         void suspendSystemServices();
         void closeNoLongerNeededApplications();
+        /// Closes the least recently used applications kept in the background if they don't fit in the heap.
+        /// Runs on application switches and once more a while after an application is kept, when the heap taken by
+        /// the next application is known.
+        void trimWarmApplications();
         auto closeApplications() -> bool;
         void closeApplication(ApplicationHandle *application);
         auto getStartingApplication() const noexcept -> ApplicationHandle *;
@@ -140,7 +150,7 @@ namespace app::manager
         /// handles dom request by passing this request to application which should provide the dom
         auto handleDOMRequest(sys::Message *request) -> std::shared_ptr<sys::ResponseMessage>;
 
-        void requestApplicationClose(ApplicationHandle &app, bool isCloseable);
+        void requestApplicationClose(ApplicationHandle &app, bool isCloseable, bool keepWarm = true);
         void onApplicationSwitch(ApplicationHandle &nextApp,
                                  std::unique_ptr<gui::SwitchData> &&data,
                                  std::string targetWindow);
@@ -154,5 +164,8 @@ namespace app::manager
 
         void displayLanguageChanged(std::string value);
         void inputLanguageChanged(std::string value);
+
+        WarmApplications warmApplications;
+        sys::TimerHandle warmApplicationsTimer;
     };
 } // namespace app::manager
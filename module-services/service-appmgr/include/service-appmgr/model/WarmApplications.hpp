@@ -0,0 +1,69 @@
+// Copyright (c) 2017-2023, Mudita Sp. z.o.o. All rights reserved.
+// For licensing, see https://github.com/mudita/MuditaOS/LICENSE.md
+
+#pragma once
+
+#include "ApplicationStack.hpp"
+
+#include <cstddef>
+#include <list>
+#include <vector>
+
+namespace app::manager
+{
+    struct WarmApplicationsConfig
+    {
+        /// Heap the kept applications may use altogether, no application is kept if zero
+        std::size_t heapBudget = 96 * 1024;
+        /// Free heap below which the kept applications are asked to drop their models
+        std::size_t flushThreshold = 64 * 1024;
+        /// Free heap below which the kept applications are closed
+        std::size_t evictThreshold = 32 * 1024;
+    };
+
+    /// Closeable applications the user left recently. They are kept running in the background with their windows, so
+    /// that going back to them doesn't start the service and build the windows again. The least recently used ones are
+    /// closed when the cache outgrows its heap budget or the heap runs low.
+    class WarmApplications
+    {
+      public:
+        using Config = WarmApplicationsConfig;
+
+        explicit WarmApplications(Config config = {});
+
+        [[nodiscard]] auto isEnabled() const noexcept -> bool;
+
+        /// Keeps the application as the most recently used one
+        void touch(const ApplicationName &appName);
+        void remove(const ApplicationName &appName);
+        [[nodiscard]] auto contains(const ApplicationName &appName) const noexcept -> bool;
+
+        /// Updates the heap used by the kept application
+        void setFootprint(const ApplicationName &appName, std::size_t bytes);
+
+        /// Removes the least recently used applications until the rest fits in the budget and the free heap,
+        /// increased by the heap of the removed applications, is above the eviction threshold
+        /// @return applications to be closed, the least recently used first
+        auto evict(std::size_t freeHeap) -> std::vector<ApplicationName>;
+
+        /// Marks the kept applications as flushed if the free heap is below the flush threshold
+        /// @return applications to drop their models, each one is returned once while it's kept
+        auto flush(std::size_t freeHeap) -> std::vector<ApplicationName>;
+
+        [[nodiscard]] auto getApplications() const -> std::vector<ApplicationName>;
+
+      private:
+        struct Entry
+        {
+            ApplicationName appName;
+            std::size_t footprint = 0;
+            bool flushed          = false;
+        };
+
+        [[nodiscard]] auto getFootprint() const noexcept -> std::size_t;
+
+        Config config;
+        /// most recently used first
+        std::list<Entry> entries;
+    };
+} // namespace app::manager
@@ -9,7 +9,9 @@
 #include "Message.hpp"
 
 #include <Service/Message.hpp>
+#include <Service/Telemetry.hpp>
 #include <SystemManager/SystemManagerCommon.hpp>
+#include <Timers/TimerFactory.hpp>
 #include <system/messages/SystemManagerMessage.hpp>
 #include <apps-common/messages/OnBoardingMessages.hpp>
 #include <apps-common/messages/AppMessage.hpp>
@@ -24,6 +26,7 @@
 #include <service-eink/ServiceEink.hpp>
 #include <service-evtmgr/EventManagerCommon.hpp>
 #include <AppWindowConstants.hpp>
+#include <memory/usermem.h>
 
 #include <algorithm>
 #include <utility>
@@ -33,6 +36,8 @@ namespace app::manager
     namespace
     {
         constexpr auto ApplicationManagerStackDepth = 1024 * 5;
+        constexpr auto warmApplicationsTimerName    = "WarmApplicationsTimer";
+        constexpr auto warmHeapCheckDelay           = std::chrono::seconds{5};
 
         bool checkIfCloseableAction(const actions::Action action)
         {
@@ -125,14 +130,18 @@ namespace app::manager
     ApplicationManagerCommon::ApplicationManagerCommon(
         const ApplicationName &serviceName,
         std::vector<std::unique_ptr<app::ApplicationLauncher>> &&launchers,
-        const ApplicationName &_rootApplicationName)
+        const ApplicationName &_rootApplicationName,
+        WarmApplications::Config warmApplicationsConfig)
         : Service{serviceName, {}, ApplicationManagerStackDepth},
           ApplicationManagerBase(std::move(launchers)), rootApplicationName{_rootApplicationName},
           actionsRegistry{[this](ActionEntry &action) { return handleAction(action); }},
-          settings(std::make_shared<settings::Settings>())
+          settings(std::make_shared<settings::Settings>()), warmApplications{warmApplicationsConfig}
     {
         bus.channels.push_back(sys::BusChannel::ServiceAudioNotifications);
         bus.channels.push_back(sys::BusChannel::ServiceDBNotifications);
+
+        warmApplicationsTimer = sys::TimerFactory::createSingleShotTimer(
+            this, warmApplicationsTimerName, warmHeapCheckDelay, [this](sys::Timer &) { trimWarmApplications(); });
     }
 
     sys::ReturnCodes ApplicationManagerCommon::InitHandler()
@@ -347,11 +356,40 @@ namespace app::manager
     void ApplicationManagerCommon::closeNoLongerNeededApplications()
     {
         for (const auto &app : getApplications()) {
-            if (app->started() && app->closeable() && !stack.contains(app->name())) {
+            if (app->started() && app->closeable() && !stack.contains(app->name()) &&
+                !warmApplications.contains(app->name())) {
                 closeApplication(app.get());
                 app->setState(ApplicationHandle::State::DEACTIVATED);
             }
         }
+        trimWarmApplications();
+    }
+
+    void ApplicationManagerCommon::trimWarmApplications()
+    {
+        if (!warmApplications.isEnabled()) {
+            return;
+        }
+        if (warmApplications.getApplications().empty()) {
+            return;
+        }
+
+        for (const auto &task : sys::telemetry::Registry::getHeapStats()) {
+            warmApplications.setFootprint(task.task, task.allocated);
+        }
+        for (const auto &appName : warmApplications.evict(usermemGetFreeHeapSize())) {
+            const auto app = getApplication(appName);
+            if (app == nullptr || !app->started() || !app->closeable() || stack.contains(appName) ||
+                app == getFocusedApplication()) {
+                continue;
+            }
+            LOG_INFO("Closing application %s kept in the background", appName.c_str());
+            closeApplication(app);
+            app->setState(ApplicationHandle::State::DEACTIVATED);
+        }
+        for (const auto &appName : warmApplications.flush(usermemGetFreeHeapSize())) {
+            app::ApplicationCommon::messageFlushModels(this, appName);
+        }
     }
 
     void ApplicationManagerCommon::closeApplication(ApplicationHandle *application)
@@ -366,6 +404,7 @@ namespace app::manager
         else {
             LOG_FATAL("Application %s is still running", application->name().c_str());
         }
+        warmApplications.remove(application->name());
         application->close();
     }
 
@@ -375,7 +414,9 @@ namespace app::manager
         return true;
     }
 
-    auto ApplicationManagerCommon::handleSwitchApplication(SwitchRequest *msg, bool closeCurrentlyFocusedApp) -> bool
+    auto ApplicationManagerCommon::handleSwitchApplication(SwitchRequest *msg,
+                                                           bool closeCurrentlyFocusedApp,
+                                                           bool keepCurrentlyFocusedAppWarm) -> bool
     {
         auto app = getApplication(msg->getName());
         if (app == nullptr) {
@@ -413,7 +454,8 @@ namespace app::manager
             return false;
         }
 
-        requestApplicationClose(*currentlyFocusedApp, isApplicationCloseable(currentlyFocusedApp));
+        requestApplicationClose(
+            *currentlyFocusedApp, isApplicationCloseable(currentlyFocusedApp), keepCurrentlyFocusedAppWarm);
         return true;
     }
 
@@ -430,8 +472,15 @@ namespace app::manager
         nextApp.switchWindow = std::move(targetWindow);
     }
 
-    void ApplicationManagerCommon::requestApplicationClose(ApplicationHandle &app, bool isCloseable)
+    void ApplicationManagerCommon::requestApplicationClose(ApplicationHandle &app, bool isCloseable, bool keepWarm)
     {
+        if (isCloseable && keepWarm && warmApplications.isEnabled()) {
+            // Going back to the application is much faster if it's kept with its windows
+            warmApplications.touch(app.name());
+            // the heap is checked again once the next application has settled, a burst of switches checks it once
+            warmApplicationsTimer.restart(warmHeapCheckDelay);
+            isCloseable = false;
+        }
         if (isCloseable) {
             LOG_INFO("Closing application %s", app.name().c_str());
             setState(State::AwaitingCloseConfirmation);
@@ -566,11 +615,12 @@ namespace app::manager
         // Inform that target app switch is caused by Action
         targetApp->startupReason = StartupReason::OnAction;
 
-        const auto closeFocusedApp = !(actionParams && actionParams->disableAppClose);
+        const auto closeFocusedApp    = !(actionParams && actionParams->disableAppClose);
+        const auto keepFocusedAppWarm = !(actionParams && actionParams->forceAppClose);
 
         SwitchRequest switchRequest(
             service::name::appmgr, targetApp->name(), targetApp->switchWindow, std::move(targetApp->switchData));
-        handleSwitchApplication(&switchRequest, closeFocusedApp);
+        handleSwitchApplication(&switchRequest, closeFocusedApp, keepFocusedAppWarm);
 
         return ActionProcessStatus::Skipped;
     }
@@ -741,6 +791,7 @@ namespace app::manager
     {
         if (getState() == State::AwaitingFocusConfirmation || getState() == State::Running) {
             app.setState(ApplicationHandle::State::ACTIVE_FORGROUND);
+            warmApplications.remove(app.name());
             setState(State::Running);
             EventManagerCommon::messageSetApplication(this, app.name());
             onLaunchFinished(app);
@@ -753,6 +804,7 @@ namespace app::manager
                          launchingApp->name().c_str());
                 app.setState(ApplicationHandle::State::ACTIVE_BACKGROUND);
                 app.switchWindow.clear();
+                trimWarmApplications();
                 startApplication(*launchingApp);
                 return true;
             }
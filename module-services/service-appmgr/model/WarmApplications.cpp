@@ -0,0 +1,96 @@
+// Copyright (c) 2017-2023, Mudita Sp. z.o.o. All rights reserved.
+// For licensing, see https://github.com/mudita/MuditaOS/LICENSE.md
+
+#include "WarmApplications.hpp"
+
+#include <algorithm>
+#include <numeric>
+
+namespace app::manager
+{
+    WarmApplications::WarmApplications(Config config) : config{config}
+    {}
+
+    auto WarmApplications::isEnabled() const noexcept -> bool
+    {
+        return config.heapBudget != 0;
+    }
+
+    void WarmApplications::touch(const ApplicationName &appName)
+    {
+        const auto it = std::find_if(
+            entries.begin(), entries.end(), [&appName](const auto &entry) { return entry.appName == appName; });
+        if (it != entries.end()) {
+            it->flushed = false;
+            entries.splice(entries.begin(), entries, it);
+            return;
+        }
+        entries.push_front(Entry{appName});
+    }
+
+    void WarmApplications::remove(const ApplicationName &appName)
+    {
+        entries.remove_if([&appName](const auto &entry) { return entry.appName == appName; });
+    }
+
+    auto WarmApplications::contains(const ApplicationName &appName) const noexcept -> bool
+    {
+        return std::any_of(
+            entries.begin(), entries.end(), [&appName](const auto &entry) { return entry.appName == appName; });
+    }
+
+    void WarmApplications::setFootprint(const ApplicationName &appName, std::size_t bytes)
+    {
+        for (auto &entry : entries) {
+            if (entry.appName == appName) {
+                entry.footprint = bytes;
+            }
+        }
+    }
+
+    auto WarmApplications::evict(std::size_t freeHeap) -> std::vector<ApplicationName>
+    {
+        std::vector<ApplicationName> evicted;
+        auto footprint = getFootprint();
+        while (!entries.empty() && (footprint > config.heapBudget || freeHeap < config.evictThreshold)) {
+            const auto &entry = entries.back();
+            footprint -= entry.footprint;
+            freeHeap += entry.footprint;
+            evicted.push_back(entry.appName);
+            entries.pop_back();
+        }
+        return evicted;
+    }
+
+    auto WarmApplications::flush(std::size_t freeHeap) -> std::vector<ApplicationName>
+    {
+        std::vector<ApplicationName> flushed;
+        if (freeHeap >= config.flushThreshold) {
+            return flushed;
+        }
+        for (auto &entry : entries) {
+            if (!entry.flushed) {
+                entry.flushed = true;
+                flushed.push_back(entry.appName);
+            }
+        }
+        return flushed;
+    }
+
+    auto WarmApplications::getApplications() const -> std::vector<ApplicationName>
+    {
+        std::vector<ApplicationName> names;
+        names.reserve(entries.size());
+        for (const auto &entry : entries) {
+            names.push_back(entry.appName);
+        }
+        return names;
+    }
+
+    auto WarmApplications::getFootprint() const noexcept -> std::size_t
+    {
+        return std::accumulate(entries.begin(), entries.end(), std::size_t{0}, [](auto sum, const auto &entry) {
+            return sum + entry.footprint;
+        });
+    }
+} // namespace app::manager
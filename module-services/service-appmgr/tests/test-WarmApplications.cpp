@@ -0,0 +1,108 @@
+// Copyright (c) 2017-2023, Mudita Sp. z.o.o. All rights reserved.
+// For licensing, see https://github.com/mudita/MuditaOS/LICENSE.md
+
+#include <catch2/catch.hpp>
+
+#include <service-appmgr/model/WarmApplications.hpp>
+
+using namespace app::manager;
+
+namespace
+{
+    constexpr WarmApplications::Config config{1000, 500, 200};
+    constexpr auto plentyOfHeap = 10000;
+} // namespace
+
+TEST_CASE("WarmApplications - touch")
+{
+    WarmApplications warm{config};
+    REQUIRE(warm.isEnabled());
+
+    SECTION("Most recently used first")
+    {
+        warm.touch("A");
+        warm.touch("B");
+        REQUIRE(warm.getApplications() == std::vector<ApplicationName>{"B", "A"});
+    }
+    SECTION("Touching again moves to the front")
+    {
+        warm.touch("A");
+        warm.touch("B");
+        warm.touch("A");
+        REQUIRE(warm.getApplications() == std::vector<ApplicationName>{"A", "B"});
+    }
+    SECTION("Remove")
+    {
+        warm.touch("A");
+        warm.touch("B");
+        warm.remove("A");
+        REQUIRE_FALSE(warm.contains("A"));
+        REQUIRE(warm.contains("B"));
+    }
+}
+
+TEST_CASE("WarmApplications - disabled")
+{
+    WarmApplications warm{{0, 0, 0}};
+    REQUIRE_FALSE(warm.isEnabled());
+}
+
+TEST_CASE("WarmApplications - evict")
+{
+    WarmApplications warm{config};
+    warm.touch("A");
+    warm.touch("B");
+    warm.touch("C");
+
+    SECTION("Fits in the budget")
+    {
+        warm.setFootprint("A", 300);
+        warm.setFootprint("B", 300);
+        warm.setFootprint("C", 300);
+        REQUIRE(warm.evict(plentyOfHeap).empty());
+    }
+    SECTION("Over the budget")
+    {
+        warm.setFootprint("A", 400);
+        warm.setFootprint("B", 400);
+        warm.setFootprint("C", 400);
+        REQUIRE(warm.evict(plentyOfHeap) == std::vector<ApplicationName>{"A"});
+        REQUIRE(warm.getApplications() == std::vector<ApplicationName>{"C", "B"});
+    }
+    SECTION("Heap running low")
+    {
+        warm.setFootprint("A", 50);
+        warm.setFootprint("B", 50);
+        warm.setFootprint("C", 50);
+        REQUIRE(warm.evict(120) == std::vector<ApplicationName>{"A", "B"});
+        REQUIRE(warm.getApplications() == std::vector<ApplicationName>{"C"});
+    }
+    SECTION("Heap exhausted")
+    {
+        REQUIRE(warm.evict(0).size() == 3);
+        REQUIRE(warm.getApplications().empty());
+    }
+}
+
+TEST_CASE("WarmApplications - flush")
+{
+    WarmApplications warm{config};
+    warm.touch("A");
+    warm.touch("B");
+
+    SECTION("Enough heap")
+    {
+        REQUIRE(warm.flush(plentyOfHeap).empty());
+    }
+    SECTION("Flushed once")
+    {
+        REQUIRE(warm.flush(300) == std::vector<ApplicationName>{"B", "A"});
+        REQUIRE(warm.flush(300).empty());
+    }
+    SECTION("Flushed again after being used")
+    {
+        warm.flush(300);
+        warm.touch("A");
+        REQUIRE(warm.flush(300) == std::vector<ApplicationName>{"A"});
+    }
+}
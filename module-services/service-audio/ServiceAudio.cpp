@@ -425,6 +425,17 @@ std::unique_ptr<AudioResponseMessage> ServiceAudio::HandleStart(const Operation:
     };
 
     if (opType == Operation::Type::Playback) {
+        // short sounds are mixed into the music instead of interrupting it
+        if (const auto mixingInput = audioMux.GetMixingInput(playbackType);
+            mixingInput && IsOperationEnabled(playbackType, opType)) {
+            const auto soundToken = audioMux.ResetInput();
+            if ((*mixingInput)->audio->Mix(fileName, playbackType, soundToken) == audio::RetCode::Success) {
+                mixedSounds.push_back(MixedSound{soundToken, (*mixingInput)->token, playbackType});
+                VibrationUpdate(playbackType);
+                return std::make_unique<AudioStartPlaybackResponse>(audio::RetCode::Success, soundToken);
+            }
+        }
+
         auto input = audioMux.GetPlaybackInput(playbackType);
 
         if (playbackType == audio::PlaybackType::CallRingtone && bluetoothVoiceProfileConnected && input) {
@@ -508,7 +519,10 @@ std::unique_ptr<AudioResponseMessage> ServiceAudio::HandleStop(const std::vector
     std::vector<std::pair<Token, audio::RetCode>> retCodes;
 
     // stop by token
-    if (const auto tokenInput = audioMux.GetInput(token); token.IsValid() && tokenInput) {
+    if (token.IsValid() && StopMixedSound(token) == audio::RetCode::Success) {
+        retCodes.emplace_back(token, audio::RetCode::Success);
+    }
+    else if (const auto tokenInput = audioMux.GetInput(token); token.IsValid() && tokenInput) {
         retCodes.emplace_back(std::make_pair(token, StopInput(tokenInput.value())));
     }
     else if (token.IsValid()) {
@@ -523,6 +537,16 @@ std::unique_ptr<AudioResponseMessage> ServiceAudio::HandleStop(const std::vector
                 retCodes.emplace_back(t, StopInput(&input));
             }
         }
+
+        std::vector<Token> mixedTokens;
+        for (const auto &sound : mixedSounds) {
+            if (std::find(stopTypes.begin(), stopTypes.end(), sound.playbackType) != stopTypes.end()) {
+                mixedTokens.push_back(sound.token);
+            }
+        }
+        for (const auto &t : mixedTokens) {
+            retCodes.emplace_back(t, StopMixedSound(t));
+        }
     }
     // stop all audio
     else if (token.IsUninitialized()) {
@@ -563,15 +587,58 @@ auto ServiceAudio::StopInput(audio::AudioMux::Input *input, StopReason stopReaso
         msg = std::make_shared<AudioStopNotification>(input->token);
     }
     bus.sendMulticast(std::move(msg), sys::BusChannel::ServiceAudioNotifications);
+    StopMixedSounds(input->token);
     audioMux.ResetInput(input);
     VibrationUpdate();
     return rCode;
 }
 
+auto ServiceAudio::StopMixedSound(audio::Token token, StopReason stopReason) -> audio::RetCode
+{
+    const auto mixedSound = std::find_if(
+        mixedSounds.begin(), mixedSounds.end(), [&token](const auto &sound) { return sound.token == token; });
+    if (mixedSound == mixedSounds.end()) {
+        return audio::RetCode::TokenNotFound;
+    }
+
+    std::shared_ptr<AudioNotificationMessage> msg;
+    if (stopReason == StopReason::Eof) {
+        msg = std::make_shared<AudioEOFNotification>(token);
+    }
+    else {
+        // the sound might have ended in the meantime, its end of file message is dropped then
+        if (const auto input = audioMux.GetInput(mixedSound->playbackToken); input) {
+            (*input)->audio->StopMixing(token);
+        }
+        msg = std::make_shared<AudioStopNotification>(token);
+    }
+    bus.sendMulticast(std::move(msg), sys::BusChannel::ServiceAudioNotifications);
+    mixedSounds.erase(mixedSound);
+    VibrationUpdate();
+    return audio::RetCode::Success;
+}
+
+void ServiceAudio::StopMixedSounds(const audio::Token &playbackToken)
+{
+    // sounds end together with the playback they are mixed into
+    const auto isMixedInto = [&playbackToken](const auto &sound) { return sound.playbackToken == playbackToken; };
+    for (const auto &sound : mixedSounds) {
+        if (isMixedInto(sound)) {
+            bus.sendMulticast(std::make_shared<AudioStopNotification>(sound.token),
+                              sys::BusChannel::ServiceAudioNotifications);
+        }
+    }
+    mixedSounds.erase(std::remove_if(mixedSounds.begin(), mixedSounds.end(), isMixedInto), mixedSounds.end());
+}
+
 void ServiceAudio::HandleEOF(const Token &token)
 {
+    if (StopMixedSound(token, StopReason::Eof) == audio::RetCode::Success) {
+        return;
+    }
     if (const auto input = audioMux.GetInput(token); input) {
         if (ShouldLoop((*input)->audio->GetCurrentOperationPlaybackType())) {
+            StopMixedSounds(token);
             (*input)->audio->Start();
             if ((*input)->audio->IsMuted()) {
                 (*input)->audio->Mute();
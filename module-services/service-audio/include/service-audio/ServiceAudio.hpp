@@ -13,6 +13,7 @@
 #include <Service/Service.hpp>
 
 #include <functional>
+#include <vector>
 
 namespace settings
 {
@@ -55,6 +56,15 @@ class ServiceAudio : public sys::Service
     bool bluetoothA2DPConnected         = false;
     bool bluetoothVoiceProfileConnected = false;
 
+    /// Short sound mixed into the playback of another input, it has a token of its own
+    struct MixedSound
+    {
+        audio::Token token;
+        audio::Token playbackToken;
+        audio::PlaybackType playbackType;
+    };
+    std::vector<MixedSound> mixedSounds;
+
     std::map<VibrationType, std::list<audio::PlaybackType>> vibrationMap = {
         {VibrationType::None, {}},
         {VibrationType::Continuous, {audio::PlaybackType::CallRingtone, audio::PlaybackType::Alarm}},
@@ -84,6 +94,8 @@ class ServiceAudio : public sys::Service
     };
 
     auto StopInput(audio::AudioMux::Input *input, StopReason stopReason = StopReason::Other) -> audio::RetCode;
+    auto StopMixedSound(audio::Token token, StopReason stopReason = StopReason::Other) -> audio::RetCode;
+    void StopMixedSounds(const audio::Token &playbackToken);
     auto HandleSendEvent(std::shared_ptr<audio::Event> evt) -> std::unique_ptr<AudioResponseMessage>;
     auto HandlePause(const audio::Token &token) -> std::unique_ptr<AudioResponseMessage>;
     auto HandlePause(std::optional<audio::AudioMux::Input *> input) -> std::unique_ptr<AudioResponseMessage>;
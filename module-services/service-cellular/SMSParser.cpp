@@ -1,4 +1,4 @@
-// Copyright (c) 2017-2022, Mudita Sp. z.o.o. All rights reserved.
+// Copyright (c) 2017-2023, Mudita Sp. z.o.o. All rights reserved.
 // For licensing, see https://github.com/mudita/MuditaOS/LICENSE.md
 
 #include "SMSParser.hpp"
@@ -8,8 +8,10 @@
 
 #include <algorithm>
 #include <ctime>
+#include <iterator>
 #include <map>
 #include <sstream>
+#include <string_view>
 #include <unordered_map>
 #include <vector>
 
@@ -18,6 +20,7 @@ namespace SMSParser
     namespace
     {
         static constexpr auto SMSReadMsgName        = "QCMGR";
+        static constexpr std::string_view SMSListMsgName{"+CMGL: "};
         static constexpr auto SingleMessageLength   = 5;
         static constexpr auto MultipleMessageLength = 8;
 
@@ -111,4 +114,29 @@ namespace SMSParser
         return std::time(nullptr);
     }
 
+    std::vector<std::uint32_t> getListedIndexes(const std::vector<std::string> &response)
+    {
+        /*
+         * Every message is listed in two lines, the header and the text:
+         * +CMGL: <index>,<stat>,<oa/da>,[<alpha>],[<scts>]
+         */
+        std::vector<std::uint32_t> indexes;
+        for (auto line = response.begin(); line != response.end(); ++line) {
+            if (line->compare(0, SMSListMsgName.size(), SMSListMsgName) != 0) {
+                continue;
+            }
+            try {
+                indexes.push_back(std::stoul(line->substr(SMSListMsgName.size())));
+                // the text may look like a header as well
+                if (std::next(line) != response.end()) {
+                    ++line;
+                }
+            }
+            catch (const std::exception &e) {
+                LOG_ERROR("Parse SMS list error %s", e.what());
+            }
+        }
+        return indexes;
+    }
+
 } // namespace SMSParser
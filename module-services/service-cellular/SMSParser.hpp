@@ -1,4 +1,4 @@
-// Copyright (c) 2017-2022, Mudita Sp. z.o.o. All rights reserved.
+// Copyright (c) 2017-2023, Mudita Sp. z.o.o. All rights reserved.
 // For licensing, see https://github.com/mudita/MuditaOS/LICENSE.md
 
 #include <utf8/UTF8.hpp>
@@ -6,6 +6,7 @@
 #include <cstdint>
 #include <string>
 #include <ctime>
+#include <vector>
 
 namespace SMSParser
 {
@@ -13,4 +14,7 @@ namespace SMSParser
     std::string getMessage();
     UTF8 getNumber();
     time_t getTime();
+
+    /// Indexes of the messages listed in the response to AT+CMGL
+    std::vector<std::uint32_t> getListedIndexes(const std::vector<std::string> &response);
 }; // namespace SMSParser
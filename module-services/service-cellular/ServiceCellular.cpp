@@ -118,6 +118,8 @@ namespace constants
     inline constexpr std::chrono::milliseconds sleepTimerInterval{500ms};
     inline constexpr std::chrono::milliseconds maxUrcHandleTime{5s};
     inline constexpr std::chrono::milliseconds maxTimeWithoutCommunication{1s};
+    /// Time the +CMTI notifications are collected for before all the messages are read at once
+    inline constexpr std::chrono::milliseconds smsBatchWindow{300ms};
 } // namespace constants
 
 ServiceCellular::ServiceCellular()
@@ -156,6 +158,8 @@ ServiceCellular::ServiceCellular()
     simTimer = sys::TimerFactory::createSingleShotTimer(
         this, "simTimer", std::chrono::milliseconds{6000}, [this](sys::Timer &) { priv->simCard->handleSimTimer(); });
 
+    smsBatchTimer = sys::TimerFactory::createSingleShotTimer(
+        this, "smsBatch", constants::smsBatchWindow, [this](sys::Timer &) { receivePendingSMS(); });
     csqTimer =
         sys::TimerFactory::createPeriodicTimer(this, "csqPollingTimer", std::chrono::minutes{15}, [this](sys::Timer &) {
             priv->csqHandler->handleTimerTick();
@@ -432,7 +436,7 @@ void ServiceCellular::registerMessageHandlers()
 
     connect(typeid(cellular::NewIncomingSMSMessage), [&](sys::Message *request) -> sys::MessagePointer {
         auto msg = static_cast<cellular::NewIncomingSMSMessage *>(request);
-        auto ret = receiveSMS(msg->getData());
+        auto ret = queueIncomingSMS(msg->getData());
         return std::make_shared<cellular::ResponseMessage>(ret);
     });
 
@@ -970,12 +974,10 @@ std::optional<std::shared_ptr<sys::Message>> ServiceCellular::identifyNotificati
 
     CellularUrcHandler urcHandler(*this);
 
-    const std::string str(data.begin(), data.end());
-
-    const std::string logStr = utils::removeNewLines(str);
+    const std::string logStr = utils::removeNewLines(data);
     LOG_SENSITIVE(LOGDEBUG, "Notification:: %s", logStr.c_str());
 
-    auto urc = at::urc::UrcFactory::Create(str);
+    auto urc = at::urc::UrcFactory::Create(data);
     urc->Handle(urcHandler);
 
     if (!urc->isHandled()) {
@@ -990,43 +992,15 @@ std::string numberFromAddress(std::string const &address)
     return utils::endsWith(address, "/TYPE=PLMN") ? address.substr(0, address.size() - 10) : std::string();
 }
 
-auto ServiceCellular::receiveSMS(std::string messageNumber) -> bool
+auto ServiceCellular::readSMS(DLCChannel &channel, const std::string &messageNumber, std::vector<SMSRecord> &records)
+    -> bool
 {
-    auto retVal = true;
-
-    auto channel = cmux->get(CellularMux::Channel::Commands);
-    if (channel == nullptr) {
-        retVal = false;
-        return retVal;
-    }
-
-    auto ucscSetRetries = 0;
-    while (ucscSetRetries < at::AtCmdMaxRetries) {
-        if (!channel->cmd(at::AT::SMS_UCSC2)) {
-            ++ucscSetRetries;
-            LOG_ERROR("Could not set UCS2 charset mode for TE. Retry %d", ucscSetRetries);
-        }
-        else {
-            break;
-        }
-    }
-    auto _ = gsl::finally([&channel, &retVal, &messageNumber] {
-        if (!channel->cmd(at::AT::SMS_GSM)) {
-            LOG_ERROR("Could not set GSM (default) charset mode for TE");
-        }
-
-        // delete message from modem memory
-        if (retVal && !channel->cmd(at::factory(at::AT::CMGD) + messageNumber)) {
-            LOG_ERROR("Could not delete SMS from modem");
-        }
-    });
-
     const auto &cmd = at::factory(at::AT::QCMGR);
     at::Result rawMessage;
     auto qcmgrRetries = 0;
 
     while (qcmgrRetries < at::AtCmdMaxRetries) {
-        rawMessage = channel->cmd(cmd + messageNumber, cmd.getTimeout());
+        rawMessage = channel.cmd(cmd + messageNumber, cmd.getTimeout());
         if (!rawMessage) {
             ++qcmgrRetries;
             LOG_ERROR("Could not read text message. Retry %d", qcmgrRetries);
@@ -1062,6 +1036,7 @@ auto ServiceCellular::receiveSMS(std::string messageNumber) -> bool
     }
 
     for (std::size_t i = 0; i < receivedMessages; i++) {
+        // Parts of concatenated messages are kept by the parser until the last one is read
         const auto messageParsed = SMSParser::parse(&rawMessage.response[i]);
         if (messageParsed) {
             UTF8 decodedMessage;
@@ -1074,8 +1049,7 @@ auto ServiceCellular::receiveSMS(std::string messageNumber) -> bool
             }
             catch (const std::exception &e) {
                 LOG_ERROR("Decoded SMS: %s", e.what());
-                retVal = false;
-                break;
+                return false;
             }
             const auto mmsNotificationOpt = pdu::parse(decodedStr);
             if (mmsNotificationOpt) {
@@ -1090,15 +1064,79 @@ auto ServiceCellular::receiveSMS(std::string messageNumber) -> bool
             }
             smsMessage.clear();
 
-            auto messageDate  = SMSParser::getTime();
-            const auto record = createSMSRecord(decodedMessage, smsNumber, messageDate);
+            auto messageDate = SMSParser::getTime();
+            records.push_back(createSMSRecord(decodedMessage, smsNumber, messageDate));
+        }
+    }
+    return true;
+}
+
+auto ServiceCellular::receivePendingSMS() -> bool
+{
+    auto indexes = std::move(pendingSMSIndexes);
+    pendingSMSIndexes.clear();
 
-            if (!dbAddSMSRecord(record)) {
-                LOG_ERROR("Failed to add text message to db");
-                retVal = false;
-                break;
-            }
+    auto channel = cmux->get(CellularMux::Channel::Commands);
+    if (channel == nullptr) {
+        return false;
+    }
+
+    auto ucscSetRetries = 0;
+    while (ucscSetRetries < at::AtCmdMaxRetries) {
+        if (!channel->cmd(at::AT::SMS_UCSC2)) {
+            ++ucscSetRetries;
+            LOG_ERROR("Could not set UCS2 charset mode for TE. Retry %d", ucscSetRetries);
+        }
+        else {
+            break;
+        }
+    }
+    auto _ = gsl::finally([&channel] {
+        if (!channel->cmd(at::AT::SMS_GSM)) {
+            LOG_ERROR("Could not set GSM (default) charset mode for TE");
         }
+    });
+
+    // Messages which came without a notification, e.g. while the modem was being configured, are read as well
+    if (auto ret = channel->cmd(at::AT::LIST_MESSAGES)) {
+        const auto listed = SMSParser::getListedIndexes(ret.response);
+        indexes.insert(listed.begin(), listed.end());
+    }
+    else {
+        LOG_ERROR("Could not list text messages, reading the notified ones");
+    }
+    for (const auto index : storingSMSIndexes) {
+        indexes.erase(index);
+    }
+    if (indexes.empty()) {
+        return true;
+    }
+
+    auto retVal = true;
+    std::vector<SMSRecord> records;
+    // Indexes of the parts of every record, a message is deleted from the modem only once its record is stored
+    std::vector<std::vector<std::uint32_t>> recordsIndexes;
+    std::vector<std::uint32_t> partsIndexes;
+    for (const auto index : indexes) {
+        const auto recordsCount = records.size();
+        if (!readSMS(*channel, std::to_string(index), records)) {
+            // AT+CMGL marks the message as read, but it's kept in the modem memory and listed with the next batch
+            LOG_WARN("Cannot receive text message %" PRIu32, index);
+            retVal = false;
+            continue;
+        }
+        partsIndexes.push_back(index);
+        if (records.size() != recordsCount) {
+            recordsIndexes.resize(records.size());
+            recordsIndexes.back() = std::move(partsIndexes);
+            partsIndexes.clear();
+        }
+    }
+    LOG_INFO("Received %zu text messages in %zu parts", records.size(), indexes.size());
+
+    if (!records.empty() && !dbAddSMSRecords(std::move(records), std::move(recordsIndexes))) {
+        LOG_ERROR("Failed to add text messages to db");
+        retVal = false;
     }
     return retVal;
 }
@@ -1416,17 +1454,100 @@ SMSRecord ServiceCellular::createSMSRecord(const UTF8 &decodedMessage,
     return record;
 }
 
-bool ServiceCellular::dbAddSMSRecord(const SMSRecord &record)
+bool ServiceCellular::dbAddSMSRecord(const SMSRecord &record, std::vector<std::uint32_t> modemIndexes)
 {
-    return DBServiceAPI::AddSMS(
-        this, record, db::QueryCallback::fromFunction([this, number = record.number](auto response) {
+    storingSMSIndexes.insert(modemIndexes.begin(), modemIndexes.end());
+    const auto added = DBServiceAPI::AddSMS(
+        this,
+        record,
+        db::QueryCallback::fromFunction([this, number = record.number, modemIndexes](auto response) {
+            for (const auto index : modemIndexes) {
+                storingSMSIndexes.erase(index);
+            }
             auto result = dynamic_cast<db::query::SMSAddResult *>(response);
             if (result == nullptr || !result->result) {
                 return false;
             }
+            deleteSMSFromModem(modemIndexes);
             onSMSReceived(number);
             return true;
         }));
+    if (!added) {
+        for (const auto index : modemIndexes) {
+            storingSMSIndexes.erase(index);
+        }
+    }
+    return added;
+}
+
+bool ServiceCellular::dbAddSMSRecords(std::vector<SMSRecord> records,
+                                      std::vector<std::vector<std::uint32_t>> modemIndexes)
+{
+    std::vector<utils::PhoneNumber::View> numbers;
+    numbers.reserve(records.size());
+    for (const auto &record : records) {
+        numbers.push_back(record.number);
+    }
+    std::vector<std::uint32_t> allIndexes;
+    for (const auto &indexes : modemIndexes) {
+        allIndexes.insert(allIndexes.end(), indexes.begin(), indexes.end());
+    }
+
+    storingSMSIndexes.insert(allIndexes.begin(), allIndexes.end());
+    const auto added = DBServiceAPI::AddSMSBatch(
+        this,
+        records,
+        db::QueryCallback::fromFunction([this,
+                                         records,
+                                         numbers      = std::move(numbers),
+                                         modemIndexes = std::move(modemIndexes),
+                                         allIndexes](auto response) {
+            for (const auto index : allIndexes) {
+                storingSMSIndexes.erase(index);
+            }
+            auto result = dynamic_cast<db::query::SMSAddBatchResult *>(response);
+            if (result == nullptr || !result->succeed()) {
+                // Nothing of the batch is stored, every message is deleted from the modem once its record is added
+                LOG_ERROR("Failed to add %zu text messages at once, adding one by one", records.size());
+                for (std::size_t i = 0; i < records.size(); ++i) {
+                    dbAddSMSRecord(records[i], modemIndexes[i]);
+                }
+                return false;
+            }
+            deleteSMSFromModem(allIndexes);
+            onSMSReceived(numbers);
+            return true;
+        }));
+    if (!added) {
+        for (const auto index : allIndexes) {
+            storingSMSIndexes.erase(index);
+        }
+    }
+    return added;
+}
+
+void ServiceCellular::deleteSMSFromModem(const std::vector<std::uint32_t> &indexes)
+{
+    auto channel = cmux->get(CellularMux::Channel::Commands);
+    if (channel == nullptr) {
+        return;
+    }
+    for (const auto index : indexes) {
+        if (!channel->cmd(at::factory(at::AT::CMGD) + std::to_string(index))) {
+            LOG_ERROR("Could not delete SMS %" PRIu32 " from modem", index);
+        }
+    }
+}
+
+void ServiceCellular::onSMSReceived(const std::vector<utils::PhoneNumber::View> &numbers)
+{
+    DBServiceAPI::GetQuery(
+        this,
+        db::Interface::Name::Notifications,
+        std::make_unique<db::query::notifications::MultipleIncrement>(NotificationsRecord::Key::Sms, numbers));
+
+    bus.sendMulticast(std::make_shared<cellular::IncomingSMSNotificationMessage>(),
+                      sys::BusChannel::ServiceCellularNotifications);
 }
 
 void ServiceCellular::onSMSReceived(const utils::PhoneNumber::View &number)
@@ -1440,29 +1561,26 @@ void ServiceCellular::onSMSReceived(const utils::PhoneNumber::View &number)
                       sys::BusChannel::ServiceCellularNotifications);
 }
 
-bool ServiceCellular::receiveAllMessages()
+bool ServiceCellular::queueIncomingSMS(const std::string &messageNumber)
 {
-    auto channel = cmux->get(CellularMux::Channel::Commands);
-    if (channel == nullptr) {
+    int index = 0;
+    if (!utils::toNumeric(messageNumber, index) || index < 0) {
+        LOG_ERROR("Invalid text message index");
         return false;
     }
 
-    constexpr std::string_view cmd = "CMGL: ";
-    if (auto ret = channel->cmd(at::AT::LIST_MESSAGES)) {
-        for (std::size_t i = 0; i < ret.response.size(); i++) {
-            if (auto pos = ret.response[i].find(cmd); pos != std::string::npos) {
-                auto startPos = pos + cmd.size();
-                auto endPos   = ret.response[i].find_first_of(',');
-                if (receiveSMS(ret.response[i].substr(startPos, endPos - startPos))) {
-                    LOG_WARN("Cannot receive text message - %" PRIu32 " / %" PRIu32,
-                             static_cast<std::uint32_t>(i),
-                             static_cast<std::uint32_t>(ret.response.size()));
-                }
-            }
-        }
-        return true;
+    pendingSMSIndexes.insert(static_cast<std::uint32_t>(index));
+    // The window isn't extended by the following notifications, so a long burst is read in several batches
+    if (!smsBatchTimer.isActive()) {
+        smsBatchTimer.start();
     }
-    return false;
+    return true;
+}
+
+bool ServiceCellular::receiveAllMessages()
+{
+    smsBatchTimer.stop();
+    return receivePendingSMS();
 }
 
 bool ServiceCellular::handle_failure()
@@ -32,6 +32,7 @@
 
 #include <optional> // for optional
 #include <memory>   // for unique_ptr, allocator, make_unique, shared_ptr
+#include <set>      // for set
 #include <string>   // for string
 #include <vector>   // for vector
 #include <cstdint>
@@ -118,6 +119,12 @@ class ServiceCellular : public sys::Service
     // used to manage network connection in Messages only mode
     sys::TimerHandle connectionTimer;
 
+    // used to read the incoming text messages in batches
+    sys::TimerHandle smsBatchTimer;
+    std::set<std::uint32_t> pendingSMSIndexes;
+    /// Messages read from the modem and being stored, they are left out of the next batches until deleted
+    std::set<std::uint32_t> storingSMSIndexes;
+
     std::unique_ptr<settings::Settings> settings;
 
     void SleepTimerHandler();
@@ -195,8 +202,14 @@ class ServiceCellular : public sys::Service
                                             const UTF8 &receivedNumber,
                                             const time_t messageDate,
                                             const SMSType &smsType = SMSType::INBOX) const noexcept;
-    bool dbAddSMSRecord(const SMSRecord &record);
+    /// The messages are deleted from the modem memory once the records are stored
+    bool dbAddSMSRecord(const SMSRecord &record, std::vector<std::uint32_t> modemIndexes = {});
+    bool dbAddSMSRecords(std::vector<SMSRecord> records, std::vector<std::vector<std::uint32_t>> modemIndexes);
+    void deleteSMSFromModem(const std::vector<std::uint32_t> &indexes);
     void onSMSReceived(const utils::PhoneNumber::View &number);
+    void onSMSReceived(const std::vector<utils::PhoneNumber::View> &numbers);
+    /// Queues the message notified with +CMTI, it's read along with the others once the batch window elapses
+    bool queueIncomingSMS(const std::string &messageNumber);
     [[nodiscard]] bool receiveAllMessages();
     /// @}
 
@@ -285,7 +298,10 @@ class ServiceCellular : public sys::Service
     auto handleCellularCallerIdNotification(sys::Message *msg) -> std::shared_ptr<sys::ResponseMessage>;
     auto handleCellularSetConnectionFrequencyMessage(sys::Message *msg) -> std::shared_ptr<sys::ResponseMessage>;
 
-    auto receiveSMS(std::string messageNumber) -> bool;
+    /// Reads all the messages waiting in the modem memory and stores them in a single transaction
+    auto receivePendingSMS() -> bool;
+    /// Reads the message, the record is added once all parts of a concatenated message are read
+    auto readSMS(DLCChannel &channel, const std::string &messageNumber, std::vector<SMSRecord> &records) -> bool;
 
     auto hangUpCallBusy() -> bool;
 
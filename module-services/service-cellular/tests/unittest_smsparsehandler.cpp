@@ -1,4 +1,4 @@
-// Copyright (c) 2017-2022, Mudita Sp. z.o.o. All rights reserved.
+// Copyright (c) 2017-2023, Mudita Sp. z.o.o. All rights reserved.
 // For licensing, see https://github.com/mudita/MuditaOS/LICENSE.md
 
 #include <catch2/catch.hpp>
@@ -352,4 +352,18 @@ TEST_CASE("SMSParseHandler functionality")
             }
         }
     }
+
+    SECTION("List messages")
+    {
+        std::vector<std::string> resp;
+        resp.emplace_back(R"(+CMGL: 3,"REC UNREAD","+48123456789",,"22/09/16,14:49:11+08")");
+        resp.emplace_back("Lorem ipsum dolor sit amet");
+        resp.emplace_back(R"(+CMGL: 12,"REC READ","+48123456789",,"22/09/16,14:50:02+08")");
+        resp.emplace_back("+CMGL: 5 is not a header when it is the text of the message");
+        resp.emplace_back(R"(+CMGL: 7,"REC UNREAD","+12998877661",,"22/09/16,14:51:40+08")");
+        resp.emplace_back("consectetur adipiscing elit");
+
+        REQUIRE(SMSParser::getListedIndexes(resp) == std::vector<std::uint32_t>{3, 12, 7});
+        REQUIRE(SMSParser::getListedIndexes({}).empty());
+    }
 }
@@ -283,11 +283,14 @@ auto DBServiceAPI::CalllogUpdate(sys::Service *serv, const CalllogRecord &rec) -
     return ((ret.first == sys::ReturnCodes::Success) && (calllogResponse->retCode != 0));
 }
 
-auto DBServiceAPI::DBPrepareSyncPackage(sys::Service *serv, const std::string &syncPackagePath) -> bool
+auto DBServiceAPI::DBPrepareSyncPackage(sys::Service *serv,
+                                        const std::string &syncPackagePath,
+                                        const db::sync::Tokens &syncTokens) -> bool
 {
     LOG_INFO("DBPrepareSyncPackage %s", syncPackagePath.c_str());
 
-    auto msg = std::make_shared<DBServiceMessageSyncPackage>(MessageType::DBSyncPackage, syncPackagePath);
+    auto msg =
+        std::make_shared<DBServiceMessageSyncPackage>(MessageType::DBSyncPackage, syncPackagePath, syncTokens);
 
     auto ret = serv->bus.sendUnicastSync(std::move(msg), service::name::db, constants::DefaultTimeoutInMs);
     if (auto retMsg = dynamic_cast<DBServiceResponseMessage *>(ret.second.get()); retMsg) {
@@ -305,6 +308,16 @@ bool DBServiceAPI::AddSMS(sys::Service *serv, const SMSRecord &record, std::uniq
     return succeed;
 }
 
+bool DBServiceAPI::AddSMSBatch(sys::Service *serv,
+                               std::vector<SMSRecord> records,
+                               std::unique_ptr<db::QueryListener> &&listener)
+{
+    auto query = std::make_unique<db::query::SMSAddBatch>(std::move(records));
+    query->setQueryListener(std::move(listener));
+    const auto [succeed, _] = DBServiceAPI::GetQuery(serv, db::Interface::Name::SMS, std::move(query));
+    return succeed;
+}
+
 void DBServiceAPI::InformLanguageChanged(sys::Service *serv)
 {
     auto query = std::make_unique<Quotes::Messages::InformLanguageChangeRequest>();
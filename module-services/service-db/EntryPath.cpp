@@ -7,6 +7,20 @@
 
 namespace settings
 {
+    namespace
+    {
+        constexpr std::uint32_t fnvOffsetBasis = 2166136261U;
+        constexpr std::uint32_t fnvPrime       = 16777619U;
+
+        auto hashAppend(std::uint32_t hash, const std::string &part) noexcept -> std::uint32_t
+        {
+            for (const auto c : part) {
+                hash = (hash ^ static_cast<std::uint8_t>(c)) * fnvPrime;
+            }
+            // separator, so that {"ab", "c"} and {"a", "bc"} differ
+            return (hash ^ 0xFFU) * fnvPrime;
+        }
+    } // namespace
 
     void EntryPath::parse(const std::string &dbPath)
     {
@@ -24,6 +38,17 @@ namespace settings
         }
     }
 
+    auto EntryPath::hash() const noexcept -> std::uint32_t
+    {
+        auto result = (fnvOffsetBasis ^ static_cast<std::uint32_t>(scope)) * fnvPrime;
+        if (scope == SettingsScope::AppLocal) {
+            result = hashAppend(result, mode);
+            result = hashAppend(result, service);
+            result = hashAppend(result, profile);
+        }
+        return hashAppend(result, variable);
+    }
+
     bool operator<(const EntryPath &lhs, const EntryPath &rhs) noexcept
     {
         if (lhs.scope != rhs.scope) {
@@ -37,4 +62,15 @@ namespace settings
         }
         return lhs.variable < rhs.variable;
     }
+
+    bool operator==(const EntryPath &lhs, const EntryPath &rhs) noexcept
+    {
+        if (lhs.scope != rhs.scope || lhs.variable != rhs.variable) {
+            return false;
+        }
+        if (lhs.scope == SettingsScope::AppLocal) {
+            return std::tie(lhs.mode, lhs.service, lhs.profile) == std::tie(rhs.mode, rhs.service, rhs.profile);
+        }
+        return true;
+    }
 } // namespace settings
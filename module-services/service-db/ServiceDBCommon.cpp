@@ -75,6 +75,7 @@ sys::ReturnCodes ServiceDBCommon::InitHandler()
 sys::ReturnCodes ServiceDBCommon::DeinitHandler()
 {
     for (auto &dbAgent : databaseAgents) {
+        dbAgent->flush();
         dbAgent->unRegisterMessages();
     }
 
@@ -89,6 +90,11 @@ sys::ReturnCodes ServiceDBCommon::DeinitHandler()
 sys::ReturnCodes ServiceDBCommon::SwitchPowerModeHandler(const sys::ServicePowerMode mode)
 {
     LOG_FATAL("[%s] PowerModeHandler: %s", this->GetName().c_str(), c_str(mode));
+    if (mode != sys::ServicePowerMode::Active) {
+        for (auto &dbAgent : databaseAgents) {
+            dbAgent->flush();
+        }
+    }
     return sys::ReturnCodes::Success;
 }
 
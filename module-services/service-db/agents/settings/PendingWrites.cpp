@@ -0,0 +1,42 @@
+// Copyright (c) 2017-2023, Mudita Sp. z.o.o. All rights reserved.
+// For licensing, see https://github.com/mudita/MuditaOS/LICENSE.md
+
+#include "PendingWrites.hpp"
+
+namespace settings
+{
+    void PendingWrites::set(const std::string &path, const std::string &value)
+    {
+        entries[path] = value;
+    }
+
+    auto PendingWrites::get(const std::string &path) const -> std::optional<std::string>
+    {
+        if (const auto it = entries.find(path); it != entries.end()) {
+            return it->second;
+        }
+        return std::nullopt;
+    }
+
+    auto PendingWrites::size() const noexcept -> std::size_t
+    {
+        return entries.size();
+    }
+
+    auto PendingWrites::empty() const noexcept -> bool
+    {
+        return entries.empty();
+    }
+
+    auto PendingWrites::flush(const Commit &commit) -> bool
+    {
+        if (entries.empty()) {
+            return true;
+        }
+        if (!commit(entries)) {
+            return false;
+        }
+        entries.clear();
+        return true;
+    }
+} // namespace settings
@@ -0,0 +1,33 @@
+// Copyright (c) 2017-2023, Mudita Sp. z.o.o. All rights reserved.
+// For licensing, see https://github.com/mudita/MuditaOS/LICENSE.md
+
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <map>
+#include <optional>
+#include <string>
+
+namespace settings
+{
+    /// Values accepted by the settings agent but not yet written to the db, keyed by db path
+    class PendingWrites
+    {
+      public:
+        using Entries = std::map<std::string, std::string>;
+        using Commit  = std::function<bool(const Entries &entries)>;
+
+        void set(const std::string &path, const std::string &value);
+        [[nodiscard]] auto get(const std::string &path) const -> std::optional<std::string>;
+        [[nodiscard]] auto size() const noexcept -> std::size_t;
+        [[nodiscard]] auto empty() const noexcept -> bool;
+
+        /// Writes the entries with the commit function. They are kept if it fails, so that the write can be retried.
+        /// @return true if the entries were written or nothing was pending
+        auto flush(const Commit &commit) -> bool;
+
+      private:
+        Entries entries;
+    };
+} // namespace settings
@@ -108,6 +108,11 @@ namespace settings
         return getCache()->getValue({.service = interface.ownerName(), .variable = variableName, .scope = scope});
     }
 
+    std::optional<double> Settings::getCachedNumericValue(const std::string &variableName, SettingsScope scope)
+    {
+        return getCache()->getNumericValue({.service = interface.ownerName(), .variable = variableName, .scope = scope});
+    }
+
     SettingsCache *Settings::getCache()
     {
         return SettingsCache::getInstance();
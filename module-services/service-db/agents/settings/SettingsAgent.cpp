@@ -7,6 +7,7 @@
 
 #include <Database/Database.hpp>
 #include <Service/Service.hpp>
+#include <Timers/TimerFactory.hpp>
 #include <purefs/filesystem_paths.hpp>
 #include <service-db/SettingsCache.hpp>
 #include <log/log.hpp>
@@ -23,6 +24,9 @@ SettingsAgent::SettingsAgent(sys::Service *parentService,
 
     database = std::make_unique<Database>((purefs::dir::getDatabasesPath() / dbName).c_str());
 
+    writeBehindTimer = sys::TimerFactory::createSingleShotTimer(
+        parentService, "settingsWriteBehind", writeBehindDelay, [this](sys::Timer &) { flush(); });
+
     factorySettings->initDb(database.get());
 
     // first approach -> take care about big amount of variables
@@ -67,6 +71,34 @@ auto SettingsAgent::getAgentName() -> const std::string
     return std::string("settingsAgent");
 }
 
+void SettingsAgent::flush()
+{
+    writeBehindTimer.stop();
+    if (!pendingWrites.flush([this](const auto &entries) { return dbCommitPendingWrites(entries); })) {
+        LOG_ERROR("SettingsAgent failed to commit %u pending writes, retrying later",
+                  static_cast<unsigned>(pendingWrites.size()));
+        writeBehindTimer.restart(writeBehindDelay);
+    }
+}
+
+auto SettingsAgent::getValue(const settings::EntryPath &path) -> std::optional<std::string>
+{
+    if (auto value = pendingWrites.get(path.to_string()); value.has_value()) {
+        return value;
+    }
+    return dbGetValue(path);
+}
+
+void SettingsAgent::scheduleWrite(const settings::EntryPath &path, const std::string &value)
+{
+    pendingWrites.set(path.to_string(), value);
+    if (pendingWrites.size() >= maxPendingWrites) {
+        flush();
+        return;
+    }
+    writeBehindTimer.restart(writeBehindDelay);
+}
+
 // dbSingleVar
 auto SettingsAgent::dbGetValue(const settings::EntryPath &path) -> std::optional<std::string>
 {
@@ -77,10 +109,23 @@ auto SettingsAgent::dbGetValue(const settings::EntryPath &path) -> std::optional
     return (*retQuery)[0].getString();
 }
 
-auto SettingsAgent::dbSetValue(const settings::EntryPath &path, const std::string &value) -> bool
+auto SettingsAgent::dbCommitPendingWrites(const settings::PendingWrites::Entries &entries) -> bool
 {
-    /// insert or update
-    return database->execute(settings::Statements::insertValue, path.to_string().c_str(), value.c_str());
+    if (!database->execute(settings::Statements::beginTransaction)) {
+        return false;
+    }
+    for (const auto &[path, value] : entries) {
+        /// insert or update
+        if (!database->execute(settings::Statements::insertValue, path.c_str(), value.c_str())) {
+            database->execute(settings::Statements::rollbackTransaction);
+            return false;
+        }
+    }
+    if (!database->execute(settings::Statements::commitTransaction)) {
+        database->execute(settings::Statements::rollbackTransaction);
+        return false;
+    }
+    return true;
 }
 
 auto SettingsAgent::dbRegisterValueChange(const settings::EntryPath &path) -> bool
@@ -98,7 +143,7 @@ auto SettingsAgent::handleGetVariable(sys::Message *req) -> sys::MessagePointer
 {
     if (auto msg = dynamic_cast<settings::Messages::GetVariable *>(req)) {
         auto path  = msg->getPath();
-        auto value = dbGetValue(path);
+        auto value = getValue(path);
         return std::make_shared<settings::Messages::VariableResponse>(std::move(path), std::move(value));
     }
     return std::make_shared<sys::ResponseMessage>();
@@ -110,9 +155,10 @@ auto SettingsAgent::handleSetVariable(sys::Message *req) -> sys::MessagePointer
 
         auto path     = msg->getPath();
         auto value    = msg->getValue().value_or("");
-        auto oldValue = dbGetValue(path);
+        auto oldValue = getValue(path);
         if (oldValue.has_value() && oldValue.value() != value) {
-            dbSetValue(path, value);
+            // the db write is deferred, recipients are notified right away
+            scheduleWrite(path, value);
             for (const auto &regPath : variableChangeRecipients[path.to_string()]) {
                 if (regPath.service != path.service) {
                     auto updateMsg =
@@ -140,7 +186,7 @@ auto SettingsAgent::handleRegisterOnVariableChange(sys::Message *req) -> sys::Me
             else {
                 return std::make_shared<sys::ResponseMessage>();
             }
-            auto currentValue = dbGetValue(path).value_or("");
+            auto currentValue = getValue(path).value_or("");
             LOG_DEBUG("SettingsAgent handled register for: %s", path.to_string().c_str());
             auto msgValue =
                 std::make_shared<::settings::Messages::VariableChanged>(std::move(path), std::move(currentValue), "");
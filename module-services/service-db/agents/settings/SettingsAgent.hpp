@@ -4,11 +4,14 @@
 #pragma once
 
 #include "FactorySettings.hpp"
+#include "PendingWrites.hpp"
 
 #include <service-db/DatabaseAgent.hpp>
 #include <service-db/SettingsMessages.hpp>
 #include <Service/Message.hpp>
+#include <Timers/TimerHandle.hpp>
 
+#include <chrono>
 #include <map>
 #include <optional>
 #include <string>
@@ -36,8 +39,14 @@ class SettingsAgent : public DatabaseAgent
     void registerMessages() override;
     void unRegisterMessages() override;
     auto getAgentName() -> const std::string override;
+    void flush() override;
 
   private:
+    /// Writes arriving within this window are committed to the db in a single transaction
+    static constexpr std::chrono::milliseconds writeBehindDelay{500};
+    /// Upper bound of buffered writes - reaching it forces an immediate commit
+    static constexpr std::size_t maxPendingWrites = 32;
+
     settings::SettingsCache *cache = nullptr;
 
     using MapOfRecipentsToBeNotified = std::map<std::string, std::set<settings::EntryPath>>;
@@ -47,11 +56,17 @@ class SettingsAgent : public DatabaseAgent
     SetOfRecipents modeChangeRecipients;
     const std::string dbName;
 
+    settings::PendingWrites pendingWrites;
+    sys::TimerHandle writeBehindTimer;
+
     // db operations
     auto dbGetValue(const settings::EntryPath &path) -> std::optional<std::string>;
-    auto dbSetValue(const settings::EntryPath &path, const std::string &value) -> bool;
     auto dbRegisterValueChange(const settings::EntryPath &path) -> bool;
     auto dbUnregisterValueChange(const settings::EntryPath &path) -> bool;
+    auto dbCommitPendingWrites(const settings::PendingWrites::Entries &entries) -> bool;
+
+    auto getValue(const settings::EntryPath &path) -> std::optional<std::string>;
+    void scheduleWrite(const settings::EntryPath &path, const std::string &value);
 
     // msg handlers
     // variable
@@ -1,14 +1,102 @@
-// Copyright (c) 2017-2021, Mudita Sp. z.o.o. All rights reserved.
+// Copyright (c) 2017-2023, Mudita Sp. z.o.o. All rights reserved.
 // For licensing, see https://github.com/mudita/MuditaOS/LICENSE.md
 
 #include <service-db/SettingsCache.hpp>
 #include <mutex.hpp>
 
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstdlib>
+#include <memory>
+#include <vector>
+
 namespace settings
 {
 
     namespace
     {
+        constexpr std::size_t initialCapacity = 256;
+        /// Number of the readers which may hold a value at the same time, the other ones wait for the writers
+        constexpr std::size_t hazardsCount = 16;
+
+        std::optional<double> parseNumeric(const std::string &value)
+        {
+            if (value.empty()) {
+                return std::nullopt;
+            }
+            char *end         = nullptr;
+            const auto parsed = std::strtod(value.c_str(), &end);
+            if (end != value.c_str() + value.size()) {
+                return std::nullopt;
+            }
+            return parsed;
+        }
+
+        /// Immutable snapshot of a single value, published to readers with a single pointer store.
+        /// The replaced snapshot is freed by the writers once no reader holds it in a hazard slot.
+        struct Value
+        {
+            explicit Value(const std::string &text) : text{text}, numeric{parseNumeric(text)}
+            {}
+
+            const std::string text;
+            const std::optional<double> numeric;
+        };
+
+        /// Node is never removed once inserted, so readers may dereference it without any protection
+        struct Node
+        {
+            Node(const EntryPath &path, std::uint32_t hash) : path{path}, hash{hash}
+            {}
+
+            const EntryPath path;
+            const std::uint32_t hash;
+            std::atomic<const Value *> current{nullptr};
+
+            // owned by writers only
+            std::unique_ptr<const Value> currentOwner;
+        };
+
+        /// Open addressing, linear probing table of node pointers. Capacity is always a power of two.
+        struct Table
+        {
+            explicit Table(std::size_t capacity) : capacity{capacity}, slots{new std::atomic<Node *>[capacity]}
+            {
+                for (std::size_t i = 0; i < capacity; ++i) {
+                    slots[i].store(nullptr, std::memory_order_relaxed);
+                }
+            }
+
+            const Node *find(const EntryPath &path, std::uint32_t hash) const
+            {
+                const auto mask = capacity - 1;
+                for (std::size_t i = 0, idx = hash & mask; i < capacity; ++i, idx = (idx + 1) & mask) {
+                    const auto node = slots[idx].load(std::memory_order_acquire);
+                    if (node == nullptr) {
+                        return nullptr;
+                    }
+                    if (node->hash == hash && node->path == path) {
+                        return node;
+                    }
+                }
+                return nullptr;
+            }
+
+            void insert(Node *node)
+            {
+                const auto mask = capacity - 1;
+                auto idx        = node->hash & mask;
+                while (slots[idx].load(std::memory_order_relaxed) != nullptr) {
+                    idx = (idx + 1) & mask;
+                }
+                slots[idx].store(node, std::memory_order_release);
+            }
+
+            const std::size_t capacity;
+            std::unique_ptr<std::atomic<Node *>[]> slots;
+        };
+
         class SettingsCacheImpl : public SettingsCache
         {
           public:
@@ -18,29 +106,142 @@ namespace settings
                 return instance;
             }
 
-            const std::string &getValue(const EntryPath &path) const;
+            std::string getValue(const EntryPath &path) const;
+            std::optional<double> getNumericValue(const EntryPath &path) const;
             void setValue(const EntryPath &path, const std::string &value);
 
           private:
-            std::map<EntryPath, std::string> settingsMap;
-            mutable cpp_freertos::MutexStandard settingsMutex;
+            SettingsCacheImpl();
+            const Node *findNode(const EntryPath &path) const;
+            Node *insertNode(const EntryPath &path, std::uint32_t hash);
+            void reclaim();
+
+            /// Calls the reader with the current value of the path, nullptr if there is none
+            template <typename Reader>
+            auto readValue(const EntryPath &path, Reader &&reader) const;
+
+            std::atomic<const Table *> table{nullptr};
+            /// Values being read, a reader takes a free slot and publishes the value before dereferencing it
+            mutable std::array<std::atomic<const Value *>, hazardsCount> hazards{};
+
+            // writers only
+            std::vector<std::unique_ptr<Table>> tables;
+            std::vector<std::unique_ptr<Node>> nodes;
+            /// Replaced values which may still be held by the readers
+            std::vector<std::unique_ptr<const Value>> retired;
+            mutable cpp_freertos::MutexStandard writeMutex;
         };
 
-        const std::string &SettingsCacheImpl::getValue(const EntryPath &path) const
+        /// Marks the hazard slot taken by a reader which hasn't published its value yet
+        const Value reservedHazard{std::string{}};
+
+        SettingsCacheImpl::SettingsCacheImpl()
         {
-            static const std::string empty;
-            cpp_freertos::LockGuard lock(settingsMutex);
-            auto pathIt = settingsMap.find(path);
-            if (settingsMap.end() != pathIt) {
-                return pathIt->second;
+            tables.push_back(std::make_unique<Table>(initialCapacity));
+            table.store(tables.back().get(), std::memory_order_release);
+        }
+
+        const Node *SettingsCacheImpl::findNode(const EntryPath &path) const
+        {
+            return table.load(std::memory_order_acquire)->find(path, path.hash());
+        }
+
+        template <typename Reader>
+        auto SettingsCacheImpl::readValue(const EntryPath &path, Reader &&reader) const
+        {
+            const auto node = findNode(path);
+            if (node == nullptr) {
+                return reader(nullptr);
+            }
+
+            for (auto &hazard : hazards) {
+                const Value *expected = nullptr;
+                if (!hazard.compare_exchange_strong(expected, &reservedHazard)) {
+                    continue;
+                }
+                // The value can't be freed once it is published and still current, otherwise it's read again
+                const Value *value = nullptr;
+                do {
+                    value = node->current.load();
+                    hazard.store(value);
+                } while (value != node->current.load());
+
+                auto result = reader(value);
+                hazard.store(nullptr, std::memory_order_release);
+                return result;
+            }
+
+            // All the slots are taken, the values are freed by the writers only
+            cpp_freertos::LockGuard lock(writeMutex);
+            return reader(node->current.load(std::memory_order_relaxed));
+        }
+
+        std::string SettingsCacheImpl::getValue(const EntryPath &path) const
+        {
+            return readValue(path, [](const Value *value) { return value != nullptr ? value->text : std::string{}; });
+        }
+
+        std::optional<double> SettingsCacheImpl::getNumericValue(const EntryPath &path) const
+        {
+            return readValue(path, [](const Value *value) {
+                return value != nullptr ? value->numeric : std::optional<double>{};
+            });
+        }
+
+        Node *SettingsCacheImpl::insertNode(const EntryPath &path, std::uint32_t hash)
+        {
+            auto active = tables.back().get();
+            // keep load factor below 1/2 so that probe sequences stay short
+            if ((nodes.size() + 1) * 2 > active->capacity) {
+                auto grown = std::make_unique<Table>(active->capacity * 2);
+                for (const auto &node : nodes) {
+                    grown->insert(node.get());
+                }
+                // previous tables are retained - readers may still be probing them
+                tables.push_back(std::move(grown));
+                active = tables.back().get();
+                table.store(active, std::memory_order_release);
             }
-            return empty;
+
+            nodes.push_back(std::make_unique<Node>(path, hash));
+            active->insert(nodes.back().get());
+            return nodes.back().get();
         }
 
         void SettingsCacheImpl::setValue(const EntryPath &path, const std::string &value)
         {
-            cpp_freertos::LockGuard lock(settingsMutex);
-            settingsMap[path] = value;
+            cpp_freertos::LockGuard lock(writeMutex);
+
+            const auto hash = path.hash();
+            auto node       = const_cast<Node *>(tables.back()->find(path, hash));
+            if (node == nullptr) {
+                node = insertNode(path, hash);
+            }
+            else if (node->currentOwner != nullptr && node->currentOwner->text == value) {
+                return;
+            }
+
+            auto newValue = std::make_unique<const Value>(value);
+            node->current.store(newValue.get());
+            if (node->currentOwner != nullptr) {
+                retired.push_back(std::move(node->currentOwner));
+            }
+            node->currentOwner = std::move(newValue);
+            reclaim();
+        }
+
+        void SettingsCacheImpl::reclaim()
+        {
+            // At most one retired value per hazard slot is kept
+            retired.erase(std::remove_if(retired.begin(),
+                                         retired.end(),
+                                         [this](const auto &value) {
+                                             return std::none_of(
+                                                 hazards.begin(), hazards.end(), [&value](const auto &hazard) {
+                                                     return hazard.load() == value.get();
+                                                 });
+                                         }),
+                          retired.end());
         }
     } // namespace
 
@@ -49,11 +250,16 @@ namespace settings
         return &SettingsCacheImpl::get();
     }
 
-    const std::string &SettingsCache::getValue(const EntryPath &path) const
+    std::string SettingsCache::getValue(const EntryPath &path) const
     {
         return SettingsCacheImpl::get().getValue(path);
     }
 
+    std::optional<double> SettingsCache::getNumericValue(const EntryPath &path) const
+    {
+        return SettingsCacheImpl::get().getNumericValue(path);
+    }
+
     void SettingsCache::setValue(const EntryPath &path, const std::string &value)
     {
         return SettingsCacheImpl::get().setValue(path, value);
@@ -54,6 +54,18 @@ namespace settings::Statements
                         ( '%q', '%q' ) ;
                         )sql";
 
+    constexpr auto beginTransaction = R"sql(
+                        BEGIN TRANSACTION;
+                        )sql";
+
+    constexpr auto commitTransaction = R"sql(
+                        COMMIT;
+                        )sql";
+
+    constexpr auto rollbackTransaction = R"sql(
+                        ROLLBACK;
+                        )sql";
+
     constexpr auto updateValue = R"sql(
                         UPDATE settings_tab SET value = '%q' WHERE path = '%q' ;
                         )sql";
@@ -15,6 +15,7 @@
 #include <utf8/UTF8.hpp>
 #include <module-db/queries/messages/sms/QuerySMSAdd.hpp>
 #include <module-db/Interface/SMSRecord.hpp>
+#include <module-db/Database/SyncChanges.hpp>
 
 #include <cstdint>
 #include <memory>
@@ -110,7 +111,13 @@ class DBServiceAPI
     [[deprecated]] static auto CalllogRemove(sys::Service *serv, uint32_t id) -> bool;
     [[deprecated]] static auto CalllogUpdate(sys::Service *serv, const CalllogRecord &rec) -> bool;
 
-    static auto DBPrepareSyncPackage(sys::Service *serv, const std::string &syncPackagePath) -> bool;
+    /**
+     * @brief Stores the synced databases in the package, databases with a valid client token only with the rows
+     * changed since then
+     */
+    static auto DBPrepareSyncPackage(sys::Service *serv,
+                                     const std::string &syncPackagePath,
+                                     const db::sync::Tokens &syncTokens = {}) -> bool;
 
     static auto IsContactInFavourites(sys::Service *serv, const utils::PhoneNumber::View &numberView) -> bool;
     static auto IsContactInEmergency(sys::Service *serv, const utils::PhoneNumber::View &numberView) -> bool;
@@ -125,6 +132,17 @@ class DBServiceAPI
      * @return true if adding sms operation succeed, otherwise false
      */
     static bool AddSMS(sys::Service *serv, const SMSRecord &record, std::unique_ptr<db::QueryListener> &&listener);
+    /**
+     * @brief Add several sms in a single transaction via DBService interface
+     *
+     * @param serv - calling service
+     * @param records - sms records data
+     * @param listener - query listener to obtain and handle query result
+     * @return true if the query was sent, otherwise false
+     */
+    static bool AddSMSBatch(sys::Service *serv,
+                            std::vector<SMSRecord> records,
+                            std::unique_ptr<db::QueryListener> &&listener);
 
     static void InformLanguageChanged(sys::Service *serv);
 };
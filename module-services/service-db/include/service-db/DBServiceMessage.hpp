@@ -1,4 +1,4 @@
-﻿// Copyright (c) 2017-2022, Mudita Sp. z.o.o. All rights reserved.
+﻿// Copyright (c) 2017-2023, Mudita Sp. z.o.o. All rights reserved.
 // For licensing, see https://github.com/mudita/MuditaOS/LICENSE.md
 
 #pragma once
@@ -6,6 +6,7 @@
 #include "DBMessage.hpp"
 
 #include <MessageType.hpp>
+#include <module-db/Database/SyncChanges.hpp>
 
 #include <cstdint>
 #include <string>
@@ -20,8 +21,11 @@ class DBServiceMessageBackup : public DBMessage
 class DBServiceMessageSyncPackage : public DBMessage
 {
   public:
-    DBServiceMessageSyncPackage(MessageType messageType, const std::string &syncPackagePath);
+    DBServiceMessageSyncPackage(MessageType messageType,
+                                const std::string &syncPackagePath,
+                                const db::sync::Tokens &syncTokens);
     std::string syncPackagePath;
+    db::sync::Tokens syncTokens;
 };
 
 class DBServiceResponseMessage : public DBResponseMessage
@@ -25,6 +25,10 @@ class DatabaseAgent
     virtual void unRegisterMessages()                              = 0;
     [[nodiscard]] virtual auto getAgentName() -> const std::string = 0;
 
+    /// Commits any writes the agent deferred; called on service shutdown and before suspend
+    virtual void flush()
+    {}
+
     static constexpr auto ZERO_ROWS_FOUND = 0;
     static constexpr auto ONE_ROW_FOUND   = 1;
 
@@ -1,9 +1,10 @@
-// Copyright (c) 2017-2021, Mudita Sp. z.o.o. All rights reserved.
+// Copyright (c) 2017-2023, Mudita Sp. z.o.o. All rights reserved.
 // For licensing, see https://github.com/mudita/MuditaOS/LICENSE.md
 
 #pragma once
 
 #include "SettingsScope.hpp"
+#include <cstdint>
 #include <string>
 #include <type_traits>
 
@@ -26,8 +27,13 @@ namespace settings
         }
 
         void parse(const std::string &dbPath);
+
+        /// FNV-1a hash of the fields compared by operator==: the scope and the variable, for AppLocal paths also
+        /// the mode, the service and the profile
+        [[nodiscard]] auto hash() const noexcept -> std::uint32_t;
     };
 
     bool operator<(const settings::EntryPath &lhs, const settings::EntryPath &rhs) noexcept;
+    bool operator==(const settings::EntryPath &lhs, const settings::EntryPath &rhs) noexcept;
 
 } // namespace settings
@@ -42,6 +42,16 @@ namespace settings
         void unregisterValueChange(const std::string &variableName, SettingsScope scope = SettingsScope::AppLocal);
         /// unregisters all registered variables (both global and local)
         virtual std::string getValue(const std::string &variableName, SettingsScope scope = SettingsScope::AppLocal);
+        /// typed read of a numeric setting, without copying nor parsing the value string
+        template <typename T>
+        std::optional<T> getNumericValue(const std::string &variableName,
+                                         SettingsScope scope = SettingsScope::AppLocal)
+        {
+            if (const auto value = getCachedNumericValue(variableName, scope); value.has_value()) {
+                return static_cast<T>(*value);
+            }
+            return std::nullopt;
+        }
 
         SettingsCache *getCache();
 
@@ -53,5 +63,6 @@ namespace settings
         ValueCb cbValues;
 
         void handleVariableChanged(const EntryPath &path, const std::string &value);
+        std::optional<double> getCachedNumericValue(const std::string &variableName, SettingsScope scope);
     };
 } // namespace settings
@@ -1,17 +1,23 @@
-// Copyright (c) 2017-2021, Mudita Sp. z.o.o. All rights reserved.
+// Copyright (c) 2017-2023, Mudita Sp. z.o.o. All rights reserved.
 // For licensing, see https://github.com/mudita/MuditaOS/LICENSE.md
 
 #pragma once
 
 #include "SettingsMessages.hpp"
 #include <map>
+#include <optional>
 
 namespace settings
 {
+    /// Process-wide settings cache.
+    /// Reads are lock-free and may be done from any task; writes are serialized internally.
+    /// Values are returned as copies, the snapshots read are freed by writers once no reader holds them.
     class SettingsCache
     {
       public:
-        const std::string &getValue(const EntryPath &path) const;
+        std::string getValue(const EntryPath &path) const;
+        /// Numeric representation of the value, parsed once on write; std::nullopt if the value is not a number
+        std::optional<double> getNumericValue(const EntryPath &path) const;
         void setValue(const EntryPath &path, const std::string &value);
         static SettingsCache *getInstance();
         virtual ~SettingsCache() = default;
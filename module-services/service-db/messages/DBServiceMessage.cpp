@@ -1,4 +1,4 @@
-﻿// Copyright (c) 2017-2022, Mudita Sp. z.o.o. All rights reserved.
+﻿// Copyright (c) 2017-2023, Mudita Sp. z.o.o. All rights reserved.
 // For licensing, see https://github.com/mudita/MuditaOS/LICENSE.md
 
 #include <service-db/DBServiceMessage.hpp>
@@ -7,8 +7,10 @@ DBServiceMessageBackup::DBServiceMessageBackup(MessageType messageType, std::str
     : DBMessage(messageType), backupPath(backupPath)
 {}
 
-DBServiceMessageSyncPackage::DBServiceMessageSyncPackage(MessageType messageType, const std::string &syncPackagePath)
-    : DBMessage(messageType), syncPackagePath(syncPackagePath)
+DBServiceMessageSyncPackage::DBServiceMessageSyncPackage(MessageType messageType,
+                                                         const std::string &syncPackagePath,
+                                                         const db::sync::Tokens &syncTokens)
+    : DBMessage(messageType), syncPackagePath(syncPackagePath), syncTokens(syncTokens)
 {}
 
 DBServiceResponseMessage::DBServiceResponseMessage(uint32_t retCode, uint32_t count, MessageType respTo)
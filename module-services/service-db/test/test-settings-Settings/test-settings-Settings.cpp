@@ -1,4 +1,4 @@
-// Copyright (c) 2017-2021, Mudita Sp. z.o.o. All rights reserved.
+// Copyright (c) 2017-2023, Mudita Sp. z.o.o. All rights reserved.
 // For licensing, see https://github.com/mudita/MuditaOS/LICENSE.md
 
 #include <catch2/catch.hpp>
@@ -38,10 +38,13 @@ namespace settings
         return "";
     }
 
-    const std::string &SettingsCache::getValue(const EntryPath &path) const
+    std::string SettingsCache::getValue(const EntryPath &path) const
     {
-        static const std::string val;
-        return val;
+        return {};
+    }
+    std::optional<double> SettingsCache::getNumericValue(const EntryPath &path) const
+    {
+        return std::nullopt;
     }
     void SettingsCache::setValue(const EntryPath &path, const std::string &value)
     {}
@@ -0,0 +1,136 @@
+// Copyright (c) 2017-2023, Mudita Sp. z.o.o. All rights reserved.
+// For licensing, see https://github.com/mudita/MuditaOS/LICENSE.md
+
+#include <catch2/catch.hpp>
+#include <service-db/SettingsCache.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <thread>
+#include <vector>
+
+using namespace settings;
+
+namespace
+{
+    EntryPath localPath(const std::string &variable, const std::string &service = "appTest")
+    {
+        return EntryPath{.service = service, .variable = variable, .scope = SettingsScope::AppLocal};
+    }
+
+    EntryPath globalPath(const std::string &variable)
+    {
+        return EntryPath{.variable = variable, .scope = SettingsScope::Global};
+    }
+} // namespace
+
+TEST_CASE("Settings cache - get and set")
+{
+    auto cache = SettingsCache::getInstance();
+
+    SECTION("Unknown path returns empty value")
+    {
+        REQUIRE(cache->getValue(localPath("unknown")).empty());
+        REQUIRE_FALSE(cache->getNumericValue(localPath("unknown")).has_value());
+    }
+
+    SECTION("Value is overwritten")
+    {
+        cache->setValue(localPath("overwritten"), "first");
+        cache->setValue(localPath("overwritten"), "second");
+        REQUIRE(cache->getValue(localPath("overwritten")) == "second");
+    }
+
+    SECTION("Scopes and services are distinguished")
+    {
+        cache->setValue(localPath("scoped", "appA"), "a");
+        cache->setValue(localPath("scoped", "appB"), "b");
+        cache->setValue(globalPath("scoped"), "global");
+        REQUIRE(cache->getValue(localPath("scoped", "appA")) == "a");
+        REQUIRE(cache->getValue(localPath("scoped", "appB")) == "b");
+        REQUIRE(cache->getValue(globalPath("scoped")) == "global");
+    }
+
+    SECTION("Global path ignores service")
+    {
+        cache->setValue(globalPath("globalOnly"), "value");
+        auto path    = globalPath("globalOnly");
+        path.service = "anyService";
+        REQUIRE(cache->getValue(path) == "value");
+    }
+
+    SECTION("Table grows")
+    {
+        constexpr auto entries = 2000;
+        for (int i = 0; i < entries; ++i) {
+            cache->setValue(localPath("grow" + std::to_string(i)), std::to_string(i));
+        }
+        for (int i = 0; i < entries; ++i) {
+            REQUIRE(cache->getValue(localPath("grow" + std::to_string(i))) == std::to_string(i));
+        }
+    }
+}
+
+TEST_CASE("Settings cache - numeric values")
+{
+    auto cache = SettingsCache::getInstance();
+
+    cache->setValue(localPath("integer"), "42");
+    cache->setValue(localPath("floating"), "12.5");
+    cache->setValue(localPath("text"), "42abc");
+    cache->setValue(localPath("empty"), "");
+
+    REQUIRE(cache->getNumericValue(localPath("integer")) == 42);
+    REQUIRE(cache->getNumericValue(localPath("floating")) == 12.5);
+    REQUIRE_FALSE(cache->getNumericValue(localPath("text")).has_value());
+    REQUIRE_FALSE(cache->getNumericValue(localPath("empty")).has_value());
+
+    cache->setValue(localPath("integer"), "not a number");
+    REQUIRE_FALSE(cache->getNumericValue(localPath("integer")).has_value());
+}
+
+TEST_CASE("Settings cache - concurrent readers")
+{
+    constexpr auto readersCount   = 4;
+    constexpr auto readsPerReader = 200000;
+    constexpr auto variables      = 8;
+
+    auto cache = SettingsCache::getInstance();
+    std::vector<EntryPath> paths;
+    for (int i = 0; i < variables; ++i) {
+        paths.push_back(localPath("concurrent" + std::to_string(i)));
+        cache->setValue(paths.back(), std::to_string(i));
+    }
+
+    // Every value is replaced many times while the readers hold the previous ones
+    std::atomic_bool writerDone{false};
+    std::thread writer([&] {
+        for (int i = 0; !writerDone; ++i) {
+            cache->setValue(paths[i % variables], std::to_string(i));
+        }
+    });
+
+    std::vector<std::thread> readers;
+    std::atomic<std::size_t> consistentReads{0};
+    for (int r = 0; r < readersCount; ++r) {
+        readers.emplace_back([&, r] {
+            std::size_t localReads = 0;
+            for (int i = 0; i < readsPerReader; ++i) {
+                const auto &path   = paths[(i + r) % variables];
+                const auto text    = cache->getValue(path);
+                const auto numeric = cache->getNumericValue(path);
+                const auto isNumber =
+                    !text.empty() && std::all_of(text.begin(), text.end(), [](char c) { return c >= '0' && c <= '9'; });
+                localReads += isNumber && numeric.has_value() ? 1 : 0;
+            }
+            consistentReads += localReads;
+        });
+    }
+    for (auto &reader : readers) {
+        reader.join();
+    }
+    writerDone = true;
+    writer.join();
+
+    REQUIRE(consistentReads == readersCount * readsPerReader);
+}
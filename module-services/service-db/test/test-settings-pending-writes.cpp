@@ -0,0 +1,54 @@
+// Copyright (c) 2017-2023, Mudita Sp. z.o.o. All rights reserved.
+// For licensing, see https://github.com/mudita/MuditaOS/LICENSE.md
+
+#include <catch2/catch.hpp>
+#include <agents/settings/PendingWrites.hpp>
+
+using namespace settings;
+
+TEST_CASE("Settings pending writes")
+{
+    PendingWrites pendingWrites;
+    PendingWrites::Entries written;
+    auto failingCommit    = [](const PendingWrites::Entries &) { return false; };
+    auto successfulCommit = [&written](const PendingWrites::Entries &entries) {
+        written.insert(entries.begin(), entries.end());
+        return true;
+    };
+
+    SECTION("Nothing pending")
+    {
+        REQUIRE(pendingWrites.empty());
+        REQUIRE(pendingWrites.flush(failingCommit));
+        REQUIRE_FALSE(pendingWrites.get("path").has_value());
+    }
+
+    SECTION("Last value is pending")
+    {
+        pendingWrites.set("path", "first");
+        pendingWrites.set("path", "second");
+        REQUIRE(pendingWrites.size() == 1);
+        REQUIRE(pendingWrites.get("path") == "second");
+    }
+
+    SECTION("Written values are no longer pending")
+    {
+        pendingWrites.set("path", "value");
+        pendingWrites.set("other", "otherValue");
+        REQUIRE(pendingWrites.flush(successfulCommit));
+        REQUIRE(pendingWrites.empty());
+        REQUIRE(written == PendingWrites::Entries{{"path", "value"}, {"other", "otherValue"}});
+    }
+
+    SECTION("Values are kept when the commit fails")
+    {
+        pendingWrites.set("path", "value");
+        REQUIRE_FALSE(pendingWrites.flush(failingCommit));
+        REQUIRE(pendingWrites.get("path") == "value");
+
+        pendingWrites.set("other", "otherValue");
+        REQUIRE(pendingWrites.flush(successfulCommit));
+        REQUIRE(pendingWrites.empty());
+        REQUIRE(written == PendingWrites::Entries{{"path", "value"}, {"other", "otherValue"}});
+    }
+}
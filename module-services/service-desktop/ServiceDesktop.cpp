@@ -94,8 +94,8 @@ sys::MessagePointer ServiceDesktop::DataReceivedHandler(sys::DataMessage * /*msg
 
 void ServiceDesktop::prepareSyncData()
 {
-    syncStatus.state   = Sync::OperationState::Stopped;
-    syncStatus.tempDir = purefs::dir::getTemporaryPath() / "sync";
+    syncStatus.state       = Sync::OperationState::Stopped;
+    syncStatus.packagePath = purefs::dir::getTemporaryPath() / sdesktop::paths::syncFilename;
 }
 
 auto ServiceDesktop::requestLogsFlush() -> void
@@ -300,10 +300,10 @@ auto ServiceDesktop::handle(sdesktop::developerMode::DeveloperModeRequest *msg)
     return sys::MessageNone{};
 }
 
-auto ServiceDesktop::handle(sdesktop::SyncMessage * /*msg*/) -> std::shared_ptr<sys::Message>
+auto ServiceDesktop::handle(sdesktop::SyncMessage *msg) -> std::shared_ptr<sys::Message>
 {
     syncStatus.state          = Sync::OperationState::Running;
-    syncStatus.completionCode = Sync::PrepareSyncPackage(this, syncStatus.tempDir);
+    syncStatus.completionCode = Sync::PrepareSyncPackage(this, syncStatus.packagePath, msg->syncTokens);
 
     if (syncStatus.completionCode == Sync::CompletionCode::Success) {
         LOG_INFO("Sync package preparation finished");
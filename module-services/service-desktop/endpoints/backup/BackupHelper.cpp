@@ -1,4 +1,4 @@
-// Copyright (c) 2017-2022, Mudita Sp. z.o.o. All rights reserved.
+// Copyright (c) 2017-2023, Mudita Sp. z.o.o. All rights reserved.
 // For licensing, see https://github.com/mudita/MuditaOS/LICENSE.md
 
 #include <endpoints/Context.hpp>
@@ -45,7 +45,7 @@ namespace sdesktop::endpoints
         return {sent::no, ResponseContext{.status = http::Code::InternalServerError}};
     }
 
-    auto BackupHelper::executeSyncRequest([[maybe_unused]] Context &context) -> ProcessResult
+    auto BackupHelper::executeSyncRequest(Context &context) -> ProcessResult
     {
         auto ownerServicePtr = static_cast<ServiceDesktop *>(owner);
 
@@ -59,8 +59,15 @@ namespace sdesktop::endpoints
             // initialize new sync information
             ownerServicePtr->prepareSyncData();
 
+            // tokens of the previous sync let the package hold only the rows changed since then
+            db::sync::Tokens syncTokens;
+            for (const auto &[database, token] : context.getBody()[json::messages::syncTokens].object_items()) {
+                syncTokens[database] = token.string_value();
+            }
+
             // start the sync package preparation process in the background
-            ownerServicePtr->bus.sendUnicast(std::make_shared<sdesktop::SyncMessage>(), service::name::service_desktop);
+            ownerServicePtr->bus.sendUnicast(std::make_shared<sdesktop::SyncMessage>(std::move(syncTokens)),
+                                             service::name::service_desktop);
 
             // return new generated sync package info
 
@@ -28,6 +28,9 @@
 
 #include <ctime>
 #include <locks/data/PhoneLockMessages.hpp>
+#include <Service/Telemetry.hpp>
+#include <Service/Trace.hpp>
+#include <base64.h>
 
 #include <fstream>
 namespace
@@ -40,6 +43,14 @@ namespace
         return state == tetheringOn ? sys::phone_modes::Tethering::On : sys::phone_modes::Tethering::Off;
     }
 
+    auto toBase64(const std::string &data) -> std::string
+    {
+        std::string encoded((data.size() + 2) / 3 * 4 + 1, '\0');
+        const auto end = bintob64(encoded.data(), data.data(), data.size());
+        encoded.resize(end - encoded.data());
+        return encoded;
+    }
+
 } // namespace
 
 namespace sdesktop::endpoints
@@ -202,6 +213,22 @@ namespace sdesktop::endpoints
                     return {sent::delayed, std::nullopt};
                 }
             }
+            else if (keyValue == json::developerMode::telemetryInfo) {
+                const auto snapshot = sys::telemetry::serialize(sys::telemetry::Registry::get().makeSnapshot());
+                auto response       = ResponseContext{
+                    .body = json11::Json::object({{json::developerMode::telemetryInfo, toBase64(snapshot)}})};
+                response.status = http::Code::OK;
+                return {sent::no, std::move(response)};
+            }
+            else if (keyValue == json::developerMode::traceInfo) {
+                const auto events = sys::trace::takeEvents();
+                std::string err;
+                const auto trace = json11::Json::parse(sys::trace::toChromeTrace(events), err);
+                auto response =
+                    ResponseContext{.body = json11::Json::object({{json::developerMode::traceInfo, trace}})};
+                response.status = http::Code::OK;
+                return {sent::no, std::move(response)};
+            }
             else if (keyValue == json::developerMode::cellularSleepModeInfo) {
                 if (!requestCellularSleepModeInfo(owner)) {
                     return {sent::no, ResponseContext{.status = http::Code::NotAcceptable}};
@@ -283,7 +310,9 @@ namespace sdesktop::endpoints
         RawKey key{.state = RawKey::State::Released, .keyCode = keyCode};
 
         gui::InputEvent event(key, state, static_cast<gui::KeyCode>(keyCode));
-        auto message = std::make_shared<app::AppInputEventMessage>(event);
+        auto message     = std::make_shared<app::AppInputEventMessage>(event);
+        message->traceId = sys::trace::newId();
+        sys::trace::record(message->traceId, sys::trace::Stage::Input, sys::trace::Phase::Begin);
 
         return owner->bus.sendUnicast(std::move(message), service::name::evt_manager);
     }
@@ -128,6 +128,22 @@ namespace sdesktop::endpoints
         }
     }
 
+    auto FS_Helper::transferModeOf(Context &context) -> FileOperations::TransferMode
+    {
+        return context.getBody()[json::fs::binaryMode].bool_value() ? FileOperations::TransferMode::Binary
+                                                                     : FileOperations::TransferMode::Json;
+    }
+
+    auto FS_Helper::addTransferParams(json11::Json::object &response, FileOperations::TransferMode mode) -> void
+    {
+        response[json::fs::chunkSize] = static_cast<int>(FileOperations::chunkSizeFor(mode));
+
+        if (mode == FileOperations::TransferMode::Binary) {
+            response[json::fs::binaryMode] = true;
+            response[json::fs::windowSize] = static_cast<int>(FileOperations::BinaryWindowSize);
+        }
+    }
+
     auto FS_Helper::startGetFile(Context &context) const -> ResponseContext
     {
         const std::filesystem::path filePath = context.getBody()[json::fs::fileName].string_value();
@@ -155,12 +171,13 @@ namespace sdesktop::endpoints
         LOG_DEBUG("Checking file");
 
         try {
-            auto [rxID, fileSize] = fileOps.createReceiveIDForFile(filePath);
+            const auto mode       = transferModeOf(context);
+            auto [rxID, fileSize] = fileOps.createReceiveIDForFile(filePath, mode);
 
             code     = http::Code::OK;
-            response = json11::Json::object({{json::fs::rxID, static_cast<int>(rxID)},
-                                             {json::fs::fileSize, static_cast<int>(fileSize)},
-                                             {json::fs::chunkSize, static_cast<int>(FileOperations::ChunkSize)}});
+            response = json11::Json::object(
+                {{json::fs::rxID, static_cast<int>(rxID)}, {json::fs::fileSize, static_cast<int>(fileSize)}});
+            addTransferParams(response, mode);
         }
         catch (std::runtime_error &e) {
             LOG_ERROR("FileOperations exception: %s", e.what());
@@ -253,11 +270,12 @@ namespace sdesktop::endpoints
         json11::Json::object response{};
 
         try {
-            auto txID = fileOps.createTransmitIDForFile(filePath, fileSize, fileCrc32);
+            const auto mode = transferModeOf(context);
+            auto txID       = fileOps.createTransmitIDForFile(filePath, fileSize, fileCrc32, mode);
 
             code     = http::Code::OK;
-            response = json11::Json::object({{json::fs::txID, static_cast<int>(txID)},
-                                             {json::fs::chunkSize, static_cast<int>(FileOperations::ChunkSize)}});
+            response = json11::Json::object({{json::fs::txID, static_cast<int>(txID)}});
+            addTransferParams(response, mode);
         }
         catch (std::runtime_error &e) {
             LOG_ERROR("FileOperations exception: %s", e.what());
@@ -66,6 +66,11 @@ auto FileContext::expectedChunkInFile() const -> std::size_t
     return 1 + chunksInQuantity(offset);
 }
 
+auto FileContext::expectedChunkSize() const -> std::size_t
+{
+    return std::min(chunkSize, size - offset);
+}
+
 auto FileContext::validateChunkRequest(std::uint32_t chunkNo) const -> bool
 {
     return !(chunkNo < 1 || chunkNo > totalChunksInFile() || chunkNo != expectedChunkInFile());
@@ -77,6 +82,15 @@ auto FileContext::fileHash() const -> std::string
 }
 
 auto FileReadContext::read() -> std::vector<std::uint8_t>
+{
+    std::vector<std::uint8_t> buffer(expectedChunkSize());
+
+    read(buffer.data());
+
+    return buffer;
+}
+
+auto FileReadContext::read(std::uint8_t *data) -> std::size_t
 {
     LOG_DEBUG("Getting file data");
 
@@ -89,18 +103,16 @@ auto FileReadContext::read() -> std::vector<std::uint8_t>
 
     file.seekg(offset);
 
-    auto dataLeft = std::min(static_cast<std::size_t>(chunkSize), (size - offset));
-
-    std::vector<std::uint8_t> buffer(dataLeft);
+    auto dataLeft = expectedChunkSize();
 
-    file.read(reinterpret_cast<char *>(buffer.data()), dataLeft);
+    file.read(reinterpret_cast<char *>(data), dataLeft);
 
     if (file.bad()) {
         LOG_ERROR("File %s read error", path.c_str());
         throw std::runtime_error("File read error");
     }
 
-    runningCrc32Digest.add(buffer.data(), dataLeft);
+    runningCrc32Digest.add(data, dataLeft);
 
     LOG_DEBUG("Read %u bytes", static_cast<unsigned int>(dataLeft));
     advanceFileOffset(dataLeft);
@@ -109,7 +121,7 @@ auto FileReadContext::read() -> std::vector<std::uint8_t>
         LOG_DEBUG("Reached EOF");
     }
 
-    return buffer;
+    return dataLeft;
 }
 
 auto FileWriteContext::write(const std::vector<std::uint8_t> &data) -> void
@@ -138,6 +150,64 @@ auto FileWriteContext::write(const std::vector<std::uint8_t> &data) -> void
     }
 }
 
+auto FileWriteContext::startChunk() -> void
+{
+    if (pendingSize != 0) {
+        file.seekp(offset);
+    }
+
+    pendingCrc32Digest = runningCrc32Digest;
+    chunkCrc32Digest.reset();
+    pendingSize = 0;
+}
+
+auto FileWriteContext::writeChunkPart(const std::uint8_t *data, std::size_t dataSize) -> void
+{
+    if (!file.is_open() || file.fail()) {
+        LOG_ERROR("File %s open error", path.c_str());
+        throw std::runtime_error("File open error");
+    }
+
+    if (pendingSize + dataSize > expectedChunkSize()) {
+        LOG_ERROR("Chunk of %s too long", path.c_str());
+        throw std::runtime_error("Chunk too long");
+    }
+
+    file.write(reinterpret_cast<const char *>(data), dataSize);
+
+    if (file.bad()) {
+        LOG_ERROR("File %s write error", path.c_str());
+        throw std::runtime_error("File write error");
+    }
+
+    chunkCrc32Digest.add(data, dataSize);
+    pendingCrc32Digest.add(data, dataSize);
+    pendingSize += dataSize;
+}
+
+auto FileWriteContext::chunkCrc32Matches(std::uint32_t crc32) -> bool
+{
+    return pendingSize == expectedChunkSize() && chunkCrc32Digest.getHashValue() == crc32;
+}
+
+auto FileWriteContext::commitChunk() -> void
+{
+    file.flush();
+
+    if (file.bad()) {
+        LOG_ERROR("File %s write error", path.c_str());
+        throw std::runtime_error("File write error");
+    }
+
+    runningCrc32Digest = pendingCrc32Digest;
+    advanceFileOffset(pendingSize);
+    pendingSize = 0;
+
+    if (reachedEOF()) {
+        LOG_DEBUG("Reached EOF of %s", path.c_str());
+    }
+}
+
 auto FileWriteContext::crc32Matches() const -> bool
 {
     LOG_DEBUG("Hash: %s", fileHash().c_str());
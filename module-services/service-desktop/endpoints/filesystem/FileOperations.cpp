@@ -5,13 +5,16 @@
 #include <base64.h>
 #include <log/log.hpp>
 
+namespace frame = sdesktop::endpoints::message::frame;
+
 FileOperations &FileOperations::instance()
 {
     static FileOperations instance;
     return instance;
 }
 
-auto FileOperations::createReceiveIDForFile(const std::filesystem::path &file) -> std::pair<transfer_id, std::size_t>
+auto FileOperations::createReceiveIDForFile(const std::filesystem::path &file, TransferMode mode)
+    -> std::pair<transfer_id, std::size_t>
 {
     cancelTimedOutReadTransfer();
     const auto rxID = ++runningRxId;
@@ -24,7 +27,7 @@ auto FileOperations::createReceiveIDForFile(const std::filesystem::path &file) -
 
     LOG_DEBUG("Creating rxID %u", static_cast<unsigned>(rxID));
 
-    createFileReadContextFor(file, size, rxID);
+    createFileReadContextFor(file, size, chunkSizeFor(mode), rxID);
 
     return std::make_pair(rxID, size);
 }
@@ -73,19 +76,30 @@ void FileOperations::cancelTimedOutWriteTransfer()
 
 auto FileOperations::createFileReadContextFor(const std::filesystem::path &file,
                                               std::size_t fileSize,
+                                              std::size_t chunkSize,
                                               transfer_id xfrId) -> void
 {
-    readTransfers.insert(
-        std::make_pair(xfrId, std::make_unique<FileReadContext>(file, fileSize, FileOperations::ChunkSize)));
+    readTransfers.insert(std::make_pair(xfrId, std::make_unique<FileReadContext>(file, fileSize, chunkSize)));
 }
 
 auto FileOperations::createFileWriteContextFor(const std::filesystem::path &file,
                                                std::size_t fileSize,
+                                               std::size_t chunkSize,
                                                const std::string &Crc32,
                                                transfer_id xfrId) -> void
 {
-    writeTransfers.insert(
-        std::make_pair(xfrId, std::make_unique<FileWriteContext>(file, fileSize, FileOperations::ChunkSize, Crc32)));
+    writeTransfers.insert(std::make_pair(xfrId, std::make_unique<FileWriteContext>(file, fileSize, chunkSize, Crc32)));
+}
+
+auto FileOperations::abortWriteTransfer(transfer_id xfrId) -> void
+{
+    const auto fileCtxEntry = writeTransfers.find(xfrId);
+    if (fileCtxEntry == writeTransfers.end()) {
+        return;
+    }
+
+    fileCtxEntry->second->removeFile();
+    writeTransfers.erase(fileCtxEntry);
 }
 
 auto FileOperations::encodedSize(std::size_t binarySize) const -> std::size_t
@@ -164,17 +178,68 @@ auto FileOperations::getDataForReceiveID(transfer_id rxID, std::uint32_t chunkNo
     return {std::move(encodeDataAsBase64(data)), std::move(fileCrc32)};
 }
 
+auto FileOperations::getFrameForReceiveID(transfer_id rxID, std::uint32_t chunkNo) -> std::unique_ptr<std::string>
+{
+    frame::Header header{frame::Type::Data, frame::Status::OK, rxID, chunkNo};
+
+    const auto fileCtxEntry = readTransfers.find(rxID);
+    if (fileCtxEntry == readTransfers.end() || !fileCtxEntry->second) {
+        LOG_ERROR("Invalid rxID %u", static_cast<unsigned>(rxID));
+        header.status = frame::Status::InvalidTransfer;
+        return frame::buildFrame(header);
+    }
+
+    auto fileCtx = fileCtxEntry->second.get();
+
+    if (!fileCtx->validateChunkRequest(chunkNo)) {
+        LOG_ERROR("Invalid chunkNo %u", static_cast<unsigned>(chunkNo));
+        header.status = frame::Status::InvalidChunk;
+        return frame::buildFrame(header);
+    }
+
+    const auto length = fileCtx->expectedChunkSize();
+    auto dataFrame    = frame::buildFrame(header, length);
+    dataFrame->resize(frame::size_header + length);
+    const auto data = reinterpret_cast<std::uint8_t *>(dataFrame->data() + frame::size_header);
+
+    try {
+        fileCtx->read(data);
+    }
+    catch (const std::exception &e) {
+        LOG_ERROR("File read error: %s", e.what());
+        readTransfers.erase(fileCtxEntry);
+        header.status = frame::Status::FileError;
+        return frame::buildFrame(header);
+    }
+
+    CRC32 chunkCrc32;
+    chunkCrc32.add(data, length);
+    header.length = length;
+    header.crc32  = chunkCrc32.getHashValue();
+    frame::encodeHeader(header, dataFrame->data());
+
+    if (fileCtx->reachedEOF()) {
+        LOG_DEBUG("Reached EOF for rxID %u", static_cast<unsigned>(rxID));
+        readTransfers.erase(fileCtxEntry);
+    }
+
+    return dataFrame;
+}
+
 auto FileOperations::createTransmitIDForFile(const std::filesystem::path &file,
                                              std::size_t size,
-                                             const std::string &Crc32) -> transfer_id
+                                             const std::string &Crc32,
+                                             TransferMode mode) -> transfer_id
 {
     cancelTimedOutWriteTransfer();
     const auto txID = ++runningTxId;
 
     LOG_DEBUG("Creating txID %u", static_cast<unsigned>(txID));
 
-    createFileWriteContextFor(file, size, Crc32, txID);
-    fileData = std::make_unique<std::vector<uint8_t>>(SingleChunkSize, 0);
+    createFileWriteContextFor(file, size, chunkSizeFor(mode), Crc32, txID);
+    if (mode == TransferMode::Json) {
+        fileData = std::make_unique<std::vector<uint8_t>>(SingleChunkSize, 0);
+    }
     return txID;
 }
 
@@ -226,6 +291,83 @@ auto FileOperations::sendDataForTransmitID(transfer_id txID, std::uint32_t chunk
     return returnCode;
 }
 
+auto FileOperations::startChunkForTransmitID(transfer_id txID, std::uint32_t chunkNo, std::size_t length)
+    -> FrameStatus
+{
+    const auto fileCtxEntry = writeTransfers.find(txID);
+    if (fileCtxEntry == writeTransfers.end() || !fileCtxEntry->second) {
+        LOG_ERROR("Invalid txID %u", static_cast<unsigned>(txID));
+        return FrameStatus::InvalidTransfer;
+    }
+
+    auto fileCtx = fileCtxEntry->second.get();
+
+    if (!fileCtx->validateChunkRequest(chunkNo) || length != fileCtx->expectedChunkSize()) {
+        LOG_ERROR("Invalid chunkNo %u of %zuB", static_cast<unsigned>(chunkNo), length);
+        return FrameStatus::InvalidChunk;
+    }
+
+    fileCtx->startChunk();
+    return FrameStatus::OK;
+}
+
+auto FileOperations::writeChunkForTransmitID(transfer_id txID, const std::uint8_t *data, std::size_t size)
+    -> FrameStatus
+{
+    const auto fileCtxEntry = writeTransfers.find(txID);
+    if (fileCtxEntry == writeTransfers.end()) {
+        return FrameStatus::InvalidTransfer;
+    }
+
+    try {
+        fileCtxEntry->second->writeChunkPart(data, size);
+    }
+    catch (const std::exception &e) {
+        LOG_ERROR("Exception during writing txID %u: %s", static_cast<unsigned>(txID), e.what());
+        abortWriteTransfer(txID);
+        return FrameStatus::FileError;
+    }
+    return FrameStatus::OK;
+}
+
+auto FileOperations::finishChunkForTransmitID(transfer_id txID, std::uint32_t crc32) -> FrameStatus
+{
+    const auto fileCtxEntry = writeTransfers.find(txID);
+    if (fileCtxEntry == writeTransfers.end()) {
+        return FrameStatus::InvalidTransfer;
+    }
+
+    auto fileCtx = fileCtxEntry->second.get();
+
+    if (!fileCtx->chunkCrc32Matches(crc32)) {
+        LOG_ERROR("Chunk CRC32 mismatch for txID %u", static_cast<unsigned>(txID));
+        return FrameStatus::CorruptedChunk;
+    }
+
+    try {
+        fileCtx->commitChunk();
+    }
+    catch (const std::exception &e) {
+        LOG_ERROR("Exception during writing txID %u: %s", static_cast<unsigned>(txID), e.what());
+        abortWriteTransfer(txID);
+        return FrameStatus::FileError;
+    }
+
+    if (!fileCtx->reachedEOF()) {
+        return FrameStatus::OK;
+    }
+
+    LOG_DEBUG("Reached EOF for txID %u", static_cast<unsigned>(txID));
+    if (!fileCtx->crc32Matches()) {
+        LOG_ERROR("File CRC32 mismatch");
+        abortWriteTransfer(txID);
+        return FrameStatus::CorruptedFile;
+    }
+
+    writeTransfers.erase(fileCtxEntry);
+    return FrameStatus::OK;
+}
+
 auto FileOperations::cleanUpUndeliveredTransfers() -> void
 {
     if (writeTransfers.empty()) {
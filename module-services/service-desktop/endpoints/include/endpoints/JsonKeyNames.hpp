@@ -77,6 +77,7 @@ namespace sdesktop::endpoints::json
         inline constexpr auto categoryTemplate = "template";
         inline constexpr auto categoryBackup   = "backup";
         inline constexpr auto categorySync     = "sync";
+        inline constexpr auto syncTokens       = "syncTokens";
 
         inline constexpr auto limit              = "limit";
         inline constexpr auto offset             = "offset";
@@ -1,4 +1,4 @@
-﻿// Copyright (c) 2017-2022, Mudita Sp. z.o.o. All rights reserved.
+﻿// Copyright (c) 2017-2023, Mudita Sp. z.o.o. All rights reserved.
 // For licensing, see https://github.com/mudita/MuditaOS/LICENSE.md
 
 #pragma once
@@ -64,6 +64,10 @@ namespace sdesktop::endpoints
         inline constexpr auto simStateInfo          = "simState";
         inline constexpr auto cellularStateInfo     = "cellularState";
         inline constexpr auto cellularSleepModeInfo = "cellularSleepMode";
+        /// base64 encoded MessagePack snapshot of sys::telemetry
+        inline constexpr auto telemetryInfo = "telemetry";
+        /// input latency trace in the Chrome trace event format, recorded since the previous request
+        inline constexpr auto traceInfo = "trace";
 
         /// values for smsCommand
         inline constexpr auto smsAdd = "smsAdd";
@@ -24,6 +24,8 @@ namespace sdesktop::endpoints
         inline constexpr auto data         = "data";
         inline constexpr auto rxID         = "rxID";
         inline constexpr auto txID         = "txID";
+        inline constexpr auto binaryMode   = "binaryMode";
+        inline constexpr auto windowSize   = "windowSize";
 
         inline constexpr auto fileDoesNotExist = "file does not exist";
     } // namespace json::fs
@@ -53,6 +55,9 @@ namespace sdesktop::endpoints
 
         auto requestLogsFlush() const -> void;
 
+        static auto transferModeOf(Context &context) -> FileOperations::TransferMode;
+        static auto addTransferParams(json11::Json::object &response, FileOperations::TransferMode mode) -> void;
+
         FileOperations &fileOps;
     };
 } // namespace sdesktop::endpoints
@@ -35,6 +35,8 @@ class FileContext
 
     auto expectedChunkInFile() const -> std::size_t;
 
+    auto expectedChunkSize() const -> std::size_t;
+
     auto fileHash() const -> std::string;
 
   protected:
@@ -56,6 +58,9 @@ class FileReadContext : public FileContext
     ~FileReadContext();
 
     auto read() -> std::vector<std::uint8_t>;
+
+    /// Reads the next chunk straight into `data` which has to hold `expectedChunkSize()` bytes
+    auto read(std::uint8_t *data) -> std::size_t;
 };
 
 class FileWriteContext : public FileContext
@@ -75,8 +80,21 @@ class FileWriteContext : public FileContext
 
     auto write(const std::vector<std::uint8_t> &data) -> void;
 
+    /// Chunks of the binary transfers are written as they arrive. The chunk is accounted for only when committed,
+    /// a discarded chunk is overwritten by the next attempt.
+    auto startChunk() -> void;
+
+    auto writeChunkPart(const std::uint8_t *data, std::size_t dataSize) -> void;
+
+    auto chunkCrc32Matches(std::uint32_t crc32) -> bool;
+
+    auto commitChunk() -> void;
+
   private:
     std::string crc32Digest{};
+    CRC32 chunkCrc32Digest;
+    CRC32 pendingCrc32Digest;
+    std::size_t pendingSize{};
 
     std::ofstream file{};
 };
@@ -5,6 +5,7 @@
 
 #include "FileContext.hpp"
 
+#include <endpoints/message/Frame.hpp>
 #include <log/log.hpp>
 #include <filesystem>
 #include <vector>
@@ -20,6 +21,7 @@ class FileOperations
     FileOperations &operator=(const FileOperations &) = delete;
 
     using transfer_id = std::uint32_t;
+    using FrameStatus = sdesktop::endpoints::message::frame::Status;
 
     std::map<transfer_id, std::unique_ptr<FileReadContext>> readTransfers;
     std::map<transfer_id, std::unique_ptr<FileWriteContext>> writeTransfers;
@@ -27,13 +29,19 @@ class FileOperations
     std::atomic<transfer_id> runningRxId{0};
     std::atomic<transfer_id> runningTxId{0};
     std::unique_ptr<std::vector<std::uint8_t>> fileData{};
-    auto createFileReadContextFor(const std::filesystem::path &file, std::size_t fileSize, transfer_id xfrId) -> void;
+    auto createFileReadContextFor(const std::filesystem::path &file,
+                                  std::size_t fileSize,
+                                  std::size_t chunkSize,
+                                  transfer_id xfrId) -> void;
 
     auto createFileWriteContextFor(const std::filesystem::path &file,
                                    std::size_t fileSize,
+                                   std::size_t chunkSize,
                                    const std::string &Crc32,
                                    transfer_id xfrId) -> void;
 
+    auto abortWriteTransfer(transfer_id xfrId) -> void;
+
     auto encodeDataAsBase64(const std::vector<std::uint8_t> &binaryData) const -> std::string;
 
     auto decodeDataFromBase64(const std::string &encodedData) -> void;
@@ -54,6 +62,21 @@ class FileOperations
     static constexpr auto SingleChunkSize     = Base64ToBinFactor * BinToBase64Factor * 1024u; // 12KB
     static constexpr auto ChunkSizeMultiplier = 12u;
     static constexpr auto ChunkSize           = ChunkSizeMultiplier * SingleChunkSize;
+    // Binary chunks are neither encoded nor copied into JSON, so they can be larger at the same memory cost
+    static constexpr auto BinaryChunkSize = 2 * ChunkSize;
+    // Number of chunks the host may keep in flight without waiting for the acknowledgement
+    static constexpr auto BinaryWindowSize = 2u;
+
+    enum class TransferMode
+    {
+        Json,
+        Binary
+    };
+
+    static constexpr auto chunkSizeFor(TransferMode mode) -> std::size_t
+    {
+        return mode == TransferMode::Binary ? BinaryChunkSize : ChunkSize;
+    }
 
     struct DataWithCrc32
     {
@@ -63,14 +86,27 @@ class FileOperations
 
     static FileOperations &instance();
 
-    auto createReceiveIDForFile(const std::filesystem::path &file) -> std::pair<transfer_id, std::size_t>;
+    auto createReceiveIDForFile(const std::filesystem::path &file, TransferMode mode = TransferMode::Json)
+        -> std::pair<transfer_id, std::size_t>;
 
     auto getDataForReceiveID(transfer_id, std::uint32_t chunkNo) -> DataWithCrc32;
 
-    auto createTransmitIDForFile(const std::filesystem::path &file, std::size_t size, const std::string &Crc32)
-        -> transfer_id;
+    /// Data frame with the chunk read straight into it, or an empty frame with the error status
+    auto getFrameForReceiveID(transfer_id, std::uint32_t chunkNo) -> std::unique_ptr<std::string>;
+
+    auto createTransmitIDForFile(const std::filesystem::path &file,
+                                 std::size_t size,
+                                 const std::string &Crc32,
+                                 TransferMode mode = TransferMode::Json) -> transfer_id;
 
     auto sendDataForTransmitID(transfer_id, std::uint32_t chunkNo, const std::string &data) -> sys::ReturnCodes;
 
+    /// Chunks of binary frames are written to the file as they arrive and verified once the whole frame is received
+    auto startChunkForTransmitID(transfer_id, std::uint32_t chunkNo, std::size_t length) -> FrameStatus;
+
+    auto writeChunkForTransmitID(transfer_id, const std::uint8_t *data, std::size_t size) -> FrameStatus;
+
+    auto finishChunkForTransmitID(transfer_id, std::uint32_t crc32) -> FrameStatus;
+
     auto cleanUpUndeliveredTransfers() -> void;
 };
@@ -7,6 +7,7 @@
 #include <service-appmgr/messages/ActionRequest.hpp>
 #include <Service/Message.hpp>
 #include <MessageType.hpp>
+#include <module-db/Database/SyncChanges.hpp>
 #include <service-desktop/DeveloperModeMessage.hpp>
 #include <service-desktop/DesktopEvent.hpp>
 
@@ -23,9 +24,12 @@ namespace sdesktop
     class SyncMessage : public sys::DataMessage
     {
       public:
-        SyncMessage() : sys::DataMessage(MessageType::Sync)
+        explicit SyncMessage(db::sync::Tokens syncTokens = {})
+            : sys::DataMessage(MessageType::Sync), syncTokens(std::move(syncTokens))
         {}
         ~SyncMessage() override = default;
+
+        db::sync::Tokens syncTokens;
     };
 
     class RestoreMessage : public sys::DataMessage
@@ -1,10 +1,11 @@
-﻿// Copyright (c) 2017-2022, Mudita Sp. z.o.o. All rights reserved.
+﻿// Copyright (c) 2017-2023, Mudita Sp. z.o.o. All rights reserved.
 // For licensing, see https://github.com/mudita/MuditaOS/LICENSE.md
 
 #pragma once
 
 #include <endpoints/JsonKeyNames.hpp>
 #include <json11.hpp>
+#include <module-db/Database/SyncChanges.hpp>
 #include <filesystem>
 
 namespace sys
@@ -43,7 +44,6 @@ class Sync
         Success,
         DBError,
         FSError,
-        PackError,
         OtherError
     };
 
@@ -56,8 +56,6 @@ class Sync
             return "DB operation error";
         case CompletionCode::FSError:
             return "FSError error";
-        case CompletionCode::PackError:
-            return "Backup pack failed";
         case CompletionCode::OtherError:
             return "Undetermined error";
         }
@@ -66,7 +64,7 @@ class Sync
 
     struct OperationStatus
     {
-        std::filesystem::path tempDir;
+        std::filesystem::path packagePath;
         CompletionCode completionCode = CompletionCode::Success;
         OperationState state = OperationState::Stopped;
         json11::Json to_json() const
@@ -81,10 +79,10 @@ class Sync
         }
     };
 
-    static CompletionCode PrepareSyncPackage(sys::Service *ownerService, std::filesystem::path &path);
+    static CompletionCode PrepareSyncPackage(sys::Service *ownerService,
+                                             const std::filesystem::path &packagePath,
+                                             const db::sync::Tokens &syncTokens);
 
   private:
-    static bool RemoveSyncDir(const std::filesystem::path &path);
-    static bool CreateSyncDir(const std::filesystem::path &path);
-    static bool PackSyncFiles(const std::filesystem::path &path);
+    static bool RemoveSyncPackage(const std::filesystem::path &packagePath);
 };
@@ -0,0 +1,110 @@
+// Copyright (c) 2017-2023, Mudita Sp. z.o.o. All rights reserved.
+// For licensing, see https://github.com/mudita/MuditaOS/LICENSE.md
+
+#pragma once
+
+#include "Common.hpp"
+
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <string>
+
+/// Frames of the file transfers negotiated in the binary mode. A frame starts with `message::rawDataChar`
+/// followed by the rest of the fixed size header and `length` bytes of raw payload:
+///
+/// | '$' | type | status | reserved | transferID | chunkNo | length | crc32 |
+///
+/// All the numbers are 32-bit little endian, `crc32` is the checksum of the payload of the frame.
+namespace sdesktop::endpoints::message::frame
+{
+    enum class Type : std::uint8_t
+    {
+        Data    = 'D', ///< Chunk of a file, sent in both directions
+        Request = 'R', ///< Request for a chunk of a file downloaded by the host
+        Ack     = 'A', ///< Confirmation of a chunk of a file uploaded by the host
+    };
+
+    enum class Status : std::uint8_t
+    {
+        OK,
+        InvalidTransfer,
+        InvalidChunk,
+        CorruptedChunk,
+        CorruptedFile,
+        FileError,
+    };
+
+    struct Header
+    {
+        Type type;
+        Status status            = Status::OK;
+        std::uint32_t transferID = 0;
+        std::uint32_t chunkNo    = 0;
+        std::uint32_t length     = 0;
+        std::uint32_t crc32      = 0;
+    };
+
+    inline constexpr auto size_header = 20U;
+
+    namespace detail
+    {
+        inline void putUint32(char *out, std::uint32_t value)
+        {
+            for (auto i = 0U; i < sizeof(value); ++i) {
+                out[i] = static_cast<char>(value >> (8 * i));
+            }
+        }
+
+        inline std::uint32_t getUint32(const char *in)
+        {
+            std::uint32_t value = 0;
+            for (auto i = 0U; i < sizeof(value); ++i) {
+                value |= static_cast<std::uint32_t>(static_cast<std::uint8_t>(in[i])) << (8 * i);
+            }
+            return value;
+        }
+    } // namespace detail
+
+    inline void encodeHeader(const Header &header, char *out)
+    {
+        out[0] = rawDataChar;
+        out[1] = static_cast<char>(header.type);
+        out[2] = static_cast<char>(header.status);
+        out[3] = 0;
+        detail::putUint32(out + 4, header.transferID);
+        detail::putUint32(out + 8, header.chunkNo);
+        detail::putUint32(out + 12, header.length);
+        detail::putUint32(out + 16, header.crc32);
+    }
+
+    /// `data` has to hold at least `size_header` bytes
+    inline std::optional<Header> decodeHeader(const char *data)
+    {
+        if (data[0] != rawDataChar) {
+            return std::nullopt;
+        }
+
+        const auto type = static_cast<Type>(data[1]);
+        if (type != Type::Data && type != Type::Request && type != Type::Ack) {
+            return std::nullopt;
+        }
+
+        Header header{type};
+        header.status     = static_cast<Status>(data[2]);
+        header.transferID = detail::getUint32(data + 4);
+        header.chunkNo    = detail::getUint32(data + 8);
+        header.length     = detail::getUint32(data + 12);
+        header.crc32      = detail::getUint32(data + 16);
+        return header;
+    }
+
+    /// Frame with the encoded header and room reserved for `payloadCapacity` bytes of the payload
+    inline std::unique_ptr<std::string> buildFrame(const Header &header, std::size_t payloadCapacity = 0)
+    {
+        auto frame = std::make_unique<std::string>(size_header, '\0');
+        frame->reserve(size_header + payloadCapacity);
+        encodeHeader(header, frame->data());
+        return frame;
+    }
+} // namespace sdesktop::endpoints::message::frame
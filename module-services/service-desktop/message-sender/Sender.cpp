@@ -22,3 +22,11 @@ void sdesktop::endpoints::sender::putToSendQueue(const json11::Json &msg)
         xQueueSend(sendQueue, &responseString, portMAX_DELAY);
     }
 }
+
+void sdesktop::endpoints::sender::putToSendQueue(std::unique_ptr<std::string> msg)
+{
+    if (uxQueueSpacesAvailable(sendQueue) != 0) {
+        auto rawMsg = msg.release();
+        xQueueSend(sendQueue, &rawMsg, portMAX_DELAY);
+    }
+}
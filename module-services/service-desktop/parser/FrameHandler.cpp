@@ -0,0 +1,52 @@
+// Copyright (c) 2017-2023, Mudita Sp. z.o.o. All rights reserved.
+// For licensing, see https://github.com/mudita/MuditaOS/LICENSE.md
+
+#include "FrameHandler.hpp"
+
+#include <endpoints/filesystem/FileOperations.hpp>
+#include <endpoints/message/Sender.hpp>
+#include <log/log.hpp>
+
+namespace sdesktop::endpoints
+{
+    using namespace message::frame;
+
+    FrameHandler::FrameHandler(FileOperations &fileOps) : fileOps(fileOps)
+    {}
+
+    void FrameHandler::startFrame(const Header &frameHeader)
+    {
+        header = frameHeader;
+        status = Status::OK;
+
+        if (header.type == Type::Data) {
+            status = fileOps.startChunkForTransmitID(header.transferID, header.chunkNo, header.length);
+        }
+    }
+
+    void FrameHandler::processPayload(const char *data, std::size_t size)
+    {
+        if (header.type != Type::Data || status != Status::OK) {
+            return;
+        }
+        status = fileOps.writeChunkForTransmitID(header.transferID, reinterpret_cast<const std::uint8_t *>(data), size);
+    }
+
+    void FrameHandler::finishFrame()
+    {
+        switch (header.type) {
+        case Type::Request:
+            sender::putToSendQueue(fileOps.getFrameForReceiveID(header.transferID, header.chunkNo));
+            break;
+        case Type::Data:
+            if (status == Status::OK) {
+                status = fileOps.finishChunkForTransmitID(header.transferID, header.crc32);
+            }
+            sender::putToSendQueue(buildFrame(Header{Type::Ack, status, header.transferID, header.chunkNo}));
+            break;
+        default:
+            LOG_ERROR("Unexpected frame type: %c", static_cast<char>(header.type));
+            break;
+        }
+    }
+} // namespace sdesktop::endpoints
@@ -0,0 +1,30 @@
+// Copyright (c) 2017-2023, Mudita Sp. z.o.o. All rights reserved.
+// For licensing, see https://github.com/mudita/MuditaOS/LICENSE.md
+
+#pragma once
+
+#include <endpoints/message/Frame.hpp>
+
+#include <cstddef>
+
+class FileOperations;
+
+namespace sdesktop::endpoints
+{
+    /// Handles binary frames of the file transfers started in the binary mode by the filesystem endpoint.
+    /// The payload is passed to the file as it is received, it is never gathered in a buffer.
+    class FrameHandler
+    {
+      public:
+        explicit FrameHandler(FileOperations &fileOps);
+
+        void startFrame(const message::frame::Header &header);
+        void processPayload(const char *data, std::size_t size);
+        void finishFrame();
+
+      private:
+        FileOperations &fileOps;
+        message::frame::Header header{message::frame::Type::Data};
+        message::frame::Status status = message::frame::Status::OK;
+    };
+} // namespace sdesktop::endpoints
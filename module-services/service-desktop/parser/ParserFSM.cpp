@@ -4,12 +4,14 @@
 #include "ParserFSM.hpp"
 
 #include <log/log.hpp>
+#include <algorithm>
 #include <memory>
 #include <string>
 
 #include <Timers/TimerFactory.hpp>
 #include "MessageHandler.hpp"
 #include <endpoints/EndpointFactory.hpp>
+#include <endpoints/filesystem/FileOperations.hpp>
 #include <endpoints/message/Common.hpp>
 
 namespace
@@ -23,7 +25,7 @@ namespace sdesktop::endpoints
 {
 
     StateMachine::StateMachine(sys::Service *OwnerService)
-        : OwnerServicePtr(OwnerService),
+        : OwnerServicePtr(OwnerService), frameHandler(FileOperations::instance()),
           parserTimer{sys::TimerFactory::createSingleShotTimer(
               OwnerService, parserTimerName, receiveMsgTimerDelayMs, [this](sys::Timer & /*timer*/) { resetParser(); })}
     {}
@@ -44,6 +46,12 @@ namespace sdesktop::endpoints
         case State::ReceivedPartialPayload:
             parsePartialMessage();
             break;
+        case State::ReceivedPartialFrameHeader:
+            parseFrameHeader();
+            break;
+        case State::ReceivedPartialFramePayload:
+            parseFramePayload(0);
+            break;
 
         default:
             break;
@@ -54,7 +62,8 @@ namespace sdesktop::endpoints
     {
         payload.clear();
         header.clear();
-        payloadLength = 0;
+        payloadLength    = 0;
+        framePayloadLeft = 0;
 
         setState(State::NoMsg);
         LOG_DEBUG("Parser state reset");
@@ -71,6 +80,11 @@ namespace sdesktop::endpoints
         header.clear();
         payloadLength = 0;
 
+        if (!receivedMsg.empty() && receivedMsg.front() == message::rawDataChar) {
+            parseFrameHeader();
+            return;
+        }
+
         auto messageStart = receivedMsg.find(message::endpointChar);
         if (messageStart == std::string::npos) {
             LOG_ERROR("This is not a valid endpoint message! Type=%c", receivedMsg.at(0));
@@ -181,6 +195,57 @@ namespace sdesktop::endpoints
         parserTimer.stop();
     }
 
+    void StateMachine::parseFrameHeader()
+    {
+        const auto missingHeaderLength = message::frame::size_header - header.size();
+
+        if (receivedMsg.size() < missingHeaderLength) // header divided in few parts
+        {
+            header.append(receivedMsg);
+            setState(State::ReceivedPartialFrameHeader);
+            return;
+        }
+
+        header.append(receivedMsg, 0, missingHeaderLength);
+        const auto frameHeader = message::frame::decodeHeader(header.data());
+        if (!frameHeader.has_value() || frameHeader->length > FileOperations::BinaryChunkSize) {
+            LOG_ERROR("Damaged frame header!");
+            header.clear();
+            setState(State::NoMsg);
+            return;
+        }
+
+        frameHandler.startFrame(*frameHeader);
+        framePayloadLeft = frameHeader->length;
+        parseFramePayload(missingHeaderLength);
+    }
+
+    void StateMachine::parseFramePayload(std::size_t pos)
+    {
+        // Payload goes to the handler straight from the received buffer, piece by piece
+        const auto received = std::min(receivedMsg.size() - pos, framePayloadLeft);
+        if (received > 0) {
+            frameHandler.processPayload(receivedMsg.data() + pos, received);
+            framePayloadLeft -= received;
+            pos += received;
+        }
+
+        if (framePayloadLeft > 0) {
+            setState(State::ReceivedPartialFramePayload);
+            return;
+        }
+
+        frameHandler.finishFrame();
+        header.clear();
+        setState(State::NoMsg);
+        parserTimer.stop();
+
+        if (pos < receivedMsg.size()) { // contains part of new header
+            message::eraseFront(receivedMsg, pos);
+            parseHeader();
+        }
+    }
+
     void StateMachine::setMessageHandler(std::unique_ptr<MessageHandler> handler)
     {
         messageHandler = std::move(handler);
@@ -3,6 +3,7 @@
 
 #pragma once
 
+#include "FrameHandler.hpp"
 #include "MessageHandler.hpp"
 
 #include <Timers/TimerHandle.hpp>
@@ -19,6 +20,8 @@ namespace sdesktop::endpoints
         NoMsg,
         ReceivedPartialHeader,
         ReceivedPartialPayload,
+        ReceivedPartialFrameHeader,
+        ReceivedPartialFramePayload,
     };
 
     class StateMachine
@@ -46,6 +49,8 @@ namespace sdesktop::endpoints
         unsigned long payloadLength   = 0;
         sys::Service *OwnerServicePtr = nullptr;
         std::unique_ptr<MessageHandler> messageHandler;
+        FrameHandler frameHandler;
+        std::size_t framePayloadLeft = 0;
         sys::TimerHandle parserTimer;
 
         void parseHeader();
@@ -55,6 +60,8 @@ namespace sdesktop::endpoints
         void parseNewMessage();
         void parsePartialMessage();
         void parsePayload();
+        void parseFrameHeader();
+        void parseFramePayload(std::size_t pos);
     };
 
 } // namespace sdesktop::endpoints
@@ -1,4 +1,4 @@
-﻿// Copyright (c) 2017-2022, Mudita Sp. z.o.o. All rights reserved.
+﻿// Copyright (c) 2017-2023, Mudita Sp. z.o.o. All rights reserved.
 // For licensing, see https://github.com/mudita/MuditaOS/LICENSE.md
 
 #include <endpoints/Endpoint.hpp>
@@ -10,6 +10,7 @@
 #include <endpoints/messages/MessageHelper.hpp>
 #include <endpoints/filesystem/FileContext.hpp>
 #include <endpoints/filesystem/FileOperations.hpp>
+#include <endpoints/message/Frame.hpp>
 #include <ParserFSM.hpp>
 
 #include <Common/Common.hpp>
@@ -23,6 +24,8 @@
 #include <utf8/UTF8.hpp>
 #include <memory>
 #include <filesystem>
+#include <fstream>
+#include <iterator>
 #include <string>
 #include <vector>
 
@@ -111,6 +114,49 @@ TEST_CASE("Parser Test")
         parser.processMessage(std::move(testMessage));
         REQUIRE(parser.getCurrentState() == State::NoMsg);
     }
+    SECTION("Parse binary frame divided in parts followed by message")
+    {
+        using namespace message;
+        auto frame = frame::buildFrame({frame::Type::Data, frame::Status::OK, 1000, 1, 4, 0});
+        frame->append("data");
+        frame->append(R"(#000000050{"endpoint":1, "method":1, "body":{"test":"test"}})");
+
+        parser.processMessage(frame->substr(0, 7));
+        REQUIRE(parser.getCurrentState() == State::ReceivedPartialFrameHeader);
+
+        parser.processMessage(frame->substr(7, frame::size_header - 5));
+        REQUIRE(parser.getCurrentState() == State::ReceivedPartialFramePayload);
+
+        parser.processMessage(frame->substr(frame::size_header + 2));
+        REQUIRE(parser.getCurrentState() == State::NoMsg);
+    }
+    SECTION("Parse binary frame with damaged header")
+    {
+        std::string testMessage = "$X" + std::string(message::frame::size_header, '0');
+        parser.processMessage(std::move(testMessage));
+        REQUIRE(parser.getCurrentState() == State::NoMsg);
+    }
+}
+
+TEST_CASE("Binary frame header")
+{
+    using namespace message::frame;
+    const Header header{Type::Ack, Status::CorruptedChunk, 0x01020304, 7, 0xA0B0C0D0, 0xDEADBEEF};
+
+    const auto frame = buildFrame(header);
+    REQUIRE(frame->size() == size_header);
+    REQUIRE(frame->at(4) == 0x04);
+
+    const auto decoded = decodeHeader(frame->data());
+    REQUIRE(decoded.has_value());
+    REQUIRE(decoded->type == header.type);
+    REQUIRE(decoded->status == header.status);
+    REQUIRE(decoded->transferID == header.transferID);
+    REQUIRE(decoded->chunkNo == header.chunkNo);
+    REQUIRE(decoded->length == header.length);
+    REQUIRE(decoded->crc32 == header.crc32);
+
+    REQUIRE_FALSE(decodeHeader(std::string(size_header, '#').data()).has_value());
 }
 
 TEST_CASE("DB Helpers test - json decoding")
@@ -392,3 +438,125 @@ TEST_CASE("FileOperations UT Test Send File")
         REQUIRE(txID != 0);
     }
 }
+
+TEST_CASE("FileOperations UT Test Binary Upload")
+{
+    using namespace sdesktop::endpoints::message;
+    auto &fileOps = FileOperations::instance();
+
+    const auto filePath = std::filesystem::path{"/sys/user/binary_upload"};
+    std::string fileData(FileOperations::BinaryChunkSize + 100, '\0');
+    for (std::size_t i = 0; i < fileData.size(); ++i) {
+        fileData[i] = static_cast<char>(i * 7);
+    }
+    const auto data = reinterpret_cast<const std::uint8_t *>(fileData.data());
+
+    CRC32 fileCrc32;
+    fileCrc32.add(data, fileData.size());
+    const auto txID = fileOps.createTransmitIDForFile(
+        filePath, fileData.size(), fileCrc32.getHash(), FileOperations::TransferMode::Binary);
+
+    const auto chunkCrc32 = [](const std::uint8_t *chunk, std::size_t size) {
+        CRC32 crc32;
+        crc32.add(chunk, size);
+        return crc32.getHashValue();
+    };
+
+    const auto firstSize  = FileOperations::BinaryChunkSize;
+    const auto secondSize = fileData.size() - firstSize;
+
+    SECTION("Chunks written in parts")
+    {
+        REQUIRE(fileOps.startChunkForTransmitID(txID, 1, firstSize) == frame::Status::OK);
+        REQUIRE(fileOps.writeChunkForTransmitID(txID, data, 1000) == frame::Status::OK);
+        REQUIRE(fileOps.writeChunkForTransmitID(txID, data + 1000, firstSize - 1000) == frame::Status::OK);
+        REQUIRE(fileOps.finishChunkForTransmitID(txID, chunkCrc32(data, firstSize)) == frame::Status::OK);
+
+        REQUIRE(fileOps.startChunkForTransmitID(txID, 1, firstSize) == frame::Status::InvalidChunk);
+        REQUIRE(fileOps.startChunkForTransmitID(txID, 2, firstSize) == frame::Status::InvalidChunk);
+
+        REQUIRE(fileOps.startChunkForTransmitID(txID, 2, secondSize) == frame::Status::OK);
+        REQUIRE(fileOps.writeChunkForTransmitID(txID, data + firstSize, secondSize) == frame::Status::OK);
+        REQUIRE(fileOps.finishChunkForTransmitID(txID, chunkCrc32(data + firstSize, secondSize)) ==
+                frame::Status::OK);
+    }
+
+    SECTION("Corrupted chunk is retried")
+    {
+        REQUIRE(fileOps.startChunkForTransmitID(txID, 1, firstSize) == frame::Status::OK);
+        REQUIRE(fileOps.writeChunkForTransmitID(txID, data, firstSize) == frame::Status::OK);
+        REQUIRE(fileOps.finishChunkForTransmitID(txID, chunkCrc32(data, firstSize)) == frame::Status::OK);
+
+        std::string corrupted(fileData, firstSize);
+        corrupted[secondSize / 2] ^= 0x10;
+        REQUIRE(fileOps.startChunkForTransmitID(txID, 2, secondSize) == frame::Status::OK);
+        REQUIRE(fileOps.writeChunkForTransmitID(
+                    txID, reinterpret_cast<const std::uint8_t *>(corrupted.data()), secondSize) == frame::Status::OK);
+        REQUIRE(fileOps.finishChunkForTransmitID(txID, chunkCrc32(data + firstSize, secondSize)) ==
+                frame::Status::CorruptedChunk);
+
+        REQUIRE(fileOps.startChunkForTransmitID(txID, 2, secondSize) == frame::Status::OK);
+        REQUIRE(fileOps.writeChunkForTransmitID(txID, data + firstSize, secondSize) == frame::Status::OK);
+        REQUIRE(fileOps.finishChunkForTransmitID(txID, chunkCrc32(data + firstSize, secondSize)) ==
+                frame::Status::OK);
+    }
+
+    REQUIRE(fileOps.startChunkForTransmitID(txID, 2, secondSize) == frame::Status::InvalidTransfer);
+
+    std::ifstream file(filePath, std::ios::binary);
+    const std::string written{std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>()};
+    REQUIRE(written == fileData);
+    std::filesystem::remove(filePath);
+}
+
+TEST_CASE("FileOperations UT Test Binary Download")
+{
+    using namespace sdesktop::endpoints::message;
+    auto &fileOps = FileOperations::instance();
+
+    const auto filePath = std::filesystem::path{"/sys/user/binary_download"};
+    std::string fileData(FileOperations::BinaryChunkSize + 100, '\0');
+    for (std::size_t i = 0; i < fileData.size(); ++i) {
+        fileData[i] = static_cast<char>(i * 13);
+    }
+    std::ofstream(filePath, std::ios::binary).write(fileData.data(), fileData.size());
+
+    auto [rxID, fileSize] = fileOps.createReceiveIDForFile(filePath, FileOperations::TransferMode::Binary);
+    REQUIRE(fileSize == fileData.size());
+
+    const auto requireChunk = [&, rxID = rxID](std::uint32_t chunkNo, std::size_t offset, std::size_t length) {
+        const auto dataFrame = fileOps.getFrameForReceiveID(rxID, chunkNo);
+        REQUIRE(dataFrame->size() == frame::size_header + length);
+
+        const auto header = frame::decodeHeader(dataFrame->data());
+        REQUIRE(header.has_value());
+        REQUIRE(header->type == frame::Type::Data);
+        REQUIRE(header->status == frame::Status::OK);
+        REQUIRE(header->transferID == rxID);
+        REQUIRE(header->chunkNo == chunkNo);
+        REQUIRE(header->length == length);
+
+        CRC32 crc32;
+        crc32.add(dataFrame->data() + frame::size_header, length);
+        REQUIRE(header->crc32 == crc32.getHashValue());
+        REQUIRE(dataFrame->compare(frame::size_header, length, fileData, offset, length) == 0);
+    };
+
+    const auto requireError = [&, rxID = rxID](std::uint32_t chunkNo, frame::Status status) {
+        const auto errorFrame = fileOps.getFrameForReceiveID(rxID, chunkNo);
+        REQUIRE(errorFrame->size() == frame::size_header);
+
+        const auto header = frame::decodeHeader(errorFrame->data());
+        REQUIRE(header.has_value());
+        REQUIRE(header->status == status);
+        REQUIRE(header->chunkNo == chunkNo);
+        REQUIRE(header->length == 0);
+    };
+
+    requireError(2, frame::Status::InvalidChunk);
+    requireChunk(1, 0, FileOperations::BinaryChunkSize);
+    requireChunk(2, FileOperations::BinaryChunkSize, 100);
+    requireError(3, frame::Status::InvalidTransfer);
+
+    std::filesystem::remove(filePath);
+}
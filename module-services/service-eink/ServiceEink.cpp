@@ -18,7 +18,6 @@
 
 #include <cstring>
 #include <memory>
-#include "Utils.hpp"
 
 namespace service::eink
 {
@@ -109,8 +108,7 @@ namespace service::eink
 
     void ServiceEink::initStaticData()
     {
-        const auto invertedModeSetting   = settings->getValue(settings::Display::invertedMode);
-        const auto isInvertedModeEnabled = utils::toNumeric(invertedModeSetting);
+        const auto isInvertedModeEnabled = settings->getNumericValue<int>(settings::Display::invertedMode).value_or(0);
         const auto mode = (isInvertedModeEnabled == 0) ? EinkModeMessage::Mode::Normal : EinkModeMessage::Mode::Invert;
         setDisplayMode(mode);
     }
@@ -314,6 +312,7 @@ namespace service::eink
             LOG_WARN("Received image while suspended, ignoring");
             return sys::MessageNone{};
         }
+        sys::trace::record(message->traceId, sys::trace::Stage::Update, sys::trace::Phase::Begin);
 
         const gui::Context &ctx = *message->getContext();
         auto refreshMode        = translateToEinkRefreshMode(message->getRefreshMode());
@@ -369,6 +368,7 @@ namespace service::eink
         }
 
         previousRefreshMode = refreshMode;
+        sys::trace::record(message->traceId, sys::trace::Stage::Update, sys::trace::Phase::End);
 
 #if DEBUG_EINK_REFRESH == 1
         LOG_INFO("Update contextId: %d, mode: %d", (int)message->getContextId(), (int)refreshMode);
@@ -394,6 +394,7 @@ namespace service::eink
             einkDisplayState = EinkDisplayState::NeedRefresh;
             const auto msg   = std::make_shared<service::eink::RefreshMessage>(
                 message->getContextId(), refreshFrame, refreshMode, message->sender);
+            msg->traceId     = message->traceId;
             bus.sendUnicast(msg, this->GetName());
 
             return sys::MessageNone{};
@@ -408,6 +409,7 @@ namespace service::eink
     sys::MessagePointer ServiceEink::handleRefreshMessage(sys::Message *request)
     {
         const auto message = static_cast<service::eink::RefreshMessage *>(request);
+        sys::trace::ScopedStage refreshStage{message->traceId, sys::trace::Stage::Refresh};
 
         if (einkDisplayState == EinkDisplayState::NeedRefresh) {
             if (previousRefreshStatus == RefreshStatus::Failed) {
@@ -128,8 +128,11 @@ sys::ReturnCodes EventManagerCommon::InitHandler()
         auto msg = static_cast<app::AppInputEventMessage *>(msgl);
         assert(msg);
 
-        auto message = std::make_shared<app::AppInputEventMessage>(msg->getEvent());
+        auto message     = std::make_shared<app::AppInputEventMessage>(msg->getEvent());
+        message->traceId = msg->traceId;
+        sys::trace::record(message->traceId, sys::trace::Stage::Input, sys::trace::Phase::End);
         if (!targetApplication.empty()) {
+            sys::trace::record(message->traceId, sys::trace::Stage::Dispatch, sys::trace::Phase::Begin);
             bus.sendUnicast(std::move(message), targetApplication);
         }
 
@@ -230,9 +233,11 @@ bool EventManagerCommon::messageSetApplication(sys::Service *sender, const std::
 
 void EventManagerCommon::handleKeyEvent(sys::Message *msg)
 {
-    auto kbdMessage = dynamic_cast<sevm::KbdMessage *>(msg);
-    auto message    = std::make_shared<sevm::KbdMessage>();
-    message->key    = kbdMessage->key;
+    auto kbdMessage  = dynamic_cast<sevm::KbdMessage *>(msg);
+    auto message     = std::make_shared<sevm::KbdMessage>();
+    message->key     = kbdMessage->key;
+    message->traceId = kbdMessage->traceId;
+    sys::trace::record(message->traceId, sys::trace::Stage::Input, sys::trace::Phase::End);
 
     debug_input_events("EVInput -> K:|%s|, S:|%s|, TP:|%d|, TR:|%d|, App:|%s|",
                        magic_enum::enum_name(message->key.keyCode).data(),
@@ -243,6 +248,7 @@ void EventManagerCommon::handleKeyEvent(sys::Message *msg)
 
     // send key to focused application
     if (!targetApplication.empty()) {
+        sys::trace::record(message->traceId, sys::trace::Stage::Dispatch, sys::trace::Phase::Begin);
         bus.sendUnicast(message, targetApplication);
     }
     else {
@@ -152,8 +152,10 @@ bool WorkerEventCommon::deinit()
 
 void WorkerEventCommon::sendKeyUnicast(RawKey const &key)
 {
-    auto message = std::make_shared<sevm::KbdMessage>();
-    message->key = key;
+    auto message     = std::make_shared<sevm::KbdMessage>();
+    message->key     = key;
+    message->traceId = sys::trace::newId();
+    sys::trace::record(message->traceId, sys::trace::Stage::Input, sys::trace::Phase::Begin);
     service->bus.sendUnicast(std::move(message), service::name::evt_manager);
 }
 
@@ -0,0 +1,87 @@
+// Copyright (c) 2017-2023, Mudita Sp. z.o.o. All rights reserved.
+// For licensing, see https://github.com/mudita/MuditaOS/LICENSE.md
+
+#include "FileRecord.hpp"
+
+#include <log/log.hpp>
+#include <Utils.hpp>
+
+#include <sys/stat.h>
+
+namespace service::detail
+{
+    namespace fs = std::filesystem;
+
+    namespace
+    {
+        std::string getMimeType(const fs::path &path)
+        {
+            const auto extension = utils::stringToLowercase(path.extension());
+
+            if (extension == ".mp3") {
+                return "audio/mpeg";
+            }
+            if (extension == ".wav") {
+                return "audio/wav";
+            }
+            if (extension == ".flac") {
+                return "audio/flac";
+            }
+            return {};
+        }
+    } // namespace
+
+    std::optional<db::multimedia_files::FileInfo> getFileInfo(const fs::path &path)
+    {
+        struct stat fileStat
+        {};
+        if (::stat(path.c_str(), &fileStat) != 0) {
+            LOG_WARN("Can't get file status");
+            return std::nullopt;
+        }
+        return db::multimedia_files::FileInfo{.path      = path.string(),
+                                              .mediaType = getMimeType(path),
+                                              .size      = static_cast<std::size_t>(fileStat.st_size),
+                                              .mtime     = static_cast<std::uint32_t>(fileStat.st_mtime)};
+    }
+
+    db::multimedia_files::MultimediaFilesRecord createMultimediaFilesRecord(
+        const db::multimedia_files::FileInfo &fileInfo, const tags::fetcher::Tags &tags)
+    {
+        return db::multimedia_files::MultimediaFilesRecord{
+            Record(DB_ID_NONE),
+            .fileInfo = fileInfo,
+            .tags =
+                {
+                    .title = tags.title,
+                    .album =
+                        {
+                            .artist = tags.artist,
+                            .title  = tags.album,
+                        },
+                    .comment = tags.comment,
+                    .genre   = tags.genre,
+                    .year    = tags.year,
+                    .track   = tags.track,
+                },
+            .audioProperties = {.songLength = tags.total_duration_s,
+                                .bitrate    = tags.bitrate,
+                                .sampleRate = tags.sample_rate,
+                                .channels   = tags.num_channel}};
+    }
+
+    std::optional<db::multimedia_files::MultimediaFilesRecord> createMultimediaFilesRecord(
+        const db::multimedia_files::FileInfo &fileInfo)
+    {
+        return createMultimediaFilesRecord(fileInfo, tags::fetcher::fetchTags(fileInfo.path));
+    }
+
+    std::optional<db::multimedia_files::MultimediaFilesRecord> createMultimediaFilesRecord(const fs::path &path)
+    {
+        const auto fileInfo = getFileInfo(path);
+        if (!fileInfo.has_value()) {
+            return std::nullopt;
+        }
+        return createMultimediaFilesRecord(*fileInfo);
+    }
+} // namespace service::detail
@@ -0,0 +1,25 @@
+// Copyright (c) 2017-2023, Mudita Sp. z.o.o. All rights reserved.
+// For licensing, see https://github.com/mudita/MuditaOS/LICENSE.md
+
+#pragma once
+
+#include <module-db/Interface/MultimediaFilesRecord.hpp>
+#include <tags_fetcher/TagsFetcher.hpp>
+
+#include <filesystem>
+#include <optional>
+
+namespace service::detail
+{
+    /// Reads size and modification time of the file with a single stat call
+    std::optional<db::multimedia_files::FileInfo> getFileInfo(const std::filesystem::path &path);
+
+    db::multimedia_files::MultimediaFilesRecord createMultimediaFilesRecord(
+        const db::multimedia_files::FileInfo &fileInfo, const tags::fetcher::Tags &tags);
+
+    /// Creates a complete database record, fetching tags from the file
+    std::optional<db::multimedia_files::MultimediaFilesRecord> createMultimediaFilesRecord(
+        const db::multimedia_files::FileInfo &fileInfo);
+    std::optional<db::multimedia_files::MultimediaFilesRecord> createMultimediaFilesRecord(
+        const std::filesystem::path &path);
+} // namespace service::detail
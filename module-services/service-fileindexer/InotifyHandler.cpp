@@ -4,6 +4,7 @@
 #include <service-fileindexer/InotifyHandler.hpp>
 
 #include "Common.hpp"
+#include "FileRecord.hpp"
 
 #include <filesystem>
 #include <log/log.hpp>
@@ -12,7 +13,6 @@
 #include <purefs/fs/inotify_message.hpp>
 #include <purefs/fs/inotify.hpp>
 #include <service-db/DBServiceAPI.hpp>
-#include <tags_fetcher/TagsFetcher.hpp>
 #include <Utils.hpp>
 
 namespace service::detail
@@ -84,59 +84,6 @@ namespace service::detail
     }
 
     namespace fs = std::filesystem;
-    namespace
-    {
-        std::string getMimeType(const fs::path &path)
-        {
-            const auto extension = utils::stringToLowercase(path.extension());
-
-            if (extension == ".mp3") {
-                return "audio/mpeg";
-            }
-            if (extension == ".wav") {
-                return "audio/wav";
-            }
-            if (extension == ".flac") {
-                return "audio/flac";
-            }
-            return {};
-        }
-
-        std::optional<db::multimedia_files::MultimediaFilesRecord> CreateMultimediaFilesRecord(const fs::path &path)
-        {
-            std::error_code errorCode;
-            auto fileSize = fs::file_size(path, errorCode);
-            if (errorCode) {
-                LOG_WARN("Can't get file size");
-                return {};
-            }
-            auto mimeType = getMimeType(path);
-            auto tags     = tags::fetcher::fetchTags(path);
-
-            db::multimedia_files::MultimediaFilesRecord record{
-                Record(DB_ID_NONE),
-                .fileInfo = {.path = std::string(path), .mediaType = mimeType, .size = static_cast<size_t>(fileSize)},
-                .tags =
-                    {
-                        .title = tags.title,
-                        .album =
-                            {
-                                .artist = tags.artist,
-                                .title  = tags.album,
-                            },
-                        .comment = tags.comment,
-                        .genre   = tags.genre,
-                        .year    = tags.year,
-                        .track   = tags.track,
-                    },
-                .audioProperties = {.songLength = tags.total_duration_s,
-                                    .bitrate    = tags.bitrate,
-                                    .sampleRate = tags.sample_rate,
-                                    .channels   = tags.num_channel}};
-
-            return record;
-        }
-    } // namespace
 
     // On update or create content
     void InotifyHandler::onUpdateOrCreate(std::string_view path)
@@ -152,7 +99,7 @@ namespace service::detail
             return;
         }
 
-        auto record = CreateMultimediaFilesRecord(path);
+        auto record = createMultimediaFilesRecord(fs::path(path));
         if (record.has_value()) {
             auto query = std::make_unique<db::multimedia_files::query::Add>(record.value());
             DBServiceAPI::GetQuery(svc.get(), db::Interface::Name::MultimediaFiles, std::move(query));
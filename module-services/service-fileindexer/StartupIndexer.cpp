@@ -2,28 +2,38 @@
 // For licensing, see https://github.com/mudita/MuditaOS/LICENSE.md
 
 #include "Common.hpp"
+#include "FileRecord.hpp"
 #include <service-fileindexer/StartupIndexer.hpp>
-#include <service-fileindexer/ServiceFileIndexerName.hpp>
 
 #include <Timers/TimerFactory.hpp>
 #include <purefs/filesystem_paths.hpp>
-#include <purefs/fs/inotify_message.hpp>
 #include <log/log.hpp>
 
 #include <fstream>
+#include <queries/multimedia_files/QueryMultimediaFilesAdd.hpp>
+#include <queries/multimedia_files/QueryMultimediaFilesGet.hpp>
+#include <queries/multimedia_files/QueryMultimediaFilesGetLimited.hpp>
 #include <queries/multimedia_files/QueryMultimediaFilesRemove.hpp>
 #include <service-db/DBServiceAPI.hpp>
+#include <service-db/QueryMessage.hpp>
 
 namespace service::detail
 {
     namespace fs = std::filesystem;
-    using namespace std::literals;
     using namespace std::chrono_literals;
 
     const auto lock_file_name        = purefs::dir::getSystemVarDirPath() / ".directory_is_indexed";
     constexpr auto indexing_interval = 50ms;
     constexpr auto start_delay       = 10000ms;
 
+    // Directory entries visited in a single timer tick
+    constexpr std::size_t entries_per_tick = 64;
+    // Files checked against the database and committed in a single transaction
+    constexpr std::size_t batch_size      = 16;
+    constexpr std::uint32_t db_timeout_ms = 5000;
+    // Threads parsing tags of a batch - used on Linux only, target parses in the service task
+    constexpr std::size_t tag_workers = 4;
+
     bool isDirectoryFullyTraversed(const std::filesystem::recursive_directory_iterator &directory)
     {
         return directory == std::filesystem::recursive_directory_iterator();
@@ -68,22 +78,143 @@ namespace service::detail
     StartupIndexer::StartupIndexer(const std::vector<std::string> &paths) : directoriesToScan{paths}
     {}
 
-    // Process single entry
-    auto StartupIndexer::processEntry(std::shared_ptr<sys::Service> svc,
-                                      const std::filesystem::recursive_directory_iterator::value_type &entry) -> void
+    // Queue single entry for indexing
+    auto StartupIndexer::processEntry(const std::filesystem::recursive_directory_iterator::value_type &entry) -> void
     {
-        if (fs::is_regular_file(entry)) {
-            auto ext = fs::path(entry).extension();
-            if (!isExtSupported(ext)) {
-                LOG_WARN("Not supported ext - %s", ext.c_str());
-                return;
+        std::error_code ec;
+        if (!entry.is_regular_file(ec)) {
+            return;
+        }
+        const auto &path = entry.path();
+        if (!isExtSupported(path.extension())) {
+            LOG_WARN("Not supported ext - %s", path.extension().c_str());
+            return;
+        }
+        if (auto fileInfo = getFileInfo(fs::absolute(path)); fileInfo.has_value()) {
+            mPendingFiles.push_back(std::move(*fileInfo));
+        }
+    }
+
+    // Walk at most entries_per_tick directory entries, queueing supported files
+    auto StartupIndexer::scanChunk() -> bool
+    {
+        for (std::size_t processed = 0; processed < entries_per_tick && mPendingFiles.size() < batch_size;
+             ++processed) {
+            if (isDirectoryFullyTraversed(mSubDirIterator)) {
+                if (mTopDirIterator == std::cend(directoriesToScan)) {
+                    return false;
+                }
+                if (auto result = scanPath(mTopDirIterator)) {
+                    mSubDirIterator = *result;
+                }
+                mTopDirIterator++;
+                continue;
             }
+            processEntry(*mSubDirIterator);
+            std::error_code ec;
+            mSubDirIterator.increment(ec);
+            if (ec) {
+                LOG_WARN("Directory traversal failed, error: %d", ec.value());
+                mSubDirIterator = {};
+            }
+        }
+        return true;
+    }
+
+    // Extract tags only for new or modified files and store them in a single transaction
+    auto StartupIndexer::indexPendingFiles(std::shared_ptr<sys::Service> svc) -> void
+    {
+        if (mPendingFiles.empty()) {
+            return;
+        }
+
+        auto changedFiles = std::move(mPendingFiles);
+        mPendingFiles.clear();
+
+        auto [code, msg] =
+            DBServiceAPI::GetQueryWithReply(svc.get(),
+                                            db::Interface::Name::MultimediaFiles,
+                                            std::make_unique<db::multimedia_files::query::GetChanged>(changedFiles),
+                                            db_timeout_ms);
+        if (code == sys::ReturnCodes::Success && msg != nullptr) {
+            if (const auto queryResponse = dynamic_cast<db::QueryResponse *>(msg.get()); queryResponse != nullptr) {
+                const auto result = queryResponse->getResult();
+                if (const auto changed = dynamic_cast<db::multimedia_files::query::GetChangedResult *>(result.get());
+                    changed != nullptr) {
+                    changedFiles = changed->getResult();
+                }
+            }
+        }
+        else {
+            LOG_WARN("Unable to check indexed files state, indexing all of them");
+        }
 
-            const auto abspath = fs::absolute(entry).string();
-            const auto inotifyMsg =
-                std::make_shared<purefs::fs::message::inotify>(purefs::fs::inotify_flags::close_write, abspath, ""sv);
-            svc->bus.sendUnicast(inotifyMsg, std::string(service::name::file_indexer));
+        if (changedFiles.empty()) {
+            return;
+        }
+
+        std::vector<std::string> paths;
+        paths.reserve(changedFiles.size());
+        for (const auto &fileInfo : changedFiles) {
+            paths.push_back(fileInfo.path);
+        }
+        const auto tags = tags::fetcher::fetchTags(paths, tag_workers);
+
+        std::vector<db::multimedia_files::MultimediaFilesRecord> records;
+        records.reserve(changedFiles.size());
+        for (std::size_t i = 0; i < changedFiles.size(); ++i) {
+            records.push_back(createMultimediaFilesRecord(changedFiles[i], tags[i]));
+        }
+        DBServiceAPI::GetQuery(svc.get(),
+                               db::Interface::Name::MultimediaFiles,
+                               std::make_unique<db::multimedia_files::query::AddBatch>(std::move(records)));
+    }
+
+    // Verify a page of records, removing those whose files are gone
+    auto StartupIndexer::cleanupChunk(std::shared_ptr<sys::Service> svc) -> bool
+    {
+        auto [code, msg] = DBServiceAPI::GetQueryWithReply(
+            svc.get(),
+            db::Interface::Name::MultimediaFiles,
+            std::make_unique<db::multimedia_files::query::GetLimited>(mCleanupOffset, batch_size),
+            db_timeout_ms);
+        if (code != sys::ReturnCodes::Success || msg == nullptr) {
+            LOG_WARN("Unable to fetch indexed files, cleanup skipped");
+            return false;
+        }
+        const auto queryResponse = dynamic_cast<db::QueryResponse *>(msg.get());
+        if (queryResponse == nullptr) {
+            return false;
+        }
+        const auto result = queryResponse->getResult();
+        const auto page   = dynamic_cast<db::multimedia_files::query::GetLimitedResult *>(result.get());
+        if (page == nullptr) {
+            return false;
+        }
+        const auto records = page->getResult();
+        if (records.empty()) {
+            return false;
+        }
+
+        std::uint32_t removed = 0;
+        for (const auto &record : records) {
+            std::error_code ec;
+            if (!fs::exists(record.fileInfo.path, ec)) {
+                auto query = std::make_unique<db::multimedia_files::query::RemoveByPath>(record.fileInfo.path);
+                DBServiceAPI::GetQuery(svc.get(), db::Interface::Name::MultimediaFiles, std::move(query));
+                removed++;
+            }
         }
+        // removals are handled by service-db before the next page request, so the page shifts by removed entries
+        mCleanupOffset += records.size() - removed;
+        return true;
+    }
+
+    auto StartupIndexer::finish() -> void
+    {
+        createLockFile();
+        LOG_INFO("Initial startup indexer: Finished");
+        mIdxTimer.stop();
     }
 
     auto StartupIndexer::onTimerTimeout(std::shared_ptr<sys::Service> svc) -> void
@@ -91,23 +222,24 @@ namespace service::detail
         if (mForceStop) {
             return;
         }
-        if (isDirectoryFullyTraversed(mSubDirIterator)) {
-            if (mTopDirIterator == std::cend(directoriesToScan)) {
-                createLockFile();
-                LOG_INFO("Initial startup indexer: Finished");
-                mIdxTimer.stop();
-                return;
+
+        switch (mPhase) {
+        case Phase::Scan: {
+            const auto hasMoreEntries = scanChunk();
+            if (mPendingFiles.size() >= batch_size || !hasMoreEntries) {
+                indexPendingFiles(svc);
             }
-            else {
-                if (auto result = scanPath(mTopDirIterator)) {
-                    mSubDirIterator = *result;
-                }
-                mTopDirIterator++;
+            if (!hasMoreEntries) {
+                mPhase         = Phase::Cleanup;
+                mCleanupOffset = 0;
             }
-        }
-        else {
-            processEntry(svc, *mSubDirIterator);
-            mSubDirIterator++;
+        } break;
+        case Phase::Cleanup:
+            if (!cleanupChunk(svc)) {
+                finish();
+                return;
+            }
+            break;
         }
 
         mIdxTimer.restart(indexing_interval);
@@ -127,10 +259,9 @@ namespace service::detail
         if (!hasLockFile()) {
             LOG_INFO("Initial startup indexer: Started");
 
-            auto query = std::make_unique<db::multimedia_files::query::RemoveAll>();
-            DBServiceAPI::GetQuery(svc.get(), db::Interface::Name::MultimediaFiles, std::move(query));
-
             mTopDirIterator = std::begin(directoriesToScan);
+            mPhase          = Phase::Scan;
+            mPendingFiles.clear();
             setupTimers(svc, svc_name);
             mForceStop = false;
         }
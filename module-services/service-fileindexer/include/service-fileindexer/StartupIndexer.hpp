@@ -5,7 +5,10 @@
 
 #include <Service/Service.hpp>
 #include <Timers/TimerHandle.hpp>
+#include <module-db/Tables/MultimediaFilesTable.hpp>
+
 #include <filesystem>
+#include <vector>
 
 namespace service::detail
 {
@@ -22,15 +25,29 @@ namespace service::detail
         void stop();
 
       private:
-        auto processEntry(std::shared_ptr<sys::Service> svc,
-                          const std::filesystem::recursive_directory_iterator::value_type &entry) -> void;
+        enum class Phase
+        {
+            Scan,   /// walk the directories and index new or modified files
+            Cleanup /// remove records of files which no longer exist
+        };
+
+        auto processEntry(const std::filesystem::recursive_directory_iterator::value_type &entry) -> void;
         auto setupTimers(std::shared_ptr<sys::Service> svc, std::string_view svc_name) -> void;
         auto onTimerTimeout(std::shared_ptr<sys::Service> svc) -> void;
+        /// @return true if there are still directory entries to process
+        auto scanChunk() -> bool;
+        /// @return true if there are still records to verify
+        auto cleanupChunk(std::shared_ptr<sys::Service> svc) -> bool;
+        auto indexPendingFiles(std::shared_ptr<sys::Service> svc) -> void;
+        auto finish() -> void;
 
         std::vector<std::string>::const_iterator mTopDirIterator;
         std::filesystem::recursive_directory_iterator mSubDirIterator;
         sys::TimerHandle mIdxTimer;
         bool mForceStop{};
+        Phase mPhase{Phase::Scan};
+        std::uint32_t mCleanupOffset{};
+        std::vector<db::multimedia_files::FileInfo> mPendingFiles;
 
         const std::vector<std::string> directoriesToScan;
     };
@@ -5,9 +5,9 @@
 
 #include <gui/core/DrawCommand.hpp>
 #include <mutex.hpp>
+#include <Service/Trace.hpp>
 
 #include <cstdint>
-#include <list>
 #include <memory>
 #include <vector>
 
@@ -16,11 +16,12 @@ namespace service::gui
     class DrawCommandsQueue
     {
       public:
-        using CommandList = std::list<std::unique_ptr<::gui::DrawCommand>>;
+        using CommandList = std::vector<std::unique_ptr<::gui::DrawCommand>>;
         struct QueueItem
         {
             CommandList commands;
             ::gui::RefreshModes refreshMode = ::gui::RefreshModes::GUI_REFRESH_FAST;
+            sys::trace::Id traceId          = sys::trace::noTrace;
         };
         using QueueContainer = std::vector<QueueItem>;
 
@@ -1,9 +1,10 @@
-// Copyright (c) 2017-2021, Mudita Sp. z.o.o. All rights reserved.
+// Copyright (c) 2017-2023, Mudita Sp. z.o.o. All rights reserved.
 // For licensing, see https://github.com/mudita/MuditaOS/LICENSE.md
 
 #pragma once
 
 #include <gui/Common.hpp>
+#include <Service/Trace.hpp>
 
 #include <optional>
 
@@ -13,6 +14,7 @@ namespace service::gui
     {
         int contextId;
         ::gui::RefreshModes refreshMode;
+        sys::trace::Id traceId = sys::trace::noTrace;
     };
 
     class RenderCache
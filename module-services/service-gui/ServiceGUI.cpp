@@ -129,7 +129,7 @@ namespace service::gui
             if (!isAnyFrameBeingRenderedOrDisplayed()) {
                 prepareDisplayEarly(drawMsg->mode);
             }
-            notifyRenderer(std::move(drawMsg->commands), drawMsg->mode);
+            notifyRenderer(std::move(drawMsg->commands), drawMsg->mode, drawMsg->traceId);
         }
         return std::make_shared<sys::ResponseMessage>();
     }
@@ -147,11 +147,12 @@ namespace service::gui
         bus.sendUnicast(msg, service::name::eink);
     }
 
-    void ServiceGUI::notifyRenderer(std::list<std::unique_ptr<::gui::DrawCommand>> &&commands,
-                                    ::gui::RefreshModes refreshMode)
+    void ServiceGUI::notifyRenderer(std::vector<std::unique_ptr<::gui::DrawCommand>> &&commands,
+                                    ::gui::RefreshModes refreshMode,
+                                    sys::trace::Id traceId)
     {
         stateManager.setState(RenderingState::Rendering);
-        enqueueDrawCommands(DrawCommandsQueue::QueueItem{std::move(commands), refreshMode});
+        enqueueDrawCommands(DrawCommandsQueue::QueueItem{std::move(commands), refreshMode, traceId});
         worker->notify(WorkerGUI::Signal::Render);
     }
 
@@ -181,6 +182,7 @@ namespace service::gui
         auto finishedMsg     = static_cast<service::gui::RenderingFinished *>(message);
         const auto contextId = finishedMsg->getContextId();
         auto refreshMode     = finishedMsg->getRefreshMode();
+        const auto traceId   = finishedMsg->traceId;
 
         if (stateManager.isInState(DisplayingState::Idle)) {
             if (cache.isRenderCached()) {
@@ -191,10 +193,10 @@ namespace service::gui
 #if DEBUG_EINK_REFRESH == 1
             LOG_INFO("Rendering finished, send, contextId: %d, mode: %d", contextId, (int)refreshMode);
 #endif
-            sendOnDisplay(context, contextId, refreshMode);
+            sendOnDisplay(context, contextId, refreshMode, traceId);
         }
         else {
-            cache.cache({contextId, refreshMode});
+            cache.cache({contextId, refreshMode, traceId});
             contextPool->returnContext(contextId);
 #if DEBUG_EINK_REFRESH == 1
             LOG_INFO("Rendering finished, cancel, contextId: %d, mode: %d", contextId, (int)refreshMode);
@@ -204,10 +206,14 @@ namespace service::gui
         return sys::MessageNone{};
     }
 
-    void ServiceGUI::sendOnDisplay(::gui::Context *context, int contextId, ::gui::RefreshModes refreshMode)
+    void ServiceGUI::sendOnDisplay(::gui::Context *context,
+                                   int contextId,
+                                   ::gui::RefreshModes refreshMode,
+                                   sys::trace::Id traceId)
     {
         stateManager.setState(DisplayingState::Displaying);
-        auto msg = std::make_shared<service::eink::ImageMessage>(contextId, context, refreshMode);
+        auto msg     = std::make_shared<service::eink::ImageMessage>(contextId, context, refreshMode);
+        msg->traceId = traceId;
         bus.sendUnicast(std::move(msg), service::name::eink);
         scheduleContextRelease(contextId);
     }
@@ -265,7 +271,8 @@ namespace service::gui
     {
         const auto contextId = cache.getCachedRender()->contextId;
         if (const auto context = contextPool->borrowContext(contextId); context != nullptr) {
-            sendOnDisplay(context, contextId, cache.getCachedRender()->refreshMode);
+            const auto render = cache.getCachedRender();
+            sendOnDisplay(context, contextId, render->refreshMode, render->traceId);
         }
         cache.invalidate();
     }
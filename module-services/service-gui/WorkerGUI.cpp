@@ -40,7 +40,8 @@ namespace service::gui
         case Signal::Render: {
             auto item = guiService->commandsQueue->dequeue();
             if (item.has_value()) {
-                render(item->commands, item->refreshMode);
+                sys::trace::record(item->traceId, sys::trace::Stage::Queue, sys::trace::Phase::End);
+                render(item->commands, item->refreshMode, item->traceId);
             }
             break;
         }
@@ -53,14 +54,18 @@ namespace service::gui
         }
     }
 
-    void WorkerGUI::render(DrawCommandsQueue::CommandList &commands, ::gui::RefreshModes refreshMode)
+    void WorkerGUI::render(DrawCommandsQueue::CommandList &commands,
+                           ::gui::RefreshModes refreshMode,
+                           sys::trace::Id traceId)
     {
         const auto [contextId, context] = guiService->contextPool->borrowContext(); // Waits for the context.
+        sys::trace::record(traceId, sys::trace::Stage::Render, sys::trace::Phase::Begin);
         renderer.render(context, commands);
+        sys::trace::record(traceId, sys::trace::Stage::Render, sys::trace::Phase::End);
 #if DEBUG_EINK_REFRESH == 1
         LOG_INFO("Render ContextId: %d\n%s", contextId, context->toAsciiScaled().c_str());
 #endif
-        onRenderingFinished(contextId, refreshMode);
+        onRenderingFinished(contextId, refreshMode, traceId);
     }
 
     void WorkerGUI::changeColorScheme(const std::unique_ptr<::gui::ColorScheme> &scheme)
@@ -68,9 +73,10 @@ namespace service::gui
         renderer.changeColorScheme(scheme);
     }
 
-    void WorkerGUI::onRenderingFinished(int contextId, ::gui::RefreshModes refreshMode)
+    void WorkerGUI::onRenderingFinished(int contextId, ::gui::RefreshModes refreshMode, sys::trace::Id traceId)
     {
-        auto msg = std::make_shared<service::gui::RenderingFinished>(contextId, refreshMode);
+        auto msg     = std::make_shared<service::gui::RenderingFinished>(contextId, refreshMode);
+        msg->traceId = traceId;
         guiService->bus.sendUnicast(std::move(msg), guiService->GetName());
     }
 
@@ -1,4 +1,4 @@
-﻿// Copyright (c) 2017-2021, Mudita Sp. z.o.o. All rights reserved.
+﻿// Copyright (c) 2017-2023, Mudita Sp. z.o.o. All rights reserved.
 // For licensing, see https://github.com/mudita/MuditaOS/LICENSE.md
 
 #pragma once
@@ -35,9 +35,11 @@ namespace service::gui
 
       private:
         void handleCommand(Signal command);
-        void render(DrawCommandsQueue::CommandList &commands, ::gui::RefreshModes refreshMode);
+        void render(DrawCommandsQueue::CommandList &commands,
+                    ::gui::RefreshModes refreshMode,
+                    sys::trace::Id traceId);
         void changeColorScheme(const std::unique_ptr<::gui::ColorScheme> &scheme);
-        void onRenderingFinished(int contextId, ::gui::RefreshModes refreshMode);
+        void onRenderingFinished(int contextId, ::gui::RefreshModes refreshMode, sys::trace::Id traceId);
 
         ServiceGUI *guiService;
         ::gui::Renderer renderer;
@@ -51,10 +51,15 @@ namespace service::gui
         void registerMessageHandlers();
 
         void prepareDisplayEarly(::gui::RefreshModes refreshMode);
-        void notifyRenderer(std::list<std::unique_ptr<::gui::DrawCommand>> &&commands, ::gui::RefreshModes refreshMode);
+        void notifyRenderer(std::vector<std::unique_ptr<::gui::DrawCommand>> &&commands,
+                            ::gui::RefreshModes refreshMode,
+                            sys::trace::Id traceId);
         void notifyRenderColorSchemeChange(::gui::ColorScheme &&scheme);
         void enqueueDrawCommands(DrawCommandsQueue::QueueItem &&item);
-        void sendOnDisplay(::gui::Context *context, int contextId, ::gui::RefreshModes refreshMode);
+        void sendOnDisplay(::gui::Context *context,
+                           int contextId,
+                           ::gui::RefreshModes refreshMode,
+                           sys::trace::Id traceId);
         void sendCancelRefresh();
         void scheduleContextRelease(int contextId);
         bool isNextFrameReady() const noexcept;
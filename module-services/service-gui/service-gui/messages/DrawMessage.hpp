@@ -1,4 +1,4 @@
-﻿// Copyright (c) 2017-2021, Mudita Sp. z.o.o. All rights reserved.
+﻿// Copyright (c) 2017-2023, Mudita Sp. z.o.o. All rights reserved.
 // For licensing, see https://github.com/mudita/MuditaOS/LICENSE.md
 
 #pragma once
@@ -8,7 +8,7 @@
 #include <gui/Common.hpp>
 #include <Service/Message.hpp>
 
-#include <list>
+#include <vector>
 #include <memory>
 
 #include "Service/Message.hpp"
@@ -29,9 +29,9 @@ namespace service::gui
 
       public:
         ::gui::RefreshModes mode;
-        std::list<::gui::Command> commands;
+        std::vector<::gui::Command> commands;
 
-        DrawMessage(std::list<::gui::Command> commandsList, ::gui::RefreshModes mode);
+        DrawMessage(std::vector<::gui::Command> commandsList, ::gui::RefreshModes mode);
 
         void setCommandType(Type value) noexcept
         {
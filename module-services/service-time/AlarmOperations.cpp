@@ -25,15 +25,22 @@ namespace alarms
 
     void AlarmOperationsCommon::updateEventsCache(TimePoint now)
     {
-        OnGetAlarmsProcessed callback = [&](std::vector<SingleEventRecord> singleEvents) {
-            nextSingleEvents.clear();
-            nextSingleEvents.reserve(singleEvents.size());
-            for (auto &ev : singleEvents) {
-                nextSingleEvents.emplace_back(std::make_unique<SingleEventRecord>(ev));
-            }
-            handleActiveAlarmsCountChange();
+        OnGetAlarmEventsCallback repoCallback = [&, now](std::vector<AlarmEventRecord> records) {
+            scheduler.reset(records, now);
+            refreshNextEvents();
         };
-        getNextSingleEvents(now, callback);
+        alarmEventsRepo->getAlarmEnabledEvents(repoCallback);
+    }
+
+    void AlarmOperationsCommon::refreshNextEvents()
+    {
+        auto singleEvents = scheduler.getNextEvents();
+        nextSingleEvents.clear();
+        nextSingleEvents.reserve(singleEvents.size());
+        for (auto &ev : singleEvents) {
+            nextSingleEvents.emplace_back(std::make_unique<SingleEventRecord>(std::move(ev)));
+        }
+        handleActiveAlarmsCountChange();
     }
 
     void AlarmOperationsCommon::getAlarm(const std::uint32_t alarmId, OnGetAlarmProcessed callback)
@@ -77,7 +84,14 @@ namespace alarms
     void AlarmOperationsCommon::addAlarm(AlarmEventRecord record, OnAddAlarmProcessed callback)
     {
         OnAddAlarmEventCallback repoCallback = [&, callback, record](bool success) mutable {
-            checkAndUpdateCache(record);
+            if (success && record.ID != 0) {
+                scheduler.schedule(record, getCurrentTime());
+                refreshNextEvents();
+            }
+            else if (success && record.enabled) {
+                // ID is assigned by the database, so the new alarm can't be scheduled on its own
+                updateEventsCache(getCurrentTime());
+            }
             callback(success);
         };
         alarmEventsRepo->addAlarmEvent(record, repoCallback);
@@ -86,12 +100,9 @@ namespace alarms
     void AlarmOperationsCommon::updateAlarm(AlarmEventRecord record, OnUpdateAlarmProcessed callback)
     {
         OnUpdateAlarmEventCallback repoCallback = [&, callback, record](bool success) mutable {
-            auto found = findSingleEventById(nextSingleEvents, record.ID);
-            if (found != std::end(nextSingleEvents)) {
-                updateEventsCache(getCurrentTime());
-            }
-            else {
-                checkAndUpdateCache(record);
+            if (success) {
+                scheduler.schedule(record, getCurrentTime());
+                refreshNextEvents();
             }
             callback(success);
         };
@@ -101,9 +112,9 @@ namespace alarms
     void AlarmOperationsCommon::removeAlarm(const std::uint32_t alarmId, OnRemoveAlarmProcessed callback)
     {
         OnRemoveAlarmEventCallback repoCallback = [&, callback, alarmId](bool success) {
-            auto found = findSingleEventById(nextSingleEvents, alarmId);
-            if (found != std::end(nextSingleEvents) && nextSingleEvents.size() == 1) {
-                updateEventsCache(getCurrentTime());
+            if (success) {
+                scheduler.remove(alarmId);
+                refreshNextEvents();
             }
             callback(success);
         };
@@ -258,19 +269,6 @@ namespace alarms
         handledCallback(outEvents);
     }
 
-    void AlarmOperationsCommon::checkAndUpdateCache(AlarmEventRecord record)
-    {
-        auto nearestNewSingleEvent = record.getNextSingleEvent(getCurrentTime());
-
-        if (nearestNewSingleEvent.EventInfo::isValid() && nearestNewSingleEvent.startDate > getCurrentTime()) {
-            auto alarmEvent = std::dynamic_pointer_cast<AlarmEventRecord>(nearestNewSingleEvent.parent);
-            if (record.enabled &&
-                (nextSingleEvents.empty() || nearestNewSingleEvent.startDate <= nextSingleEvents.front()->startDate)) {
-                updateEventsCache(getCurrentTime());
-            }
-        }
-    }
-
     auto AlarmOperationsCommon::minuteUpdated(TimePoint now) -> void
     {
         processEvents(now);
@@ -368,11 +366,12 @@ namespace alarms
     auto AlarmOperationsCommon::processNextEventsQueue(const TimePoint now) -> void
     {
         if (nextSingleEvents.front()->startDate <= now) {
+            // Only the alarms which have just fired are rescheduled, the rest of the schedule stays valid
+            auto dueEvents = scheduler.takeDueEvents(now);
             if (!isCriticalBatteryLevel) {
-                triggerAlarm();
+                triggerAlarm(std::move(dueEvents));
             }
-            nextSingleEvents.clear();
-            updateEventsCache(now);
+            refreshNextEvents();
         }
     }
 
@@ -407,11 +406,11 @@ namespace alarms
         }
     }
 
-    void AlarmOperationsCommon::triggerAlarm()
+    void AlarmOperationsCommon::triggerAlarm(std::vector<SingleEventRecord> dueEvents)
     {
-        ongoingSingleEvents.insert(ongoingSingleEvents.end(),
-                                   std::make_move_iterator(nextSingleEvents.begin()),
-                                   std::make_move_iterator(nextSingleEvents.end()));
+        for (auto &event : dueEvents) {
+            ongoingSingleEvents.emplace_back(std::make_unique<SingleEventRecord>(std::move(event)));
+        }
     }
 
     void AlarmOperationsCommon::toggleAll(bool toggle, OnToggleAll callback)
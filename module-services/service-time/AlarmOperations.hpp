@@ -4,6 +4,7 @@
 #pragma once
 
 #include "AlarmRepository.hpp"
+#include "AlarmScheduler.hpp"
 #include "SnoozedAlarmEventRecord.hpp"
 
 #include <service-time/AlarmHandlerFactory.hpp>
@@ -135,6 +136,7 @@ namespace alarms
 
       private:
         bool isCriticalBatteryLevel{false};
+        AlarmScheduler scheduler;
         GetCurrentTime getCurrentTimeCallback;
         OnSnoozedAlarmsCountChange onSnoozedAlarmsCountChangeCallback = nullptr;
         OnActiveAlarmCountChange onActiveAlarmCountChangeCallback     = nullptr;
@@ -151,14 +153,14 @@ namespace alarms
         void onRepoGetAlarmsResponse(TimePoint start,
                                      std::vector<AlarmEventRecord> records,
                                      OnGetAlarmsProcessed handledCallback);
-        void checkAndUpdateCache(AlarmEventRecord record);
+        void refreshNextEvents();
         void switchAlarmExecution(const SingleEventRecord &singleAlarmEvent, bool newStateOn);
         void processEvents(TimePoint now);
         void processOngoingEvents();
         void processNextEventsQueue(const TimePoint now);
         void processSnoozedEventsQueue(const TimePoint now);
         void stopAllRingingAlarms();
-        void triggerAlarm();
+        void triggerAlarm(std::vector<SingleEventRecord> dueEvents);
         virtual void onAlarmTurnedOff(const std::shared_ptr<AlarmEventRecord> &event, alarms::AlarmType alarmType);
 
         TimePoint getCurrentTime();
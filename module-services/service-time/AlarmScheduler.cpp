@@ -0,0 +1,138 @@
+// Copyright (c) 2017-2023, Mudita Sp. z.o.o. All rights reserved.
+// For licensing, see https://github.com/mudita/MuditaOS/LICENSE.md
+
+#include "AlarmScheduler.hpp"
+
+#include <algorithm>
+
+namespace alarms
+{
+    namespace
+    {
+        // Rebuild the heap once stale entries outnumber the live ones
+        constexpr std::size_t staleEntriesFactor = 2;
+        constexpr std::size_t minHeapSizeToCompact = 16;
+
+        bool isSchedulable(const SingleEventRecord &event, TimePoint from)
+        {
+            return event.startDate != TIME_POINT_INVALID && event.startDate > from;
+        }
+    } // namespace
+
+    bool AlarmScheduler::isLater(const Entry &lhs, const Entry &rhs)
+    {
+        return lhs.startDate > rhs.startDate;
+    }
+
+    void AlarmScheduler::reset(const std::vector<AlarmEventRecord> &records, TimePoint from)
+    {
+        heap.clear();
+        scheduled.clear();
+        for (auto record : records) {
+            if (!record.enabled) {
+                continue;
+            }
+            if (auto event = record.getNextSingleEvent(from); isSchedulable(event, from)) {
+                push(std::move(event));
+            }
+        }
+    }
+
+    void AlarmScheduler::schedule(const AlarmEventRecord &record, TimePoint from)
+    {
+        remove(record.ID);
+        if (!record.enabled) {
+            return;
+        }
+        auto copy = record;
+        if (auto event = copy.getNextSingleEvent(from); isSchedulable(event, from)) {
+            push(std::move(event));
+        }
+    }
+
+    void AlarmScheduler::remove(std::uint32_t alarmId)
+    {
+        if (scheduled.erase(alarmId) > 0) {
+            dropStaleEntries();
+            compact();
+        }
+    }
+
+    std::vector<SingleEventRecord> AlarmScheduler::getNextEvents()
+    {
+        dropStaleEntries();
+        if (heap.empty()) {
+            return {};
+        }
+
+        const auto startDate = heap.front().startDate;
+        std::vector<SingleEventRecord> events;
+        for (const auto &entry : heap) {
+            const auto found = scheduled.find(entry.alarmId);
+            if (entry.startDate == startDate && found != scheduled.end() && found->second.version == entry.version) {
+                events.push_back(found->second.event);
+            }
+        }
+        return events;
+    }
+
+    std::vector<SingleEventRecord> AlarmScheduler::takeDueEvents(TimePoint now)
+    {
+        std::vector<SingleEventRecord> due;
+        dropStaleEntries();
+        while (!heap.empty() && heap.front().startDate <= now) {
+            const auto found = scheduled.find(heap.front().alarmId);
+            pop();
+
+            auto event = std::move(found->second.event);
+            scheduled.erase(found);
+
+            if (auto alarm = std::dynamic_pointer_cast<AlarmEventRecord>(event.parent); alarm != nullptr) {
+                if (auto next = alarm->getNextSingleEvent(now); isSchedulable(next, now)) {
+                    push(std::move(next));
+                }
+            }
+            due.push_back(std::move(event));
+            dropStaleEntries();
+        }
+        return due;
+    }
+
+    void AlarmScheduler::push(SingleEventRecord event)
+    {
+        const auto alarmId = event.parent->ID;
+        const auto version = nextVersion++;
+        heap.push_back(Entry{event.startDate, alarmId, version});
+        std::push_heap(heap.begin(), heap.end(), isLater);
+        scheduled.insert_or_assign(alarmId, Scheduled{version, std::move(event)});
+    }
+
+    void AlarmScheduler::pop()
+    {
+        std::pop_heap(heap.begin(), heap.end(), isLater);
+        heap.pop_back();
+    }
+
+    void AlarmScheduler::dropStaleEntries()
+    {
+        while (!heap.empty()) {
+            const auto found = scheduled.find(heap.front().alarmId);
+            if (found != scheduled.end() && found->second.version == heap.front().version) {
+                return;
+            }
+            pop();
+        }
+    }
+
+    void AlarmScheduler::compact()
+    {
+        if (heap.size() < minHeapSizeToCompact || heap.size() <= staleEntriesFactor * scheduled.size()) {
+            return;
+        }
+        heap.clear();
+        for (const auto &[alarmId, entry] : scheduled) {
+            heap.push_back(Entry{entry.event.startDate, alarmId, entry.version});
+        }
+        std::make_heap(heap.begin(), heap.end(), isLater);
+    }
+} // namespace alarms
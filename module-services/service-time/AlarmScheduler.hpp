@@ -0,0 +1,61 @@
+// Copyright (c) 2017-2023, Mudita Sp. z.o.o. All rights reserved.
+// For licensing, see https://github.com/mudita/MuditaOS/LICENSE.md
+
+#pragma once
+
+#include <module-db/Interface/AlarmEventRecord.hpp>
+
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+namespace alarms
+{
+    /// Keeps the next occurrence of every enabled alarm in a min-heap ordered by start time.
+    /// Only the alarm which has just fired is expanded again, so the schedule doesn't have to be
+    /// rebuilt from the repository unless alarms are changed in bulk or the time zone changes.
+    /// The schedule is still checked on every minute tick - the RTC minute alarm also drives the clock,
+    /// pre-wake up and bedtime, so it isn't reprogrammed to wake the system up at the next alarm only.
+    class AlarmScheduler
+    {
+      public:
+        /// Rebuilds the schedule from all enabled alarms
+        void reset(const std::vector<AlarmEventRecord> &records, TimePoint from);
+        /// Schedules the first occurrence of the alarm after `from`, replacing the previous one.
+        /// Disabled alarms and alarms which won't occur anymore are removed from the schedule.
+        void schedule(const AlarmEventRecord &record, TimePoint from);
+        void remove(std::uint32_t alarmId);
+
+        /// Events with the earliest start time - more than one if several alarms are set to the same time
+        [[nodiscard]] std::vector<SingleEventRecord> getNextEvents();
+        /// Removes events due at `now` or earlier and schedules the following occurrences of recurring alarms
+        [[nodiscard]] std::vector<SingleEventRecord> takeDueEvents(TimePoint now);
+
+      private:
+        struct Entry
+        {
+            TimePoint startDate;
+            std::uint32_t alarmId;
+            std::uint32_t version;
+        };
+
+        struct Scheduled
+        {
+            std::uint32_t version;
+            SingleEventRecord event;
+        };
+
+        static bool isLater(const Entry &lhs, const Entry &rhs);
+
+        void push(SingleEventRecord event);
+        void pop();
+        /// Drops heap entries of removed or rescheduled alarms from the top of the heap
+        void dropStaleEntries();
+        void compact();
+
+        /// Entries of removed or rescheduled alarms are left in the heap and skipped lazily
+        std::vector<Entry> heap;
+        std::unordered_map<std::uint32_t, Scheduled> scheduled;
+        std::uint32_t nextVersion = 0;
+    };
+} // namespace alarms
@@ -1,4 +1,4 @@
-// Copyright (c) 2017-2021, Mudita Sp. z.o.o. All rights reserved.
+// Copyright (c) 2017-2023, Mudita Sp. z.o.o. All rights reserved.
 // For licensing, see https://github.com/mudita/MuditaOS/LICENSE.md
 
 #include <AlarmOperations.hpp>
@@ -21,6 +21,8 @@ class MockAlarmEventsRepository : public alarms::AbstractAlarmEventsRepository
 {
   public:
     std::vector<AlarmEventRecord> nextRecords;
+    unsigned enabledEventsQueries = 0;
+    bool writeResult              = true;
 
     MOCK_METHOD(void,
                 getAlarmEvent,
@@ -34,8 +36,10 @@ class MockAlarmEventsRepository : public alarms::AbstractAlarmEventsRepository
 
     auto addAlarmEvent(const AlarmEventRecord &alarmEvent, const alarms::OnAddAlarmEventCallback &callback) -> void
     {
-        addSingleEvent(alarmEvent);
-        callback({true});
+        if (writeResult) {
+            addSingleEvent(alarmEvent);
+        }
+        callback({writeResult});
     }
 
     auto updateAlarmEvent(const AlarmEventRecord &alarmEvent, const alarms::OnAddAlarmEventCallback &callback) -> void
@@ -49,11 +53,13 @@ class MockAlarmEventsRepository : public alarms::AbstractAlarmEventsRepository
     }
     auto removeAlarmEvent(const std::uint32_t alarmId, const alarms::OnRemoveAlarmEventCallback &callback) -> void
     {
-        nextRecords.erase(std::remove_if(nextRecords.begin(),
-                                         nextRecords.end(),
-                                         [&alarmId](const AlarmEventRecord &ae) { return ae.ID == alarmId; }),
-                          nextRecords.end());
-        callback({true});
+        if (writeResult) {
+            nextRecords.erase(std::remove_if(nextRecords.begin(),
+                                             nextRecords.end(),
+                                             [&alarmId](const AlarmEventRecord &ae) { return ae.ID == alarmId; }),
+                              nextRecords.end());
+        }
+        callback({writeResult});
     }
 
     void getAlarmEventsInRange(std::uint32_t offset,
@@ -65,6 +71,7 @@ class MockAlarmEventsRepository : public alarms::AbstractAlarmEventsRepository
 
     void getAlarmEnabledEvents(const alarms::OnGetAlarmEventsCallback &callback)
     {
+        ++enabledEventsQueries;
         std::vector<AlarmEventRecord> result;
         for (const auto &rec : nextRecords) {
             if (rec.enabled) {
@@ -648,3 +655,79 @@ TEST_F(AlarmOperationsFixture, handleMultipleConcurrentAlarms)
     alarmOperations->turnOffRingingAlarm(2, universalBoolCallback);
     alarmOperations->turnOffRingingAlarm(3, universalBoolCallback);
 }
+
+TEST_F(AlarmOperationsFixture, handleAlarmsWithoutRepositoryQueries)
+{
+    auto alarmRepoMock    = std::make_unique<MockAlarmEventsRepository>();
+    const auto alarmRrule = "FREQ=WEEKLY;BYDAY=MO,TU,WE,TH,FR,SA,SU";
+    alarmRepoMock->nextRecords.push_back(
+        AlarmEventRecord(1, AlarmTime{11h, 0min}, defMusic, defEnabled, defSnooze, alarmRrule));
+    alarmRepoMock->nextRecords.push_back(
+        AlarmEventRecord(2, AlarmTime{12h, 0min}, defMusic, defEnabled, defSnooze, defRRule));
+    alarmRepoMock->nextRecords.push_back(
+        AlarmEventRecord(3, AlarmTime{10h, 0min}, defMusic, defEnabled, defSnooze, alarmRrule));
+    const auto repo = alarmRepoMock.get();
+
+    constexpr auto daysInWeek = 7;
+
+    auto alarmOperations = getMockedAlarmOperations(alarmRepoMock);
+    auto handler         = std::make_shared<MockAlarmHandler>();
+    EXPECT_CALL(*handler, handle(testing::_)).Times(3 * daysInWeek);
+    alarmOperations->addAlarmExecutionHandler(alarms::AlarmType::Clock, handler);
+
+    alarmOperations->updateEventsCache(TimePointFromStringWithShift("2022-11-11 09:00:00"));
+    EXPECT_EQ(repo->enabledEventsQueries, 1);
+
+    for (auto i = 0; i < daysInWeek; ++i) {
+        for (const auto &[id, time] : {std::pair{3, "2022-11-11 10:00:00"},
+                                       std::pair{1, "2022-11-11 11:00:00"},
+                                       std::pair{2, "2022-11-11 12:00:00"}}) {
+            alarmOperations->minuteUpdated(TimePointFromStringWithShift(time) + date::days{i});
+            alarmOperations->turnOffRingingAlarm(id, universalBoolCallback);
+        }
+    }
+    EXPECT_EQ(repo->enabledEventsQueries, 1);
+}
+
+TEST_F(AlarmOperationsFixture, removeNearestWithoutRepoQuery)
+{
+    auto alarmRepoMock = std::make_unique<MockAlarmEventsRepository>();
+    alarmRepoMock->nextRecords.push_back(
+        AlarmEventRecord(1, AlarmTime{11h, 0min}, defMusic, defEnabled, defSnooze, defRRule));
+    const auto repo = alarmRepoMock.get();
+
+    auto alarmOperations = getMockedAlarmOperations(alarmRepoMock);
+    alarmOperations->updateEventsCache(TimePointFromStringWithShift("2022-11-11 09:00:00"));
+    EXPECT_EQ(repo->enabledEventsQueries, 1);
+
+    alarmOperations->removeAlarm(1, universalBoolCallback);
+    EXPECT_EQ(repo->enabledEventsQueries, 1);
+
+    auto handler = std::make_shared<MockAlarmHandler>();
+    EXPECT_CALL(*handler, handle(testing::_)).Times(0);
+    alarmOperations->addAlarmExecutionHandler(alarms::AlarmType::Clock, handler);
+    alarmOperations->minuteUpdated(TimePointFromStringWithShift("2022-11-11 11:00:00"));
+}
+
+TEST_F(AlarmOperationsFixture, failedWritesDontChangeSchedule)
+{
+    auto alarmRepoMock = std::make_unique<MockAlarmEventsRepository>();
+    alarmRepoMock->nextRecords.push_back(
+        AlarmEventRecord(1, AlarmTime{11h, 0min}, defMusic, defEnabled, defSnooze, defRRule));
+    const auto repo = alarmRepoMock.get();
+
+    auto alarmOperations = getMockedAlarmOperations(alarmRepoMock);
+    alarmOperations->updateEventsCache(TimePointFromStringWithShift("2022-11-11 09:00:00"));
+
+    const auto failureCallback = [](bool success) { EXPECT_EQ(success, false); };
+    repo->writeResult          = false;
+    alarmOperations->addAlarm(AlarmEventRecord(2, AlarmTime{10h, 0min}, defMusic, defEnabled, defSnooze, defRRule),
+                              failureCallback);
+    alarmOperations->removeAlarm(1, failureCallback);
+
+    auto handler = std::make_shared<MockAlarmHandler>();
+    EXPECT_CALL(*handler, handle(testing::_)).Times(1);
+    alarmOperations->addAlarmExecutionHandler(alarms::AlarmType::Clock, handler);
+    alarmOperations->minuteUpdated(TimePointFromStringWithShift("2022-11-11 10:00:00"));
+    alarmOperations->minuteUpdated(TimePointFromStringWithShift("2022-11-11 11:00:00"));
+}
@@ -63,11 +63,14 @@ namespace sys
         std::string name, std::string parent, uint32_t stackDepth, ServicePriority priority, Watchdog &watchdog)
         : cpp_freertos::Thread(name, stackDepth / 4 /* Stack depth in bytes */, static_cast<UBaseType_t>(priority)),
           parent(parent), bus(this, watchdog), mailbox(this), watchdog(watchdog), isReady(false), enableRunLoop(false)
-    {}
+    {
+        telemetry::Registry::get().add(GetName(), &telemetry);
+    }
 
     Service::~Service()
     {
         enableRunLoop = false;
+        telemetry::Registry::get().remove(&telemetry);
         LOG_DEBUG("%s", (GetName() + ":Service base destructor").c_str());
     }
 
@@ -97,9 +100,12 @@ namespace sys
     void Service::processBus()
     {
         if (auto msg = mailbox.pop(); msg) {
-            const bool respond  = msg->type != Message::Type::Response && GetName() != msg->sender;
-            currentlyProcessing = msg;
-            auto response       = msg->Execute(this);
+            const auto mailboxDepth = mailbox.size() + 1;
+            const bool respond      = msg->type != Message::Type::Response && GetName() != msg->sender;
+            currentlyProcessing     = msg;
+            const auto startTicks   = Ticks::GetTicks();
+            auto response           = msg->Execute(this);
+            telemetry.onMessageHandled(typeid(*msg), mailboxDepth, Ticks::TicksToMs(Ticks::GetTicks() - startTicks));
             if (response == nullptr || !respond) {
                 return;
             }
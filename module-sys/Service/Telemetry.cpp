@@ -0,0 +1,181 @@
+// Copyright (c) 2017-2023, Mudita Sp. z.o.o. All rights reserved.
+// For licensing, see https://github.com/mudita/MuditaOS/LICENSE.md
+
+#include <Service/Telemetry.hpp>
+
+#include <memory/usermem.h>
+#include <msgpack11/msgpack11.hpp>
+#include <ticks.hpp>
+
+#include <FreeRTOS.h>
+#include <task.h>
+
+#include <algorithm>
+
+namespace sys::telemetry
+{
+    namespace
+    {
+        constexpr std::size_t maxTasks = 64;
+
+        auto toBucket(std::uint32_t timeMs) -> std::size_t
+        {
+            const auto bucket = std::upper_bound(handlerTimeBucketsMs.begin(), handlerTimeBucketsMs.end(), timeMs);
+            return std::distance(handlerTimeBucketsMs.begin(), bucket);
+        }
+
+        auto toMsgPack(const Histogram &histogram) -> msgpack11::MsgPack::array
+        {
+            return msgpack11::MsgPack::array(histogram.begin(), histogram.end());
+        }
+    } // namespace
+
+    void ServiceTelemetry::onMessageHandled(const std::type_info &type,
+                                            std::size_t mailboxDepth,
+                                            std::uint32_t handlerTimeMs)
+    {
+        cpp_freertos::LockGuard lock(mutex);
+        ++messages;
+        mailboxHighWater = std::max(mailboxHighWater, static_cast<std::uint32_t>(mailboxDepth));
+
+        auto &handler = handlers[std::type_index(type)];
+        ++handler.count;
+        handler.totalMs += handlerTimeMs;
+        handler.maxMs = std::max(handler.maxMs, handlerTimeMs);
+        ++handler.histogram[toBucket(handlerTimeMs)];
+    }
+
+    auto ServiceTelemetry::getStats(const std::string &serviceName) const -> ServiceStats
+    {
+        cpp_freertos::LockGuard lock(mutex);
+        ServiceStats stats;
+        stats.name             = serviceName;
+        stats.messages         = messages;
+        stats.mailboxHighWater = mailboxHighWater;
+        stats.handlers.reserve(handlers.size());
+        for (const auto &[type, handler] : handlers) {
+            stats.handlers.push_back(HandlerStats{.messageType = type.name(),
+                                                  .count       = handler.count,
+                                                  .totalMs     = handler.totalMs,
+                                                  .maxMs       = handler.maxMs,
+                                                  .histogram   = handler.histogram});
+        }
+        return stats;
+    }
+
+    Registry &Registry::get()
+    {
+        static Registry instance;
+        return instance;
+    }
+
+    void Registry::add(const std::string &serviceName, const ServiceTelemetry *telemetry)
+    {
+        cpp_freertos::LockGuard lock(mutex);
+        services.emplace_back(serviceName, telemetry);
+    }
+
+    void Registry::remove(const ServiceTelemetry *telemetry)
+    {
+        cpp_freertos::LockGuard lock(mutex);
+        services.erase(std::remove_if(services.begin(),
+                                      services.end(),
+                                      [telemetry](const auto &service) { return service.second == telemetry; }),
+                       services.end());
+    }
+
+    void Registry::setFrequencyStats(std::vector<FrequencyResidency> residency, std::vector<FrequencyHolder> holders)
+    {
+        cpp_freertos::LockGuard lock(mutex);
+        this->residency = std::move(residency);
+        this->holders   = std::move(holders);
+    }
+
+    auto Registry::makeSnapshot() const -> Snapshot
+    {
+        Snapshot snapshot;
+        snapshot.timestampMs = cpp_freertos::Ticks::TicksToMs(cpp_freertos::Ticks::GetTicks());
+        snapshot.services    = getServicesStats();
+        snapshot.heap        = getHeapStats();
+
+        cpp_freertos::LockGuard lock(mutex);
+        snapshot.residency = residency;
+        snapshot.holders   = holders;
+        return snapshot;
+    }
+
+    auto Registry::getServicesStats() const -> std::vector<ServiceStats>
+    {
+        cpp_freertos::LockGuard lock(mutex);
+        std::vector<ServiceStats> stats;
+        stats.reserve(services.size());
+        for (const auto &[name, telemetry] : services) {
+            stats.push_back(telemetry->getStats(name));
+        }
+        return stats;
+    }
+
+    auto Registry::getHeapStats() -> std::vector<TaskHeapStats>
+    {
+        std::array<usermem_task_usage, maxTasks> usage{};
+        const auto usageCount = usermemGetTasksUsage(usage.data(), usage.size());
+
+        // names are taken from the living tasks only, handles of the deleted ones may be dangling
+        std::vector<TaskStatus_t> tasks(uxTaskGetNumberOfTasks());
+        tasks.resize(uxTaskGetSystemState(tasks.data(), tasks.size(), nullptr));
+
+        std::vector<TaskHeapStats> stats;
+        stats.reserve(usageCount);
+        for (std::size_t i = 0; i < usageCount; ++i) {
+            const auto task = std::find_if(
+                tasks.begin(), tasks.end(), [&](const auto &status) { return status.xHandle == usage[i].task; });
+            stats.push_back(TaskHeapStats{.task      = task != tasks.end() ? task->pcTaskName : "",
+                                          .allocated = static_cast<std::uint32_t>(usage[i].allocated),
+                                          .peak      = static_cast<std::uint32_t>(usage[i].peak)});
+        }
+        return stats;
+    }
+
+    auto serialize(const Snapshot &snapshot) -> std::string
+    {
+        using msgpack11::MsgPack;
+
+        MsgPack::array services;
+        for (const auto &service : snapshot.services) {
+            MsgPack::array handlers;
+            for (const auto &handler : service.handlers) {
+                handlers.push_back(MsgPack::object{{"type", handler.messageType},
+                                                   {"count", handler.count},
+                                                   {"total", handler.totalMs},
+                                                   {"max", handler.maxMs},
+                                                   {"hist", toMsgPack(handler.histogram)}});
+            }
+            services.push_back(MsgPack::object{{"name", service.name},
+                                               {"msgs", service.messages},
+                                               {"mbox", service.mailboxHighWater},
+                                               {"handlers", std::move(handlers)}});
+        }
+
+        MsgPack::array heap;
+        for (const auto &task : snapshot.heap) {
+            heap.push_back(MsgPack::object{{"task", task.task}, {"now", task.allocated}, {"peak", task.peak}});
+        }
+
+        MsgPack::array residency;
+        for (const auto &level : snapshot.residency) {
+            residency.push_back(MsgPack::object{{"mhz", level.frequencyMHz}, {"ms", level.ms}});
+        }
+
+        MsgPack::array holders;
+        for (const auto &holder : snapshot.holders) {
+            holders.push_back(MsgPack::object{{"name", holder.name}, {"ms", holder.ms}});
+        }
+
+        const MsgPack obj = MsgPack::object{{"ts", snapshot.timestampMs},
+                                            {"services", std::move(services)},
+                                            {"heap", std::move(heap)},
+                                            {"residency", std::move(residency)},
+                                            {"holders", std::move(holders)}};
+        return obj.dump();
+    }
+} // namespace sys::telemetry
@@ -0,0 +1,184 @@
+// Copyright (c) 2017-2023, Mudita Sp. z.o.o. All rights reserved.
+// For licensing, see https://github.com/mudita/MuditaOS/LICENSE.md
+
+#include <Service/Trace.hpp>
+
+#include <ticks.hpp>
+
+#include <sstream>
+
+namespace sys::trace
+{
+    namespace
+    {
+        TraceBuffer systemTrace;
+        std::atomic<Id> lastId{noTrace};
+
+        constexpr auto phaseShift = 8U;
+
+        auto pack(Stage stage, Phase phase) noexcept -> std::uint16_t
+        {
+            return static_cast<std::uint16_t>(stage) | (static_cast<std::uint16_t>(phase) << phaseShift);
+        }
+    } // namespace
+
+    void TraceBuffer::record(const Event &event) noexcept
+    {
+        const auto number = next.fetch_add(1, std::memory_order_relaxed);
+        auto &slot        = slots[number % capacity];
+
+        slot.sequence.store(0, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+        slot.id.store(event.id, std::memory_order_relaxed);
+        slot.timestampMs.store(event.timestampMs, std::memory_order_relaxed);
+        slot.stageAndPhase.store(pack(event.stage, event.phase), std::memory_order_relaxed);
+        slot.sequence.store(number + 1, std::memory_order_release);
+    }
+
+    auto TraceBuffer::getEvents() const -> std::vector<Event>
+    {
+        const auto end = next.load(std::memory_order_acquire);
+        return readEvents(first.load(std::memory_order_acquire), end);
+    }
+
+    auto TraceBuffer::takeEvents() -> std::vector<Event>
+    {
+        auto begin = first.load(std::memory_order_acquire);
+        while (true) {
+            const auto end = next.load(std::memory_order_acquire);
+            if (begin == end) {
+                return {};
+            }
+            // the events still being written are left for the next take
+            auto taken  = end;
+            auto events = readEvents(begin, end, &taken);
+            if (first.compare_exchange_strong(begin, taken, std::memory_order_acq_rel)) {
+                return events;
+            }
+        }
+    }
+
+    auto TraceBuffer::readEvents(std::uint32_t begin, std::uint32_t end, std::uint32_t *pending) const
+        -> std::vector<Event>
+    {
+        if (end - begin > capacity) {
+            begin = end - capacity;
+        }
+
+        std::vector<Event> events;
+        events.reserve(end - begin);
+        for (auto number = begin; number != end; ++number) {
+            const auto &slot    = slots[number % capacity];
+            const auto sequence = slot.sequence.load(std::memory_order_acquire);
+            if (pending != nullptr && sequence < number + 1) {
+                *pending = number;
+                break;
+            }
+            if (sequence != number + 1) {
+                continue;
+            }
+            const auto id            = slot.id.load(std::memory_order_relaxed);
+            const auto timestampMs   = slot.timestampMs.load(std::memory_order_relaxed);
+            const auto stageAndPhase = slot.stageAndPhase.load(std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_acquire);
+            if (slot.sequence.load(std::memory_order_relaxed) != sequence) {
+                continue;
+            }
+            events.push_back(Event{id,
+                                   timestampMs,
+                                   static_cast<Stage>(stageAndPhase & 0xFFU),
+                                   static_cast<Phase>(stageAndPhase >> phaseShift)});
+        }
+        return events;
+    }
+
+    void TraceBuffer::clear() noexcept
+    {
+        first.store(next.load(std::memory_order_acquire), std::memory_order_release);
+    }
+
+    auto newId() noexcept -> Id
+    {
+        auto id = lastId.fetch_add(1, std::memory_order_relaxed) + 1;
+        if (id == noTrace) {
+            id = lastId.fetch_add(1, std::memory_order_relaxed) + 1;
+        }
+        return id;
+    }
+
+    void record(Id id, Stage stage, Phase phase) noexcept
+    {
+        if (id == noTrace) {
+            return;
+        }
+        const auto timestampMs = cpp_freertos::Ticks::TicksToMs(cpp_freertos::Ticks::GetTicks());
+        systemTrace.record(Event{id, static_cast<std::uint32_t>(timestampMs), stage, phase});
+    }
+
+    auto getEvents() -> std::vector<Event>
+    {
+        return systemTrace.getEvents();
+    }
+
+    auto takeEvents() -> std::vector<Event>
+    {
+        return systemTrace.takeEvents();
+    }
+
+    void clear() noexcept
+    {
+        systemTrace.clear();
+    }
+
+    auto toString(Stage stage) -> const char *
+    {
+        switch (stage) {
+        case Stage::Input:
+            return "Input";
+        case Stage::Dispatch:
+            return "Dispatch";
+        case Stage::Window:
+            return "Window";
+        case Stage::DrawList:
+            return "DrawList";
+        case Stage::Queue:
+            return "Queue";
+        case Stage::Render:
+            return "Render";
+        case Stage::Update:
+            return "Update";
+        case Stage::Refresh:
+            return "Refresh";
+        }
+        return "Unknown";
+    }
+
+    auto toChromeTrace(const std::vector<Event> &events) -> std::string
+    {
+        constexpr auto usInMs = 1000U;
+
+        // Async events, the stages of a single input are drawn as one track regardless of the task recording them
+        std::ostringstream json;
+        json << R"({"displayTimeUnit":"ms","traceEvents":[)";
+        for (auto it = events.begin(); it != events.end(); ++it) {
+            if (it != events.begin()) {
+                json << ',';
+            }
+            json << R"({"name":")" << toString(it->stage) << R"(","cat":")" << category << R"(","ph":")"
+                 << (it->phase == Phase::Begin ? 'b' : 'e') << R"(","id":)" << it->id
+                 << R"(,"ts":)" << static_cast<std::uint64_t>(it->timestampMs) * usInMs << R"(,"pid":1,"tid":1})";
+        }
+        json << "]}";
+        return json.str();
+    }
+
+    ScopedStage::ScopedStage(Id id, Stage stage) noexcept : id{id}, stage{stage}
+    {
+        record(id, stage, Phase::Begin);
+    }
+
+    ScopedStage::~ScopedStage() noexcept
+    {
+        record(id, stage, Phase::End);
+    }
+} // namespace sys::trace
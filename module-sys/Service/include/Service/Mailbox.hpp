@@ -1,4 +1,4 @@
-// Copyright (c) 2017-2022, Mudita Sp. z.o.o. All rights reserved.
+// Copyright (c) 2017-2023, Mudita Sp. z.o.o. All rights reserved.
 // For licensing, see https://github.com/mudita/MuditaOS/LICENSE.md
 
 #pragma once
@@ -95,6 +95,12 @@ class Mailbox
         return queue_.empty();
     }
 
+    std::size_t size()
+    {
+        cpp_freertos::LockGuard mlock(mutex_);
+        return queue_.size();
+    }
+
   private:
     Base thread_;
     std::deque<T> queue_;
@@ -1,9 +1,10 @@
-// Copyright (c) 2017-2022, Mudita Sp. z.o.o. All rights reserved.
+// Copyright (c) 2017-2023, Mudita Sp. z.o.o. All rights reserved.
 // For licensing, see https://github.com/mudita/MuditaOS/LICENSE.md
 
 #pragma once
 
 #include "MessageForward.hpp"
+#include "Trace.hpp"
 
 #include <system/Common.hpp>
 #include <MessageType.hpp>
@@ -67,6 +68,7 @@ namespace sys
         TransmissionType transType = TransmissionType::Unspecified;
         BusChannel channel         = BusChannel::Unknown;
         std::string sender         = "Unknown";
+        trace::Id traceId          = trace::noTrace; ///< the traced input the message was caused by
 
         [[nodiscard]] std::string to_string() const
         {
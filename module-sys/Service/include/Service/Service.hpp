@@ -1,4 +1,4 @@
-// Copyright (c) 2017-2022, Mudita Sp. z.o.o. All rights reserved.
+// Copyright (c) 2017-2023, Mudita Sp. z.o.o. All rights reserved.
 // For licensing, see https://github.com/mudita/MuditaOS/LICENSE.md
 
 #pragma once
@@ -8,6 +8,7 @@
 #include "Mailbox.hpp" // for Mailbox
 #include "Message.hpp" // for MessagePointer
 #include "ServiceManifest.hpp"
+#include "Telemetry.hpp"
 #include "thread.hpp" // for Thread
 #include <SystemWatchdog/Watchdog.hpp>
 #include <SystemWatchdog/SystemWatchdog.hpp> // for SystemWatchdog
@@ -250,6 +251,8 @@ namespace sys
 
         MessagePointer currentlyProcessing = nullptr;
 
+        telemetry::ServiceTelemetry telemetry;
+
       public:
         auto getTimers() -> auto &
         {
@@ -0,0 +1,127 @@
+// Copyright (c) 2017-2023, Mudita Sp. z.o.o. All rights reserved.
+// For licensing, see https://github.com/mudita/MuditaOS/LICENSE.md
+
+#pragma once
+
+#include <mutex.hpp>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <typeindex>
+#include <unordered_map>
+#include <vector>
+
+/// Runtime statistics of the services, the tasks and the CPU, gathered all the time and exported on request as one
+/// snapshot, so that it's possible to tell in the field who keeps the system busy.
+namespace sys::telemetry
+{
+    /// Upper bounds of the handler execution time buckets, the last bucket holds all the longer executions
+    inline constexpr std::array<std::uint32_t, 7> handlerTimeBucketsMs{1, 2, 5, 10, 20, 50, 100};
+    using Histogram = std::array<std::uint32_t, handlerTimeBucketsMs.size() + 1>;
+
+    struct HandlerStats
+    {
+        /// Mangled type name of the handled message
+        std::string messageType;
+        std::uint32_t count   = 0;
+        std::uint32_t totalMs = 0;
+        std::uint32_t maxMs   = 0;
+        Histogram histogram{};
+    };
+
+    struct ServiceStats
+    {
+        std::string name;
+        std::uint32_t messages         = 0;
+        std::uint32_t mailboxHighWater = 0;
+        std::vector<HandlerStats> handlers;
+    };
+
+    struct TaskHeapStats
+    {
+        std::string task;
+        std::uint32_t allocated = 0;
+        std::uint32_t peak      = 0;
+    };
+
+    /// Time spent at the CPU frequency
+    struct FrequencyResidency
+    {
+        std::uint32_t frequencyMHz = 0;
+        std::uint32_t ms           = 0;
+    };
+
+    /// Time the CPU was kept above the lowest frequency on request of the sentinel, or the load if no sentinel
+    /// required that frequency
+    struct FrequencyHolder
+    {
+        std::string name;
+        std::uint32_t ms = 0;
+    };
+
+    struct Snapshot
+    {
+        std::uint32_t timestampMs = 0;
+        std::vector<ServiceStats> services;
+        std::vector<TaskHeapStats> heap;
+        std::vector<FrequencyResidency> residency;
+        std::vector<FrequencyHolder> holders;
+    };
+
+    /// Statistics of the messages handled by a service. Updated by the service task, read by any task.
+    class ServiceTelemetry
+    {
+      public:
+        /// @param type type of the handled message
+        /// @param mailboxDepth messages waiting in the mailbox, including the handled one
+        /// @param handlerTimeMs time of handling the message
+        void onMessageHandled(const std::type_info &type, std::size_t mailboxDepth, std::uint32_t handlerTimeMs);
+
+        auto getStats(const std::string &serviceName) const -> ServiceStats;
+
+      private:
+        struct Handler
+        {
+            std::uint32_t count   = 0;
+            std::uint32_t totalMs = 0;
+            std::uint32_t maxMs   = 0;
+            Histogram histogram{};
+        };
+
+        mutable cpp_freertos::MutexStandard mutex;
+        std::unordered_map<std::type_index, Handler> handlers;
+        std::uint32_t messages         = 0;
+        std::uint32_t mailboxHighWater = 0;
+    };
+
+    /// Telemetry of all the running services and the CPU frequency statistics of the power manager
+    class Registry
+    {
+      public:
+        static Registry &get();
+
+        void add(const std::string &serviceName, const ServiceTelemetry *telemetry);
+        void remove(const ServiceTelemetry *telemetry);
+
+        void setFrequencyStats(std::vector<FrequencyResidency> residency, std::vector<FrequencyHolder> holders);
+
+        /// Gathers statistics of the services, the CPU and the heap usage of the tasks
+        auto makeSnapshot() const -> Snapshot;
+
+        /// Heap usage of the tasks, empty if the heap statistics are disabled
+        static auto getHeapStats() -> std::vector<TaskHeapStats>;
+
+      private:
+        auto getServicesStats() const -> std::vector<ServiceStats>;
+
+        mutable cpp_freertos::MutexStandard mutex;
+        std::vector<std::pair<std::string, const ServiceTelemetry *>> services;
+        std::vector<FrequencyResidency> residency;
+        std::vector<FrequencyHolder> holders;
+    };
+
+    /// Compact binary (MessagePack) form of the snapshot
+    auto serialize(const Snapshot &snapshot) -> std::string;
+} // namespace sys::telemetry
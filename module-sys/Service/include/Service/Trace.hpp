@@ -0,0 +1,112 @@
+// Copyright (c) 2017-2023, Mudita Sp. z.o.o. All rights reserved.
+// For licensing, see https://github.com/mudita/MuditaOS/LICENSE.md
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/// Latency tracing of the input handling, from the key press to the refreshed display. Each key press gets
+/// a correlation id which is carried by the messages and the draw commands of the frame it caused, the services on the
+/// way record the stages they went through under that id.
+namespace sys::trace
+{
+    using Id                       = std::uint32_t;
+    inline constexpr Id noTrace    = 0;
+    inline constexpr auto category = "input";
+
+    enum class Stage : std::uint8_t
+    {
+        Input,    ///< key press delivered to the event manager
+        Dispatch, ///< key forwarded to the focused application
+        Window,   ///< window handling the input
+        DrawList, ///< building of the draw commands
+        Queue,    ///< draw commands waiting for the renderer
+        Render,   ///< rendering to the frame buffer
+        Update,   ///< frame sent to the display
+        Refresh   ///< display refreshed
+    };
+
+    enum class Phase : std::uint8_t
+    {
+        Begin,
+        End
+    };
+
+    struct Event
+    {
+        Id id;
+        std::uint32_t timestampMs;
+        Stage stage;
+        Phase phase;
+    };
+
+    /// Ring buffer of the most recent events. Recording doesn't lock so it can be done from any task, a reader skips
+    /// the slots that are being overwritten at the moment. A traced key press records about 20 events, so a reader
+    /// should take the events every few dozen presses.
+    class TraceBuffer
+    {
+      public:
+        static constexpr std::size_t capacity = 512;
+
+        void record(const Event &event) noexcept;
+        /// Events recorded since the last take or clear
+        [[nodiscard]] auto getEvents() const -> std::vector<Event>;
+        /// Same as getEvents followed by clear, but the events recorded in between are neither lost nor taken twice
+        [[nodiscard]] auto takeEvents() -> std::vector<Event>;
+        void clear() noexcept;
+
+      private:
+        struct Slot
+        {
+            /// Number of the event held increased by one, zero while the slot is written
+            std::atomic<std::uint32_t> sequence{0};
+            std::atomic<Id> id{noTrace};
+            std::atomic<std::uint32_t> timestampMs{0};
+            std::atomic<std::uint16_t> stageAndPhase{0};
+        };
+
+        /// Stops at the first event still being written if `pending` is given and stores its number there
+        [[nodiscard]] auto readEvents(std::uint32_t begin, std::uint32_t end, std::uint32_t *pending = nullptr) const
+            -> std::vector<Event>;
+
+        std::array<Slot, capacity> slots;
+        std::atomic<std::uint32_t> next{0};
+        /// Number of the oldest event which hasn't been taken or cleared
+        std::atomic<std::uint32_t> first{0};
+    };
+
+    /// Id for a new input event
+    [[nodiscard]] auto newId() noexcept -> Id;
+
+    /// Records the stage of the traced input in the system trace buffer, the events without an id are dropped
+    void record(Id id, Stage stage, Phase phase) noexcept;
+
+    [[nodiscard]] auto getEvents() -> std::vector<Event>;
+    [[nodiscard]] auto takeEvents() -> std::vector<Event>;
+    void clear() noexcept;
+
+    [[nodiscard]] auto toString(Stage stage) -> const char *;
+
+    /// Events in the Chrome trace event format, loadable by Perfetto and chrome://tracing
+    [[nodiscard]] auto toChromeTrace(const std::vector<Event> &events) -> std::string;
+
+    /// Records the beginning of the stage on construction and its end on destruction
+    class ScopedStage
+    {
+      public:
+        ScopedStage(Id id, Stage stage) noexcept;
+        ~ScopedStage() noexcept;
+
+        ScopedStage(const ScopedStage &) = delete;
+        ScopedStage &operator=(const ScopedStage &) = delete;
+
+      private:
+        Id id;
+        Stage stage;
+    };
+} // namespace sys::trace
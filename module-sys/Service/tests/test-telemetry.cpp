@@ -0,0 +1,79 @@
+// Copyright (c) 2017-2023, Mudita Sp. z.o.o. All rights reserved.
+// For licensing, see https://github.com/mudita/MuditaOS/LICENSE.md
+
+#include <catch2/catch.hpp>
+
+#include <Service/Telemetry.hpp>
+#include <msgpack11/msgpack11.hpp>
+
+#include <algorithm>
+
+namespace
+{
+    struct FirstMessage
+    {};
+    struct SecondMessage
+    {};
+
+    auto findHandler(const sys::telemetry::ServiceStats &stats, const std::type_info &type)
+    {
+        return std::find_if(stats.handlers.begin(), stats.handlers.end(), [&type](const auto &handler) {
+            return handler.messageType == type.name();
+        });
+    }
+} // namespace
+
+TEST_CASE("Service telemetry")
+{
+    using namespace sys::telemetry;
+    ServiceTelemetry telemetry;
+
+    telemetry.onMessageHandled(typeid(FirstMessage), 1, 0);
+    telemetry.onMessageHandled(typeid(FirstMessage), 5, 7);
+    telemetry.onMessageHandled(typeid(FirstMessage), 2, 250);
+    telemetry.onMessageHandled(typeid(SecondMessage), 3, 1);
+
+    const auto stats = telemetry.getStats("ServiceTest");
+    REQUIRE(stats.name == "ServiceTest");
+    REQUIRE(stats.messages == 4);
+    REQUIRE(stats.mailboxHighWater == 5);
+    REQUIRE(stats.handlers.size() == 2);
+
+    SECTION("Handler times")
+    {
+        const auto first = findHandler(stats, typeid(FirstMessage));
+        REQUIRE(first != stats.handlers.end());
+        REQUIRE(first->count == 3);
+        REQUIRE(first->totalMs == 257);
+        REQUIRE(first->maxMs == 250);
+    }
+
+    SECTION("Histogram buckets")
+    {
+        const auto first = findHandler(stats, typeid(FirstMessage));
+        REQUIRE(first->histogram == Histogram{1, 0, 0, 1, 0, 0, 0, 1});
+
+        const auto second = findHandler(stats, typeid(SecondMessage));
+        REQUIRE(second->histogram == Histogram{0, 1, 0, 0, 0, 0, 0, 0});
+    }
+
+    SECTION("Serialized snapshot")
+    {
+        Snapshot snapshot;
+        snapshot.timestampMs = 1000;
+        snapshot.services.push_back(stats);
+        snapshot.heap.push_back({.task = "ServiceTest", .allocated = 100, .peak = 200});
+        snapshot.residency.push_back({.frequencyMHz = 528, .ms = 10});
+        snapshot.holders.push_back({.name = "load", .ms = 10});
+
+        std::string error;
+        const auto parsed = msgpack11::MsgPack::parse(serialize(snapshot), error);
+        REQUIRE(error.empty());
+        REQUIRE(parsed["ts"].uint32_value() == 1000);
+        REQUIRE(parsed["services"][0]["name"].string_value() == "ServiceTest");
+        REQUIRE(parsed["services"][0]["mbox"].uint32_value() == 5);
+        REQUIRE(parsed["heap"][0]["peak"].uint32_value() == 200);
+        REQUIRE(parsed["residency"][0]["mhz"].uint32_value() == 528);
+        REQUIRE(parsed["holders"][0]["name"].string_value() == "load");
+    }
+}
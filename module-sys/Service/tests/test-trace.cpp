@@ -0,0 +1,116 @@
+// Copyright (c) 2017-2023, Mudita Sp. z.o.o. All rights reserved.
+// For licensing, see https://github.com/mudita/MuditaOS/LICENSE.md
+
+#include <catch2/catch.hpp>
+
+#include <Service/Trace.hpp>
+
+#include <algorithm>
+#include <memory>
+#include <thread>
+#include <vector>
+
+TEST_CASE("Trace buffer")
+{
+    using namespace sys::trace;
+    auto buffer = std::make_unique<TraceBuffer>();
+
+    SECTION("Empty")
+    {
+        REQUIRE(buffer->getEvents().empty());
+    }
+
+    SECTION("Events in the recording order")
+    {
+        buffer->record(Event{1, 10, Stage::Render, Phase::Begin});
+        buffer->record(Event{1, 15, Stage::Render, Phase::End});
+
+        const auto events = buffer->getEvents();
+        REQUIRE(events.size() == 2);
+        REQUIRE(events[0].id == 1);
+        REQUIRE(events[0].timestampMs == 10);
+        REQUIRE(events[0].stage == Stage::Render);
+        REQUIRE(events[0].phase == Phase::Begin);
+        REQUIRE(events[1].timestampMs == 15);
+        REQUIRE(events[1].phase == Phase::End);
+    }
+
+    SECTION("Oldest events are overwritten")
+    {
+        const auto recorded = TraceBuffer::capacity + 10;
+        for (std::uint32_t i = 0; i < recorded; ++i) {
+            buffer->record(Event{i + 1, i, Stage::Input, Phase::Begin});
+        }
+
+        const auto events = buffer->getEvents();
+        REQUIRE(events.size() == TraceBuffer::capacity);
+        REQUIRE(events.front().id == 11);
+        REQUIRE(events.back().id == recorded);
+    }
+
+    SECTION("Clear")
+    {
+        buffer->record(Event{1, 10, Stage::Input, Phase::Begin});
+        buffer->clear();
+        REQUIRE(buffer->getEvents().empty());
+
+        buffer->record(Event{2, 20, Stage::Input, Phase::Begin});
+        REQUIRE(buffer->getEvents().size() == 1);
+        REQUIRE(buffer->getEvents().front().id == 2);
+    }
+
+    SECTION("Taken events are removed")
+    {
+        buffer->record(Event{1, 10, Stage::Input, Phase::Begin});
+        buffer->record(Event{1, 15, Stage::Input, Phase::End});
+        REQUIRE(buffer->takeEvents().size() == 2);
+        REQUIRE(buffer->takeEvents().empty());
+
+        buffer->record(Event{2, 20, Stage::Input, Phase::Begin});
+        const auto events = buffer->takeEvents();
+        REQUIRE(events.size() == 1);
+        REQUIRE(events.front().id == 2);
+    }
+
+    SECTION("Events are taken once while recorded concurrently")
+    {
+        constexpr std::uint32_t recorded = 100000;
+        std::thread writer{[&buffer] {
+            for (std::uint32_t i = 0; i < recorded; ++i) {
+                buffer->record(Event{i + 1, i, Stage::Input, Phase::Begin});
+            }
+        }};
+
+        std::vector<Id> taken;
+        while (taken.empty() || taken.back() != recorded) {
+            for (const auto &event : buffer->takeEvents()) {
+                taken.push_back(event.id);
+            }
+        }
+        writer.join();
+
+        // events overwritten before they were taken are lost, the rest are taken once and in order
+        REQUIRE(std::is_sorted(taken.begin(), taken.end()));
+        REQUIRE(std::adjacent_find(taken.begin(), taken.end()) == taken.end());
+    }
+}
+
+TEST_CASE("Trace ids")
+{
+    const auto first  = sys::trace::newId();
+    const auto second = sys::trace::newId();
+    REQUIRE(first != sys::trace::noTrace);
+    REQUIRE(second != first);
+}
+
+TEST_CASE("Chrome trace format")
+{
+    using namespace sys::trace;
+    const std::vector<Event> events{{7, 2, Stage::Update, Phase::Begin}, {7, 5, Stage::Update, Phase::End}};
+
+    REQUIRE(toChromeTrace({}) == R"({"displayTimeUnit":"ms","traceEvents":[]})");
+    REQUIRE(toChromeTrace(events) ==
+            R"({"displayTimeUnit":"ms","traceEvents":[)"
+            R"({"name":"Update","cat":"input","ph":"b","id":7,"ts":2000,"pid":1,"tid":1},)"
+            R"({"name":"Update","cat":"input","ph":"e","id":7,"ts":5000,"pid":1,"tid":1}]})");
+}
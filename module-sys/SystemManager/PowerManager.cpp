@@ -8,10 +8,12 @@
 #include "magic_enum.hpp"
 #include <SystemManager/CpuStatistics.hpp>
 #include <SystemManager/PowerManager.hpp>
+#include <Service/Telemetry.hpp>
 #include <gsl/util>
 #include <log/log.hpp>
 #include <Logger.hpp>
 #include <Utils.hpp>
+#include <ticks.hpp>
 
 namespace sys
 {
@@ -20,6 +22,7 @@ namespace sys
         constexpr auto lowestLevelName{"lowestCpuFrequency"};
         constexpr auto middleLevelName{"middleCpuFrequency"};
         constexpr auto highestLevelName{"highestCpuFrequency"};
+        constexpr auto loadHolderName{"load"};
 
         constexpr bsp::CpuFrequencyMHz logDumpFrequencyToHold{bsp::CpuFrequencyMHz::Level_4};
     } // namespace
@@ -118,6 +121,7 @@ namespace sys
         auto _ = gsl::finally([&retval, this, data] {
             retval.frequencySet = lowPowerControl->GetCurrentFrequencyLevel();
             retval.data         = data.sentinel;
+            UpdateFrequencyHolder(data.sentinel);
         });
 
         auto algorithms = {
@@ -211,7 +215,43 @@ namespace sys
             }
         }
 
+        frequencyResidency[currentFreq] += ticks - lastCpuFrequencyChangeTimestamp;
+        if (currentFreq != powerProfile.minimalFrequency && !frequencyHolder.empty()) {
+            frequencyHolders[frequencyHolder] += ticks - lastCpuFrequencyChangeTimestamp;
+        }
+
         lastCpuFrequencyChangeTimestamp = ticks;
+        PublishFrequencyTelemetry();
+    }
+
+    void PowerManager::UpdateFrequencyHolder(const sentinel::View &minimumRequested)
+    {
+        const auto currentFreq = lowPowerControl->GetCurrentFrequencyLevel();
+        const auto requested   = !minimumRequested.name.empty() && minimumRequested.minFrequency >= currentFreq;
+        std::string holder     = requested ? minimumRequested.name : loadHolderName;
+        if (holder != frequencyHolder) {
+            // time so far belongs to the previous holder
+            UpdateCpuFrequencyMonitor(currentFreq);
+            frequencyHolder = std::move(holder);
+        }
+    }
+
+    void PowerManager::PublishFrequencyTelemetry() const
+    {
+        std::vector<telemetry::FrequencyResidency> residency;
+        residency.reserve(frequencyResidency.size());
+        for (const auto &[frequency, ticks] : frequencyResidency) {
+            residency.push_back({.frequencyMHz = static_cast<std::uint32_t>(frequency),
+                                 .ms           = cpp_freertos::Ticks::TicksToMs(ticks)});
+        }
+
+        std::vector<telemetry::FrequencyHolder> holders;
+        holders.reserve(frequencyHolders.size());
+        for (const auto &[name, ticks] : frequencyHolders) {
+            holders.push_back({.name = name, .ms = cpp_freertos::Ticks::TicksToMs(ticks)});
+        }
+
+        telemetry::Registry::get().setFrequencyStats(std::move(residency), std::move(holders));
     }
 
     void PowerManager::LogPowerManagerStatistics()
@@ -12,6 +12,7 @@
 #include "LogSentinel.hpp"
 #include "TaskStatistics.hpp"
 #include <bsp/lpm/PowerProfile.hpp>
+#include <map>
 #include <vector>
 
 namespace sys::cpu
@@ -76,12 +77,18 @@ namespace sys
         void SetCpuFrequency(bsp::CpuFrequencyMHz freq);
 
         void UpdateCpuFrequencyMonitor(bsp::CpuFrequencyMHz currentFreq);
+        /// Time at the current frequency is accounted to the sentinel requesting it, or to the load otherwise
+        void UpdateFrequencyHolder(const sentinel::View &minimumRequested);
+        void PublishFrequencyTelemetry() const;
         [[nodiscard]] auto GetMinimumCpuFrequencyRequested() const noexcept -> sentinel::View;
 
         TickType_t lastCpuFrequencyChangeTimestamp{0};
         TickType_t lastLogStatisticsTimestamp{0};
 
         std::vector<CpuFrequencyMonitor> cpuFrequencyMonitor;
+        std::map<bsp::CpuFrequencyMHz, TickType_t> frequencyResidency;
+        std::map<std::string, TickType_t> frequencyHolders;
+        std::string frequencyHolder;
 
         std::shared_ptr<drivers::DriverSEMC> driverSEMC;
         std::unique_ptr<bsp::LowPowerMode> lowPowerControl;
@@ -1,18 +1,78 @@
-// Copyright (c) 2017-2022, Mudita Sp. z.o.o. All rights reserved.
+// Copyright (c) 2017-2023, Mudita Sp. z.o.o. All rights reserved.
 // For licensing, see https://github.com/mudita/MuditaOS/LICENSE.md
 
 #include "PhoneNumber.hpp"
 
 #include "country.hpp"
 
+#include <mutex.hpp>
 #include <phonenumbers/phonenumberutil.h>
-#include <phonenumbers/asyoutypeformatter.h>
 
+#include <algorithm>
 #include <exception>
+#include <list>
+#include <optional>
 #include <string>
+#include <unordered_map>
+#include <utility>
 
 using namespace utils;
 
+namespace
+{
+    constexpr std::size_t parseCacheCapacity = 32;
+
+    /// Most recently parsed numbers, the same ones are parsed over and over again when lists of calls, messages
+    /// or contacts are shown. Numbers are constructed by many services, hence the lock.
+    class ParseCache
+    {
+      public:
+        static ParseCache &get()
+        {
+            static ParseCache instance;
+            return instance;
+        }
+
+        std::optional<PhoneNumber> find(const std::string &key)
+        {
+            cpp_freertos::LockGuard lock(mutex);
+            const auto it = index.find(key);
+            if (it == index.end()) {
+                return std::nullopt;
+            }
+            entries.splice(entries.begin(), entries, it->second);
+            return it->second->second;
+        }
+
+        void insert(const std::string &key, const PhoneNumber &number)
+        {
+            cpp_freertos::LockGuard lock(mutex);
+            if (const auto it = index.find(key); it != index.end()) {
+                entries.erase(it->second);
+                index.erase(it);
+            }
+            entries.emplace_front(key, number);
+            index.emplace(key, entries.begin());
+            if (entries.size() > parseCacheCapacity) {
+                index.erase(entries.back().first);
+                entries.pop_back();
+            }
+        }
+
+      private:
+        /// most recently used first
+        std::list<std::pair<std::string, PhoneNumber>> entries;
+        std::unordered_map<std::string, std::list<std::pair<std::string, PhoneNumber>>::iterator> index;
+        cpp_freertos::MutexStandard mutex;
+    };
+
+    // Keys of the constructors are told apart by the first character
+    std::string makeKey(char constructor, const std::string &first, const std::string &second = {})
+    {
+        return constructor + first + '\n' + second;
+    }
+} // namespace
+
 PhoneNumber::Error::Error(const std::string &number, const std::string &reason) : number(number), reason(reason)
 {}
 
@@ -29,6 +89,12 @@ const std::string &PhoneNumber::Error::getNumber() const
 PhoneNumber::PhoneNumber(const std::string &phoneNumber, country::Id defaultCountryCode)
     : countryCode(defaultCountryCode)
 {
+    const auto key = makeKey('c', phoneNumber, std::to_string(static_cast<int>(defaultCountryCode)));
+    if (auto cached = ParseCache::get().find(key); cached.has_value()) {
+        *this = std::move(*cached);
+        return;
+    }
+
     auto &util = *phn_util::GetInstance();
     auto number = phoneNumber;
     number.erase(std::remove_if(number.begin(), number.end(), PhoneNumber::CharacterToRemove), number.end());
@@ -41,10 +107,19 @@ PhoneNumber::PhoneNumber(const std::string &phoneNumber, country::Id defaultCoun
 
     // create view representation
     viewSelf = makeView(number);
+    ParseCache::get().insert(key, *this);
 }
 
 PhoneNumber::PhoneNumber(const View &numberView)
 {
+    const auto key = makeKey(numberView.isValid() ? 'V' : 'v',
+                             numberView.getEntered(),
+                             numberView.getE164() + '\n' + numberView.getFormatted());
+    if (auto cached = ParseCache::get().find(key); cached.has_value()) {
+        *this = std::move(*cached);
+        return;
+    }
+
     auto &util = *phn_util::GetInstance();
 
     if (numberView.isValid()) {
@@ -77,10 +152,17 @@ PhoneNumber::PhoneNumber(const View &numberView)
 
     // save original view without recalculating
     viewSelf = numberView;
+    ParseCache::get().insert(key, *this);
 }
 
 PhoneNumber::PhoneNumber(const std::string &phoneNumber, const std::string &e164number)
 {
+    const auto key = makeKey('e', phoneNumber, e164number);
+    if (auto cached = ParseCache::get().find(key); cached.has_value()) {
+        *this = std::move(*cached);
+        return;
+    }
+
     auto &util = *phn_util::GetInstance();
     std::string regionCode;
 
@@ -127,6 +209,7 @@ PhoneNumber::PhoneNumber(const std::string &phoneNumber, const std::string &e164
 
     // create view representation
     viewSelf = makeView(number);
+    ParseCache::get().insert(key, *this);
 }
 
 bool PhoneNumber::isValid() const
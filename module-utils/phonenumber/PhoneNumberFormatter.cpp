@@ -0,0 +1,82 @@
+// Copyright (c) 2017-2023, Mudita Sp. z.o.o. All rights reserved.
+// For licensing, see https://github.com/mudita/MuditaOS/LICENSE.md
+
+#include "PhoneNumberFormatter.hpp"
+
+#include <phonenumbers/phonenumberutil.h>
+
+using namespace utils;
+
+PhoneNumberFormatter::PhoneNumberFormatter(country::Id country)
+{
+    setCountry(country);
+}
+
+void PhoneNumberFormatter::setCountry(country::Id country)
+{
+    auto &util = *::i18n::phonenumbers::PhoneNumberUtil::GetInstance();
+    formatter.reset(util.GetAsYouTypeFormatter(country::getAlpha2Code(country)));
+    setNumber(std::string{entered});
+}
+
+const std::string &PhoneNumberFormatter::inputDigit(char digit)
+{
+    if (stale) {
+        restore();
+    }
+    formatter->InputDigit(digit, &formatted);
+    entered += digit;
+    history.push_back(formatted);
+    return formatted;
+}
+
+const std::string &PhoneNumberFormatter::removeLastDigit()
+{
+    if (entered.empty()) {
+        return formatted;
+    }
+    entered.pop_back();
+    history.pop_back();
+    formatted = history.empty() ? std::string{} : history.back();
+    // AsYouTypeFormatter can't take a digit back, it's fed the number again only when another digit comes
+    stale = true;
+    return formatted;
+}
+
+const std::string &PhoneNumberFormatter::setNumber(const std::string &number)
+{
+    clear();
+    for (const auto c : number) {
+        inputDigit(c);
+    }
+    return formatted;
+}
+
+void PhoneNumberFormatter::clear()
+{
+    formatter->Clear();
+    entered.clear();
+    formatted.clear();
+    history.clear();
+    stale = false;
+}
+
+const std::string &PhoneNumberFormatter::getEntered() const noexcept
+{
+    return entered;
+}
+
+const std::string &PhoneNumberFormatter::getFormatted() const noexcept
+{
+    return formatted;
+}
+
+void PhoneNumberFormatter::restore()
+{
+    std::string unused;
+    formatter->Clear();
+    for (const auto c : entered) {
+        formatter->InputDigit(c, &unused);
+    }
+    stale = false;
+}
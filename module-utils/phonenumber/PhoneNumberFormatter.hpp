@@ -0,0 +1,76 @@
+// Copyright (c) 2017-2023, Mudita Sp. z.o.o. All rights reserved.
+// For licensing, see https://github.com/mudita/MuditaOS/LICENSE.md
+
+#pragma once
+
+#include "country.hpp"
+
+#include <phonenumbers/asyoutypeformatter.h>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace utils
+{
+    /**
+     * @brief Formats a phone number as it is being typed. It keeps the state of
+     * libphonenumber's AsYouTypeFormatter between the keystrokes, so adding
+     * a digit formats just that digit and removing one takes the formatting
+     * remembered for the shorter number.
+     */
+    class PhoneNumberFormatter
+    {
+      public:
+        explicit PhoneNumberFormatter(country::Id country = country::defaultCountry);
+
+        /**
+         * @brief Switches formatting to the rules of the country, the entered
+         * number is formatted again.
+         *
+         * @param country - country of the number
+         */
+        void setCountry(country::Id country);
+
+        /**
+         * @brief Appends a character to the number.
+         *
+         * @param digit - a digit, '+', '*' or '#'
+         * @return formatted number
+         */
+        const std::string &inputDigit(char digit);
+
+        /**
+         * @brief Removes the last character of the number.
+         *
+         * @return formatted number
+         */
+        const std::string &removeLastDigit();
+
+        /**
+         * @brief Replaces the whole number.
+         *
+         * @param number - number to be formatted
+         * @return formatted number
+         */
+        const std::string &setNumber(const std::string &number);
+
+        void clear();
+
+        [[nodiscard]] const std::string &getEntered() const noexcept;
+        [[nodiscard]] const std::string &getFormatted() const noexcept;
+
+      private:
+        using Formatter = ::i18n::phonenumbers::AsYouTypeFormatter;
+
+        /// Brings the formatter in line with the entered number after digits were removed
+        void restore();
+
+        std::unique_ptr<Formatter> formatter;
+        std::string entered;
+        std::string formatted;
+        /// Formatted number after each of the entered characters
+        std::vector<std::string> history;
+        bool stale = false;
+    };
+} // namespace utils
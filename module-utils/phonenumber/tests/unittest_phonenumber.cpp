@@ -1,4 +1,4 @@
-// Copyright (c) 2017-2022, Mudita Sp. z.o.o. All rights reserved.
+// Copyright (c) 2017-2023, Mudita Sp. z.o.o. All rights reserved.
 // For licensing, see https://github.com/mudita/MuditaOS/LICENSE.md
 
 #include "PhoneNumber.hpp"
@@ -140,6 +140,41 @@ TEST_CASE("PhoneNumber - views")
     }
 }
 
+TEST_CASE("PhoneNumber - parse cache")
+{
+    SECTION("Same input, different country")
+    {
+        PhoneNumber polish(pl_entered, country::Id::POLAND);
+        PhoneNumber british(pl_entered, country::Id::UNITED_KINGDOM);
+        PhoneNumber polishAgain(pl_entered, country::Id::POLAND);
+
+        REQUIRE(polish.isValid());
+        REQUIRE_FALSE(british.isValid());
+        REQUIRE(polishAgain.isValid());
+        REQUIRE(polishAgain.getCountryCode() == country::Id::POLAND);
+        REQUIRE(polishAgain.getView().getFormatted() == pl_formatted);
+        REQUIRE(polishAgain.match(polish) == PhoneNumber::Match::EXACT);
+    }
+
+    SECTION("Same input, different constructor")
+    {
+        PhoneNumber fromE164(pl_entered, pl_e164);
+        PhoneNumber fromEntered(pl_entered, std::string{});
+        PhoneNumber fromE164Again(pl_entered, pl_e164);
+
+        REQUIRE(fromE164.isValid());
+        REQUIRE(fromE164Again.getView() == fromE164.getView());
+        REQUIRE(fromE164Again.getCountryCode() == country::Id::POLAND);
+        REQUIRE(fromEntered.getView().getEntered() == pl_entered);
+    }
+
+    SECTION("Mismatched numbers still throw")
+    {
+        REQUIRE_THROWS_AS(PhoneNumber("600123457", pl_e164), PhoneNumber::Error);
+        REQUIRE_THROWS_AS(PhoneNumber("600123457", pl_e164), PhoneNumber::Error);
+    }
+}
+
 TEST_CASE("PhoneNumber - equality")
 {
     PhoneNumber number1(pl_entered, country::Id::POLAND);
@@ -0,0 +1,66 @@
+// Copyright (c) 2017-2023, Mudita Sp. z.o.o. All rights reserved.
+// For licensing, see https://github.com/mudita/MuditaOS/LICENSE.md
+
+#include "PhoneNumberFormatter.hpp"
+#include "country.hpp"
+
+#include <catch2/catch.hpp>
+
+#include <string>
+
+using namespace utils;
+
+TEST_CASE("PhoneNumberFormatter - typing")
+{
+    PhoneNumberFormatter formatter(country::Id::POLAND);
+    REQUIRE(formatter.getFormatted().empty());
+
+    SECTION("National")
+    {
+        for (const auto c : std::string{"600123456"}) {
+            formatter.inputDigit(c);
+        }
+        REQUIRE(formatter.getEntered() == "600123456");
+        REQUIRE(formatter.getFormatted() == "600 123 456");
+    }
+
+    SECTION("International")
+    {
+        REQUIRE(formatter.setNumber("+48600123456") == "+48 600 123 456");
+        REQUIRE(formatter.getEntered() == "+48600123456");
+    }
+
+    SECTION("Removing digits")
+    {
+        PhoneNumberFormatter reference(country::Id::POLAND);
+        formatter.setNumber("600123456");
+
+        REQUIRE(formatter.removeLastDigit() == reference.setNumber("60012345"));
+        REQUIRE(formatter.removeLastDigit() == reference.setNumber("6001234"));
+        REQUIRE(formatter.getEntered() == "6001234");
+
+        // typing after removal continues from the shorter number
+        REQUIRE(formatter.inputDigit('9') == reference.setNumber("60012349"));
+        REQUIRE(formatter.inputDigit('9') == reference.setNumber("600123499"));
+    }
+
+    SECTION("Removing all digits")
+    {
+        formatter.setNumber("60");
+        formatter.removeLastDigit();
+        formatter.removeLastDigit();
+        REQUIRE(formatter.removeLastDigit().empty());
+        REQUIRE(formatter.getEntered().empty());
+        REQUIRE(formatter.inputDigit('6') == "6");
+    }
+
+    SECTION("Switching country")
+    {
+        formatter.setNumber("600123456");
+        formatter.setCountry(country::Id::UNITED_KINGDOM);
+
+        PhoneNumberFormatter reference(country::Id::UNITED_KINGDOM);
+        REQUIRE(formatter.getEntered() == "600123456");
+        REQUIRE(formatter.getFormatted() == reference.setNumber("600123456"));
+    }
+}
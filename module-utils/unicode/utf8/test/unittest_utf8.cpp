@@ -1,10 +1,85 @@
-// Copyright (c) 2017-2022, Mudita Sp. z.o.o. All rights reserved.
+// Copyright (c) 2017-2023, Mudita Sp. z.o.o. All rights reserved.
 // For licensing, see https://github.com/mudita/MuditaOS/LICENSE.md
 
 #include <catch2/catch.hpp>
 
 #include "utf8/UTF8.hpp"
 
+#include <chrono>
+#include <functional>
+#include <iostream>
+#include <random>
+#include <vector>
+
+namespace
+{
+    /// Long string mixing 1, 2 and 3 byte characters
+    std::string makeText(unsigned int characters)
+    {
+        const std::vector<std::string> pieces = {"a", "ą", "Zadzwonię ", "€", " ", "ż"};
+        std::string text;
+        std::mt19937 generator{characters};
+        for (unsigned int count = 0; count < characters;) {
+            const auto &piece = pieces[generator() % pieces.size()];
+            text += piece;
+            count += UTF8::getCharactersCount(piece.c_str());
+        }
+        return text;
+    }
+
+    std::vector<uint32_t> decodeAll(const std::string &text)
+    {
+        std::vector<uint32_t> codes;
+        for (auto ptr = text.c_str(); *ptr != 0;) {
+            uint32_t length = 0;
+            codes.push_back(UTF8::decode(ptr, length));
+            ptr += length;
+        }
+        return codes;
+    }
+
+    /// Indexing from the beginning of the string, as UTF8 did before the offsets table
+    uint32_t indexByWalking(const UTF8 &text, uint32_t idx)
+    {
+        auto ptr = text.c_str();
+        for (uint32_t i = 0; i < idx; ++i) {
+            uint32_t length = 0;
+            UTF8::decode(ptr, length);
+            ptr += length;
+        }
+        uint32_t length = 0;
+        return UTF8::decode(ptr, length);
+    }
+
+    uint32_t offsetByWalking(const UTF8 &text, uint32_t idx)
+    {
+        uint32_t offset = 0;
+        for (uint32_t i = 0; i < idx; ++i) {
+            uint32_t length = 0;
+            UTF8::decode(text.c_str() + offset, length);
+            offset += length;
+        }
+        return offset;
+    }
+
+    /// Gives access to the offsets table to check that indexing uses it
+    class IndexedUTF8 : public UTF8
+    {
+      public:
+        using UTF8::UTF8;
+
+        [[nodiscard]] auto getOffsets() const -> const std::vector<uint32_t> &
+        {
+            return offsets;
+        }
+
+        [[nodiscard]] static auto getOffsetsStride() -> uint32_t
+        {
+            return offsetsStride;
+        }
+    };
+} // namespace
+
 TEST_CASE("UTF8: operator index returns value")
 {
     UTF8 ustr = UTF8("Rąbać");
@@ -449,3 +524,208 @@ TEST_CASE("UTF8: Not ASCII combination")
         REQUIRE_FALSE(combination.toASCII().has_value());
     }
 }
+
+TEST_CASE("UTF8: random and backward indexing of long string")
+{
+    const auto text     = makeText(1000);
+    const auto expected = decodeAll(text);
+    const UTF8 ustr(text);
+    REQUIRE(ustr.length() == expected.size());
+
+    for (auto i = expected.size(); i > 0; --i) {
+        REQUIRE(ustr[i - 1] == expected[i - 1]);
+    }
+
+    std::mt19937 generator{0};
+    for (auto i = 0; i < 1000; ++i) {
+        const auto idx = generator() % expected.size();
+        REQUIRE(ustr[idx] == expected[idx]);
+    }
+    REQUIRE(ustr.substr(700, 100) == UTF8(ustr.substr(0, 800).split(700)));
+}
+
+TEST_CASE("UTF8: indexing after changes of long string")
+{
+    UTF8 ustr(makeText(300));
+    auto expected = decodeAll(ustr.c_str());
+
+    const auto requireSameCharacters = [&]() {
+        REQUIRE(ustr.length() == expected.size());
+        for (auto i = expected.size(); i > 0; --i) {
+            REQUIRE(ustr[i - 1] == expected[i - 1]);
+        }
+    };
+    requireSameCharacters();
+
+    SECTION("insert")
+    {
+        for (const uint32_t idx : {250U, 10U, 64U, 200U, 0U}) {
+            ustr.insertCode(0x20AC, idx);
+            expected.insert(expected.begin() + idx, 0x20AC);
+            requireSameCharacters();
+        }
+        ustr.insertCode('x');
+        expected.push_back('x');
+        requireSameCharacters();
+    }
+
+    SECTION("remove")
+    {
+        for (const uint32_t idx : {250U, 10U, 64U, 200U, 0U}) {
+            ustr.removeChar(idx, 3);
+            expected.erase(expected.begin() + idx, expected.begin() + idx + 3);
+            requireSameCharacters();
+        }
+    }
+
+    SECTION("split and append")
+    {
+        auto tail = ustr.split(100);
+        expected.resize(100);
+        requireSameCharacters();
+
+        ustr += tail;
+        expected = decodeAll(ustr.c_str());
+        requireSameCharacters();
+    }
+}
+
+TEST_CASE("UTF8: iterators")
+{
+    const auto text     = makeText(100);
+    const auto expected = decodeAll(text);
+    const UTF8 ustr(text);
+
+    SECTION("forward")
+    {
+        std::vector<uint32_t> codes;
+        for (const auto code : ustr.characters()) {
+            codes.push_back(code);
+        }
+        REQUIRE(codes == expected);
+    }
+
+    SECTION("backward")
+    {
+        const std::vector<uint32_t> codes(ustr.characters().rbegin(), ustr.characters().rend());
+        REQUIRE(codes == std::vector<uint32_t>(expected.rbegin(), expected.rend()));
+    }
+
+    SECTION("from index")
+    {
+        auto character = ustr.iteratorAt(50);
+        REQUIRE(*character == expected[50]);
+        REQUIRE(*--character == expected[49]);
+        REQUIRE(ustr.iteratorAt(ustr.length()) == ustr.characters().end());
+        REQUIRE(std::distance(ustr.iteratorAt(40), ustr.characters().end()) == ustr.length() - 40);
+    }
+
+    SECTION("empty")
+    {
+        const UTF8 empty;
+        REQUIRE(empty.characters().begin() == empty.characters().end());
+    }
+}
+
+TEST_CASE("UTF8: indexing through the offsets table")
+{
+    const IndexedUTF8 ustr(makeText(10000));
+    const auto length = ustr.length();
+    const auto stride = IndexedUTF8::getOffsetsStride();
+    REQUIRE(ustr.getOffsets().empty());
+
+    SECTION("offsets of the indexed characters")
+    {
+        REQUIRE(ustr[length - 1] == indexByWalking(ustr, length - 1));
+        const auto &offsets = ustr.getOffsets();
+        REQUIRE(offsets.size() == (length - 1) / stride + 1);
+        for (auto entry = 0U; entry < offsets.size(); ++entry) {
+            REQUIRE(offsets[entry] == offsetByWalking(ustr, entry * stride));
+        }
+    }
+
+    SECTION("backward indexing reuses the offsets")
+    {
+        uint32_t walkedChecksum  = 0;
+        uint32_t indexedChecksum = 0;
+        for (auto i = length; i > 0; --i) {
+            indexedChecksum += ustr[i - 1];
+            walkedChecksum += indexByWalking(ustr, i - 1);
+        }
+        REQUIRE(indexedChecksum == walkedChecksum);
+        REQUIRE(ustr.getOffsets().size() == (length - 1) / stride + 1);
+    }
+
+    SECTION("random indexing")
+    {
+        std::mt19937 generator{0};
+        for (auto i = 0; i < 1000; ++i) {
+            const auto idx = generator() % length;
+            REQUIRE(ustr[idx] == indexByWalking(ustr, idx));
+        }
+        REQUIRE_FALSE(ustr.getOffsets().empty());
+    }
+}
+
+TEST_CASE("UTF8: indexing performance", "[.benchmark]")
+{
+    for (const auto characters : {1000U, 10000U}) {
+        const UTF8 ustr(makeText(characters));
+        const auto length = ustr.length();
+
+        const auto measure = [&](const char *name, const std::function<uint32_t()> &operation) {
+            const auto start    = std::chrono::steady_clock::now();
+            const auto checksum = operation();
+            const auto elapsed  = std::chrono::steady_clock::now() - start;
+            std::cout << characters << " characters, " << name << ": "
+                      << std::chrono::duration_cast<std::chrono::microseconds>(elapsed).count() << " us (" << checksum
+                      << ")" << std::endl;
+        };
+
+        measure("backward walking from the beginning", [&]() {
+            uint32_t sum = 0;
+            for (auto i = length; i > 0; --i) {
+                sum += indexByWalking(ustr, i - 1);
+            }
+            return sum;
+        });
+        measure("backward operator[]", [&]() {
+            uint32_t sum = 0;
+            for (auto i = length; i > 0; --i) {
+                sum += ustr[i - 1];
+            }
+            return sum;
+        });
+        measure("backward iterator", [&]() {
+            uint32_t sum = 0;
+            const auto characters = ustr.characters();
+            for (auto character = characters.rbegin(); character != characters.rend(); ++character) {
+                sum += *character;
+            }
+            return sum;
+        });
+        measure("random walking from the beginning", [&]() {
+            std::mt19937 generator{0};
+            uint32_t sum = 0;
+            for (auto i = 0U; i < length; ++i) {
+                sum += indexByWalking(ustr, generator() % length);
+            }
+            return sum;
+        });
+        measure("random operator[]", [&]() {
+            std::mt19937 generator{0};
+            uint32_t sum = 0;
+            for (auto i = 0U; i < length; ++i) {
+                sum += ustr[generator() % length];
+            }
+            return sum;
+        });
+        measure("substr of every 10 characters", [&]() {
+            uint32_t sum = 0;
+            for (auto i = 0U; i + 10 <= length; i += 10) {
+                sum += ustr.substr(i, 10).used();
+            }
+            return sum;
+        });
+    }
+}
@@ -1,6 +1,7 @@
 // Copyright (c) 2017-2023, Mudita Sp. z.o.o. All rights reserved.
 // For licensing, see https://github.com/mudita/MuditaOS/LICENSE.md
 
+#include <algorithm>
 #include <cassert>
 #include <cstring>
 #include <cstdint>
@@ -76,6 +77,7 @@ static inline uint32_t charLength(const char *utf8Char)
 
 const char *UTF8::emptyString        = "";
 const uint32_t UTF8::stringExpansion = 32;
+const uint32_t UTF8::offsetsStride   = 32;
 
 U8char::U8char(uint32_t code)
 {
@@ -114,7 +116,7 @@ void U8char::set(char *val, unsigned int size)
 
 UTF8::UTF8()
     : data{std::make_unique<char[]>(stringExpansion)},
-      sizeAllocated{stringExpansion}, sizeUsed{1}, strLength{0}, lastIndex{0}, lastIndexData{data.get()}
+      sizeAllocated{stringExpansion}, sizeUsed{1}, strLength{0}, lastIndex{0}, lastIndexOffset{0}
 {}
 
 UTF8::UTF8(const char *str)
@@ -125,10 +127,10 @@ UTF8::UTF8(const char *str)
     data          = std::make_unique<char[]>(sizeAllocated);
     if (data != nullptr) {
         memcpy(data.get(), str, sizeUsed);
-        lastIndexData = data.get();
     }
-    strLength = getCharactersCount(data.get());
-    lastIndex = 0;
+    strLength       = getCharactersCount(data.get());
+    lastIndex       = 0;
+    lastIndexOffset = 0;
 }
 
 UTF8::UTF8(const std::string &str)
@@ -139,10 +141,10 @@ UTF8::UTF8(const std::string &str)
     data          = std::make_unique<char[]>(sizeAllocated);
     if (data != nullptr) {
         memcpy(data.get(), str.c_str(), sizeUsed);
-        lastIndexData = data.get();
     }
-    strLength = getCharactersCount(data.get());
-    lastIndex = 0;
+    strLength       = getCharactersCount(data.get());
+    lastIndex       = 0;
+    lastIndexOffset = 0;
 }
 
 UTF8::UTF8(const UTF8 &utf)
@@ -166,17 +168,17 @@ UTF8::UTF8(const UTF8 &utf)
         data          = std::make_unique<char[]>(sizeAllocated);
         sizeUsed      = 1;
     }
-    lastIndex     = 0;
-    lastIndexData = data.get();
+    lastIndex       = 0;
+    lastIndexOffset = 0;
 }
 
 UTF8::UTF8(UTF8 &&utf)
     : data{std::move(utf.data)}, sizeAllocated{utf.sizeAllocated}, sizeUsed{utf.sizeUsed}, strLength{utf.strLength},
-      lastIndex{0}, lastIndexData{data.get()}
+      lastIndex{utf.lastIndex}, lastIndexOffset{utf.lastIndexOffset}, offsets{std::move(utf.offsets)}
 {}
 
 UTF8::UTF8(const char *data, const uint32_t allocated, const uint32_t used, const uint32_t len)
-    : sizeAllocated{allocated}, sizeUsed{used}, strLength{len}, lastIndex{0}
+    : sizeAllocated{allocated}, sizeUsed{used}, strLength{len}, lastIndex{0}, lastIndexOffset{0}
 {
     this->data = std::make_unique<char[]>(allocated);
     if (this->data == nullptr) {
@@ -186,7 +188,6 @@ UTF8::UTF8(const char *data, const uint32_t allocated, const uint32_t used, cons
         return;
     }
     memcpy(this->data.get(), data, allocated);
-    lastIndexData = this->data.get();
 }
 
 bool UTF8::expand(uint32_t size)
@@ -199,10 +200,9 @@ bool UTF8::expand(uint32_t size)
 
         memcpy(newData.get(), data.get(), sizeUsed);
 
+        // offsets are relative to the buffer, so they stay valid
         data          = std::move(newData);
         sizeAllocated = newSizeAllocated;
-        lastIndex     = 0;
-        lastIndexData = data.get();
         return true;
     }
     return false;
@@ -250,8 +250,7 @@ UTF8 &UTF8::operator=(const UTF8 &utf)
     data = std::make_unique<char[]>(sizeAllocated);
     memcpy(data.get(), utf.data.get(), sizeAllocated);
 
-    lastIndex     = 0;
-    lastIndexData = data.get();
+    resetOffsets();
 
     return *this;
 }
@@ -260,58 +259,136 @@ UTF8 &UTF8::operator=(UTF8 &&utf) noexcept
 {
     // prevent moving if object is moved to itself
     if (this != &utf) {
-        data          = std::move(utf.data);
-        sizeAllocated = utf.sizeAllocated;
-        sizeUsed      = utf.sizeUsed;
-        strLength     = utf.strLength;
+        data            = std::move(utf.data);
+        sizeAllocated   = utf.sizeAllocated;
+        sizeUsed        = utf.sizeUsed;
+        strLength       = utf.strLength;
+        lastIndex       = utf.lastIndex;
+        lastIndexOffset = utf.lastIndexOffset;
+        offsets         = std::move(utf.offsets);
     }
     return *this;
 }
 
-uint32_t UTF8::operator[](const uint32_t &idx) const
+uint32_t UTF8::getOffset(uint32_t idx) const
 {
-
-    if (idx >= strLength) {
-        return 0;
+    if (isAscii()) {
+        return idx;
     }
 
-    char *dataPtr    = nullptr;
     uint32_t charCnt = 0;
+    uint32_t offset  = 0;
 
-    if (lastIndex < idx) {
-        dataPtr = lastIndexData;
+    // Characters read in order are found from the previous one, the table is needed only for jumps
+    if (lastIndex <= idx && idx - lastIndex < offsetsStride) {
         charCnt = lastIndex;
+        offset  = lastIndexOffset;
     }
-    else {
-        dataPtr = data.get();
-        charCnt = 0;
+    else if (idx >= offsetsStride) {
+        const uint32_t entry = idx / offsetsStride;
+        if (offsets.empty()) {
+            offsets.push_back(0);
+        }
+        while (offsets.size() <= entry) {
+            auto next = offsets.back();
+            for (uint32_t i = 0; i < offsetsStride; ++i) {
+                next += charLength(data.get() + next);
+            }
+            offsets.push_back(next);
+        }
+        charCnt = entry * offsetsStride;
+        offset  = offsets[entry];
     }
-    assert(dataPtr);
+
     while (charCnt != idx) {
-        dataPtr += charLength(dataPtr);
+        offset += charLength(data.get() + offset);
         charCnt++;
     }
 
-    lastIndex     = charCnt;
-    lastIndexData = dataPtr;
+    lastIndex       = charCnt;
+    lastIndexOffset = offset;
+    return offset;
+}
+
+void UTF8::resetOffsets(uint32_t idx) const
+{
+    // Offset of the character on the position itself doesn't change when characters are added or removed there
+    offsets.resize(std::min<std::size_t>(offsets.size(), idx / offsetsStride + 1));
+    if (lastIndex > idx) {
+        lastIndex       = 0;
+        lastIndexOffset = 0;
+    }
+}
 
+uint32_t UTF8::const_iterator::operator*() const
+{
     uint32_t length;
-    return decode(dataPtr, length);
+    return decode(position, length);
 }
 
-U8char UTF8::getChar(unsigned int pos)
+UTF8::const_iterator &UTF8::const_iterator::operator++()
+{
+    position += charLength(position);
+    return *this;
+}
+
+UTF8::const_iterator UTF8::const_iterator::operator++(int)
 {
-    auto ptr    = data.get();
-    long int to = pos;
+    auto previous = *this;
+    ++*this;
+    return previous;
+}
+
+UTF8::const_iterator &UTF8::const_iterator::operator--()
+{
+    do {
+        --position;
+    } while (UTF8_CHAR_IS_INNER(*position));
+    return *this;
+}
+
+UTF8::const_iterator UTF8::const_iterator::operator--(int)
+{
+    auto previous = *this;
+    --*this;
+    return previous;
+}
+
+UTF8::const_iterator UTF8::Characters::begin() const
+{
+    return const_iterator(str.data.get());
+}
+
+UTF8::const_iterator UTF8::Characters::end() const
+{
+    return const_iterator(str.data.get() + str.sizeUsed - 1);
+}
 
-    U8char u;
-    while (to >= 0) {
-        u = U8char(ptr);
-        ptr += u.size;
-        --to;
+UTF8::const_iterator UTF8::iteratorAt(uint32_t idx) const
+{
+    if (idx >= strLength) {
+        return characters().end();
     }
+    return const_iterator(data.get() + getOffset(idx));
+}
 
-    return u;
+uint32_t UTF8::operator[](const uint32_t &idx) const
+{
+
+    if (idx >= strLength) {
+        return 0;
+    }
+
+    uint32_t length;
+    return decode(data.get() + getOffset(idx), length);
+}
+
+U8char UTF8::getChar(unsigned int pos)
+{
+    if (pos >= strLength) {
+        return U8char();
+    }
+    return U8char(data.get() + getOffset(pos));
 }
 
 UTF8 UTF8::operator+(const UTF8 &utf) const
@@ -338,8 +415,6 @@ UTF8 &UTF8::operator+=(const UTF8 &utf)
         strLength += utf.strLength;
         //-1 is to ignore double null terminator as it is counted in sizeUsed
         sizeUsed += utf.sizeUsed - 1;
-        lastIndex     = 0;
-        lastIndexData = data.get();
     }
     return *this;
 }
@@ -365,8 +440,7 @@ void UTF8::clear()
     sizeAllocated = stringExpansion;
     sizeUsed      = 1;
     strLength     = 0;
-    lastIndex     = 0;
-    lastIndexData = data.get();
+    resetOffsets();
 }
 
 UTF8 UTF8::substr(const uint32_t begin, const uint32_t length) const
@@ -376,24 +450,10 @@ UTF8 UTF8::substr(const uint32_t begin, const uint32_t length) const
         return UTF8();
     }
 
-    char *beginPtr = this->data.get();
-    char *endPtr   = nullptr;
+    const char *beginPtr      = this->data.get() + getOffset(begin);
+    const char *endPtr        = this->data.get() + getOffset(begin + length);
+    const uint32_t bufferSize = endPtr - beginPtr;
 
-    uint32_t bufferSize = 0;
-    uint32_t strCounter = 0;
-    // find pointer to begin char
-    while (strCounter != begin) {
-        beginPtr += charLength(beginPtr);
-        strCounter++;
-    }
-    // find pinter to end char
-    endPtr = beginPtr;
-    for (strCounter = 0; strCounter < length; strCounter++) {
-        uint32_t charSize = 0;
-        charSize          = charLength(endPtr);
-        endPtr += charSize;
-        bufferSize += charSize;
-    }
     // copy data to buffer
     // bufferSize increased by 1 to ensure ending 0 in new string
     auto buffer = std::make_unique<char[]>(bufferSize + 1);
@@ -421,11 +481,7 @@ uint32_t UTF8::find(const char *s, uint32_t pos) const
     }
 
     uint32_t position = 0;
-    auto *dataPtr     = this->data.get();
-
-    for (position = 0; position < pos; position++) {
-        dataPtr += charLength(dataPtr);
-    }
+    auto *dataPtr     = this->data.get() + getOffset(pos);
 
     for (position = pos; position < this->length(); position++) {
 
@@ -457,20 +513,17 @@ uint32_t UTF8::findLast(const char *s, uint32_t pos) const
         return npos;
     }
 
-    uint32_t position          = 0;
-    auto *dataPtr              = this->data.get();
-    uint32_t lastFoundPosition = npos;
-
-    // calculate position of last string to compare
-    uint32_t positionEnd = pos - stringCount + 1;
-    for (position = 0; position <= positionEnd; position++) {
-        if (memcmp(dataPtr, s, stringSize) == 0) {
-            lastFoundPosition = position;
+    // search backwards from the position of last string to compare
+    uint32_t position = pos - stringCount + 1;
+    auto character    = iteratorAt(position);
+    while (memcmp(character.data(), s, stringSize) != 0) {
+        if (position == 0) {
+            return npos;
         }
-
-        dataPtr += charLength(dataPtr);
+        --character;
+        --position;
     }
-    return lastFoundPosition;
+    return position;
 }
 
 UTF8 UTF8::split(const uint32_t &idx)
@@ -480,12 +533,8 @@ UTF8 UTF8::split(const uint32_t &idx)
         return UTF8();
     }
 
-    auto *dataPtr = this->data.get();
+    auto *dataPtr = this->data.get() + getOffset(idx);
 
-    // move data pointer to split index
-    for (uint32_t i = 0; i < idx; i++) {
-        dataPtr += charLength(dataPtr);
-    }
     // create new string
     UTF8 retString(dataPtr);
 
@@ -505,19 +554,19 @@ UTF8 UTF8::split(const uint32_t &idx)
     // clear used memory
     this->data = std::move(tempString);
 
-    this->lastIndex     = 0;
-    this->lastIndexData = this->data.get();
+    resetOffsets(idx);
 
     return retString;
 }
 
 UTF8 UTF8::getLine()
 {
-    for (uint32_t i = 0; i < this->length(); i++) {
-        uint32_t character = this->operator[](i);
+    uint32_t i = 0;
+    for (const auto character : characters()) {
         if ((character == '\r') || (character == '\n')) {
             return this->substr(0, i);
         }
+        ++i;
     }
     return UTF8();
 }
@@ -533,17 +582,9 @@ bool UTF8::removeChar(const uint32_t &pos, const uint32_t &count)
         return false;
     }
 
-    // get pointer to begin of string to remove
-    auto *beginPtr = this->data.get();
-    for (uint32_t i = 0; i < pos; i++) {
-        beginPtr += charLength(beginPtr);
-    }
-
-    // get pointer to end of string to remove
-    auto *endPtr = beginPtr;
-    for (uint32_t i = 0; i < count; i++) {
-        endPtr += charLength(endPtr);
-    }
+    // get pointers to begin and end of string to remove
+    auto *beginPtr = this->data.get() + getOffset(pos);
+    auto *endPtr   = this->data.get() + getOffset(pos + count);
 
     uint32_t bytesToRemove = endPtr - beginPtr;
     uint32_t newStringSize = this->sizeUsed - bytesToRemove;
@@ -566,6 +607,8 @@ bool UTF8::removeChar(const uint32_t &pos, const uint32_t &count)
     // assign new data buffer
     this->data = std::move(tempString);
 
+    resetOffsets(pos);
+
     return true;
 }
 
@@ -652,10 +695,7 @@ bool UTF8::insert(const char *ch, const uint32_t &index)
     }
 
     // find pointer where new character should be copied
-    auto *pos = data.get();
-    for (unsigned int i = 0; i < insertIndex; i++) {
-        pos += charLength(pos);
-    }
+    auto *pos = data.get() + getOffset(insertIndex);
 
     if ((pos - data.get()) >= static_cast<int64_t>(sizeUsed)) {
         debug_utf("decode/encode error %d - ( %d ) < 0 && allocated: %d\n", sizeUsed, pos - data, sizeAllocated);
@@ -668,6 +708,7 @@ bool UTF8::insert(const char *ch, const uint32_t &index)
 
     sizeUsed += ch_len;
     ++strLength;
+    resetOffsets(insertIndex);
 
     return true;
 }
@@ -700,14 +741,12 @@ bool UTF8::insertString(const UTF8 &str, const uint32_t &index)
     uint32_t totalSize = sizeUsed + str.sizeUsed - 1; //-1 because there are 2 end terminators
     expand(getDataBufferSize(totalSize));
 
-    auto *beginPtr = this->data.get();
-    for (uint32_t i = 0; i < insertIndex; i++) {
-        beginPtr += charLength(beginPtr);
-    }
+    auto *beginPtr = this->data.get() + getOffset(insertIndex);
 
     //-1 to ignore end terminator from str
     memmove(beginPtr + str.sizeUsed - 1, beginPtr, sizeUsed - (beginPtr - data.get()));
     memcpy(beginPtr, str.data.get(), str.sizeUsed - 1);
+    resetOffsets(insertIndex);
 
     return false;
 }
@@ -6,8 +6,10 @@
 #include <string>
 #include <cstdint>
 #include <iosfwd> // for forward declaration for ostream
+#include <iterator>
 #include <memory>
 #include <optional>
+#include <vector>
 
 /// single utf8 character representation struct
 struct U8char
@@ -48,13 +50,27 @@ class UTF8
     uint32_t strLength;
     /// last used index
     mutable uint32_t lastIndex;
-    /// pointer to last indexed character
-    mutable char *lastIndexData;
+    /// offset in the buffer of the last indexed character
+    mutable uint32_t lastIndexOffset;
+    /// offsets in the buffer of every offsetsStride-th character, built on demand for long strings with non-ASCII
+    /// characters so that indexing doesn't have to walk the buffer from its beginning
+    mutable std::vector<uint32_t> offsets;
 
     /// variable used when c_str() is called for a string that has no data yet
     static const char *emptyString;
     /// holds number of bytes by which buffer will be expanded in case when current buffer can't hold new data.
     static const uint32_t stringExpansion;
+    /// number of characters between entries of the offsets table
+    static const uint32_t offsetsStride;
+
+    /**
+     * @brief Finds the character in the buffer.
+     * @param idx index of the character, up to length() which gives the offset of the terminating zero.
+     * @return Offset of the first byte of the character in the buffer.
+     */
+    uint32_t getOffset(uint32_t idx) const;
+    /// forgets offsets of characters from the position on, has to be called whenever the buffer changes
+    void resetOffsets(uint32_t idx = 0) const;
     /**
      * @brief Calculates size of the buffer to store given number of data bytes.
      * @param dataBytes number of data bytes
@@ -65,6 +81,70 @@ class UTF8
     bool expand(uint32_t size = stringExpansion);
 
   public:
+    /// Bidirectional iterator over characters of the string, dereferenced to UTF16 values like operator[].
+    /// Invalidated by any change of the string.
+    class const_iterator
+    {
+      public:
+        using iterator_category = std::bidirectional_iterator_tag;
+        using value_type        = uint32_t;
+        using difference_type   = std::ptrdiff_t;
+        using pointer           = const uint32_t *;
+        using reference         = uint32_t;
+
+        const_iterator() = default;
+        explicit const_iterator(const char *position) : position{position}
+        {}
+
+        uint32_t operator*() const;
+        const_iterator &operator++();
+        const_iterator operator++(int);
+        const_iterator &operator--();
+        const_iterator operator--(int);
+
+        bool operator==(const const_iterator &other) const noexcept
+        {
+            return position == other.position;
+        }
+        bool operator!=(const const_iterator &other) const noexcept
+        {
+            return position != other.position;
+        }
+
+        /// first byte of the character in the string buffer
+        const char *data() const noexcept
+        {
+            return position;
+        }
+
+      private:
+        const char *position = nullptr;
+    };
+    using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+    /// Characters of the string as a range. UTF8 itself isn't one, as containers and JSON would take it for
+    /// an array then instead of converting it to std::string.
+    class Characters
+    {
+      public:
+        explicit Characters(const UTF8 &str) : str{str}
+        {}
+
+        const_iterator begin() const;
+        const_iterator end() const;
+        const_reverse_iterator rbegin() const
+        {
+            return const_reverse_iterator(end());
+        }
+        const_reverse_iterator rend() const
+        {
+            return const_reverse_iterator(begin());
+        }
+
+      private:
+        const UTF8 &str;
+    };
+
     UTF8();
     UTF8(const char *str);
     UTF8(const std::string &str);
@@ -109,6 +189,13 @@ class UTF8
         return strLength;
     }
 
+    Characters characters() const
+    {
+        return Characters(*this);
+    }
+    /// iterator pointing to the character on the position, end of characters() for positions past the last one
+    const_iterator iteratorAt(uint32_t idx) const;
+
     bool empty() const noexcept
     {
         return strLength == 0U;
@@ -207,12 +294,11 @@ class UTF8
     /*
      * @brief Check if string has only ASCII characters
      * @return true if there are only ASCII characters in string, false otherwise.
+     * @note every character takes one byte then, so character indexes are the same as offsets in the buffer.
      */
     bool isAscii(void) const
     {
-        if (this->sizeUsed - 1 == this->length())
-            return true;
-        return false;
+        return this->sizeUsed - 1 == this->length();
     }
     /**
      * @brief Returns pointer to character encoded using provided Unicode value.
@@ -25,6 +25,80 @@
 #include <CrashdumpMetadataStore.hpp>
 #include <product/version.hpp>
 
+#include <json11.hpp>
+#include <microtar.hpp>
+#include <module-db/Database/SyncChanges.hpp>
+
+namespace
+{
+    /// Databases with more rows changed since the previous sync are sent whole
+    constexpr auto maxSyncChanges   = 1000;
+    constexpr auto syncManifestName = "sync.json";
+
+    /// Writes the image of a database as a member of the sync package archive
+    class SyncPackageSink : public Database::StreamSink
+    {
+      public:
+        SyncPackageSink(mtar_t &archive, const std::filesystem::path &name) : archive(archive), name(name)
+        {}
+
+        bool begin(std::size_t imageSize) override
+        {
+            return mtar_write_file_header(&archive, name.c_str(), static_cast<unsigned>(imageSize)) == MTAR_ESUCCESS;
+        }
+
+        bool write(const std::uint8_t *data, std::size_t size) override
+        {
+            return mtar_write_data(&archive, data, static_cast<unsigned>(size)) == MTAR_ESUCCESS;
+        }
+
+      private:
+        mtar_t &archive;
+        std::filesystem::path name;
+    };
+
+    bool writeArchiveMember(mtar_t &archive, const std::string &name, const std::string &content)
+    {
+        const auto size = static_cast<unsigned>(content.size());
+        return mtar_write_file_header(&archive, name.c_str(), size) == MTAR_ESUCCESS &&
+               mtar_write_data(&archive, content.data(), size) == MTAR_ESUCCESS;
+    }
+
+    /// Stores the rows changed since the token of the client if it's still valid, the whole database otherwise.
+    /// What has been stored is described in the manifest entry of the database.
+    bool storeIntoArchive(mtar_t &archive,
+                          Database &db,
+                          const db::sync::Tokens &syncTokens,
+                          json11::Json::object &manifest)
+    {
+        const auto file  = std::filesystem::path(db.getName()).filename();
+        const auto name  = file.stem().string();
+        const auto token = db::sync::currentToken(db);
+
+        json11::Json::object entry;
+        if (token.has_value()) {
+            entry["token"] = token->toString();
+        }
+
+        if (const auto client = syncTokens.find(name); token.has_value() && client != syncTokens.end()) {
+            if (const auto since = db::sync::Token::parse(client->second); since.has_value()) {
+                if (const auto changes = db::sync::exportChangesSince(db, *since, maxSyncChanges); changes) {
+                    entry["mode"]  = "delta";
+                    entry["file"]  = name + ".json";
+                    manifest[name] = entry;
+                    return writeArchiveMember(archive, name + ".json", *changes);
+                }
+            }
+        }
+
+        entry["mode"]  = "full";
+        entry["file"]  = file.string();
+        manifest[name] = entry;
+        SyncPackageSink sink{archive, file};
+        return db.storeIntoStream(sink);
+    }
+} // namespace
+
 ServiceDB::~ServiceDB()
 {
     eventsDB.reset();
@@ -227,7 +301,7 @@ sys::MessagePointer ServiceDB::DataReceivedHandler(sys::DataMessage *msgl, sys::
     case MessageType::DBSyncPackage: {
         auto time   = utils::time::Scoped("DBSyncPackage");
         auto msg    = static_cast<DBServiceMessageSyncPackage *>(msgl);
-        auto ret    = StoreIntoSyncPackage({msg->syncPackagePath});
+        auto ret    = StoreIntoSyncPackage({msg->syncPackagePath}, msg->syncTokens);
         responseMsg = std::make_shared<DBServiceResponseMessage>(ret);
     } break;
 
@@ -300,17 +374,38 @@ sys::ReturnCodes ServiceDB::InitHandler()
     return sys::ReturnCodes::Success;
 }
 
-bool ServiceDB::StoreIntoSyncPackage(const std::filesystem::path &syncPackagePath)
+bool ServiceDB::StoreIntoSyncPackage(const std::filesystem::path &syncPackagePath, const db::sync::Tokens &syncTokens)
 {
-    if (!contactsDB->storeIntoFile(syncPackagePath / std::filesystem::path(contactsDB->getName()).filename())) {
+    mtar_t archive;
+    if (mtar_open(&archive, syncPackagePath.c_str(), "w") != MTAR_ESUCCESS) {
+        LOG_ERROR("Opening sync package failed");
+        return false;
+    }
+
+    json11::Json::object manifest;
+    if (!storeIntoArchive(archive, *contactsDB, syncTokens, manifest)) {
         LOG_ERROR("Store contactsDB in sync package failed");
+        mtar_close(&archive);
         return false;
     }
 
-    if (!smsDB->storeIntoFile(syncPackagePath / std::filesystem::path(smsDB->getName()).filename())) {
+    if (!storeIntoArchive(archive, *smsDB, syncTokens, manifest)) {
         LOG_ERROR("Store smsDB in sync package failed");
+        mtar_close(&archive);
+        return false;
+    }
+
+    if (!writeArchiveMember(archive, syncManifestName, json11::Json(manifest).dump())) {
+        LOG_ERROR("Store manifest in sync package failed");
+        mtar_close(&archive);
+        return false;
+    }
+
+    if (mtar_finalize(&archive) != MTAR_ESUCCESS) {
+        LOG_ERROR("Finalizing sync package failed");
+        mtar_close(&archive);
         return false;
     }
 
-    return true;
+    return mtar_close(&archive) == MTAR_ESUCCESS;
 }
@@ -0,0 +1,32 @@
+-- Copyright (c) 2017-2023, Mudita Sp. z.o.o. All rights reserved.
+-- For licensing, see https://github.com/mudita/MuditaOS/LICENSE.md
+
+-- Message: Tracking changes of the rows for the incremental sync with the desktop client
+-- Revision: f1db02bb-a859-4d67-9e85-528a4fa1dcad
+-- Create Date: 2023-06-12 09:41:27
+
+DROP TRIGGER IF EXISTS sync_on_contacts_insert;
+DROP TRIGGER IF EXISTS sync_on_contacts_update;
+DROP TRIGGER IF EXISTS sync_on_contacts_delete;
+DROP TRIGGER IF EXISTS sync_on_contact_name_insert;
+DROP TRIGGER IF EXISTS sync_on_contact_name_update;
+DROP TRIGGER IF EXISTS sync_on_contact_name_delete;
+DROP TRIGGER IF EXISTS sync_on_contact_number_insert;
+DROP TRIGGER IF EXISTS sync_on_contact_number_update;
+DROP TRIGGER IF EXISTS sync_on_contact_number_delete;
+DROP TRIGGER IF EXISTS sync_on_contact_address_insert;
+DROP TRIGGER IF EXISTS sync_on_contact_address_update;
+DROP TRIGGER IF EXISTS sync_on_contact_address_delete;
+DROP TRIGGER IF EXISTS sync_on_contact_ringtones_insert;
+DROP TRIGGER IF EXISTS sync_on_contact_ringtones_update;
+DROP TRIGGER IF EXISTS sync_on_contact_ringtones_delete;
+DROP TRIGGER IF EXISTS sync_on_contact_groups_insert;
+DROP TRIGGER IF EXISTS sync_on_contact_groups_update;
+DROP TRIGGER IF EXISTS sync_on_contact_groups_delete;
+DROP TRIGGER IF EXISTS sync_on_contact_match_groups_insert;
+DROP TRIGGER IF EXISTS sync_on_contact_match_groups_update;
+DROP TRIGGER IF EXISTS sync_on_contact_match_groups_delete;
+
+DROP INDEX IF EXISTS sync_changes_index_on_counter;
+DROP TABLE IF EXISTS sync_changes;
+DROP TABLE IF EXISTS sync_state;
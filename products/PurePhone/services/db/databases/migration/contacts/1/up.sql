@@ -0,0 +1,54 @@
+-- Copyright (c) 2017-2023, Mudita Sp. z.o.o. All rights reserved.
+-- For licensing, see https://github.com/mudita/MuditaOS/LICENSE.md
+
+-- Message: Tracking changes of the rows for the incremental sync with the desktop client
+-- Revision: f1db02bb-a859-4d67-9e85-528a4fa1dcad
+-- Create Date: 2023-06-12 09:41:27
+
+CREATE TABLE IF NOT EXISTS sync_state
+(
+    _id        INTEGER PRIMARY KEY,
+    generation INTEGER NOT NULL,
+    counter    INTEGER NOT NULL
+);
+
+CREATE TABLE IF NOT EXISTS sync_changes
+(
+    table_name TEXT    NOT NULL,
+    row_id     INTEGER NOT NULL,
+    counter    INTEGER NOT NULL,
+    deleted    INTEGER NOT NULL,
+    PRIMARY KEY (table_name, row_id)
+) WITHOUT ROWID;
+
+CREATE INDEX IF NOT EXISTS sync_changes_index_on_counter ON sync_changes (counter);
+
+INSERT OR IGNORE INTO sync_state (_id, generation, counter) VALUES (1, abs(random()), 0);
+
+CREATE TRIGGER IF NOT EXISTS sync_on_contacts_insert AFTER INSERT ON contacts BEGIN UPDATE sync_state SET counter=counter+1 WHERE _id=1; INSERT OR REPLACE INTO sync_changes (table_name, row_id, counter, deleted) SELECT 'contacts', NEW._id, counter, 0 FROM sync_state WHERE _id=1; END;
+CREATE TRIGGER IF NOT EXISTS sync_on_contacts_update AFTER UPDATE ON contacts BEGIN UPDATE sync_state SET counter=counter+1 WHERE _id=1; INSERT OR REPLACE INTO sync_changes (table_name, row_id, counter, deleted) SELECT 'contacts', NEW._id, counter, 0 FROM sync_state WHERE _id=1; END;
+CREATE TRIGGER IF NOT EXISTS sync_on_contacts_delete AFTER DELETE ON contacts BEGIN UPDATE sync_state SET counter=counter+1 WHERE _id=1; INSERT OR REPLACE INTO sync_changes (table_name, row_id, counter, deleted) SELECT 'contacts', OLD._id, counter, 1 FROM sync_state WHERE _id=1; END;
+
+CREATE TRIGGER IF NOT EXISTS sync_on_contact_name_insert AFTER INSERT ON contact_name BEGIN UPDATE sync_state SET counter=counter+1 WHERE _id=1; INSERT OR REPLACE INTO sync_changes (table_name, row_id, counter, deleted) SELECT 'contact_name', NEW._id, counter, 0 FROM sync_state WHERE _id=1; END;
+CREATE TRIGGER IF NOT EXISTS sync_on_contact_name_update AFTER UPDATE ON contact_name BEGIN UPDATE sync_state SET counter=counter+1 WHERE _id=1; INSERT OR REPLACE INTO sync_changes (table_name, row_id, counter, deleted) SELECT 'contact_name', NEW._id, counter, 0 FROM sync_state WHERE _id=1; END;
+CREATE TRIGGER IF NOT EXISTS sync_on_contact_name_delete AFTER DELETE ON contact_name BEGIN UPDATE sync_state SET counter=counter+1 WHERE _id=1; INSERT OR REPLACE INTO sync_changes (table_name, row_id, counter, deleted) SELECT 'contact_name', OLD._id, counter, 1 FROM sync_state WHERE _id=1; END;
+
+CREATE TRIGGER IF NOT EXISTS sync_on_contact_number_insert AFTER INSERT ON contact_number BEGIN UPDATE sync_state SET counter=counter+1 WHERE _id=1; INSERT OR REPLACE INTO sync_changes (table_name, row_id, counter, deleted) SELECT 'contact_number', NEW._id, counter, 0 FROM sync_state WHERE _id=1; END;
+CREATE TRIGGER IF NOT EXISTS sync_on_contact_number_update AFTER UPDATE ON contact_number BEGIN UPDATE sync_state SET counter=counter+1 WHERE _id=1; INSERT OR REPLACE INTO sync_changes (table_name, row_id, counter, deleted) SELECT 'contact_number', NEW._id, counter, 0 FROM sync_state WHERE _id=1; END;
+CREATE TRIGGER IF NOT EXISTS sync_on_contact_number_delete AFTER DELETE ON contact_number BEGIN UPDATE sync_state SET counter=counter+1 WHERE _id=1; INSERT OR REPLACE INTO sync_changes (table_name, row_id, counter, deleted) SELECT 'contact_number', OLD._id, counter, 1 FROM sync_state WHERE _id=1; END;
+
+CREATE TRIGGER IF NOT EXISTS sync_on_contact_address_insert AFTER INSERT ON contact_address BEGIN UPDATE sync_state SET counter=counter+1 WHERE _id=1; INSERT OR REPLACE INTO sync_changes (table_name, row_id, counter, deleted) SELECT 'contact_address', NEW._id, counter, 0 FROM sync_state WHERE _id=1; END;
+CREATE TRIGGER IF NOT EXISTS sync_on_contact_address_update AFTER UPDATE ON contact_address BEGIN UPDATE sync_state SET counter=counter+1 WHERE _id=1; INSERT OR REPLACE INTO sync_changes (table_name, row_id, counter, deleted) SELECT 'contact_address', NEW._id, counter, 0 FROM sync_state WHERE _id=1; END;
+CREATE TRIGGER IF NOT EXISTS sync_on_contact_address_delete AFTER DELETE ON contact_address BEGIN UPDATE sync_state SET counter=counter+1 WHERE _id=1; INSERT OR REPLACE INTO sync_changes (table_name, row_id, counter, deleted) SELECT 'contact_address', OLD._id, counter, 1 FROM sync_state WHERE _id=1; END;
+
+CREATE TRIGGER IF NOT EXISTS sync_on_contact_ringtones_insert AFTER INSERT ON contact_ringtones BEGIN UPDATE sync_state SET counter=counter+1 WHERE _id=1; INSERT OR REPLACE INTO sync_changes (table_name, row_id, counter, deleted) SELECT 'contact_ringtones', NEW._id, counter, 0 FROM sync_state WHERE _id=1; END;
+CREATE TRIGGER IF NOT EXISTS sync_on_contact_ringtones_update AFTER UPDATE ON contact_ringtones BEGIN UPDATE sync_state SET counter=counter+1 WHERE _id=1; INSERT OR REPLACE INTO sync_changes (table_name, row_id, counter, deleted) SELECT 'contact_ringtones', NEW._id, counter, 0 FROM sync_state WHERE _id=1; END;
+CREATE TRIGGER IF NOT EXISTS sync_on_contact_ringtones_delete AFTER DELETE ON contact_ringtones BEGIN UPDATE sync_state SET counter=counter+1 WHERE _id=1; INSERT OR REPLACE INTO sync_changes (table_name, row_id, counter, deleted) SELECT 'contact_ringtones', OLD._id, counter, 1 FROM sync_state WHERE _id=1; END;
+
+CREATE TRIGGER IF NOT EXISTS sync_on_contact_groups_insert AFTER INSERT ON contact_groups BEGIN UPDATE sync_state SET counter=counter+1 WHERE _id=1; INSERT OR REPLACE INTO sync_changes (table_name, row_id, counter, deleted) SELECT 'contact_groups', NEW._id, counter, 0 FROM sync_state WHERE _id=1; END;
+CREATE TRIGGER IF NOT EXISTS sync_on_contact_groups_update AFTER UPDATE ON contact_groups BEGIN UPDATE sync_state SET counter=counter+1 WHERE _id=1; INSERT OR REPLACE INTO sync_changes (table_name, row_id, counter, deleted) SELECT 'contact_groups', NEW._id, counter, 0 FROM sync_state WHERE _id=1; END;
+CREATE TRIGGER IF NOT EXISTS sync_on_contact_groups_delete AFTER DELETE ON contact_groups BEGIN UPDATE sync_state SET counter=counter+1 WHERE _id=1; INSERT OR REPLACE INTO sync_changes (table_name, row_id, counter, deleted) SELECT 'contact_groups', OLD._id, counter, 1 FROM sync_state WHERE _id=1; END;
+
+CREATE TRIGGER IF NOT EXISTS sync_on_contact_match_groups_insert AFTER INSERT ON contact_match_groups BEGIN UPDATE sync_state SET counter=counter+1 WHERE _id=1; INSERT OR REPLACE INTO sync_changes (table_name, row_id, counter, deleted) SELECT 'contact_match_groups', NEW._id, counter, 0 FROM sync_state WHERE _id=1; END;
+CREATE TRIGGER IF NOT EXISTS sync_on_contact_match_groups_update AFTER UPDATE ON contact_match_groups BEGIN UPDATE sync_state SET counter=counter+1 WHERE _id=1; INSERT OR REPLACE INTO sync_changes (table_name, row_id, counter, deleted) SELECT 'contact_match_groups', NEW._id, counter, 0 FROM sync_state WHERE _id=1; END;
+CREATE TRIGGER IF NOT EXISTS sync_on_contact_match_groups_delete AFTER DELETE ON contact_match_groups BEGIN UPDATE sync_state SET counter=counter+1 WHERE _id=1; INSERT OR REPLACE INTO sync_changes (table_name, row_id, counter, deleted) SELECT 'contact_match_groups', OLD._id, counter, 1 FROM sync_state WHERE _id=1; END;
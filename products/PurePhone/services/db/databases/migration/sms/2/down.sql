@@ -0,0 +1,20 @@
+-- Copyright (c) 2017-2023, Mudita Sp. z.o.o. All rights reserved.
+-- For licensing, see https://github.com/mudita/MuditaOS/LICENSE.md
+
+-- Message: Tracking changes of the rows for the incremental sync with the desktop client
+-- Revision: b14daf23-0b29-4200-98ed-b75b2d86d2d4
+-- Create Date: 2023-06-12 09:41:27
+
+DROP TRIGGER IF EXISTS sync_on_sms_insert;
+DROP TRIGGER IF EXISTS sync_on_sms_update;
+DROP TRIGGER IF EXISTS sync_on_sms_delete;
+DROP TRIGGER IF EXISTS sync_on_threads_insert;
+DROP TRIGGER IF EXISTS sync_on_threads_update;
+DROP TRIGGER IF EXISTS sync_on_threads_delete;
+DROP TRIGGER IF EXISTS sync_on_templates_insert;
+DROP TRIGGER IF EXISTS sync_on_templates_update;
+DROP TRIGGER IF EXISTS sync_on_templates_delete;
+
+DROP INDEX IF EXISTS sync_changes_index_on_counter;
+DROP TABLE IF EXISTS sync_changes;
+DROP TABLE IF EXISTS sync_state;
@@ -0,0 +1,38 @@
+-- Copyright (c) 2017-2023, Mudita Sp. z.o.o. All rights reserved.
+-- For licensing, see https://github.com/mudita/MuditaOS/LICENSE.md
+
+-- Message: Tracking changes of the rows for the incremental sync with the desktop client
+-- Revision: b14daf23-0b29-4200-98ed-b75b2d86d2d4
+-- Create Date: 2023-06-12 09:41:27
+
+CREATE TABLE IF NOT EXISTS sync_state
+(
+    _id        INTEGER PRIMARY KEY,
+    generation INTEGER NOT NULL,
+    counter    INTEGER NOT NULL
+);
+
+CREATE TABLE IF NOT EXISTS sync_changes
+(
+    table_name TEXT    NOT NULL,
+    row_id     INTEGER NOT NULL,
+    counter    INTEGER NOT NULL,
+    deleted    INTEGER NOT NULL,
+    PRIMARY KEY (table_name, row_id)
+) WITHOUT ROWID;
+
+CREATE INDEX IF NOT EXISTS sync_changes_index_on_counter ON sync_changes (counter);
+
+INSERT OR IGNORE INTO sync_state (_id, generation, counter) VALUES (1, abs(random()), 0);
+
+CREATE TRIGGER IF NOT EXISTS sync_on_sms_insert AFTER INSERT ON sms BEGIN UPDATE sync_state SET counter=counter+1 WHERE _id=1; INSERT OR REPLACE INTO sync_changes (table_name, row_id, counter, deleted) SELECT 'sms', NEW._id, counter, 0 FROM sync_state WHERE _id=1; END;
+CREATE TRIGGER IF NOT EXISTS sync_on_sms_update AFTER UPDATE ON sms BEGIN UPDATE sync_state SET counter=counter+1 WHERE _id=1; INSERT OR REPLACE INTO sync_changes (table_name, row_id, counter, deleted) SELECT 'sms', NEW._id, counter, 0 FROM sync_state WHERE _id=1; END;
+CREATE TRIGGER IF NOT EXISTS sync_on_sms_delete AFTER DELETE ON sms BEGIN UPDATE sync_state SET counter=counter+1 WHERE _id=1; INSERT OR REPLACE INTO sync_changes (table_name, row_id, counter, deleted) SELECT 'sms', OLD._id, counter, 1 FROM sync_state WHERE _id=1; END;
+
+CREATE TRIGGER IF NOT EXISTS sync_on_threads_insert AFTER INSERT ON threads BEGIN UPDATE sync_state SET counter=counter+1 WHERE _id=1; INSERT OR REPLACE INTO sync_changes (table_name, row_id, counter, deleted) SELECT 'threads', NEW._id, counter, 0 FROM sync_state WHERE _id=1; END;
+CREATE TRIGGER IF NOT EXISTS sync_on_threads_update AFTER UPDATE ON threads BEGIN UPDATE sync_state SET counter=counter+1 WHERE _id=1; INSERT OR REPLACE INTO sync_changes (table_name, row_id, counter, deleted) SELECT 'threads', NEW._id, counter, 0 FROM sync_state WHERE _id=1; END;
+CREATE TRIGGER IF NOT EXISTS sync_on_threads_delete AFTER DELETE ON threads BEGIN UPDATE sync_state SET counter=counter+1 WHERE _id=1; INSERT OR REPLACE INTO sync_changes (table_name, row_id, counter, deleted) SELECT 'threads', OLD._id, counter, 1 FROM sync_state WHERE _id=1; END;
+
+CREATE TRIGGER IF NOT EXISTS sync_on_templates_insert AFTER INSERT ON templates BEGIN UPDATE sync_state SET counter=counter+1 WHERE _id=1; INSERT OR REPLACE INTO sync_changes (table_name, row_id, counter, deleted) SELECT 'templates', NEW._id, counter, 0 FROM sync_state WHERE _id=1; END;
+CREATE TRIGGER IF NOT EXISTS sync_on_templates_update AFTER UPDATE ON templates BEGIN UPDATE sync_state SET counter=counter+1 WHERE _id=1; INSERT OR REPLACE INTO sync_changes (table_name, row_id, counter, deleted) SELECT 'templates', NEW._id, counter, 0 FROM sync_state WHERE _id=1; END;
+CREATE TRIGGER IF NOT EXISTS sync_on_templates_delete AFTER DELETE ON templates BEGIN UPDATE sync_state SET counter=counter+1 WHERE _id=1; INSERT OR REPLACE INTO sync_changes (table_name, row_id, counter, deleted) SELECT 'templates', OLD._id, counter, 1 FROM sync_state WHERE _id=1; END;
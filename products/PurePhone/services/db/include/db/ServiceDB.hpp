@@ -5,6 +5,7 @@
 
 #include <service-db/DBServiceName.hpp>
 #include <service-db/ServiceDBCommon.hpp>
+#include <module-db/Database/SyncChanges.hpp>
 
 class AlarmEventRecordInterface;
 class CalllogDB;
@@ -38,7 +39,7 @@ class ServiceDB : public ServiceDBCommon
   public:
     ~ServiceDB() override;
 
-    bool StoreIntoSyncPackage(const std::filesystem::path &syncPackagePath);
+    bool StoreIntoSyncPackage(const std::filesystem::path &syncPackagePath, const db::sync::Tokens &syncTokens);
 
   private:
     std::unique_ptr<EventsDB> eventsDB;
@@ -86,6 +86,7 @@ enum class MessageType
     AppFocus,
     AppFocusLost,
     AppSwitchBack,
+    AppFlushModels, ///< application kept in the background drops the data its windows can fetch again
 
     EVMFocusApplication,
     EVMKeyboardProfile,
@@ -0,0 +1,80 @@
+# Copyright (c) 2017-2023, Mudita Sp. z.o.o. All rights reserved.
+# For licensing, see https://github.com/mudita/MuditaOS/LICENSE.md
+
+import json
+import math
+import time
+
+import pytest
+from harness import log
+from harness.interface.defs import key_codes, status
+
+# Input handling stages in the pipeline order, as recorded by sys::trace
+stages = ["Input", "Dispatch", "Window", "DrawList", "Queue", "Render", "Update", "Refresh"]
+presses = 50
+press_interval_s = 0.5
+# a press records about 20 events and the phone keeps the last 512 of them, so the trace is taken in batches
+presses_per_fetch = 10
+trace_file = "input_latency_trace.json"
+
+
+def get_trace(harness):
+    ret = harness.endpoint_request("developerMode", "get", {"getInfo": "trace"})
+    assert ret["status"] == status["OK"]
+    return ret["body"]["trace"]
+
+
+def percentile(samples, p):
+    ordered = sorted(samples)
+    return ordered[max(0, math.ceil(p / 100 * len(ordered)) - 1)]
+
+
+def collect_latencies(trace):
+    '''
+    Durations of the stages and of the whole input handling, per correlation id
+    '''
+    begins = {}
+    latencies = {stage: [] for stage in stages + ["Total"]}
+    inputs = {}
+    for event in trace["traceEvents"]:
+        key = (event["id"], event["name"])
+        if event["ph"] == "b":
+            begins[key] = event["ts"]
+            if event["name"] == "Input":
+                inputs[event["id"]] = [event["ts"], None]
+        elif key in begins:
+            latencies[event["name"]].append((event["ts"] - begins.pop(key)) / 1000)
+            if event["id"] in inputs and event["name"] in ("Update", "Refresh"):
+                inputs[event["id"]][1] = event["ts"]
+    latencies["Total"] = [(end - begin) / 1000 for begin, end in inputs.values() if end is not None]
+    return latencies
+
+
+@pytest.mark.usefixtures("phone_unlocked")
+def test_input_latency(harness):
+    # drop whatever was traced before the benchmark
+    get_trace(harness)
+
+    harness.connection.send_key_code(key_codes["enter"])
+    time.sleep(press_interval_s)
+    trace = get_trace(harness)
+    for i in range(presses):
+        harness.connection.send_key_code(key_codes["down"] if i % 2 == 0 else key_codes["up"])
+        time.sleep(press_interval_s)
+        if (i + 1) % presses_per_fetch == 0:
+            trace["traceEvents"] += get_trace(harness)["traceEvents"]
+    harness.connection.send_key_code(key_codes["fnRight"])
+    time.sleep(press_interval_s)
+    trace["traceEvents"] += get_trace(harness)["traceEvents"]
+
+    with open(trace_file, "w") as file:
+        json.dump(trace, file)
+    log.info(f"Trace saved to {trace_file}, open it with https://ui.perfetto.dev")
+
+    latencies = collect_latencies(trace)
+    log.info(f"{'stage':<10}{'count':>7}{'p50 [ms]':>10}{'p99 [ms]':>10}")
+    for stage, samples in latencies.items():
+        if samples:
+            log.info(f"{stage:<10}{len(samples):>7}{percentile(samples, 50):>10.0f}{percentile(samples, 99):>10.0f}")
+
+    assert latencies["Total"], "no input was traced up to the display"